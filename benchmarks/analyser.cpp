@@ -0,0 +1,97 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "benchmarkutils.h"
+
+static void analyseModel(benchmark::State &state, const libcellml::ModelPtr &model)
+{
+    auto analyser = libcellml::Analyser::create();
+    MemoryCounters memoryCounters;
+
+    for (auto _ : state) {
+        analyser->analyseModel(model);
+
+        benchmark::DoNotOptimize(analyser->model());
+    }
+
+    memoryCounters.report(state);
+
+    if (analyser->errorCount() != 0) {
+        state.SkipWithError("The model could not be analysed.");
+    }
+}
+
+static void BM_Analyser_analyseModel(benchmark::State &state, const std::string &fileName)
+{
+    analyseModel(state, parseResource(fileName));
+}
+
+static void BM_Analyser_analyseSyntheticModel(benchmark::State &state, SyntheticShape shape)
+{
+    analyseModel(state, createSyntheticModel(shape, size_t(state.range(0))));
+}
+
+BENCHMARK_CAPTURE(BM_Analyser_analyseModel, hodgkin_huxley_1952, HODGKIN_HUXLEY_1952)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Analyser_analyseModel, noble_1962, NOBLE_1962)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Analyser_analyseModel, garny_2003, GARNY_2003)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Analyser_analyseModel, fabbri_2017, FABBRI_2017)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Analyser_analyseSyntheticModel, chain, SyntheticShape::CHAIN)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Analyser_analyseSyntheticModel, tree, SyntheticShape::TREE)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Analyser_analyseSyntheticModel, deep_encapsulation, SyntheticShape::DEEP_ENCAPSULATION)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Analyser_analyseSyntheticModel, cell_array, SyntheticShape::CELL_ARRAY)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Analyser_analyseSyntheticModel, dense_cell_array, SyntheticShape::DENSE_CELL_ARRAY)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Analyser_analyseSyntheticModel, dae, SyntheticShape::DAE)->Apply(syntheticScales);
+
+static void BM_AnalyserModel_iterate(benchmark::State &state, const std::string &fileName)
+{
+    // Iterate over the states, variables and equations of an analysed model,
+    // as well as over the variables of each equation, as done by code
+    // generators and interpreters.  Since all of them are returned by const
+    // reference, no allocation should be made.
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(parseResource(fileName));
+
+    auto analyserModel = analyser->model();
+    MemoryCounters memoryCounters;
+
+    for (auto _ : state) {
+        size_t count = 0;
+
+        for (const auto &stateVariable : analyserModel->states()) {
+            count += stateVariable->index();
+        }
+
+        for (const auto &variable : analyserModel->variables()) {
+            count += variable->index();
+        }
+
+        for (const auto &equation : analyserModel->equations()) {
+            for (const auto &variable : equation->variables()) {
+                count += variable->index();
+            }
+        }
+
+        benchmark::DoNotOptimize(count);
+    }
+
+    memoryCounters.report(state);
+}
+
+BENCHMARK_CAPTURE(BM_AnalyserModel_iterate, hodgkin_huxley_1952, HODGKIN_HUXLEY_1952);
+BENCHMARK_CAPTURE(BM_AnalyserModel_iterate, garny_2003, GARNY_2003);
+BENCHMARK_CAPTURE(BM_AnalyserModel_iterate, fabbri_2017, FABBRI_2017);
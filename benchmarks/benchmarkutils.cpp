@@ -0,0 +1,217 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "benchmarkutils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <sstream>
+
+#ifdef _WIN32
+#    define NOMINMAX
+#    include <windows.h>
+// clang-format off
+#    include <psapi.h>
+// clang-format on
+#else
+#    include <sys/resource.h>
+#endif
+
+#include "benchmark_resources.h"
+#include "syntheticmodels.h"
+
+namespace {
+
+std::atomic<size_t> allocationCount(0);
+std::atomic<size_t> allocatedBytes(0);
+
+size_t peakResidentSetSize()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) != 0) {
+        return counters.PeakWorkingSetSize;
+    }
+
+    return 0;
+#else
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+
+#    ifdef __APPLE__
+    return size_t(usage.ru_maxrss);
+#    else
+    return size_t(usage.ru_maxrss) * 1024;
+#    endif
+#endif
+}
+
+int64_t maximumScale()
+{
+    auto maxScale = std::getenv("LIBCELLML_BENCHMARKS_MAX_SCALE");
+
+    if (maxScale != nullptr) {
+        auto scale = int64_t(std::strtoll(maxScale, nullptr, 10));
+
+        if (scale >= SYNTHETIC_MIN_SCALE) {
+            return std::min(scale, SYNTHETIC_MAX_SCALE);
+        }
+    }
+
+    return SYNTHETIC_MAX_SCALE;
+}
+
+} // namespace
+
+// Count all the allocations made by the benchmarks, including those made from
+// within libCellML itself.
+
+void *operator new(size_t size)
+{
+    ++allocationCount;
+    allocatedBytes += size;
+
+    auto res = std::malloc((size != 0) ? size : 1);
+
+    if (res == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    return res;
+}
+
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, size_t /* size */) noexcept
+{
+    std::free(pointer);
+}
+
+std::string resourcePath(const std::string &resourceRelativePath)
+{
+    return BENCHMARKS_RESOURCE_LOCATION + "/" + resourceRelativePath;
+}
+
+std::string fileContents(const std::string &fileName)
+{
+    std::ifstream file(resourcePath(fileName));
+    std::stringstream buffer;
+
+    buffer << file.rdbuf();
+
+    return buffer.str();
+}
+
+libcellml::ModelPtr parseResource(const std::string &fileName)
+{
+    auto parser = libcellml::Parser::create();
+
+    return parser->parseModel(fileContents(fileName));
+}
+
+libcellml::ModelPtr createSyntheticModel(SyntheticShape shape, size_t variableCount)
+{
+    switch (shape) {
+    case SyntheticShape::CHAIN:
+        return synthetic::createChainModel(std::max(variableCount / 2, size_t(1)));
+    case SyntheticShape::TREE: {
+        // A binary tree of depth d has 2^(d+1)-1 components, each of which has
+        // two variables.
+
+        size_t depth = 0;
+
+        while (2 * ((size_t(1) << (depth + 2)) - 1) <= variableCount) {
+            ++depth;
+        }
+
+        return synthetic::createTreeModel(depth, 2);
+    }
+    case SyntheticShape::DEEP_ENCAPSULATION:
+        return synthetic::createTreeModel(std::max(variableCount / 2, size_t(1)) - 1, 1);
+    case SyntheticShape::CELL_ARRAY:
+        return synthetic::createCellArrayModel(std::max(variableCount / 7, size_t(1)), 1);
+    case SyntheticShape::DENSE_CELL_ARRAY:
+        return synthetic::createCellArrayModel(std::max(variableCount / 16, size_t(1)), 10);
+    case SyntheticShape::DAE:
+        return synthetic::createDaeModel(std::max(variableCount / 7, size_t(1)), 4);
+    default: { // SyntheticShape::IMPORT_FAN_OUT.
+        // Import sources only keep a weak reference to their model, so keep
+        // the library model alive for the duration of the benchmarks.
+
+        static const auto libraryModel = synthetic::createImportLibraryModel();
+
+        return synthetic::createImportFanOutModel(libraryModel, std::max(variableCount / 3, size_t(1)));
+    }
+    }
+}
+
+void syntheticScales(benchmark::internal::Benchmark *benchmark)
+{
+    for (int64_t scale = SYNTHETIC_MIN_SCALE, maxScale = maximumScale(); scale <= maxScale; scale *= 10) {
+        benchmark->Arg(scale);
+    }
+
+    benchmark->Unit(benchmark::kMillisecond);
+}
+
+size_t totalAllocationCount()
+{
+    return allocationCount;
+}
+
+void reportProfiler(benchmark::State &state, const libcellml::ProfilerPtr &profiler)
+{
+    for (auto phase = libcellml::Profiler::Phase::PARSE_MODEL;
+         phase <= libcellml::Profiler::Phase::ADD_NLA_SYSTEMS_CODE;
+         phase = libcellml::Profiler::Phase(int(phase) + 1)) {
+        if (profiler->callCount(phase) != 0) {
+            auto name = libcellml::Profiler::phaseAsString(phase);
+
+            state.counters[name + "_ms"] = benchmark::Counter(1000.0 * profiler->elapsedTime(phase),
+                                                              benchmark::Counter::kAvgIterations);
+            state.counters[name + "_allocs"] = benchmark::Counter(double(profiler->allocationCount(phase)),
+                                                                  benchmark::Counter::kAvgIterations);
+        }
+    }
+}
+
+MemoryCounters::MemoryCounters()
+    : mAllocationCount(allocationCount)
+    , mAllocatedBytes(allocatedBytes)
+{
+}
+
+void MemoryCounters::report(benchmark::State &state) const
+{
+    state.counters["allocs"] = benchmark::Counter(double(allocationCount - mAllocationCount),
+                                                  benchmark::Counter::kAvgIterations);
+    state.counters["alloc_bytes"] = benchmark::Counter(double(allocatedBytes - mAllocatedBytes),
+                                                       benchmark::Counter::kAvgIterations,
+                                                       benchmark::Counter::OneK::kIs1024);
+    state.counters["peak_rss"] = benchmark::Counter(double(peakResidentSetSize()),
+                                                    benchmark::Counter::kDefaults,
+                                                    benchmark::Counter::OneK::kIs1024);
+}
@@ -0,0 +1,105 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+#include <libcellml>
+
+/**
+ * Resources, relative to the tests resource directory, that the benchmarks
+ * are run against.
+ */
+const std::string HODGKIN_HUXLEY_1952 = "generator/hodgkin_huxley_squid_axon_model_1952/model.cellml";
+const std::string NOBLE_1962 = "generator/noble_model_1962/model.cellml";
+const std::string GARNY_2003 = "generator/garny_kohl_hunter_boyett_noble_rabbit_san_model_2003/model.cellml";
+const std::string FABBRI_2017 = "generator/fabbri_fantini_wilders_severi_human_san_model_2017/model.cellml";
+const std::string OHARA_RUDY_2011 = "Ohara_Rudy_2011.cellml";
+
+/**
+ * The smallest and largest scales, in number of variables, of the synthetic
+ * models.  The largest scale can be lowered using the
+ * LIBCELLML_BENCHMARKS_MAX_SCALE environment variable.
+ */
+const int64_t SYNTHETIC_MIN_SCALE = 1000;
+const int64_t SYNTHETIC_MAX_SCALE = 100000;
+
+std::string resourcePath(const std::string &resourceRelativePath = "");
+std::string fileContents(const std::string &fileName);
+
+libcellml::ModelPtr parseResource(const std::string &fileName);
+
+/**
+ * The shapes of synthetic models that the benchmarks are run against.
+ */
+enum class SyntheticShape
+{
+    CHAIN,
+    TREE,
+    DEEP_ENCAPSULATION,
+    CELL_ARRAY,
+    DENSE_CELL_ARRAY,
+    DAE,
+    IMPORT_FAN_OUT
+};
+
+/**
+ * Create a synthetic model of the given @p shape with (roughly)
+ * @p variableCount variables.
+ */
+libcellml::ModelPtr createSyntheticModel(SyntheticShape shape, size_t variableCount);
+
+/**
+ * Register the synthetic scales, from SYNTHETIC_MIN_SCALE up to the maximum
+ * scale, as the arguments of @p benchmark.
+ */
+void syntheticScales(benchmark::internal::Benchmark *benchmark);
+
+/**
+ * Return the number of allocations made so far by the benchmarks, including
+ * those made from within libCellML itself.  This can be used as the allocation
+ * counter of a libcellml::Profiler.
+ */
+size_t totalAllocationCount();
+
+/**
+ * Report, as counters of @p state, the time spent and the allocations made in
+ * each of the phases that @p profiler has seen.
+ */
+void reportProfiler(benchmark::State &state, const libcellml::ProfilerPtr &profiler);
+
+/**
+ * Record the allocations made while a benchmark is running, as well as the
+ * peak resident set size of the process once it has run.
+ *
+ * Create an instance right before the benchmark loop and call report() right
+ * after it.
+ */
+class MemoryCounters
+{
+public:
+    MemoryCounters();
+
+    void report(benchmark::State &state) const;
+
+private:
+    size_t mAllocationCount;
+    size_t mAllocatedBytes;
+};
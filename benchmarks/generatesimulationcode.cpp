@@ -0,0 +1,91 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <libcellml>
+
+namespace {
+
+int usage(const std::string &program)
+{
+    std::cerr << "Usage: " << program << " <cellml_file> <mode> <output_base_name>\n"
+              << "\n"
+              << "Generate the C code for <cellml_file> and write it to <output_base_name>.h and\n"
+              << "<output_base_name>.c.  The available modes are:\n"
+              << "  default          generate the code using the default settings of the generator\n"
+              << "  split_variables  split the variables array into constants, computed constants and\n"
+              << "                   algebraic arrays\n";
+
+    return 1;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    std::vector<std::string> arguments(argv, argv + argc);
+
+    if (arguments.size() != 4) {
+        return usage(arguments.front());
+    }
+
+    auto mode = arguments[2];
+
+    if ((mode != "default") && (mode != "split_variables")) {
+        return usage(arguments.front());
+    }
+
+    std::ifstream file(arguments[1]);
+
+    if (!file) {
+        std::cerr << "The CellML file '" << arguments[1] << "' could not be opened.\n";
+
+        return 1;
+    }
+
+    std::stringstream buffer;
+
+    buffer << file.rdbuf();
+
+    auto parser = libcellml::Parser::create();
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(parser->parseModel(buffer.str()));
+
+    if (analyser->errorCount() != 0) {
+        std::cerr << "The CellML file '" << arguments[1] << "' could not be analysed.\n";
+
+        return 1;
+    }
+
+    auto generator = libcellml::Generator::create();
+    auto baseName = arguments[3];
+    auto interfaceFileName = baseName.substr(baseName.find_last_of("/\\") + 1) + ".h";
+
+    generator->profile()->setInterfaceFileNameString(interfaceFileName);
+    generator->setModel(analyser->model());
+    generator->setVariablesArraySplit(mode == "split_variables");
+
+    std::ofstream(baseName + ".h") << generator->interfaceCode();
+    std::ofstream(baseName + ".c") << generator->implementationCode();
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <libcellml>
+
+#include "syntheticmodels.h"
+
+namespace {
+
+int usage(const std::string &program)
+{
+    std::cerr << "Usage: " << program << " <shape> <parameters>\n"
+              << "\n"
+              << "Write a synthetic CellML model to the standard output.  The available shapes are:\n"
+              << "  chain <length>\n"
+              << "  tree <depth> <branching>\n"
+              << "  cell_array <cell_count> [<coupling_count>]\n"
+              << "  dae <block_count> <block_size>\n"
+              << "  import_fan_out <import_count> <library_file>\n"
+              << "\n"
+              << "For the import_fan_out shape, the library model is written to <library_file>.\n";
+
+    return 1;
+}
+
+bool toSize(const std::string &value, size_t &size)
+{
+    if (value.empty() || (value.find_first_not_of("0123456789") != std::string::npos)) {
+        return false;
+    }
+
+    size = std::stoul(value);
+
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    std::vector<std::string> arguments(argv, argv + argc);
+
+    if (arguments.size() < 3) {
+        return usage(arguments.front());
+    }
+
+    auto shape = arguments[1];
+    size_t first = 0;
+    size_t second = 0;
+    auto printer = libcellml::Printer::create();
+    libcellml::ModelPtr model = nullptr;
+
+    if (!toSize(arguments[2], first)) {
+        return usage(arguments.front());
+    }
+
+    if ((shape == "chain") && (arguments.size() == 3)) {
+        model = synthetic::createChainModel(first);
+    } else if ((shape == "tree") && (arguments.size() == 4) && toSize(arguments[3], second)) {
+        model = synthetic::createTreeModel(first, second);
+    } else if ((shape == "cell_array") && (arguments.size() == 3)) {
+        model = synthetic::createCellArrayModel(first);
+    } else if ((shape == "cell_array") && (arguments.size() == 4) && toSize(arguments[3], second)) {
+        model = synthetic::createCellArrayModel(first, second);
+    } else if ((shape == "dae") && (arguments.size() == 4) && toSize(arguments[3], second)) {
+        model = synthetic::createDaeModel(first, second);
+    } else if ((shape == "import_fan_out") && (arguments.size() == 4)) {
+        auto libraryModel = synthetic::createImportLibraryModel();
+        std::ofstream libraryFile(arguments[3]);
+
+        if (!libraryFile) {
+            std::cerr << "The library file '" << arguments[3] << "' could not be created.\n";
+
+            return 1;
+        }
+
+        libraryFile << printer->printModel(libraryModel);
+
+        std::cout << printer->printModel(synthetic::createImportFanOutModel(libraryModel, first, arguments[3]));
+
+        return 0;
+    } else {
+        return usage(arguments.front());
+    }
+
+    std::cout << printer->printModel(model);
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "benchmarkutils.h"
+
+static void generateCode(benchmark::State &state, const libcellml::ModelPtr &model)
+{
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    if (analyser->errorCount() != 0) {
+        state.SkipWithError("The model could not be analysed.");
+
+        return;
+    }
+
+    auto generator = libcellml::Generator::create();
+    MemoryCounters memoryCounters;
+
+    generator->setModel(analyser->model());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(generator->interfaceCode());
+        benchmark::DoNotOptimize(generator->implementationCode());
+    }
+
+    memoryCounters.report(state);
+}
+
+static void BM_Generator_generateCode(benchmark::State &state, const std::string &fileName)
+{
+    generateCode(state, parseResource(fileName));
+}
+
+static void BM_Generator_generateSyntheticCode(benchmark::State &state, SyntheticShape shape)
+{
+    generateCode(state, createSyntheticModel(shape, size_t(state.range(0))));
+}
+
+BENCHMARK_CAPTURE(BM_Generator_generateCode, hodgkin_huxley_1952, HODGKIN_HUXLEY_1952)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Generator_generateCode, noble_1962, NOBLE_1962)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Generator_generateCode, garny_2003, GARNY_2003)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Generator_generateCode, fabbri_2017, FABBRI_2017)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Generator_generateSyntheticCode, chain, SyntheticShape::CHAIN)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Generator_generateSyntheticCode, tree, SyntheticShape::TREE)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Generator_generateSyntheticCode, deep_encapsulation, SyntheticShape::DEEP_ENCAPSULATION)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Generator_generateSyntheticCode, cell_array, SyntheticShape::CELL_ARRAY)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Generator_generateSyntheticCode, dense_cell_array, SyntheticShape::DENSE_CELL_ARRAY)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Generator_generateSyntheticCode, dae, SyntheticShape::DAE)->Apply(syntheticScales);
@@ -0,0 +1,59 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "benchmarkutils.h"
+
+static void BM_Importer_flattenModel(benchmark::State &state, const std::string &fileName)
+{
+    // Some of the importer resources are CellML 1.x models, hence we use a
+    // non-strict parser and importer.
+    auto parser = libcellml::Parser::create(false);
+    auto model = parser->parseModel(fileContents(fileName));
+    auto baseFile = resourcePath(fileName);
+    auto baseDirectory = baseFile.substr(0, baseFile.find_last_of('/') + 1);
+    MemoryCounters memoryCounters;
+
+    for (auto _ : state) {
+        auto importer = libcellml::Importer::create(false);
+
+        importer->resolveImports(model, baseDirectory);
+
+        benchmark::DoNotOptimize(importer->flattenModel(model));
+    }
+
+    memoryCounters.report(state);
+}
+
+BENCHMARK_CAPTURE(BM_Importer_flattenModel, hodgkin_huxley, std::string("importer/HHComplete/MembraneModel.cellml"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Importer_flattenModel, complex_bond_graph, std::string("importer/complexbondgraph/cpp_coupling.cellml"))->Unit(benchmark::kMillisecond);
+
+static void BM_Importer_flattenSyntheticModel(benchmark::State &state, SyntheticShape shape)
+{
+    auto model = createSyntheticModel(shape, size_t(state.range(0)));
+    MemoryCounters memoryCounters;
+
+    for (auto _ : state) {
+        auto importer = libcellml::Importer::create();
+
+        benchmark::DoNotOptimize(importer->flattenModel(model));
+    }
+
+    memoryCounters.report(state);
+}
+
+BENCHMARK_CAPTURE(BM_Importer_flattenSyntheticModel, tree, SyntheticShape::TREE)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Importer_flattenSyntheticModel, deep_encapsulation, SyntheticShape::DEEP_ENCAPSULATION)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Importer_flattenSyntheticModel, import_fan_out, SyntheticShape::IMPORT_FAN_OUT)->Apply(syntheticScales);
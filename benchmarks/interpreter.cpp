@@ -0,0 +1,132 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// The code generated for the models we benchmark against, which we include
+// (before anything else, since <libcellml> undefines NAN and INFINITY) in
+// their own namespace so that they can coexist in this translation unit.
+
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#ifdef _MSC_VER
+#    pragma warning(push)
+#    pragma warning(disable : 4100)
+#else
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+
+namespace hodgkin_huxley_1952 {
+#include "../tests/resources/generator/hodgkin_huxley_squid_axon_model_1952/model.c"
+} // namespace hodgkin_huxley_1952
+
+namespace noble_1962 {
+#include "../tests/resources/generator/noble_model_1962/model.c"
+} // namespace noble_1962
+
+namespace garny_2003 {
+#include "../tests/resources/generator/garny_kohl_hunter_boyett_noble_rabbit_san_model_2003/model.c"
+} // namespace garny_2003
+
+namespace fabbri_2017 {
+#include "../tests/resources/generator/fabbri_fantini_wilders_severi_human_san_model_2017/model.c"
+} // namespace fabbri_2017
+
+#ifdef _MSC_VER
+#    pragma warning(pop)
+#else
+#    pragma GCC diagnostic pop
+#endif
+
+#include "benchmarkutils.h"
+
+/**
+ * The value of the variable of integration at which the rates are computed,
+ * i.e. one that is not too close to the start of the simulation.
+ */
+const double VOI = 10.2;
+
+static void BM_Interpreter_computeRates(benchmark::State &state, const std::string &fileName)
+{
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(parseResource(fileName));
+
+    if (analyser->errorCount() != 0) {
+        state.SkipWithError("The model could not be analysed.");
+
+        return;
+    }
+
+    auto interpreter = libcellml::Interpreter::create();
+
+    interpreter->setModel(analyser->model());
+    interpreter->initialiseVariables();
+    interpreter->computeComputedConstants();
+
+    for (auto _ : state) {
+        interpreter->computeRates(VOI);
+
+        benchmark::DoNotOptimize(interpreter->rate(0));
+    }
+
+    state.counters["rhs_evaluations"] = benchmark::Counter(double(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+template<typename CreateArray, typename DeleteArray, typename InitialiseVariables, typename ComputeComputedConstants, typename ComputeRates>
+static void generatedCodeComputeRates(benchmark::State &state, CreateArray createStatesArray, CreateArray createVariablesArray, DeleteArray deleteArray,
+                                      InitialiseVariables initialiseVariables, ComputeComputedConstants computeComputedConstants, ComputeRates computeRates)
+{
+    auto states = createStatesArray();
+    auto rates = createStatesArray();
+    auto variables = createVariablesArray();
+
+    initialiseVariables(states, rates, variables);
+    computeComputedConstants(variables);
+
+    for (auto _ : state) {
+        computeRates(VOI, states, rates, variables);
+
+        benchmark::DoNotOptimize(rates[0]);
+    }
+
+    state.counters["rhs_evaluations"] = benchmark::Counter(double(state.iterations()), benchmark::Counter::kIsRate);
+
+    deleteArray(states);
+    deleteArray(rates);
+    deleteArray(variables);
+}
+
+#define BM_GENERATED_CODE_COMPUTE_RATES(MODEL) \
+    static void BM_GeneratedCode_computeRates_##MODEL(benchmark::State &state) \
+    { \
+        generatedCodeComputeRates(state, MODEL::createStatesArray, MODEL::createVariablesArray, MODEL::deleteArray, \
+                                  MODEL::initialiseVariables, MODEL::computeComputedConstants, MODEL::computeRates); \
+    } \
+    BENCHMARK(BM_GeneratedCode_computeRates_##MODEL)->Unit(benchmark::kNanosecond)
+
+BENCHMARK_CAPTURE(BM_Interpreter_computeRates, hodgkin_huxley_1952, HODGKIN_HUXLEY_1952)->Unit(benchmark::kNanosecond);
+BENCHMARK_CAPTURE(BM_Interpreter_computeRates, noble_1962, NOBLE_1962)->Unit(benchmark::kNanosecond);
+BENCHMARK_CAPTURE(BM_Interpreter_computeRates, garny_2003, GARNY_2003)->Unit(benchmark::kNanosecond);
+BENCHMARK_CAPTURE(BM_Interpreter_computeRates, fabbri_2017, FABBRI_2017)->Unit(benchmark::kNanosecond);
+BM_GENERATED_CODE_COMPUTE_RATES(hodgkin_huxley_1952);
+BM_GENERATED_CODE_COMPUTE_RATES(noble_1962);
+BM_GENERATED_CODE_COMPUTE_RATES(garny_2003);
+BM_GENERATED_CODE_COMPUTE_RATES(fabbri_2017);
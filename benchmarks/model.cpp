@@ -0,0 +1,120 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "benchmarkutils.h"
+
+static libcellml::VariablePtr firstVariable(const libcellml::ComponentPtr &component)
+{
+    if (component->variableCount() != 0) {
+        return component->variable(0);
+    }
+
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        auto variable = firstVariable(component->component(i));
+
+        if (variable != nullptr) {
+            return variable;
+        }
+    }
+
+    return nullptr;
+}
+
+static void BM_Model_cloneVariant(benchmark::State &state, const std::string &fileName)
+{
+    // Create a parameter variant of a model, i.e. clone it and change the
+    // initial value of one of its variables, leaving its maths and units
+    // untouched.
+
+    auto model = parseResource(fileName);
+    MemoryCounters memoryCounters;
+
+    for (auto _ : state) {
+        auto variant = model->clone();
+
+        firstVariable(variant->component(0))->setInitialValue(1.0);
+
+        benchmark::DoNotOptimize(variant);
+    }
+
+    memoryCounters.report(state);
+}
+
+BENCHMARK_CAPTURE(BM_Model_cloneVariant, hodgkin_huxley_1952, HODGKIN_HUXLEY_1952)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Model_cloneVariant, garny_2003, GARNY_2003)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Model_cloneVariant, fabbri_2017, FABBRI_2017)->Unit(benchmark::kMillisecond);
+
+static void BM_Model_clone(benchmark::State &state, SyntheticShape shape)
+{
+    // Clone a model, including the transfer of all its equivalences, which
+    // may be connected across a deep encapsulation hierarchy.
+
+    auto model = createSyntheticModel(shape, size_t(state.range(0)));
+    MemoryCounters memoryCounters;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(model->clone());
+    }
+
+    memoryCounters.report(state);
+}
+
+BENCHMARK_CAPTURE(BM_Model_clone, tree, SyntheticShape::TREE)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Model_clone, deep_encapsulation, SyntheticShape::DEEP_ENCAPSULATION)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Model_clone, cell_array, SyntheticShape::CELL_ARRAY)->Apply(syntheticScales);
+
+static void BM_Model_construct(benchmark::State &state)
+{
+    // Build a model with thousands of units and of components, and a
+    // component with thousands of variables, through the public API, looking
+    // each of them up by name and renaming them, as done by the Parser and the
+    // Importer.
+
+    auto entityCount = size_t(state.range(0));
+    MemoryCounters memoryCounters;
+
+    for (auto _ : state) {
+        auto model = libcellml::Model::create("model");
+        auto component = libcellml::Component::create("component");
+
+        model->addComponent(component);
+
+        for (size_t i = 0; i < entityCount; ++i) {
+            auto index = std::to_string(i);
+            auto units = libcellml::Units::create("units_" + index);
+            auto variable = libcellml::Variable::create("variable_" + index);
+
+            model->addUnits(units);
+            variable->setUnits(units);
+            component->addVariable(variable);
+            component->addComponent(libcellml::Component::create("component_" + index));
+        }
+
+        for (size_t i = 0; i < entityCount; ++i) {
+            auto index = std::to_string(i);
+
+            model->units("units_" + index)->setName("renamed_units_" + index);
+            component->variable("variable_" + index)->setName("renamed_variable_" + index);
+            component->component("component_" + index)->setName("renamed_component_" + index);
+        }
+
+        benchmark::DoNotOptimize(model);
+    }
+
+    memoryCounters.report(state);
+}
+
+BENCHMARK(BM_Model_construct)->Apply(syntheticScales);
@@ -0,0 +1,63 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "benchmarkutils.h"
+
+static void parseModel(benchmark::State &state, const std::string &modelString)
+{
+    MemoryCounters memoryCounters;
+    size_t errorCount = 0;
+
+    for (auto _ : state) {
+        auto parser = libcellml::Parser::create();
+
+        benchmark::DoNotOptimize(parser->parseModel(modelString));
+
+        errorCount = parser->errorCount();
+    }
+
+    memoryCounters.report(state);
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(modelString.size()));
+
+    if (errorCount != 0) {
+        state.SkipWithError("The model could not be parsed.");
+    }
+}
+
+static void BM_Parser_parseModel(benchmark::State &state, const std::string &fileName)
+{
+    parseModel(state, fileContents(fileName));
+}
+
+static void BM_Parser_parseSyntheticModel(benchmark::State &state, SyntheticShape shape)
+{
+    auto printer = libcellml::Printer::create();
+
+    parseModel(state, printer->printModel(createSyntheticModel(shape, size_t(state.range(0)))));
+}
+
+BENCHMARK_CAPTURE(BM_Parser_parseModel, hodgkin_huxley_1952, HODGKIN_HUXLEY_1952)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Parser_parseModel, noble_1962, NOBLE_1962)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Parser_parseModel, garny_2003, GARNY_2003)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Parser_parseModel, fabbri_2017, FABBRI_2017)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Parser_parseModel, ohara_rudy_2011, OHARA_RUDY_2011)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Parser_parseSyntheticModel, chain, SyntheticShape::CHAIN)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Parser_parseSyntheticModel, tree, SyntheticShape::TREE)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Parser_parseSyntheticModel, deep_encapsulation, SyntheticShape::DEEP_ENCAPSULATION)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Parser_parseSyntheticModel, cell_array, SyntheticShape::CELL_ARRAY)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Parser_parseSyntheticModel, dense_cell_array, SyntheticShape::DENSE_CELL_ARRAY)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Parser_parseSyntheticModel, dae, SyntheticShape::DAE)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Parser_parseSyntheticModel, import_fan_out, SyntheticShape::IMPORT_FAN_OUT)->Apply(syntheticScales);
@@ -0,0 +1,88 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "benchmarkutils.h"
+
+static void BM_Pipeline(benchmark::State &state, const std::string &fileName)
+{
+    auto modelString = fileContents(fileName);
+    MemoryCounters memoryCounters;
+
+    for (auto _ : state) {
+        auto parser = libcellml::Parser::create();
+        auto model = parser->parseModel(modelString);
+        auto validator = libcellml::Validator::create();
+
+        validator->validateModel(model);
+
+        auto analyser = libcellml::Analyser::create();
+
+        analyser->analyseModel(model);
+
+        auto generator = libcellml::Generator::create();
+
+        generator->setModel(analyser->model());
+
+        benchmark::DoNotOptimize(generator->interfaceCode());
+        benchmark::DoNotOptimize(generator->implementationCode());
+    }
+
+    memoryCounters.report(state);
+}
+
+static void BM_PipelinePhases(benchmark::State &state, const std::string &fileName)
+{
+    auto modelString = fileContents(fileName);
+    auto profiler = libcellml::Profiler::create();
+
+    profiler->setAllocationCounter(totalAllocationCount);
+
+    for (auto _ : state) {
+        auto parser = libcellml::Parser::create();
+
+        parser->setProfiler(profiler);
+
+        auto model = parser->parseModel(modelString);
+        auto validator = libcellml::Validator::create();
+
+        validator->setProfiler(profiler);
+        validator->validateModel(model);
+
+        auto analyser = libcellml::Analyser::create();
+
+        analyser->setProfiler(profiler);
+        analyser->analyseModel(model);
+
+        auto generator = libcellml::Generator::create();
+
+        generator->setProfiler(profiler);
+        generator->setModel(analyser->model());
+
+        benchmark::DoNotOptimize(generator->interfaceCode());
+        benchmark::DoNotOptimize(generator->implementationCode());
+    }
+
+    reportProfiler(state, profiler);
+}
+
+BENCHMARK_CAPTURE(BM_Pipeline, hodgkin_huxley_1952, HODGKIN_HUXLEY_1952)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Pipeline, noble_1962, NOBLE_1962)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Pipeline, garny_2003, GARNY_2003)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Pipeline, fabbri_2017, FABBRI_2017)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Pipeline, ohara_rudy_2011, OHARA_RUDY_2011)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_PipelinePhases, hodgkin_huxley_1952, HODGKIN_HUXLEY_1952)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_PipelinePhases, fabbri_2017, FABBRI_2017)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,52 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "benchmarkutils.h"
+
+static void printModel(benchmark::State &state, const libcellml::ModelPtr &model)
+{
+    auto printer = libcellml::Printer::create();
+    MemoryCounters memoryCounters;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(printer->printModel(model));
+    }
+
+    memoryCounters.report(state);
+}
+
+static void BM_Printer_printModel(benchmark::State &state, const std::string &fileName)
+{
+    printModel(state, parseResource(fileName));
+}
+
+static void BM_Printer_printSyntheticModel(benchmark::State &state, SyntheticShape shape)
+{
+    printModel(state, createSyntheticModel(shape, size_t(state.range(0))));
+}
+
+BENCHMARK_CAPTURE(BM_Printer_printModel, hodgkin_huxley_1952, HODGKIN_HUXLEY_1952)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Printer_printModel, noble_1962, NOBLE_1962)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Printer_printModel, garny_2003, GARNY_2003)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Printer_printModel, fabbri_2017, FABBRI_2017)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Printer_printModel, ohara_rudy_2011, OHARA_RUDY_2011)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Printer_printSyntheticModel, chain, SyntheticShape::CHAIN)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Printer_printSyntheticModel, tree, SyntheticShape::TREE)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Printer_printSyntheticModel, deep_encapsulation, SyntheticShape::DEEP_ENCAPSULATION)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Printer_printSyntheticModel, cell_array, SyntheticShape::CELL_ARRAY)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Printer_printSyntheticModel, dense_cell_array, SyntheticShape::DENSE_CELL_ARRAY)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Printer_printSyntheticModel, dae, SyntheticShape::DAE)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Printer_printSyntheticModel, import_fan_out, SyntheticShape::IMPORT_FAN_OUT)->Apply(syntheticScales);
@@ -0,0 +1,287 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "simulation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+namespace {
+
+/**
+ * The settings used to simulate a model.  The voi of the Hodgkin-Huxley model
+ * is in milliseconds while the one of the other models is in seconds.
+ */
+struct SimulationSettings
+{
+    double endTime;
+    double fixedStep;
+    double maximumStep;
+};
+
+const double RELATIVE_TOLERANCE = 1.0e-7;
+const double ABSOLUTE_TOLERANCE = 1.0e-9;
+
+const std::map<std::string, SimulationSettings> SIMULATION_SETTINGS = {
+    {"hodgkin_huxley_1952", {50.0, 1.0e-2, 0.1}},
+    {"garny_2003", {1.0, 1.0e-5, 1.0e-3}},
+    {"fabbri_2017", {1.0, 1.0e-5, 1.0e-3}},
+};
+
+// The Butcher tableau of the Dormand-Prince 5(4) method.
+
+const double DP_C2 = 1.0 / 5.0;
+const double DP_C3 = 3.0 / 10.0;
+const double DP_C4 = 4.0 / 5.0;
+const double DP_C5 = 8.0 / 9.0;
+const double DP_A21 = 1.0 / 5.0;
+const double DP_A31 = 3.0 / 40.0;
+const double DP_A32 = 9.0 / 40.0;
+const double DP_A41 = 44.0 / 45.0;
+const double DP_A42 = -56.0 / 15.0;
+const double DP_A43 = 32.0 / 9.0;
+const double DP_A51 = 19372.0 / 6561.0;
+const double DP_A52 = -25360.0 / 2187.0;
+const double DP_A53 = 64448.0 / 6561.0;
+const double DP_A54 = -212.0 / 729.0;
+const double DP_A61 = 9017.0 / 3168.0;
+const double DP_A62 = -355.0 / 33.0;
+const double DP_A63 = 46732.0 / 5247.0;
+const double DP_A64 = 49.0 / 176.0;
+const double DP_A65 = -5103.0 / 18656.0;
+const double DP_B1 = 35.0 / 384.0;
+const double DP_B3 = 500.0 / 1113.0;
+const double DP_B4 = 125.0 / 192.0;
+const double DP_B5 = -2187.0 / 6784.0;
+const double DP_B6 = 11.0 / 84.0;
+const double DP_E1 = 71.0 / 57600.0;
+const double DP_E3 = -71.0 / 16695.0;
+const double DP_E4 = 71.0 / 1920.0;
+const double DP_E5 = -17253.0 / 339200.0;
+const double DP_E6 = 22.0 / 525.0;
+const double DP_E7 = -1.0 / 40.0;
+
+const double SAFETY_FACTOR = 0.9;
+const double MINIMUM_STEP_FACTOR = 0.2;
+const double MAXIMUM_STEP_FACTOR = 5.0;
+
+void simulate(benchmark::State &state, const SimulationModelCreator &creator, const std::string &modelName,
+              bool adaptiveStep)
+{
+    auto settings = SIMULATION_SETTINGS.find(modelName);
+
+    if (settings == SIMULATION_SETTINGS.end()) {
+        state.SkipWithError("There are no simulation settings for the model.");
+
+        return;
+    }
+
+    auto model = creator();
+    std::vector<double> states(model->stateCount());
+    IntegrationStatistics statistics;
+    size_t rhsEvaluationCount = 0;
+
+    for (auto _ : state) {
+        model->initialise(states.data());
+
+        statistics = adaptiveStep ?
+                         integrateAdaptiveStep(*model, states, settings->second.endTime, settings->second.maximumStep,
+                                               RELATIVE_TOLERANCE, ABSOLUTE_TOLERANCE) :
+                         integrateFixedStep(*model, states, settings->second.endTime, settings->second.fixedStep);
+
+        rhsEvaluationCount += statistics.rhsEvaluationCount;
+    }
+
+    if (!std::all_of(states.begin(), states.end(), [](double value) { return std::isfinite(value); })) {
+        state.SkipWithError("The simulation did not complete successfully.");
+
+        return;
+    }
+
+    state.counters["rhs_evaluations"] = benchmark::Counter(double(rhsEvaluationCount), benchmark::Counter::kIsRate);
+    state.counters["steps"] = double(statistics.stepCount);
+    state.counters["rejected_steps"] = double(statistics.rejectedStepCount);
+}
+
+} // namespace
+
+IntegrationStatistics integrateFixedStep(SimulationModel &model, std::vector<double> &states,
+                                         double endTime, double step)
+{
+    IntegrationStatistics statistics;
+    auto stateCount = states.size();
+    std::vector<double> k1(stateCount);
+    std::vector<double> k2(stateCount);
+    std::vector<double> k3(stateCount);
+    std::vector<double> k4(stateCount);
+    std::vector<double> work(stateCount);
+    auto stepCount = size_t(std::ceil(endTime / step - 1.0e-9));
+
+    for (size_t n = 0; n < stepCount; ++n) {
+        auto voi = double(n) * step;
+        auto h = std::min(step, endTime - voi);
+
+        model.computeRates(voi, states.data(), k1.data());
+
+        for (size_t i = 0; i < stateCount; ++i) {
+            work[i] = states[i] + 0.5 * h * k1[i];
+        }
+
+        model.computeRates(voi + 0.5 * h, work.data(), k2.data());
+
+        for (size_t i = 0; i < stateCount; ++i) {
+            work[i] = states[i] + 0.5 * h * k2[i];
+        }
+
+        model.computeRates(voi + 0.5 * h, work.data(), k3.data());
+
+        for (size_t i = 0; i < stateCount; ++i) {
+            work[i] = states[i] + h * k3[i];
+        }
+
+        model.computeRates(voi + h, work.data(), k4.data());
+
+        for (size_t i = 0; i < stateCount; ++i) {
+            states[i] += h * (k1[i] + 2.0 * (k2[i] + k3[i]) + k4[i]) / 6.0;
+        }
+    }
+
+    statistics.stepCount = stepCount;
+    statistics.rhsEvaluationCount = 4 * stepCount;
+
+    return statistics;
+}
+
+IntegrationStatistics integrateAdaptiveStep(SimulationModel &model, std::vector<double> &states,
+                                            double endTime, double maximumStep,
+                                            double relativeTolerance, double absoluteTolerance)
+{
+    IntegrationStatistics statistics;
+    auto stateCount = states.size();
+    std::vector<double> k1(stateCount);
+    std::vector<double> k2(stateCount);
+    std::vector<double> k3(stateCount);
+    std::vector<double> k4(stateCount);
+    std::vector<double> k5(stateCount);
+    std::vector<double> k6(stateCount);
+    std::vector<double> k7(stateCount);
+    std::vector<double> work(stateCount);
+    std::vector<double> newStates(stateCount);
+    double voi = 0.0;
+    double h = 0.01 * maximumStep;
+
+    // The Dormand-Prince method has the first same as last property, i.e. the
+    // rates at the end of an accepted step are those at the start of the next
+    // step.
+
+    model.computeRates(voi, states.data(), k1.data());
+
+    ++statistics.rhsEvaluationCount;
+
+    while (voi < endTime) {
+        h = std::min(h, endTime - voi);
+
+        for (size_t i = 0; i < stateCount; ++i) {
+            work[i] = states[i] + h * DP_A21 * k1[i];
+        }
+
+        model.computeRates(voi + DP_C2 * h, work.data(), k2.data());
+
+        for (size_t i = 0; i < stateCount; ++i) {
+            work[i] = states[i] + h * (DP_A31 * k1[i] + DP_A32 * k2[i]);
+        }
+
+        model.computeRates(voi + DP_C3 * h, work.data(), k3.data());
+
+        for (size_t i = 0; i < stateCount; ++i) {
+            work[i] = states[i] + h * (DP_A41 * k1[i] + DP_A42 * k2[i] + DP_A43 * k3[i]);
+        }
+
+        model.computeRates(voi + DP_C4 * h, work.data(), k4.data());
+
+        for (size_t i = 0; i < stateCount; ++i) {
+            work[i] = states[i] + h * (DP_A51 * k1[i] + DP_A52 * k2[i] + DP_A53 * k3[i] + DP_A54 * k4[i]);
+        }
+
+        model.computeRates(voi + DP_C5 * h, work.data(), k5.data());
+
+        for (size_t i = 0; i < stateCount; ++i) {
+            work[i] = states[i] + h * (DP_A61 * k1[i] + DP_A62 * k2[i] + DP_A63 * k3[i] + DP_A64 * k4[i] + DP_A65 * k5[i]);
+        }
+
+        model.computeRates(voi + h, work.data(), k6.data());
+
+        for (size_t i = 0; i < stateCount; ++i) {
+            newStates[i] = states[i] + h * (DP_B1 * k1[i] + DP_B3 * k3[i] + DP_B4 * k4[i] + DP_B5 * k5[i] + DP_B6 * k6[i]);
+        }
+
+        model.computeRates(voi + h, newStates.data(), k7.data());
+
+        statistics.rhsEvaluationCount += 6;
+
+        // Estimate the error of the step, using the weighted root mean square
+        // norm, and accept or reject the step accordingly.
+
+        double error = 0.0;
+
+        for (size_t i = 0; i < stateCount; ++i) {
+            auto scale = absoluteTolerance + relativeTolerance * std::max(std::fabs(states[i]), std::fabs(newStates[i]));
+            auto localError = h * (DP_E1 * k1[i] + DP_E3 * k3[i] + DP_E4 * k4[i] + DP_E5 * k5[i] + DP_E6 * k6[i] + DP_E7 * k7[i]) / scale;
+
+            error += localError * localError;
+        }
+
+        error = std::sqrt(error / double(std::max(stateCount, size_t(1))));
+
+        if (std::isnan(error)) {
+            // The step is not recoverable, so we give up.
+
+            std::fill(states.begin(), states.end(), NAN);
+
+            break;
+        }
+
+        if (error <= 1.0) {
+            voi += h;
+
+            states.swap(newStates);
+            k1.swap(k7);
+
+            ++statistics.stepCount;
+        } else {
+            ++statistics.rejectedStepCount;
+        }
+
+        auto factor = (error == 0.0) ?
+                          MAXIMUM_STEP_FACTOR :
+                          std::min(MAXIMUM_STEP_FACTOR, std::max(MINIMUM_STEP_FACTOR, SAFETY_FACTOR * std::pow(error, -0.2)));
+
+        h = std::min(maximumStep, h * factor);
+    }
+
+    return statistics;
+}
+
+void BM_Simulation_fixedStep(benchmark::State &state, const SimulationModelCreator &creator, const std::string &modelName)
+{
+    simulate(state, creator, modelName, false);
+}
+
+void BM_Simulation_adaptiveStep(benchmark::State &state, const SimulationModelCreator &creator, const std::string &modelName)
+{
+    simulate(state, creator, modelName, true);
+}
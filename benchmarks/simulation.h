@@ -0,0 +1,89 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * The interface to the code generated for a model, as used by the built-in
+ * integrators.  An implementation of it is configured, from
+ * simulationmodel.in.cpp, for each model and optimisation mode of the
+ * generator that we benchmark.
+ */
+class SimulationModel
+{
+public:
+    virtual ~SimulationModel() = default;
+
+    /**
+     * Return the number of states of the model.
+     */
+    virtual size_t stateCount() const = 0;
+
+    /**
+     * Initialise the variables of the model, compute its computed constants
+     * and copy the initial value of its states to @p states.
+     */
+    virtual void initialise(double *states) = 0;
+
+    /**
+     * Compute the @p rates of the model at @p voi for the given @p states.
+     */
+    virtual void computeRates(double voi, double *states, double *rates) = 0;
+};
+
+using SimulationModelCreator = std::function<std::unique_ptr<SimulationModel>()>;
+
+/**
+ * The statistics of an integration.
+ */
+struct IntegrationStatistics
+{
+    size_t stepCount = 0; /**< The number of accepted steps. */
+    size_t rejectedStepCount = 0; /**< The number of rejected steps. */
+    size_t rhsEvaluationCount = 0; /**< The number of calls to computeRates. */
+};
+
+/**
+ * Integrate @p model from 0 to @p endTime using the classical fourth-order
+ * Runge-Kutta method with a fixed @p step.  The @p states are those of the
+ * model at the end of the integration.
+ */
+IntegrationStatistics integrateFixedStep(SimulationModel &model, std::vector<double> &states,
+                                         double endTime, double step);
+
+/**
+ * Integrate @p model from 0 to @p endTime using the Dormand-Prince 5(4)
+ * method with an adaptive step, which never exceeds @p maximumStep.  The
+ * @p states are those of the model at the end of the integration.
+ */
+IntegrationStatistics integrateAdaptiveStep(SimulationModel &model, std::vector<double> &states,
+                                            double endTime, double maximumStep,
+                                            double relativeTolerance, double absoluteTolerance);
+
+/**
+ * Benchmark the simulation of the model created by @p creator, which is one
+ * of the generator fixtures, i.e. @p modelName, using the fixed step or
+ * adaptive step integrator.
+ */
+void BM_Simulation_fixedStep(benchmark::State &state, const SimulationModelCreator &creator, const std::string &modelName);
+void BM_Simulation_adaptiveStep(benchmark::State &state, const SimulationModelCreator &creator, const std::string &modelName);
@@ -0,0 +1,129 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// The code generated for @SIMULATION_MODEL@ using the @SIMULATION_MODE@
+// optimisation mode, which we include in its own namespace so that it does not
+// clash with the code generated for other models and/or modes.
+
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#ifdef _MSC_VER
+#    pragma warning(push)
+#    pragma warning(disable : 4100)
+#else
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+
+namespace @SIMULATION_NAME@ {
+#include "@SIMULATION_NAME@.c"
+} // namespace @SIMULATION_NAME@
+
+#ifdef _MSC_VER
+#    pragma warning(pop)
+#else
+#    pragma GCC diagnostic pop
+#endif
+
+#include "simulation.h"
+
+#cmakedefine SIMULATION_VARIABLES_ARRAY_SPLIT
+
+namespace {
+
+namespace generated = @SIMULATION_NAME@;
+
+class Model: public SimulationModel
+{
+public:
+    Model()
+        : mRates(generated::createStatesArray())
+#ifdef SIMULATION_VARIABLES_ARRAY_SPLIT
+        , mConstants(generated::createConstantsArray())
+        , mComputedConstants(generated::createComputedConstantsArray())
+        , mAlgebraic(generated::createAlgebraicArray())
+#else
+        , mVariables(generated::createVariablesArray())
+#endif
+    {
+    }
+
+    ~Model() override
+    {
+        generated::deleteArray(mRates);
+#ifdef SIMULATION_VARIABLES_ARRAY_SPLIT
+        generated::deleteArray(mConstants);
+        generated::deleteArray(mComputedConstants);
+        generated::deleteArray(mAlgebraic);
+#else
+        generated::deleteArray(mVariables);
+#endif
+    }
+
+    Model(const Model &rhs) = delete;
+    Model(Model &&rhs) noexcept = delete;
+    Model &operator=(Model rhs) = delete;
+
+    size_t stateCount() const override
+    {
+        return generated::STATE_COUNT;
+    }
+
+    void initialise(double *states) override
+    {
+#ifdef SIMULATION_VARIABLES_ARRAY_SPLIT
+        generated::initialiseVariables(states, mRates, mConstants, mComputedConstants, mAlgebraic);
+        generated::computeComputedConstants(mConstants, mComputedConstants, mAlgebraic);
+#else
+        generated::initialiseVariables(states, mRates, mVariables);
+        generated::computeComputedConstants(mVariables);
+#endif
+    }
+
+    void computeRates(double voi, double *states, double *rates) override
+    {
+#ifdef SIMULATION_VARIABLES_ARRAY_SPLIT
+        generated::computeRates(voi, states, rates, mConstants, mComputedConstants, mAlgebraic);
+#else
+        generated::computeRates(voi, states, rates, mVariables);
+#endif
+    }
+
+private:
+    double *mRates;
+#ifdef SIMULATION_VARIABLES_ARRAY_SPLIT
+    double *mConstants;
+    double *mComputedConstants;
+    double *mAlgebraic;
+#else
+    double *mVariables;
+#endif
+};
+
+std::unique_ptr<SimulationModel> createModel()
+{
+    return std::make_unique<Model>();
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_Simulation_fixedStep, @SIMULATION_NAME@, createModel, "@SIMULATION_MODEL@")->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Simulation_adaptiveStep, @SIMULATION_NAME@, createModel, "@SIMULATION_MODEL@")->Unit(benchmark::kMillisecond);
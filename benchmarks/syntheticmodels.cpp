@@ -0,0 +1,371 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "syntheticmodels.h"
+
+#include <algorithm>
+#include <deque>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace synthetic {
+
+namespace {
+
+const std::string MATH_BEGIN = "<math xmlns=\"http://www.w3.org/1998/Math/MathML\" xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\">\n";
+const std::string MATH_END = "</math>\n";
+
+std::string toString(double value)
+{
+    std::ostringstream res;
+
+    res << value;
+
+    return res.str();
+}
+
+std::string ci(const std::string &name)
+{
+    return "<ci>" + name + "</ci>";
+}
+
+std::string cn(const std::string &value, const std::string &units = "dimensionless")
+{
+    return "<cn cellml:units=\"" + units + "\">" + value + "</cn>";
+}
+
+std::string operation(const std::string &op, const std::vector<std::string> &arguments)
+{
+    std::string res = "<apply><" + op + "/>";
+
+    for (const auto &argument : arguments) {
+        res += argument;
+    }
+
+    return res + "</apply>";
+}
+
+std::string diff(const std::string &voi, const std::string &variable)
+{
+    return "<apply><diff/><bvar>" + ci(voi) + "</bvar>" + ci(variable) + "</apply>";
+}
+
+std::string equation(const std::string &lhs, const std::string &rhs)
+{
+    return operation("eq", {lhs, rhs}) + "\n";
+}
+
+void addTimeUnits(const libcellml::ModelPtr &model)
+{
+    auto ms = libcellml::Units::create("ms");
+    auto per_ms = libcellml::Units::create("per_ms");
+
+    ms->addUnit("second", "milli");
+    per_ms->addUnit("ms", -1.0);
+
+    model->addUnits(ms);
+    model->addUnits(per_ms);
+}
+
+libcellml::VariablePtr addVariable(const libcellml::ComponentPtr &component, const std::string &name,
+                                   const std::string &units,
+                                   libcellml::Variable::InterfaceType interfaceType = libcellml::Variable::InterfaceType::NONE,
+                                   const std::string &initialValue = "")
+{
+    auto variable = libcellml::Variable::create(name);
+
+    variable->setUnits(units);
+
+    if (interfaceType != libcellml::Variable::InterfaceType::NONE) {
+        variable->setInterfaceType(interfaceType);
+    }
+
+    if (!initialValue.empty()) {
+        variable->setInitialValue(initialValue);
+    }
+
+    component->addVariable(variable);
+
+    return variable;
+}
+
+libcellml::VariablePtr addEnvironment(const libcellml::ModelPtr &model)
+{
+    auto environment = libcellml::Component::create("environment");
+
+    model->addComponent(environment);
+
+    return addVariable(environment, "t", "ms", libcellml::Variable::InterfaceType::PUBLIC);
+}
+
+} // namespace
+
+libcellml::ModelPtr createChainModel(size_t length)
+{
+    auto model = libcellml::Model::create("chain");
+    libcellml::VariablePtr previousX = nullptr;
+
+    for (size_t i = 0; i < length; ++i) {
+        auto link = libcellml::Component::create("link_" + std::to_string(i));
+        auto x = addVariable(link, "x", "dimensionless", libcellml::Variable::InterfaceType::PUBLIC);
+        auto xPrevious = addVariable(link, "x_previous", "dimensionless", libcellml::Variable::InterfaceType::PUBLIC);
+
+        link->setMath(MATH_BEGIN
+                      + equation(ci("x"), operation("plus", {ci("x_previous"), cn("1")}))
+                      + MATH_END);
+
+        model->addComponent(link);
+
+        if (previousX != nullptr) {
+            libcellml::Variable::addEquivalence(previousX, xPrevious);
+        } else {
+            xPrevious->setInitialValue(0.0);
+        }
+
+        previousX = x;
+    }
+
+    model->linkUnits();
+
+    return model;
+}
+
+libcellml::ModelPtr createTreeModel(size_t depth, size_t branching)
+{
+    static const std::string MATH = MATH_BEGIN
+                                    + equation(ci("x"), operation("times", {cn("0.5"), ci("x_parent")}))
+                                    + MATH_END;
+
+    auto model = libcellml::Model::create("tree");
+    auto root = libcellml::Component::create("node_0");
+    size_t nodeCount = 1;
+
+    addVariable(root, "x", "dimensionless", libcellml::Variable::InterfaceType::PRIVATE);
+    addVariable(root, "x_parent", "dimensionless", libcellml::Variable::InterfaceType::NONE, "1");
+
+    root->setMath(MATH);
+
+    model->addComponent(root);
+
+    // Build the tree breadth first, rather than recursively, so that deep trees
+    // can be created.
+
+    std::deque<std::pair<libcellml::ComponentPtr, size_t>> nodes = {{root, 0}};
+
+    while (!nodes.empty()) {
+        auto [parent, level] = nodes.front();
+
+        nodes.pop_front();
+
+        if (level == depth) {
+            continue;
+        }
+
+        for (size_t i = 0; i < branching; ++i) {
+            auto node = libcellml::Component::create("node_" + std::to_string(nodeCount++));
+            auto x = addVariable(node, "x", "dimensionless", libcellml::Variable::InterfaceType::PUBLIC_AND_PRIVATE);
+            auto xParent = addVariable(node, "x_parent", "dimensionless", libcellml::Variable::InterfaceType::PUBLIC);
+
+            node->setMath(MATH);
+
+            parent->addComponent(node);
+
+            libcellml::Variable::addEquivalence(parent->variable("x"), xParent);
+
+            nodes.emplace_back(node, level + 1);
+        }
+    }
+
+    model->linkUnits();
+
+    return model;
+}
+
+libcellml::ModelPtr createCellArrayModel(size_t cellCount, size_t couplingCount)
+{
+    auto model = libcellml::Model::create("cell_array");
+
+    addTimeUnits(model);
+
+    auto t = addEnvironment(model);
+    std::vector<libcellml::ComponentPtr> cells;
+
+    couplingCount = std::min(couplingCount, (cellCount > 0) ? cellCount - 1 : 0);
+
+    for (size_t i = 0; i < cellCount; ++i) {
+        auto cell = libcellml::Component::create("cell_" + std::to_string(i));
+        std::string currentMath;
+
+        libcellml::Variable::addEquivalence(t, addVariable(cell, "t", "ms", libcellml::Variable::InterfaceType::PUBLIC));
+
+        addVariable(cell, "V", "dimensionless", libcellml::Variable::InterfaceType::PUBLIC, toString(-1.2 + 0.01 * double(i % 100)));
+        addVariable(cell, "w", "dimensionless", libcellml::Variable::InterfaceType::NONE, "-0.6");
+        addVariable(cell, "I", "dimensionless");
+        addVariable(cell, "k", "per_ms", libcellml::Variable::InterfaceType::NONE, "1");
+        addVariable(cell, "g", "dimensionless", libcellml::Variable::InterfaceType::NONE, "0.1");
+
+        if (couplingCount == 0) {
+            currentMath = equation(ci("I"), cn("0"));
+        } else {
+            std::vector<std::string> neighbours;
+
+            for (size_t j = 1; j <= couplingCount; ++j) {
+                auto name = "V_" + std::to_string(j);
+
+                addVariable(cell, name, "dimensionless", libcellml::Variable::InterfaceType::PUBLIC);
+
+                neighbours.push_back(ci(name));
+            }
+
+            currentMath = equation(ci("I"),
+                                   operation("times", {ci("g"),
+                                                   operation("minus", {(couplingCount == 1) ? neighbours.front() : operation("plus", neighbours),
+                                                                   operation("times", {cn(std::to_string(couplingCount)), ci("V")})})}));
+        }
+
+        cell->setMath(MATH_BEGIN
+                      + equation(diff("t", "V"),
+                                 operation("times", {ci("k"),
+                                                 operation("plus", {operation("minus", {operation("minus", {ci("V"),
+                                                                                                           operation("divide", {operation("power", {ci("V"), cn("3")}), cn("3")})}),
+                                                                                ci("w")}),
+                                                                ci("I")})}))
+                      + equation(diff("t", "w"),
+                                 operation("times", {ci("k"), cn("0.08"),
+                                                 operation("minus", {operation("plus", {ci("V"), cn("0.7")}),
+                                                                 operation("times", {cn("0.8"), ci("w")})})}))
+                      + currentMath
+                      + MATH_END);
+
+        model->addComponent(cell);
+        cells.push_back(cell);
+    }
+
+    for (size_t i = 0; i < cellCount; ++i) {
+        for (size_t j = 1; j <= couplingCount; ++j) {
+            libcellml::Variable::addEquivalence(cells[(i + cellCount - j) % cellCount]->variable("V"),
+                                                cells[i]->variable("V_" + std::to_string(j)));
+        }
+    }
+
+    model->linkUnits();
+
+    return model;
+}
+
+libcellml::ModelPtr createDaeModel(size_t blockCount, size_t blockSize)
+{
+    auto model = libcellml::Model::create("dae");
+
+    addTimeUnits(model);
+
+    auto t = addEnvironment(model);
+
+    blockSize = std::max(blockSize, size_t(1));
+
+    for (size_t i = 0; i < blockCount; ++i) {
+        auto block = libcellml::Component::create("block_" + std::to_string(i));
+        auto math = MATH_BEGIN + equation(diff("t", "u"), operation("times", {ci("k"), operation("minus", {ci("z_0"), ci("u")})}));
+
+        libcellml::Variable::addEquivalence(t, addVariable(block, "t", "ms", libcellml::Variable::InterfaceType::PUBLIC));
+
+        addVariable(block, "u", "dimensionless", libcellml::Variable::InterfaceType::NONE, "1");
+        addVariable(block, "k", "per_ms", libcellml::Variable::InterfaceType::NONE, "0.1");
+
+        // Each equation involves all the unknowns of the block, which means
+        // that none of them can be computed on its own.  Their initial value
+        // is used as an initial guess.
+
+        std::vector<std::string> unknowns;
+
+        for (size_t j = 0; j < blockSize; ++j) {
+            auto z = "z_" + std::to_string(j);
+
+            addVariable(block, z, "dimensionless", libcellml::Variable::InterfaceType::NONE, "0");
+
+            unknowns.push_back(ci(z));
+        }
+
+        auto sum = (blockSize == 1) ? unknowns.front() : operation("plus", unknowns);
+
+        for (size_t j = 0; j < blockSize; ++j) {
+            math += equation(operation("plus", {unknowns[j], operation("times", {cn("0.5"), sum})}),
+                             operation("plus", {ci("u"), cn(std::to_string(j))}));
+        }
+
+        block->setMath(math + MATH_END);
+
+        model->addComponent(block);
+    }
+
+    model->linkUnits();
+
+    return model;
+}
+
+libcellml::ModelPtr createImportLibraryModel()
+{
+    auto model = libcellml::Model::create("library");
+    auto component = libcellml::Component::create("template");
+
+    addTimeUnits(model);
+
+    addVariable(component, "t", "ms", libcellml::Variable::InterfaceType::PUBLIC);
+    addVariable(component, "x", "dimensionless", libcellml::Variable::InterfaceType::NONE, "1");
+    addVariable(component, "k", "per_ms", libcellml::Variable::InterfaceType::NONE, "0.1");
+
+    component->setMath(MATH_BEGIN
+                       + equation(diff("t", "x"), operation("times", {operation("minus", {ci("k")}), ci("x")}))
+                       + MATH_END);
+
+    model->addComponent(component);
+
+    model->linkUnits();
+
+    return model;
+}
+
+libcellml::ModelPtr createImportFanOutModel(const libcellml::ModelPtr &libraryModel, size_t importCount,
+                                            const std::string &url)
+{
+    auto model = libcellml::Model::create("import_fan_out");
+    auto importSource = libcellml::ImportSource::create();
+
+    addTimeUnits(model);
+
+    auto t = addEnvironment(model);
+
+    importSource->setUrl(url);
+    importSource->setModel(libraryModel);
+
+    for (size_t i = 0; i < importCount; ++i) {
+        auto instance = libcellml::Component::create("instance_" + std::to_string(i));
+
+        instance->setImportSource(importSource);
+        instance->setImportReference("template");
+
+        libcellml::Variable::addEquivalence(t, addVariable(instance, "t", "ms", libcellml::Variable::InterfaceType::PUBLIC));
+
+        model->addComponent(instance);
+    }
+
+    model->linkUnits();
+
+    return model;
+}
+
+} // namespace synthetic
@@ -0,0 +1,129 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+
+#include <libcellml>
+
+/**
+ * Programmatically generate large CellML models of various shapes, using only
+ * the public libCellML API.
+ *
+ * All the models are valid and, except where noted, can be analysed (and
+ * their code generated) as is.  Their size grows linearly with their
+ * parameters, which makes them suitable for benchmarking and stress testing
+ * the Parser, Validator, Analyser, Importer, Printer and Generator.
+ */
+namespace synthetic {
+
+/**
+ * Create a chain model of @p length sibling components.
+ *
+ * Each component computes its variable @c x from the @c x of the previous
+ * component in the chain, resulting in a chain of @p length algebraic
+ * equations and @p length - 1 connections.  Each component has two
+ * variables.
+ *
+ * @param length The number of components in the chain.
+ *
+ * @return The chain @c ModelPtr.
+ */
+libcellml::ModelPtr createChainModel(size_t length);
+
+/**
+ * Create a tree model of encapsulated components.
+ *
+ * The root component encapsulates @p branching components, each of which
+ * encapsulates @p branching components, and so on down to a depth of
+ * @p depth.  Each component computes its variable @c x from the @c x of its
+ * parent.  A @p branching of one gives an encapsulation hierarchy that is
+ * @p depth components deep.  Each component has two variables.
+ *
+ * @param depth The depth of the tree, with a depth of zero only having the
+ * root component.
+ * @param branching The number of children of each non-leaf component.
+ *
+ * @return The tree @c ModelPtr.
+ */
+libcellml::ModelPtr createTreeModel(size_t depth, size_t branching);
+
+/**
+ * Create a coupled cell array model.
+ *
+ * The model is a ring of @p cellCount FitzHugh-Nagumo-like cells, each with
+ * two state variables.  Each cell is coupled to the membrane potential of its
+ * @p couplingCount previous cells in the ring, giving a connection graph that
+ * gets denser as @p couplingCount increases.  All the cells share the
+ * variable of integration of an environment component.  Each cell has
+ * 6 + @p couplingCount variables.
+ *
+ * @param cellCount The number of cells.
+ * @param couplingCount The number of cells each cell is coupled to.
+ *
+ * @return The cell array @c ModelPtr.
+ */
+libcellml::ModelPtr createCellArrayModel(size_t cellCount, size_t couplingCount = 1);
+
+/**
+ * Create a DAE model made of independent blocks.
+ *
+ * Each of the @p blockCount blocks has a state variable and a system of
+ * @p blockSize implicit algebraic equations, each of which involves all the
+ * @p blockSize unknowns of the block.  The Analyser identifies each system as
+ * a non-linear algebraic system.  All the blocks share the variable of
+ * integration of an environment component.  Each block has 3 + @p blockSize
+ * variables.
+ *
+ * @param blockCount The number of blocks.
+ * @param blockSize The number of coupled unknowns in each block.
+ *
+ * @return The DAE @c ModelPtr.
+ */
+libcellml::ModelPtr createDaeModel(size_t blockCount, size_t blockSize);
+
+/**
+ * Create the library model used by createImportFanOutModel().
+ *
+ * The library model has a single @c template component with a decaying state
+ * variable.
+ *
+ * @return The library @c ModelPtr.
+ */
+libcellml::ModelPtr createImportLibraryModel();
+
+/**
+ * Create an import fan-out model.
+ *
+ * The model has an environment component and @p importCount components that
+ * all import the @c template component of @p libraryModel through a single
+ * import source, which refers to @p url.  The import source is resolved with
+ * @p libraryModel, so the model can be flattened directly (it must be
+ * flattened before it can be analysed).  Import sources only keep a weak
+ * reference to their model, so @p libraryModel must outlive the model.
+ *
+ * @param libraryModel The library @c ModelPtr, as created by
+ * createImportLibraryModel().
+ * @param importCount The number of imported components.
+ * @param url The URL of the library model.
+ *
+ * @return The import fan-out @c ModelPtr.
+ */
+libcellml::ModelPtr createImportFanOutModel(const libcellml::ModelPtr &libraryModel, size_t importCount,
+                                            const std::string &url = "library.cellml");
+
+} // namespace synthetic
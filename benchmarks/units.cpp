@@ -0,0 +1,70 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "benchmarkutils.h"
+
+#include <utility>
+#include <vector>
+
+static void collectConnectedUnits(const libcellml::ComponentPtr &component,
+                                  std::vector<std::pair<libcellml::UnitsPtr, libcellml::UnitsPtr>> &connectedUnits)
+{
+    for (size_t i = 0; i < component->variableCount(); ++i) {
+        auto variable = component->variable(i);
+
+        for (size_t j = 0; j < variable->equivalentVariableCount(); ++j) {
+            connectedUnits.emplace_back(variable->units(), variable->equivalentVariable(j)->units());
+        }
+    }
+
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        collectConnectedUnits(component->component(i), connectedUnits);
+    }
+}
+
+static void BM_Units_equivalentConnections(benchmark::State &state, SyntheticShape shape)
+{
+    // Check the units of both ends of every connection, as done when
+    // validating or analysing a model.
+
+    auto model = createSyntheticModel(shape, size_t(state.range(0)));
+    std::vector<std::pair<libcellml::UnitsPtr, libcellml::UnitsPtr>> connectedUnits;
+
+    for (size_t i = 0; i < model->componentCount(); ++i) {
+        collectConnectedUnits(model->component(i), connectedUnits);
+    }
+
+    MemoryCounters memoryCounters;
+
+    for (auto _ : state) {
+        size_t equivalentCount = 0;
+
+        for (const auto &units : connectedUnits) {
+            if (libcellml::Units::equivalent(units.first, units.second)) {
+                ++equivalentCount;
+            }
+        }
+
+        benchmark::DoNotOptimize(equivalentCount);
+    }
+
+    state.counters["connections"] = double(connectedUnits.size());
+
+    memoryCounters.report(state);
+}
+
+BENCHMARK_CAPTURE(BM_Units_equivalentConnections, cell_array, SyntheticShape::CELL_ARRAY)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Units_equivalentConnections, dense_cell_array, SyntheticShape::DENSE_CELL_ARRAY)->Apply(syntheticScales);
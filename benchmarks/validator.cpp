@@ -0,0 +1,54 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "benchmarkutils.h"
+
+static void validateModel(benchmark::State &state, const libcellml::ModelPtr &model)
+{
+    auto validator = libcellml::Validator::create();
+    MemoryCounters memoryCounters;
+
+    for (auto _ : state) {
+        validator->validateModel(model);
+
+        benchmark::DoNotOptimize(validator->issueCount());
+    }
+
+    memoryCounters.report(state);
+}
+
+static void BM_Validator_validateModel(benchmark::State &state, const std::string &fileName)
+{
+    validateModel(state, parseResource(fileName));
+}
+
+static void BM_Validator_validateSyntheticModel(benchmark::State &state, SyntheticShape shape)
+{
+    validateModel(state, createSyntheticModel(shape, size_t(state.range(0))));
+}
+
+BENCHMARK_CAPTURE(BM_Validator_validateModel, hodgkin_huxley_1952, HODGKIN_HUXLEY_1952)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Validator_validateModel, noble_1962, NOBLE_1962)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Validator_validateModel, garny_2003, GARNY_2003)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Validator_validateModel, fabbri_2017, FABBRI_2017)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Validator_validateModel, ohara_rudy_2011, OHARA_RUDY_2011)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Validator_validateSyntheticModel, chain, SyntheticShape::CHAIN)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Validator_validateSyntheticModel, tree, SyntheticShape::TREE)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Validator_validateSyntheticModel, deep_encapsulation, SyntheticShape::DEEP_ENCAPSULATION)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Validator_validateSyntheticModel, cell_array, SyntheticShape::CELL_ARRAY)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Validator_validateSyntheticModel, dense_cell_array, SyntheticShape::DENSE_CELL_ARRAY)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Validator_validateSyntheticModel, dae, SyntheticShape::DAE)->Apply(syntheticScales);
+BENCHMARK_CAPTURE(BM_Validator_validateSyntheticModel, import_fan_out, SyntheticShape::IMPORT_FAN_OUT)->Apply(syntheticScales);
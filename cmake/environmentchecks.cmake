@@ -73,6 +73,7 @@ else ()
   find_package(Doxygen)
   find_package(Sphinx)
   find_package(SWIG 3)
+  find_package(benchmark CONFIG QUIET)
 
   set(_ORIGINAL_CMAKE_REQUIRED_FLAGS ${CMAKE_REQUIRED_FLAGS})
 
@@ -237,6 +238,10 @@ if(INSTALL_NAME_TOOL_EXE)
   set(INSTALL_NAME_TOOL_AVAILABLE TRUE CACHE INTERNAL "Executable required for manipulating dynamic library paths is available.")
 endif()
 
+if(benchmark_FOUND)
+  set(BENCHMARKS_AVAILABLE TRUE CACHE INTERNAL "Library required to build the benchmarks is available.")
+endif()
+
 if(HAVE_COVERAGE)
   set(PYTHON_COVERAGE_TESTING_AVAILABLE TRUE CACHE INTERNAL "Module required to run Python coverage testing is available.")
 endif()
@@ -26,6 +26,7 @@ int main()
 {
     auto cGeneratorProfile = libcellml::GeneratorProfile::create();
     auto pyGeneratorProfile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+    auto npGeneratorProfile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::NUMPY);
 
     auto cGeneratorProfileRepr = libcellml::generatorProfileAsString(cGeneratorProfile);
     std::string cSha1Value = libcellml::sha1(cGeneratorProfileRepr);
@@ -33,10 +34,14 @@ int main()
     auto pyGeneratorProfileRepr = libcellml::generatorProfileAsString(pyGeneratorProfile);
     std::string pySha1Value = libcellml::sha1(pyGeneratorProfileRepr);
 
+    auto npGeneratorProfileRepr = libcellml::generatorProfileAsString(npGeneratorProfile);
+    std::string npSha1Value = libcellml::sha1(npGeneratorProfileRepr);
+
     std::ofstream outFile("generatorprofilesha1values.cmake");
 
     outFile << "set(C_GENERATOR_PROFILE_SHA1_VALUE " << cSha1Value << ")" << std::endl;
     outFile << "set(PYTHON_GENERATOR_PROFILE_SHA1_VALUE " << pySha1Value << ")" << std::endl;
+    outFile << "set(NUMPY_GENERATOR_PROFILE_SHA1_VALUE " << npSha1Value << ")" << std::endl;
 
     outFile.close();
 
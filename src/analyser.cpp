@@ -27,11 +27,13 @@ limitations under the License.
 #include "libcellml/analyserequationast.h"
 #include "libcellml/analyserexternalvariable.h"
 #include "libcellml/analysermodel.h"
+#include "libcellml/analyserreset.h"
 #include "libcellml/analyservariable.h"
 #include "libcellml/component.h"
 #include "libcellml/generator.h"
 #include "libcellml/generatorprofile.h"
 #include "libcellml/model.h"
+#include "libcellml/reset.h"
 #include "libcellml/units.h"
 #include "libcellml/validator.h"
 #include "libcellml/variable.h"
@@ -39,6 +41,7 @@ limitations under the License.
 #include "analyserequation_p.h"
 #include "analyserequationast_p.h"
 #include "analysermodel_p.h"
+#include "analyserreset_p.h"
 #include "analyservariable_p.h"
 #include "anycellmlelement_p.h"
 #include "commonutils.h"
@@ -54,14 +57,17 @@ limitations under the License.
 namespace libcellml {
 
 struct AnalyserInternalEquation;
+struct AnalyserInternalReset;
 struct AnalyserInternalVariable;
 
 using AnalyserInternalEquationWeakPtr = std::weak_ptr<AnalyserInternalEquation>;
 using AnalyserInternalEquationPtr = std::shared_ptr<AnalyserInternalEquation>;
+using AnalyserInternalResetPtr = std::shared_ptr<AnalyserInternalReset>;
 using AnalyserInternalVariablePtr = std::shared_ptr<AnalyserInternalVariable>;
 
 using AnalyserInternalEquationWeakPtrs = std::vector<AnalyserInternalEquationWeakPtr>;
 using AnalyserInternalEquationPtrs = std::vector<AnalyserInternalEquationPtr>;
+using AnalyserInternalResetPtrs = std::vector<AnalyserInternalResetPtr>;
 using AnalyserInternalVariablePtrs = std::vector<AnalyserInternalVariablePtr>;
 
 using AnalyserEquationPtrs = std::vector<AnalyserEquationPtr>;
@@ -495,6 +501,25 @@ bool AnalyserInternalEquation::check(const AnalyserModelPtr &model,
     return false;
 }
 
+struct AnalyserInternalReset
+{
+    ResetPtr mReset;
+
+    AnalyserEquationAstPtr mConditionAst;
+    AnalyserEquationAstPtr mResetAst;
+
+    static AnalyserInternalResetPtr create(const ResetPtr &reset);
+};
+
+AnalyserInternalResetPtr AnalyserInternalReset::create(const ResetPtr &reset)
+{
+    auto res = AnalyserInternalResetPtr {new AnalyserInternalReset {}};
+
+    res->mReset = reset;
+
+    return res;
+}
+
 /**
  * @brief The Analyser::AnalyserImpl class.
  *
@@ -517,6 +542,14 @@ public:
         AnalyserEquationAstPtr mExponentAst;
     };
 
+    class CompiledUnits
+    {
+    public:
+        UnitsMap mUnitsMap;
+        UnitsMap mUserUnitsMap;
+        double mUnitsMultiplier = 0.0;
+    };
+
     Analyser *mAnalyser = nullptr;
 
     AnalyserModelPtr mModel = AnalyserModel::AnalyserModelImpl::create();
@@ -525,11 +558,13 @@ public:
 
     AnalyserInternalVariablePtrs mInternalVariables;
     AnalyserInternalEquationPtrs mInternalEquations;
+    AnalyserInternalResetPtrs mInternalResets;
 
     GeneratorProfilePtr mGeneratorProfile = libcellml::GeneratorProfile::create();
 
     std::map<std::string, UnitsPtr> mStandardUnits;
     std::map<AnalyserEquationAstPtr, UnitsPtr> mCiCnUnits;
+    std::map<UnitsPtr, CompiledUnits> mCompiledUnits;
 
     AnalyserImpl();
 
@@ -542,6 +577,9 @@ public:
                      const AnalyserEquationAstPtr &astParent,
                      const ComponentPtr &component,
                      const AnalyserInternalEquationPtr &equation);
+    AnalyserEquationAstPtr analyseResetMath(const VariablePtr &variable,
+                                            const std::string &math,
+                                            const ComponentPtr &component);
     void analyseComponent(const ComponentPtr &component);
     void analyseComponentVariables(const ComponentPtr &component);
 
@@ -600,6 +638,7 @@ public:
     void defaultUnitsMapsAndMultipliers(UnitsMaps &unitsMaps,
                                         UnitsMaps &userUnitsMaps,
                                         UnitsMultipliers &unitsMultipliers);
+    const CompiledUnits &compiledUnits(const UnitsPtr &units);
     void analyseEquationUnits(const AnalyserEquationAstPtr &ast,
                               UnitsMaps &unitsMaps, UnitsMaps &userUnitsMaps,
                               UnitsMultipliers &unitsMultipliers,
@@ -1077,6 +1116,34 @@ void Analyser::AnalyserImpl::analyseNode(const XmlNodePtr &node,
     }
 }
 
+AnalyserEquationAstPtr Analyser::AnalyserImpl::analyseResetMath(const VariablePtr &variable,
+                                                                const std::string &math,
+                                                                const ComponentPtr &component)
+{
+    // Analyse the given math (i.e. the test value or the reset value of a
+    // reset) as if it was the RHS of an equation for the given variable, i.e.
+    // variable = math. This allows us to analyse and scale it in the same way
+    // as we do for our equations.
+    // Note: the equation used to analyse the math is not tracked since a reset
+    //       is not an equation of the model.
+
+    auto ast = AnalyserEquationAst::create();
+    auto equation = AnalyserInternalEquation::create(component);
+
+    ast->mPimpl->populate(AnalyserEquationAst::Type::EQUALITY, nullptr);
+
+    ast->mPimpl->mOwnedLeftChild = AnalyserEquationAst::create();
+
+    ast->mPimpl->mOwnedLeftChild->mPimpl->populate(AnalyserEquationAst::Type::CI, variable, ast);
+
+    mCiCnUnits.emplace(ast->mPimpl->mOwnedLeftChild, variable->units());
+
+    analyseNode(mathmlChildNode(multiRootXml(math).front()->rootNode(), 0),
+                ast->mPimpl->mOwnedRightChild, ast, component, equation);
+
+    return ast;
+}
+
 void Analyser::AnalyserImpl::analyseComponent(const ComponentPtr &component)
 {
     // Retrieve the math string associated with the given component and analyse
@@ -1107,18 +1174,32 @@ void Analyser::AnalyserImpl::analyseComponent(const ComponentPtr &component)
                     if (internalEquation->mAst->mPimpl->mType != AnalyserEquationAst::Type::EQUALITY) {
                         auto issue = Issue::IssueImpl::create();
 
-                        issue->mPimpl->setDescription("Equation " + expression(internalEquation->mAst)
-                                                      + " is not an equality statement (i.e. LHS = RHS).");
                         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_EQUATION_NOT_EQUALITY_STATEMENT);
                         issue->mPimpl->mItem->mPimpl->setComponent(component);
 
-                        addIssue(issue);
+                        addIssue(issue, [&] {
+                            return "Equation " + expression(internalEquation->mAst)
+                                   + " is not an equality statement (i.e. LHS = RHS).";
+                        });
                     }
                 }
             }
         }
     }
 
+    // Go through the given component's resets and analyse their test value and
+    // reset value.
+
+    for (size_t i = 0; i < component->resetCount(); ++i) {
+        auto reset = component->reset(i);
+        auto internalReset = AnalyserInternalReset::create(reset);
+
+        internalReset->mConditionAst = analyseResetMath(reset->testVariable(), reset->testValue(), component);
+        internalReset->mResetAst = analyseResetMath(reset->variable(), reset->resetValue(), component);
+
+        mInternalResets.push_back(internalReset);
+    }
+
     // Go through the given component's variables and internally keep track of
     // the ones that have an initial value.
 
@@ -1168,15 +1249,16 @@ void Analyser::AnalyserImpl::analyseComponentVariables(const ComponentPtr &compo
             auto issue = Issue::IssueImpl::create();
             auto trackedVariableComponent = owningComponent(internalVariable->mVariable);
 
-            issue->mPimpl->setDescription("Variable '" + variable->name()
-                                          + "' in component '" + component->name()
-                                          + "' and variable '" + internalVariable->mVariable->name()
-                                          + "' in component '" + trackedVariableComponent->name()
-                                          + "' are equivalent and cannot therefore both be initialised.");
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_VARIABLE_INITIALISED_MORE_THAN_ONCE);
             issue->mPimpl->mItem->mPimpl->setVariable(variable);
 
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return "Variable '" + variable->name()
+                       + "' in component '" + component->name()
+                       + "' and variable '" + internalVariable->mVariable->name()
+                       + "' in component '" + trackedVariableComponent->name()
+                       + "' are equivalent and cannot therefore both be initialised.";
+            });
         } else if (!internalVariable->mVariable->initialValue().empty()
                    && !isCellMLReal(internalVariable->mVariable->initialValue())) {
             auto initialisingComponent = owningComponent(internalVariable->mVariable);
@@ -1186,14 +1268,15 @@ void Analyser::AnalyserImpl::analyseComponentVariables(const ComponentPtr &compo
             if (initialisingInternalVariable->mType != AnalyserInternalVariable::Type::INITIALISED) {
                 auto issue = Issue::IssueImpl::create();
 
-                issue->mPimpl->setDescription("Variable '" + variable->name()
-                                              + "' in component '" + component->name()
-                                              + "' is initialised using variable '" + internalVariable->mVariable->initialValue()
-                                              + "', which is not a constant.");
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_VARIABLE_NON_CONSTANT_INITIALISATION);
                 issue->mPimpl->mItem->mPimpl->setVariable(variable);
 
-                addIssue(issue);
+                addIssue(issue, [&] {
+                    return "Variable '" + variable->name()
+                           + "' in component '" + component->name()
+                           + "' is initialised using variable '" + internalVariable->mVariable->initialValue()
+                           + "', which is not a constant.";
+                });
             }
         }
     }
@@ -1279,13 +1362,14 @@ void Analyser::AnalyserImpl::analyseEquationAst(const AnalyserEquationAstPtr &as
                         if (!voiEquivalentVariable->initialValue().empty()) {
                             auto issue = Issue::IssueImpl::create();
 
-                            issue->mPimpl->setDescription("Variable '" + voiEquivalentVariable->name()
-                                                          + "' in component '" + owningComponent(voiEquivalentVariable)->name()
-                                                          + "' cannot be both a variable of integration and initialised.");
                             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_VOI_INITIALISED);
                             issue->mPimpl->mItem->mPimpl->setVariable(voiEquivalentVariable);
 
-                            addIssue(issue);
+                            addIssue(issue, [&] {
+                                return "Variable '" + voiEquivalentVariable->name()
+                                       + "' in component '" + owningComponent(voiEquivalentVariable)->name()
+                                       + "' cannot be both a variable of integration and initialised.";
+                            });
 
                             isVoiInitialised = true;
                         }
@@ -1305,15 +1389,16 @@ void Analyser::AnalyserImpl::analyseEquationAst(const AnalyserEquationAstPtr &as
             if (!mModel->areEquivalentVariables(astVariable, voiVariable)) {
                 auto issue = Issue::IssueImpl::create();
 
-                issue->mPimpl->setDescription("Variable '" + voiVariable->name()
-                                              + "' in component '" + owningComponent(voiVariable)->name()
-                                              + "' and variable '" + astVariable->name()
-                                              + "' in component '" + owningComponent(astVariable)->name()
-                                              + "' cannot both be the variable of integration.");
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_VOI_SEVERAL);
                 issue->mPimpl->mItem->mPimpl->setVariable(astVariable);
 
-                addIssue(issue);
+                addIssue(issue, [&] {
+                    return "Variable '" + voiVariable->name()
+                           + "' in component '" + owningComponent(voiVariable)->name()
+                           + "' and variable '" + astVariable->name()
+                           + "' in component '" + owningComponent(astVariable)->name()
+                           + "' cannot both be the variable of integration.";
+                });
             }
         }
     }
@@ -1331,13 +1416,14 @@ void Analyser::AnalyserImpl::analyseEquationAst(const AnalyserEquationAstPtr &as
             auto variable = astGreatGrandparent->mPimpl->mOwnedRightChild->variable();
             auto issue = Issue::IssueImpl::create();
 
-            issue->mPimpl->setDescription("The differential equation for variable '" + variable->name()
-                                          + "' in component '" + owningComponent(variable)->name()
-                                          + "' must be of the first order.");
             issue->mPimpl->mItem->mPimpl->setMath(owningComponent(variable));
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_ODE_NOT_FIRST_ORDER);
 
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return "The differential equation for variable '" + variable->name()
+                       + "' in component '" + owningComponent(variable)->name()
+                       + "' must be of the first order.";
+            });
         }
     }
 
@@ -2028,6 +2114,29 @@ void Analyser::AnalyserImpl::defaultUnitsMapsAndMultipliers(UnitsMaps &unitsMaps
     unitsMultipliers = {0.0};
 }
 
+const Analyser::AnalyserImpl::CompiledUnits &Analyser::AnalyserImpl::compiledUnits(const UnitsPtr &units)
+{
+    // Return the units map, user units map and units multiplier of the given
+    // units, resolving them only the first time we come across those units.
+    // Many CI/CN elements share the same units, so this saves us from going
+    // through the units definitions for each of them.
+
+    auto iter = mCompiledUnits.find(units);
+
+    if (iter != mCompiledUnits.end()) {
+        return iter->second;
+    }
+
+    auto model = owningModel(units);
+    auto &res = mCompiledUnits[units];
+
+    updateUnitsMap(model, units->name(), res.mUnitsMap);
+    updateUnitsMap(model, units->name(), res.mUserUnitsMap, true);
+    updateUnitsMultiplier(model, units->name(), res.mUnitsMultiplier);
+
+    return res;
+}
+
 void Analyser::AnalyserImpl::analyseEquationUnits(const AnalyserEquationAstPtr &ast,
                                                   UnitsMaps &unitsMaps,
                                                   UnitsMaps &userUnitsMaps,
@@ -2095,22 +2204,11 @@ void Analyser::AnalyserImpl::analyseEquationUnits(const AnalyserEquationAstPtr &
     switch (ast->mPimpl->mType) {
     case AnalyserEquationAst::Type::CI:
     case AnalyserEquationAst::Type::CN: {
-        auto units = mCiCnUnits[ast];
-        auto model = owningModel(units);
-
-        defaultUnitsMapsAndMultipliers(unitsMaps, userUnitsMaps, unitsMultipliers);
-
-        for (auto &unitsMap : unitsMaps) {
-            updateUnitsMap(model, units->name(), unitsMap);
-        }
-
-        for (auto &userUnitsMap : userUnitsMaps) {
-            updateUnitsMap(model, units->name(), userUnitsMap, true);
-        }
+        auto &units = compiledUnits(mCiCnUnits[ast]);
 
-        for (auto &unitsMultiplier : unitsMultipliers) {
-            updateUnitsMultiplier(model, units->name(), unitsMultiplier);
-        }
+        unitsMaps = {units.mUnitsMap};
+        userUnitsMaps = {units.mUserUnitsMap};
+        unitsMultipliers = {units.mUnitsMultiplier};
 
         return;
     }
@@ -2513,7 +2611,9 @@ bool Analyser::AnalyserImpl::isStateRateBased(const AnalyserEquationPtr &equatio
 
     checkedEquations.push_back(equation);
 
-    for (const auto &dependency : equation->dependencies()) {
+    for (size_t i = 0; i < equation->dependencyCount(); ++i) {
+        auto dependency = equation->dependency(i);
+
         // A rate is computed either through an ODE equation or through an NLA
         // equation in case the rate is not on its own on either the LHS or RHS
         // of the equation.
@@ -2555,13 +2655,14 @@ void Analyser::AnalyserImpl::addInvalidVariableIssue(const AnalyserInternalVaria
     auto issue = Issue::IssueImpl::create();
     auto realVariable = variable->mVariable;
 
-    issue->mPimpl->setDescription(descriptionStart + " '" + realVariable->name()
-                                  + "' in component '" + owningComponent(realVariable)->name()
-                                  + "' " + descriptionEnd + ".");
     issue->mPimpl->setReferenceRule(referenceRule);
     issue->mPimpl->mItem->mPimpl->setVariable(realVariable);
 
-    addIssue(issue);
+    addIssue(issue, [&] {
+        return descriptionStart + " '" + realVariable->name()
+               + "' in component '" + owningComponent(realVariable)->name()
+               + "' " + descriptionEnd + ".";
+    });
 }
 
 void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
@@ -2573,8 +2674,10 @@ void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
 
     mInternalVariables.clear();
     mInternalEquations.clear();
+    mInternalResets.clear();
 
     mCiCnUnits.clear();
+    mCompiledUnits.clear();
 
     // Recursively analyse the model's components, so that we end up with an AST
     // for each of the model's equations.
@@ -2609,14 +2712,15 @@ void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
             if (owningModel(variable) != model) {
                 auto issue = Issue::IssueImpl::create();
 
-                issue->mPimpl->setDescription("Variable '" + variable->name()
-                                              + "' in component '" + owningComponent(variable)->name()
-                                              + "' is marked as an external variable, but it belongs to a different model and will therefore be ignored.");
                 issue->mPimpl->setLevel(Issue::Level::MESSAGE);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_EXTERNAL_VARIABLE_DIFFERENT_MODEL);
                 issue->mPimpl->mItem->mPimpl->setVariable(variable);
 
-                addIssue(issue);
+                addIssue(issue, [&] {
+                    return "Variable '" + variable->name()
+                           + "' in component '" + owningComponent(variable)->name()
+                           + "' is marked as an external variable, but it belongs to a different model and will therefore be ignored.";
+                });
             } else {
                 auto internalVariable = Analyser::AnalyserImpl::internalVariable(variable);
 
@@ -2733,8 +2837,12 @@ void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
         std::string issueDescription;
         PowerData powerData;
 
-        analyseEquationUnits(internalEquation->mAst, unitsMaps, userUnitsMaps, unitsMultipliers,
-                             issueDescription, powerData);
+        {
+            ProfilerScope profilerScope(mProfiler, Profiler::Phase::ANALYSE_EQUATION_UNITS);
+
+            analyseEquationUnits(internalEquation->mAst, unitsMaps, userUnitsMaps, unitsMultipliers,
+                                 issueDescription, powerData);
+        }
 
         if (!issueDescription.empty()) {
             auto issue = Issue::IssueImpl::create();
@@ -2747,6 +2855,31 @@ void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
         }
     }
 
+    // Do the same for our resets' test value and reset value.
+
+    for (const auto &internalReset : mInternalResets) {
+        for (const auto &ast : {internalReset->mConditionAst, internalReset->mResetAst}) {
+            UnitsMaps unitsMaps;
+            UnitsMaps userUnitsMaps;
+            UnitsMultipliers unitsMultipliers;
+            std::string issueDescription;
+            PowerData powerData;
+
+            analyseEquationUnits(ast, unitsMaps, userUnitsMaps, unitsMultipliers,
+                                 issueDescription, powerData);
+
+            if (!issueDescription.empty()) {
+                auto issue = Issue::IssueImpl::create();
+
+                issue->mPimpl->setDescription(issueDescription);
+                issue->mPimpl->setLevel(Issue::Level::WARNING);
+                issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_UNITS);
+
+                addIssue(issue);
+            }
+        }
+    }
+
     // Detmerine whether some variables have been marked as external.
 
     auto hasExternalVariables = std::any_of(mInternalVariables.begin(), mInternalVariables.end(), [](const auto &iv) {
@@ -2774,9 +2907,13 @@ void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
     do {
         relevantCheck = false;
 
-        for (const auto &internalEquation : mInternalEquations) {
-            relevantCheck = internalEquation->check(mModel, stateIndex, variableIndex, checkNlaSystems)
-                            || relevantCheck;
+        {
+            ProfilerScope profilerScope(mProfiler, Profiler::Phase::CHECK_EQUATIONS);
+
+            for (const auto &internalEquation : mInternalEquations) {
+                relevantCheck = internalEquation->check(mModel, stateIndex, variableIndex, checkNlaSystems)
+                                || relevantCheck;
+            }
         }
 
         if (((loopNumber == 1) || (loopNumber == 3)) && !relevantCheck) {
@@ -3014,6 +3151,31 @@ void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
         return;
     }
 
+    // Make sure that our resets only reset state variables.
+
+    for (const auto &internalReset : mInternalResets) {
+        auto variable = internalReset->mReset->variable();
+
+        if (internalVariable(variable)->mType != AnalyserInternalVariable::Type::STATE) {
+            auto issue = Issue::IssueImpl::create();
+
+            issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_RESET_VARIABLE_NOT_STATE);
+            issue->mPimpl->mItem->mPimpl->setReset(internalReset->mReset);
+
+            addIssue(issue, [&] {
+                return "Variable '" + variable->name()
+                       + "' in component '" + owningComponent(variable)->name()
+                       + "' is reset, but it is not a state variable.";
+            });
+        }
+    }
+
+    if (mAnalyser->errorCount() != 0) {
+        mModel->mPimpl->mType = AnalyserModel::Type::INVALID;
+
+        return;
+    }
+
     // Determine the type of our model.
 
     auto hasNlaEquations = std::any_of(mInternalEquations.begin(), mInternalEquations.end(), [=](const auto &ie) {
@@ -3143,6 +3305,64 @@ void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
         }
     }
 
+    // Map all the variables in the model to their corresponding analyser
+    // variable, so that the latter can be retrieved in constant time.
+
+    auto mapAnalyserVariable = [&](const AnalyserVariablePtr &analyserVariable) {
+        for (const auto &variable : equivalentVariables(analyserVariable->variable())) {
+            mModel->mPimpl->mAnalyserVariables.emplace(variable, analyserVariable);
+        }
+    };
+
+    if (mModel->mPimpl->mVoi != nullptr) {
+        mapAnalyserVariable(mModel->mPimpl->mVoi);
+    }
+
+    for (const auto &state : mModel->mPimpl->mStates) {
+        mapAnalyserVariable(state);
+    }
+
+    for (const auto &variable : mModel->mPimpl->mVariables) {
+        mapAnalyserVariable(variable);
+    }
+
+    // Make our internal resets available through our API.
+
+    for (const auto &internalReset : mInternalResets) {
+        // Scale our reset's condition, which we first turn into a test variable
+        // minus test value expression so that our test variable also gets
+        // scaled, if needed.
+
+        internalReset->mConditionAst->setType(AnalyserEquationAst::Type::MINUS);
+
+        scaleEquationAst(internalReset->mConditionAst);
+
+        // Scale our reset's reset value, the result of which must also be
+        // expressed in the units of the state variable it resets.
+
+        auto variable = internalReset->mReset->variable();
+
+        scaleEquationAst(internalReset->mResetAst);
+
+        auto scalingFactor = Analyser::AnalyserImpl::scalingFactor(variable);
+
+        if (!areNearlyEqual(scalingFactor, 1.0)) {
+            scaleAst(internalReset->mResetAst->mPimpl->mOwnedRightChild, internalReset->mResetAst, 1.0 / scalingFactor);
+        }
+
+        // Populate and keep track of the reset.
+
+        auto reset = AnalyserReset::AnalyserResetImpl::create();
+
+        reset->mPimpl->populate(internalReset->mReset,
+                                mModel->mPimpl->mAnalyserVariables[variable],
+                                mModel->mPimpl->mAnalyserVariables[internalReset->mReset->testVariable()],
+                                internalReset->mConditionAst,
+                                internalReset->mResetAst);
+
+        mModel->mPimpl->mResets.push_back(reset);
+    }
+
     // Make our internal equations available through our API.
 
     for (const auto &internalEquation : mInternalEquations) {
@@ -3253,7 +3473,9 @@ void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
             auto variable = v2avMappings[variableDependency];
 
             if (variable != nullptr) {
-                for (const auto &equation : variable->equations()) {
+                for (size_t i = 0; i < variable->equationCount(); ++i) {
+                    auto equation = variable->equation(i);
+
                     if (std::find(equationDependencies.begin(), equationDependencies.end(), equation) == equationDependencies.end()) {
                         equationDependencies.push_back(equation);
                     }
@@ -3275,7 +3497,8 @@ void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
 
         auto equation = aie2aeMappings[internalEquation];
 
-        equation->mPimpl->populate(type,
+        equation->mPimpl->populate(mModel,
+                                   type,
                                    (type == AnalyserEquation::Type::EXTERNAL) ?
                                        nullptr :
                                        internalEquation->mAst,
@@ -3356,6 +3579,8 @@ AnalyserPtr Analyser::create() noexcept
 
 void Analyser::analyseModel(const ModelPtr &model)
 {
+    ProfilerScope profilerScope(pFunc()->mProfiler, Profiler::Phase::ANALYSE_MODEL);
+
     // Make sure that we have a model and that it is valid before analysing it.
 
     pFunc()->removeAllIssues();
@@ -3373,6 +3598,7 @@ void Analyser::analyseModel(const ModelPtr &model)
 
     auto validator = Validator::create();
 
+    validator->setProfiler(pFunc()->mProfiler);
     validator->validateModel(model);
 
     if (validator->issueCount() > 0) {
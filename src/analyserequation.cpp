@@ -19,22 +19,31 @@ limitations under the License.
 #include <algorithm>
 #include <iterator>
 
+#include "libcellml/analysermodel.h"
+
 #include "analyserequation_p.h"
+#include "differentiator.h"
 
 namespace libcellml {
 
 AnalyserEquationPtr AnalyserEquation::AnalyserEquationImpl::create()
 {
-    return std::shared_ptr<AnalyserEquation> {new AnalyserEquation {}};
+    auto res = std::shared_ptr<AnalyserEquation> {new AnalyserEquation {}};
+
+    res->mPimpl->mEquation = res;
+
+    return res;
 }
 
-void AnalyserEquation::AnalyserEquationImpl::populate(AnalyserEquation::Type type,
+void AnalyserEquation::AnalyserEquationImpl::populate(const AnalyserModelPtr &model,
+                                                      AnalyserEquation::Type type,
                                                       const AnalyserEquationAstPtr &ast,
                                                       const std::vector<AnalyserEquationPtr> &dependencies,
                                                       size_t nlaSystemIndex,
                                                       const std::vector<AnalyserEquationPtr> &nlaSiblings,
                                                       const std::vector<AnalyserVariablePtr> &variables)
 {
+    mModel = model;
     mType = type;
     mAst = ast;
     mNlaSystemIndex = nlaSystemIndex;
@@ -153,12 +162,33 @@ bool AnalyserEquation::isStateRateBased() const
     return mPimpl->mIsStateRateBased;
 }
 
+bool AnalyserEquation::isLinearInState() const
+{
+    // Determining whether an ODE is linear in its state requires differentiating
+    // its rate, so only do it when we are asked for it and do it only once.
+
+    // Note: this requires our model, so if it has already been released then
+    //       we consider that we are not linear in our state.
+
+    std::call_once(mPimpl->mIsLinearInStateFlag, [this]() {
+        auto model = mPimpl->mModel.lock();
+
+        if (model != nullptr) {
+            Differentiator differentiator(model, true);
+
+            mPimpl->mIsLinearInState = differentiator.isLinearInState(mPimpl->mEquation.lock());
+        }
+    });
+
+    return mPimpl->mIsLinearInState;
+}
+
 size_t AnalyserEquation::variableCount() const
 {
     return mPimpl->mVariables.size();
 }
 
-std::vector<AnalyserVariablePtr> AnalyserEquation::variables() const
+const std::vector<AnalyserVariablePtr> &AnalyserEquation::variables() const
 {
     return mPimpl->mVariables;
 }
@@ -16,6 +16,8 @@ limitations under the License.
 
 #pragma once
 
+#include <mutex>
+
 #include "libcellml/analyserequation.h"
 
 #include "internaltypes.h"
@@ -29,17 +31,22 @@ namespace libcellml {
  */
 struct AnalyserEquation::AnalyserEquationImpl
 {
+    AnalyserEquationWeakPtr mEquation;
+    AnalyserModelWeakPtr mModel;
     AnalyserEquation::Type mType = AnalyserEquation::Type::ALGEBRAIC;
     AnalyserEquationAstPtr mAst;
     std::vector<AnalyserEquationWeakPtr> mDependencies;
     size_t mNlaSystemIndex;
     std::vector<AnalyserEquationWeakPtr> mNlaSiblings;
     bool mIsStateRateBased = false;
+    std::once_flag mIsLinearInStateFlag;
+    bool mIsLinearInState = false;
     std::vector<AnalyserVariablePtr> mVariables;
 
     static AnalyserEquationPtr create();
 
-    void populate(AnalyserEquation::Type type,
+    void populate(const AnalyserModelPtr &model,
+                  AnalyserEquation::Type type,
                   const AnalyserEquationAstPtr &ast,
                   const std::vector<AnalyserEquationPtr> &dependencies,
                   size_t nlaSystemIndex,
@@ -59,6 +59,10 @@ AnalyserModel::Type AnalyserModel::type() const
     return mPimpl->mType;
 }
 
+static const std::vector<AnalyserVariablePtr> noVariables;
+static const std::vector<AnalyserEquationPtr> noEquations;
+static const std::vector<AnalyserResetPtr> noResets;
+
 static const std::map<AnalyserModel::Type, std::string> typeToString = {
     {AnalyserModel::Type::UNKNOWN, "unknown"},
     {AnalyserModel::Type::ODE, "ode"},
@@ -102,10 +106,10 @@ size_t AnalyserModel::stateCount() const
     return mPimpl->mStates.size();
 }
 
-std::vector<AnalyserVariablePtr> AnalyserModel::states() const
+const std::vector<AnalyserVariablePtr> &AnalyserModel::states() const
 {
     if (!isValid()) {
-        return {};
+        return noVariables;
     }
 
     return mPimpl->mStates;
@@ -130,10 +134,10 @@ size_t AnalyserModel::variableCount() const
     return mPimpl->mVariables.size();
 }
 
-std::vector<AnalyserVariablePtr> AnalyserModel::variables() const
+const std::vector<AnalyserVariablePtr> &AnalyserModel::variables() const
 {
     if (!isValid()) {
-        return {};
+        return noVariables;
     }
 
     return mPimpl->mVariables;
@@ -148,6 +152,21 @@ AnalyserVariablePtr AnalyserModel::variable(size_t index) const
     return mPimpl->mVariables[index];
 }
 
+AnalyserVariablePtr AnalyserModel::analyserVariable(const VariablePtr &variable) const
+{
+    if (!isValid()) {
+        return {};
+    }
+
+    auto analyserVariable = mPimpl->mAnalyserVariables.find(variable);
+
+    if (analyserVariable == mPimpl->mAnalyserVariables.end()) {
+        return {};
+    }
+
+    return analyserVariable->second;
+}
+
 size_t AnalyserModel::equationCount() const
 {
     if (!isValid()) {
@@ -157,10 +176,10 @@ size_t AnalyserModel::equationCount() const
     return mPimpl->mEquations.size();
 }
 
-std::vector<AnalyserEquationPtr> AnalyserModel::equations() const
+const std::vector<AnalyserEquationPtr> &AnalyserModel::equations() const
 {
     if (!isValid()) {
-        return {};
+        return noEquations;
     }
 
     return mPimpl->mEquations;
@@ -175,6 +194,33 @@ AnalyserEquationPtr AnalyserModel::equation(size_t index) const
     return mPimpl->mEquations[index];
 }
 
+size_t AnalyserModel::resetCount() const
+{
+    if (!isValid()) {
+        return 0;
+    }
+
+    return mPimpl->mResets.size();
+}
+
+const std::vector<AnalyserResetPtr> &AnalyserModel::resets() const
+{
+    if (!isValid()) {
+        return noResets;
+    }
+
+    return mPimpl->mResets;
+}
+
+AnalyserResetPtr AnalyserModel::reset(size_t index) const
+{
+    if (!isValid() || (index >= mPimpl->mResets.size())) {
+        return {};
+    }
+
+    return mPimpl->mResets[index];
+}
+
 bool AnalyserModel::needEqFunction() const
 {
     if (!isValid()) {
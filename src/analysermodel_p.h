@@ -16,6 +16,8 @@ limitations under the License.
 
 #pragma once
 
+#include <unordered_map>
+
 #include "libcellml/analysermodel.h"
 
 namespace libcellml {
@@ -37,6 +39,9 @@ struct AnalyserModel::AnalyserModelImpl
     std::vector<AnalyserVariablePtr> mStates;
     std::vector<AnalyserVariablePtr> mVariables;
     std::vector<AnalyserEquationPtr> mEquations;
+    std::vector<AnalyserResetPtr> mResets;
+
+    std::unordered_map<VariablePtr, AnalyserVariablePtr> mAnalyserVariables;
 
     bool mNeedEqFunction = false;
     bool mNeedNeqFunction = false;
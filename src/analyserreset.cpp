@@ -0,0 +1,86 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "libcellml/analyserreset.h"
+
+#include "libcellml/analyserequationast.h"
+#include "libcellml/reset.h"
+
+#include "analyserreset_p.h"
+
+namespace libcellml {
+
+AnalyserResetPtr AnalyserReset::AnalyserResetImpl::create()
+{
+    return std::shared_ptr<AnalyserReset> {new AnalyserReset {}};
+}
+
+void AnalyserReset::AnalyserResetImpl::populate(const ResetPtr &reset,
+                                                const AnalyserVariablePtr &variable,
+                                                const AnalyserVariablePtr &testVariable,
+                                                const AnalyserEquationAstPtr &conditionAst,
+                                                const AnalyserEquationAstPtr &resetAst)
+{
+    mReset = reset;
+    mVariable = variable;
+    mTestVariable = testVariable;
+    mConditionAst = conditionAst;
+    mResetAst = resetAst;
+}
+
+AnalyserReset::AnalyserReset()
+    : mPimpl(new AnalyserResetImpl())
+{
+}
+
+AnalyserReset::~AnalyserReset()
+{
+    delete mPimpl;
+}
+
+ResetPtr AnalyserReset::reset() const
+{
+    return mPimpl->mReset;
+}
+
+int AnalyserReset::order() const
+{
+    return mPimpl->mReset->order();
+}
+
+AnalyserVariablePtr AnalyserReset::variable() const
+{
+    return mPimpl->mVariable;
+}
+
+AnalyserVariablePtr AnalyserReset::testVariable() const
+{
+    return mPimpl->mTestVariable;
+}
+
+AnalyserEquationAstPtr AnalyserReset::conditionAst() const
+{
+    return mPimpl->mConditionAst;
+}
+
+AnalyserEquationAstPtr AnalyserReset::resetValueAst() const
+{
+    // Our reset AST is of the form variable = reset value, so return its RHS.
+
+    return mPimpl->mResetAst->rightChild();
+}
+
+} // namespace libcellml
@@ -0,0 +1,47 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "libcellml/analyserreset.h"
+
+#include "internaltypes.h"
+
+namespace libcellml {
+
+/**
+ * @brief The AnalyserReset::AnalyserResetImpl struct.
+ *
+ * The private implementation for the AnalyserReset class.
+ */
+struct AnalyserReset::AnalyserResetImpl
+{
+    ResetPtr mReset;
+    AnalyserVariablePtr mVariable;
+    AnalyserVariablePtr mTestVariable;
+    AnalyserEquationAstPtr mConditionAst;
+    AnalyserEquationAstPtr mResetAst;
+
+    static AnalyserResetPtr create();
+
+    void populate(const ResetPtr &reset,
+                  const AnalyserVariablePtr &variable,
+                  const AnalyserVariablePtr &testVariable,
+                  const AnalyserEquationAstPtr &conditionAst,
+                  const AnalyserEquationAstPtr &resetAst);
+};
+
+} // namespace libcellml
@@ -17,8 +17,8 @@ limitations under the License.
 #include "libcellml/annotator.h"
 
 #include <algorithm>
-#include <sstream>
 #include <unordered_map>
+#include <vector>
 
 #include "libcellml/component.h"
 #include "libcellml/importsource.h"
@@ -30,14 +30,16 @@ limitations under the License.
 
 #include "anycellmlelement_p.h"
 #include "commonutils.h"
+#include "entity_p.h"
 #include "internaltypes.h"
 #include "issue_p.h"
 #include "logger_p.h"
+#include "model_p.h"
 #include "utilities.h"
 
 namespace libcellml {
 
-using ItemList = std::multimap<std::string, AnyCellmlElementPtr>;
+using ItemList = std::unordered_map<std::string, std::vector<AnyCellmlElementPtr>>;
 
 /**
  * @brief The Annotator::AnnotatorImpl class.
@@ -54,17 +56,35 @@ public:
     ModelWeakPtr mModel;
     size_t mCounter = 0xb4da55;
     size_t mHash = 0;
+    size_t mIdsRevision = 0; /**< Revision of the identifiers of the model mIdList is up to date with, 0 if unknown. */
+    std::vector<std::pair<ImportSourceWeakPtr, std::string>> mImportSourceIds; /**< The import sources of the model and their identifier. */
 
     AnyCellmlElementPtr convertToWeak(const AnyCellmlElementPtr &item);
     AnyCellmlElementPtr convertToShared(const AnyCellmlElementPtr &item);
 
+    /**
+     * @brief Test whether the given weak @p item is the given @p entity.
+     *
+     * @param item The weak item to test.
+     * @param type The type of the @p entity.
+     * @param entity The entity to test against.
+     *
+     * @return @c true if the @p item is the @p entity, @c false otherwise.
+     */
+    static bool isItemOf(const AnyCellmlElementPtr &item, CellmlElementType type, const EntityWeakPtr &entity);
+
     void listComponentIdsAndItems(const ComponentPtr &component, ItemList &idList);
     ItemList listIdsAndItems(const ModelPtr &model);
 
     void update();
+    bool applyIdChanges(const std::vector<IdChange> &idChanges);
     void buildIdList();
+    void markIdListUpToDate();
+    bool importSourceIdsChanged() const;
+    void recordImportSourceIds();
 
     size_t idCount();
+    size_t itemCount(const std::string &id) const;
 
     std::string makeUniqueId();
 
@@ -140,7 +160,7 @@ Annotator::Annotator()
     : Logger(new Annotator::AnnotatorImpl())
 {
     pFunc()->mAnnotator = this;
-    pFunc()->mIdList = std::multimap<std::string, AnyCellmlElementPtr>();
+    pFunc()->mIdList = ItemList();
 }
 
 Annotator::~Annotator()
@@ -159,13 +179,33 @@ inline bool equals(const std::weak_ptr<T> &t, const std::weak_ptr<U> &u)
     return !t.owner_before(u) && !u.owner_before(t);
 }
 
+bool Annotator::AnnotatorImpl::isItemOf(const AnyCellmlElementPtr &item, CellmlElementType type, const EntityWeakPtr &entity)
+{
+    if (item->type() != type) {
+        return false;
+    }
+
+    switch (type) {
+    case CellmlElementType::COMPONENT:
+        return equals(std::any_cast<ComponentWeakPtr>(item->mPimpl->mItem), entity);
+    case CellmlElementType::MODEL:
+        return equals(std::any_cast<ModelWeakPtr>(item->mPimpl->mItem), entity);
+    case CellmlElementType::RESET:
+        return equals(std::any_cast<ResetWeakPtr>(item->mPimpl->mItem), entity);
+    case CellmlElementType::UNITS:
+        return equals(std::any_cast<UnitsWeakPtr>(item->mPimpl->mItem), entity);
+    default: /* CellmlElementType::VARIABLE */
+        return equals(std::any_cast<VariableWeakPtr>(item->mPimpl->mItem), entity);
+    }
+}
+
 void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &component, ItemList &idList)
 {
     std::string id = component->id();
     if (!id.empty()) {
         auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
         entry->mPimpl->setComponent(component);
-        idList.insert(std::make_pair(id, convertToWeak(entry)));
+        idList[id].push_back(convertToWeak(entry));
     }
     // Imports.
     ImportSourcePtr importSource = component->importSource();
@@ -174,7 +214,7 @@ void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &comp
         if (!id.empty()) {
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setImportSource(importSource);
-            idList.insert(std::make_pair(id, convertToWeak(entry)));
+            idList[id].push_back(convertToWeak(entry));
         }
     }
     // Component reference in encapsulation structure.
@@ -182,7 +222,7 @@ void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &comp
     if (!id.empty()) {
         auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
         entry->mPimpl->setComponentRef(component);
-        idList.insert(std::make_pair(id, convertToWeak(entry)));
+        idList[id].push_back(convertToWeak(entry));
     }
     // Variables.
     for (size_t v = 0; v < component->variableCount(); ++v) {
@@ -192,7 +232,7 @@ void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &comp
         if (!id.empty()) {
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setVariable(variable);
-            idList.insert(std::make_pair(id, convertToWeak(entry)));
+            idList[id].push_back(convertToWeak(entry));
         }
         for (size_t e = 0; e < variable->equivalentVariableCount(); ++e) {
             // Equivalent variable mappings.
@@ -204,13 +244,13 @@ void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &comp
                 // side this is a separate check for duplicates.  We can't rely on the variables having names to set an order
                 // either.
                 bool found = false;
-                if (idList.count(id) != 0) {
-                    // Get the range of items with this identifier:
-                    auto rangePair = idList.equal_range(id);
-                    for (auto it = rangePair.first; it != rangePair.second; ++it) {
+                auto items = idList.find(id);
+                if (items != idList.end()) {
+                    // Go through the items with this identifier:
+                    for (const auto &item : items->second) {
                         // Make sure it's also a MAP_VARIABLES item.
-                        if (it->second->type() == CellmlElementType::MAP_VARIABLES) {
-                            auto testPair = it->second->variablePair();
+                        if (item->type() == CellmlElementType::MAP_VARIABLES) {
+                            auto testPair = item->variablePair();
                             VariableWeakPtr variable1Weak = testPair->variable1();
                             VariableWeakPtr variable2Weak = testPair->variable2();
                             if (equals(variable1Weak, weakEquivalentVariable) && equals(variable2Weak, weakVariable)) {
@@ -222,7 +262,7 @@ void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &comp
                 if (!found) {
                     auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
                     entry->mPimpl->setMapVariables(variable, equivalentVariable);
-                    idList.insert(std::make_pair(id, convertToWeak(entry)));
+                    idList[id].push_back(convertToWeak(entry));
                 }
             }
 
@@ -233,13 +273,13 @@ void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &comp
                 // side this is a separate check for duplicates.  We can't rely on the variables having names to set an order
                 // either.
                 bool found = false;
-                if (idList.count(id) != 0) {
-                    // Get the range of items with this identifier:
-                    auto rangePair = idList.equal_range(id);
-                    for (auto it = rangePair.first; it != rangePair.second; ++it) {
+                auto items = idList.find(id);
+                if (items != idList.end()) {
+                    // Go through the items with this identifier:
+                    for (const auto &item : items->second) {
                         // Make sure it's also a CONNECTION item.
-                        if (it->second->type() == CellmlElementType::CONNECTION) {
-                            auto testPair = it->second->variablePair();
+                        if (item->type() == CellmlElementType::CONNECTION) {
+                            auto testPair = item->variablePair();
                             if ((owningComponent(testPair->variable1()) == owningComponent(equivalentVariable)) && (owningComponent(testPair->variable2()) == owningComponent(variable))) {
                                 found = true;
                             } else if ((owningComponent(testPair->variable2()) == owningComponent(equivalentVariable)) && (owningComponent(testPair->variable1()) == owningComponent(variable))) {
@@ -251,7 +291,7 @@ void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &comp
                 if (!found) {
                     auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
                     entry->mPimpl->setConnection(variable, equivalentVariable);
-                    idList.insert(std::make_pair(id, convertToWeak(entry)));
+                    idList[id].push_back(convertToWeak(entry));
                 }
             }
         }
@@ -263,19 +303,19 @@ void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &comp
         if (!id.empty()) {
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setReset(reset);
-            idList.insert(std::make_pair(id, convertToWeak(entry)));
+            idList[id].push_back(convertToWeak(entry));
         }
         id = reset->testValueId();
         if (!id.empty()) {
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setTestValue(reset);
-            idList.insert(std::make_pair(id, convertToWeak(entry)));
+            idList[id].push_back(convertToWeak(entry));
         }
         id = reset->resetValueId();
         if (!id.empty()) {
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setResetValue(reset);
-            idList.insert(std::make_pair(id, convertToWeak(entry)));
+            idList[id].push_back(convertToWeak(entry));
         }
     }
 
@@ -294,7 +334,7 @@ ItemList Annotator::AnnotatorImpl::listIdsAndItems(const ModelPtr &model)
     if (!id.empty()) {
         auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
         entry->mPimpl->setModel(model);
-        idList.insert(std::make_pair(id, convertToWeak(entry)));
+        idList[id].push_back(convertToWeak(entry));
     }
 
     // Units.
@@ -304,7 +344,7 @@ ItemList Annotator::AnnotatorImpl::listIdsAndItems(const ModelPtr &model)
         if (!id.empty()) {
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setUnits(units);
-            idList.insert(std::make_pair(id, convertToWeak(entry)));
+            idList[id].push_back(convertToWeak(entry));
         }
         for (size_t i = 0; i < units->unitCount(); ++i) {
             std::string prefix;
@@ -315,7 +355,7 @@ ItemList Annotator::AnnotatorImpl::listIdsAndItems(const ModelPtr &model)
             if (!id.empty()) {
                 auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
                 entry->mPimpl->setUnitsItem(UnitsItem::create(units, i));
-                idList.insert(std::make_pair(id, convertToWeak(entry)));
+                idList[id].push_back(convertToWeak(entry));
             }
         }
         if (units->isImport()) {
@@ -324,7 +364,7 @@ ItemList Annotator::AnnotatorImpl::listIdsAndItems(const ModelPtr &model)
             if (!id.empty()) {
                 auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
                 entry->mPimpl->setImportSource(importSource);
-                idList.insert(std::make_pair(id, convertToWeak(entry)));
+                idList[id].push_back(convertToWeak(entry));
             }
         }
     }
@@ -339,7 +379,7 @@ ItemList Annotator::AnnotatorImpl::listIdsAndItems(const ModelPtr &model)
     if (!id.empty()) {
         auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
         entry->mPimpl->setEncapsulation(model);
-        idList.insert(std::make_pair(id, convertToWeak(entry)));
+        idList[id].push_back(convertToWeak(entry));
     }
 
     return idList;
@@ -462,22 +502,160 @@ AnyCellmlElementPtr Annotator::AnnotatorImpl::convertToShared(const AnyCellmlEle
 
 void Annotator::AnnotatorImpl::buildIdList()
 {
+    auto model = mModel.lock();
+
     mIdList.clear();
-    mIdList = listIdsAndItems(mModel.lock());
+    mIdList = listIdsAndItems(model);
+
+    mImportSourceIds.clear();
+
+    for (const auto &importSource : getAllImportSources(model)) {
+        mImportSourceIds.emplace_back(importSource, importSource->id());
+    }
+}
+
+void Annotator::AnnotatorImpl::recordImportSourceIds()
+{
+    for (auto &importSourceId : mImportSourceIds) {
+        auto importSource = importSourceId.first.lock();
+
+        importSourceId.second = (importSource != nullptr) ? importSource->id() : "";
+    }
+}
+
+bool Annotator::AnnotatorImpl::importSourceIdsChanged() const
+{
+    // The identifiers of import sources are not tracked by the model since an
+    // import source may be shared by several models, so check them ourselves.
+
+    for (const auto &importSourceId : mImportSourceIds) {
+        auto importSource = importSourceId.first.lock();
+
+        if ((importSource == nullptr) || (importSource->id() != importSourceId.second)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool Annotator::AnnotatorImpl::applyIdChanges(const std::vector<IdChange> &idChanges)
+{
+    // We can only bring our list of identifiers up to date if the model has
+    // recorded all the changes of identifiers since our revision.
+
+    if ((mIdsRevision == 0) || idChanges.empty() || (idChanges.front().mRevision != mIdsRevision + 1)) {
+        return false;
+    }
+
+    for (const auto &idChange : idChanges) {
+        auto entity = idChange.mEntity.lock();
+
+        if (entity == nullptr) {
+            return false;
+        }
+
+        auto items = mIdList.find(idChange.mOldId);
+
+        if (items != mIdList.end()) {
+            auto item = std::find_if(items->second.begin(), items->second.end(), [&](const AnyCellmlElementPtr &item) {
+                return isItemOf(item, idChange.mType, idChange.mEntity);
+            });
+
+            if (item != items->second.end()) {
+                items->second.erase(item);
+
+                if (items->second.empty()) {
+                    mIdList.erase(items);
+                }
+            }
+        }
+
+        if (!idChange.mId.empty()) {
+            auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
+
+            switch (idChange.mType) {
+            case CellmlElementType::COMPONENT:
+                entry->mPimpl->setComponent(std::dynamic_pointer_cast<Component>(entity));
+                break;
+            case CellmlElementType::MODEL:
+                entry->mPimpl->setModel(std::dynamic_pointer_cast<Model>(entity));
+                break;
+            case CellmlElementType::RESET:
+                entry->mPimpl->setReset(std::dynamic_pointer_cast<Reset>(entity));
+                break;
+            case CellmlElementType::UNITS:
+                entry->mPimpl->setUnits(std::dynamic_pointer_cast<Units>(entity));
+                break;
+            default: /* CellmlElementType::VARIABLE */
+                entry->mPimpl->setVariable(std::dynamic_pointer_cast<Variable>(entity));
+                break;
+            }
+
+            mIdList[idChange.mId].push_back(convertToWeak(entry));
+        }
+    }
+
+    return true;
+}
+
+void Annotator::AnnotatorImpl::markIdListUpToDate()
+{
+    // Our list of identifiers was kept up to date while we changed identifiers
+    // in the model, so record the current revision of the identifiers to avoid
+    // going through the model again.  We don't know the hash of the model
+    // anymore, so reset it to force a rebuild of our list if some identifiers
+    // get changed behind our back.
+
+    auto model = mModel.lock();
+
+    mHash = 0;
+    mIdsRevision = (model != nullptr) ? model->pFunc()->mIdsRevision : 0;
+
+    recordImportSourceIds();
 }
 
 size_t Annotator::AnnotatorImpl::idCount()
 {
-    return mIdList.size();
+    size_t res = 0;
+
+    for (const auto &items : mIdList) {
+        res += items.second.size();
+    }
+
+    return res;
+}
+
+size_t Annotator::AnnotatorImpl::itemCount(const std::string &id) const
+{
+    auto items = mIdList.find(id);
+
+    return (items != mIdList.end()) ? items->second.size() : 0;
 }
 
 void Annotator::AnnotatorImpl::update()
 {
+    // Only go through the model if an identifier may have changed since we
+    // last did so, and not even then if we can apply the changes recorded by
+    // the model to our list of identifiers.
+
     removeAllIssues();
-    size_t hash = generateHash();
-    if (mHash != hash) {
-        buildIdList();
-        mHash = hash;
+    auto model = mModel.lock();
+    size_t revision = (model != nullptr) ? model->pFunc()->mIdsRevision : 0;
+    bool importSourceIdsHaveChanged = importSourceIdsChanged();
+    if ((revision == 0) || (mIdsRevision != revision) || importSourceIdsHaveChanged) {
+        if ((revision == 0) || importSourceIdsHaveChanged || !applyIdChanges(model->pFunc()->mIdChanges)) {
+            size_t hash = generateHash();
+            if (mHash != hash) {
+                buildIdList();
+                mHash = hash;
+            } else {
+                recordImportSourceIds();
+            }
+        } else {
+            mHash = 0;
+        }
+        mIdsRevision = revision;
     }
 }
 
@@ -485,6 +663,7 @@ void Annotator::setModel(const ModelPtr &model)
 {
     pFunc()->mModel = model;
     pFunc()->mHash = 0;
+    pFunc()->mIdsRevision = 0;
     pFunc()->update();
 }
 
@@ -517,7 +696,7 @@ void Annotator::AnnotatorImpl::addIssueInvalidArgument(CellmlElementType type)
 void Annotator::AnnotatorImpl::addIssueNonUnique(const std::string &id)
 {
     auto issue = Issue::IssueImpl::create();
-    issue->mPimpl->setDescription("The identifier '" + id + "' occurs " + std::to_string(mIdList.count(id)) + " times in the model so a unique item cannot be located.");
+    issue->mPimpl->setDescription("The identifier '" + id + "' occurs " + std::to_string(itemCount(id)) + " times in the model so a unique item cannot be located.");
     issue->mPimpl->setLevel(Issue::Level::WARNING);
     issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANNOTATOR_ID_NOT_UNIQUE);
     addIssue(issue);
@@ -561,16 +740,18 @@ AnyCellmlElementPtr Annotator::item(const std::string &id, size_t index)
 bool Annotator::isUnique(const std::string &id)
 {
     pFunc()->update();
-    return pFunc()->mIdList.count(id) == 1;
+    return pFunc()->itemCount(id) == 1;
 }
 
 std::vector<AnyCellmlElementPtr> Annotator::items(const std::string &id)
 {
     pFunc()->update();
     std::vector<AnyCellmlElementPtr> items;
-    auto range = pFunc()->mIdList.equal_range(id);
-    for (auto it = range.first; it != range.second; ++it) {
-        items.push_back(pFunc()->convertToShared(it->second));
+    auto found = pFunc()->mIdList.find(id);
+    if (found != pFunc()->mIdList.end()) {
+        for (const auto &item : found->second) {
+            items.push_back(pFunc()->convertToShared(item));
+        }
     }
     return items;
 }
@@ -579,13 +760,12 @@ std::vector<std::string> Annotator::duplicateIds()
 {
     pFunc()->update();
     std::vector<std::string> ids;
-    for (auto i = pFunc()->mIdList.begin(), end = pFunc()->mIdList.end(); i != end; i = pFunc()->mIdList.upper_bound(i->first)) {
-        auto next = i;
-        ++next;
-        if ((next != end) && (next->first == i->first)) {
-            ids.push_back(i->first);
+    for (const auto &items : pFunc()->mIdList) {
+        if (items.second.size() > 1) {
+            ids.push_back(items.first);
         }
     }
+    std::sort(ids.begin(), ids.end());
     return ids;
 }
 
@@ -593,9 +773,10 @@ std::vector<std::string> Annotator::ids()
 {
     pFunc()->update();
     std::vector<std::string> ids;
-    for (auto i = pFunc()->mIdList.begin(), end = pFunc()->mIdList.end(); i != end; i = pFunc()->mIdList.upper_bound(i->first)) {
-        ids.push_back(i->first);
+    for (const auto &items : pFunc()->mIdList) {
+        ids.push_back(items.first);
     }
+    std::sort(ids.begin(), ids.end());
     return ids;
 }
 
@@ -751,7 +932,7 @@ void Annotator::clearAllIds()
         model->removeEncapsulationId();
 
         pFunc()->mIdList.clear();
-        pFunc()->mHash = 0;
+        pFunc()->markIdListUpToDate();
     } else {
         pFunc()->addIssueNoModel();
     }
@@ -793,8 +974,10 @@ bool Annotator::assignAllIds()
 {
     auto model = pFunc()->mModel.lock();
     if (model != nullptr) {
+        pFunc()->update();
         size_t initialSize = pFunc()->idCount();
         pFunc()->doSetAllAutomaticIds();
+        pFunc()->markIdListUpToDate();
         return pFunc()->idCount() > initialSize;
     }
     pFunc()->addIssueNoModel();
@@ -821,6 +1004,8 @@ bool Annotator::assignIds(CellmlElementType type)
         return false;
     }
 
+    pFunc()->update();
+
     size_t initialSize = pFunc()->idCount();
 
     switch (type) {
@@ -856,7 +1041,10 @@ bool Annotator::assignIds(CellmlElementType type)
         break;
     }
 
-    setModel(model);
+    // The new identifiers were added to our list as they were assigned, so
+    // there is no need to rebuild it.
+
+    pFunc()->markIdListUpToDate();
 
     return pFunc()->idCount() > initialSize;
 }
@@ -877,14 +1065,14 @@ void Annotator::AnnotatorImpl::doSetComponentTreeTypeIds(const ComponentPtr &com
         component->setId(id);
         auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
         entry->mPimpl->setComponent(component);
-        mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+        mIdList[id].push_back(convertToWeak(entry));
     }
     if (assignEncapsulationId(component, type, all)) {
         auto id = makeUniqueId();
         component->setEncapsulationId(id);
         auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
         entry->mPimpl->setComponentRef(component);
-        mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+        mIdList[id].push_back(convertToWeak(entry));
     }
     if ((type == CellmlElementType::VARIABLE) || all) {
         for (size_t vIndex = 0; vIndex < component->variableCount(); ++vIndex) {
@@ -894,7 +1082,7 @@ void Annotator::AnnotatorImpl::doSetComponentTreeTypeIds(const ComponentPtr &com
                 v->setId(id);
                 auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
                 entry->mPimpl->setVariable(v);
-                mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+                mIdList[id].push_back(convertToWeak(entry));
             }
         }
     }
@@ -908,7 +1096,7 @@ void Annotator::AnnotatorImpl::doSetComponentTreeTypeIds(const ComponentPtr &com
                 Variable::setEquivalenceConnectionId(v1, v2, id);
                 auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
                 entry->mPimpl->setConnection(v1, v2);
-                mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+                mIdList[id].push_back(convertToWeak(entry));
             }
             if (((type == CellmlElementType::MAP_VARIABLES) || all)
                 && Variable::equivalenceMappingId(v1, v2).empty()) {
@@ -916,7 +1104,7 @@ void Annotator::AnnotatorImpl::doSetComponentTreeTypeIds(const ComponentPtr &com
                 Variable::setEquivalenceMappingId(v1, v2, id);
                 auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
                 entry->mPimpl->setMapVariables(v1, v2);
-                mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+                mIdList[id].push_back(convertToWeak(entry));
             }
         }
     }
@@ -928,7 +1116,7 @@ void Annotator::AnnotatorImpl::doSetComponentTreeTypeIds(const ComponentPtr &com
             r->setId(id);
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setReset(r);
-            mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+            mIdList[id].push_back(convertToWeak(entry));
         }
         if (((type == CellmlElementType::RESET_VALUE) || all)
             && r->resetValueId().empty()) {
@@ -936,7 +1124,7 @@ void Annotator::AnnotatorImpl::doSetComponentTreeTypeIds(const ComponentPtr &com
             r->setResetValueId(id);
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setResetValue(r);
-            mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+            mIdList[id].push_back(convertToWeak(entry));
         }
         if (((type == CellmlElementType::TEST_VALUE) || all)
             && r->testValueId().empty()) {
@@ -944,7 +1132,7 @@ void Annotator::AnnotatorImpl::doSetComponentTreeTypeIds(const ComponentPtr &com
             r->setTestValueId(id);
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setTestValue(r);
-            mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+            mIdList[id].push_back(convertToWeak(entry));
         }
     }
 
@@ -964,7 +1152,7 @@ void Annotator::AnnotatorImpl::doSetImportSourceIds()
             importSource->setId(id);
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setImportSource(importSource);
-            mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+            mIdList[id].push_back(convertToWeak(entry));
         }
     }
 }
@@ -980,7 +1168,7 @@ void Annotator::AnnotatorImpl::doSetUnitsIds()
             us->setId(id);
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setUnits(us);
-            mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+            mIdList[id].push_back(convertToWeak(entry));
         }
     }
 }
@@ -996,7 +1184,7 @@ void Annotator::AnnotatorImpl::doSetUnitsItemIds()
                 us->setUnitId(i, id);
                 auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
                 entry->mPimpl->setUnitsItem(UnitsItem::create(us, i));
-                mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+                mIdList[id].push_back(convertToWeak(entry));
             }
         }
     }
@@ -1010,7 +1198,7 @@ void Annotator::AnnotatorImpl::doSetEncapsulationIds()
         model->setEncapsulationId(id);
         auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
         entry->mPimpl->setEncapsulation(model);
-        mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+        mIdList[id].push_back(convertToWeak(entry));
     }
 }
 
@@ -1022,7 +1210,7 @@ void Annotator::AnnotatorImpl::doSetModelIds()
         model->setId(id);
         auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
         entry->mPimpl->setModel(model);
-        mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+        mIdList[id].push_back(convertToWeak(entry));
     }
 }
 
@@ -1047,16 +1235,10 @@ std::string Annotator::AnnotatorImpl::makeUniqueId()
     // so that "holes" in the automatic identifier list are not filled; they will always build from the previous
     // maximum value.
 
-    std::stringstream stream;
-    stream << std::hex << mCounter;
-    std::string id = stream.str();
-    stream.str(std::string());
+    std::string id = convertToHexString(mCounter);
 
     while (mIdList.count(id) != 0) {
-        ++mCounter;
-        stream << std::hex << mCounter;
-        id = stream.str();
-        stream.str(std::string());
+        id = convertToHexString(++mCounter);
     }
     // Note: this is only as unique as the information in mIdList permits.  That array must be updated
     // outside this function.
@@ -1296,13 +1478,20 @@ bool Annotator::AnnotatorImpl::validItem(const AnyCellmlElementPtr &item)
 
 void Annotator::AnnotatorImpl::removeId(const AnyCellmlElementPtr &item, const std::string &id)
 {
-    auto range = mIdList.equal_range(id);
-    for (auto it = range.first; it != range.second; ++it) {
-        if ((it->second->type() == item->type()) && itemsEqual(it->second, item)) {
-            mIdList.erase(it);
+    auto items = mIdList.find(id);
+    if (items == mIdList.end()) {
+        return;
+    }
+    auto &list = items->second;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        if (((*it)->type() == item->type()) && itemsEqual(*it, item)) {
+            list.erase(it);
             break;
         }
     }
+    if (list.empty()) {
+        mIdList.erase(items);
+    }
 }
 
 std::string Annotator::AnnotatorImpl::setAutoId(const AnyCellmlElementPtr &item)
@@ -1324,7 +1513,8 @@ std::string Annotator::AnnotatorImpl::setAutoId(const AnyCellmlElementPtr &item)
             }
 
             setId(item, newId);
-            mIdList.insert(std::make_pair(newId, convertToWeak(item)));
+            mIdList[newId].push_back(convertToWeak(item));
+            markIdListUpToDate();
         } else {
             addIssueNoModel();
         }
@@ -1412,7 +1602,7 @@ std::string Annotator::assignId(const VariablePtr &variable1, const VariablePtr
 size_t Annotator::itemCount(const std::string &id)
 {
     pFunc()->update();
-    return pFunc()->mIdList.count(id);
+    return pFunc()->itemCount(id);
 }
 
 void Annotator::AnnotatorImpl::doUpdateComponentHash(const ComponentPtr &component, std::string &idsString)
@@ -165,6 +165,26 @@ public:
      */
     bool isStateRateBased() const;
 
+    /**
+     * @brief Test to determine if this @ref AnalyserEquation is linear in its
+     * state.
+     *
+     * Test to determine if this @ref AnalyserEquation is an ODE of the form
+     * dy/dt = a-b*y, where neither a nor b depends on the state y, either
+     * directly or through the equations used to compute the rate, and b is not
+     * zero.  This is typically the case of a gating equation of the form
+     * dy/dt = alpha*(1-y)-beta*y, for which y tends exponentially towards
+     * a/b with a time constant of 1/b, and which can therefore be integrated
+     * using the Rush-Larsen method.  An ODE that relies on an external
+     * variable or on a variable computed using an NLA system is never
+     * considered to be linear in its state.  Neither is an ODE whose
+     * @ref AnalyserModel has been released before this was first tested.
+     *
+     * @return @c true if this @ref AnalyserEquation is linear in its state,
+     * @c false otherwise.
+     */
+    bool isLinearInState() const;
+
     /**
      * @brief Get the number of variables computed by this @ref AnalyserEquation.
      *
@@ -179,9 +199,9 @@ public:
      *
      * Return the variables computed by this @ref AnalyserEquation.
      *
-     * @return The variables as a @c std::vector.
+     * @return The variables as a reference to a @c std::vector.
      */
-    std::vector<AnalyserVariablePtr> variables() const;
+    const std::vector<AnalyserVariablePtr> &variables() const;
 
     /**
      * @brief Get the variable, at @p index, computed by this @ref AnalyserEquation.
@@ -125,9 +125,9 @@ public:
      *
      * Return the states in the @ref AnalyserModel.
      *
-     * @return The states as a @c std::vector.
+     * @return The states as a reference to a @c std::vector.
      */
-    std::vector<AnalyserVariablePtr> states() const;
+    const std::vector<AnalyserVariablePtr> &states() const;
 
     /**
      * @brief Get the state at @p index.
@@ -155,9 +155,9 @@ public:
      *
      * Return the variables in the @ref AnalyserModel.
      *
-     * @return The variables as a @c std::vector.
+     * @return The variables as a reference to a @c std::vector.
      */
-    std::vector<AnalyserVariablePtr> variables() const;
+    const std::vector<AnalyserVariablePtr> &variables() const;
 
     /**
      * @brief Get the variable at @p index.
@@ -171,6 +171,21 @@ public:
      */
     AnalyserVariablePtr variable(size_t index) const;
 
+    /**
+     * @brief Get the @ref AnalyserVariable for the given @p variable.
+     *
+     * Return the @ref AnalyserVariable, i.e. the variable of integration, a
+     * state or a variable, that corresponds to the given @p variable or to a
+     * variable equivalent to it.
+     *
+     * @param variable The @ref Variable for which to return the
+     * @ref AnalyserVariable.
+     *
+     * @return The @ref AnalyserVariable for the given @p variable on success,
+     * @c nullptr on failure.
+     */
+    AnalyserVariablePtr analyserVariable(const VariablePtr &variable) const;
+
     /**
      * @brief Get the number of equations.
      *
@@ -185,9 +200,9 @@ public:
      *
      * Return the equations in the @ref AnalyserModel.
      *
-     * @return The equations as a @c std::vector.
+     * @return The equations as a reference to a @c std::vector.
      */
-    std::vector<AnalyserEquationPtr> equations() const;
+    const std::vector<AnalyserEquationPtr> &equations() const;
 
     /**
      * @brief Get the equation at @p index.
@@ -201,6 +216,37 @@ public:
      */
     AnalyserEquationPtr equation(size_t index) const;
 
+    /**
+     * @brief Get the number of resets.
+     *
+     * Return the number of resets in the @ref AnalyserModel.
+     *
+     * @return The number of resets.
+     */
+    size_t resetCount() const;
+
+    /**
+     * @brief Get the resets.
+     *
+     * Return the resets in the @ref AnalyserModel.  The index of a reset in
+     * this list is the index of its event in the generated code.
+     *
+     * @return The resets as a reference to a @c std::vector.
+     */
+    const std::vector<AnalyserResetPtr> &resets() const;
+
+    /**
+     * @brief Get the reset at @p index.
+     *
+     * Return the reset at the index @p index for the @ref AnalyserModel.
+     *
+     * @param index The index of the reset to return.
+     *
+     * @return The reset at the given @p index on success, @c nullptr on
+     * failure.
+     */
+    AnalyserResetPtr reset(size_t index) const;
+
     /**
      * @brief Test to determine if @ref AnalyserModel needs an "equal to"
      * function.
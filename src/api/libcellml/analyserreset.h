@@ -0,0 +1,110 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "libcellml/analyser.h"
+
+namespace libcellml {
+
+/**
+ * @brief The AnalyserReset class.
+ *
+ * The AnalyserReset class is for representing a reset in the context of a
+ * CellML Analyser.  A reset is active when its condition, i.e. the value of its
+ * test variable minus its test value, crosses zero, in which case the value of
+ * its (state) variable is set to its reset value.
+ */
+class LIBCELLML_EXPORT AnalyserReset
+{
+    friend class Analyser;
+
+public:
+    ~AnalyserReset(); /**< Destructor, @private. */
+    AnalyserReset(const AnalyserReset &rhs) = delete; /**< Copy constructor, @private. */
+    AnalyserReset(AnalyserReset &&rhs) noexcept = delete; /**< Move constructor, @private. */
+    AnalyserReset &operator=(AnalyserReset rhs) = delete; /**< Assignment operator, @private. */
+
+    /**
+     * @brief Get the @ref Reset for this @ref AnalyserReset.
+     *
+     * Return the @ref Reset for this @ref AnalyserReset.
+     *
+     * @return The @ref Reset.
+     */
+    ResetPtr reset() const;
+
+    /**
+     * @brief Get the order of this @ref AnalyserReset.
+     *
+     * Return the order of this @ref AnalyserReset.  If several resets of the
+     * same variable are active at the same time, then only the one with the
+     * lowest order is applied.
+     *
+     * @return The order.
+     */
+    int order() const;
+
+    /**
+     * @brief Get the @ref AnalyserVariable reset by this @ref AnalyserReset.
+     *
+     * Return the @ref AnalyserVariable reset by this @ref AnalyserReset.  It
+     * is always a state.
+     *
+     * @return The @ref AnalyserVariable.
+     */
+    AnalyserVariablePtr variable() const;
+
+    /**
+     * @brief Get the test @ref AnalyserVariable of this @ref AnalyserReset.
+     *
+     * Return the test @ref AnalyserVariable of this @ref AnalyserReset.
+     *
+     * @return The test @ref AnalyserVariable.
+     */
+    AnalyserVariablePtr testVariable() const;
+
+    /**
+     * @brief Get the @ref AnalyserEquationAst for the condition of this
+     * @ref AnalyserReset.
+     *
+     * Return the @ref AnalyserEquationAst for the condition of this
+     * @ref AnalyserReset, i.e. the value of its test variable minus its test
+     * value.  The reset is active when its condition crosses zero.
+     *
+     * @return The @ref AnalyserEquationAst for the condition.
+     */
+    AnalyserEquationAstPtr conditionAst() const;
+
+    /**
+     * @brief Get the @ref AnalyserEquationAst for the reset value of this
+     * @ref AnalyserReset.
+     *
+     * Return the @ref AnalyserEquationAst for the reset value of this
+     * @ref AnalyserReset, expressed in the units of its @ref AnalyserVariable.
+     *
+     * @return The @ref AnalyserEquationAst for the reset value.
+     */
+    AnalyserEquationAstPtr resetValueAst() const;
+
+private:
+    AnalyserReset(); /**< Constructor, @private. */
+
+    struct AnalyserResetImpl;
+    AnalyserResetImpl *mPimpl; /**< Private member to implementation pointer, @private. */
+};
+
+} // namespace libcellml
@@ -85,6 +85,240 @@ public:
      */
     void setModel(const AnalyserModelPtr &model);
 
+    /**
+     * @brief Get the @ref Profiler.
+     *
+     * Get the @ref Profiler used by this @ref Generator.
+     *
+     * @return The @ref Profiler used, @c nullptr if none.
+     */
+    ProfilerPtr profiler() const;
+
+    /**
+     * @brief Set the @ref Profiler.
+     *
+     * Set the @ref Profiler that collects timing and counting data for the
+     * code generation phases of this @ref Generator.  A @c nullptr
+     * @p profiler, the default, disables profiling.
+     *
+     * @param profiler The @ref Profiler to set.
+     */
+    void setProfiler(const ProfilerPtr &profiler);
+
+    /**
+     * @brief Test if Jacobian code is generated.
+     *
+     * Test if this @ref Generator generates code to compute Jacobians.
+     *
+     * @sa setJacobianGenerated
+     *
+     * @return @c true if Jacobian code is generated, @c false otherwise.
+     */
+    bool isJacobianGenerated() const;
+
+    /**
+     * @brief Set whether Jacobian code is generated.
+     *
+     * Set whether this @ref Generator generates code to compute analytic
+     * Jacobians, @c false by default.  When @c true, the following code is
+     * generated, using the @ref GeneratorProfile:
+     *  - for a model with ODEs, a method to compute the Jacobian of the rates
+     *    with respect to the states.  The Jacobian is stored in row-major order
+     *    and only its nonzero entries are set, so the Jacobian array should be
+     *    zero-initialised by the caller.  The method expects the variables to
+     *    be up to date, i.e. the method to compute the rates must have been
+     *    called for the same variable of integration and states.  The method
+     *    is not generated if a rate depends on an external variable or on a
+     *    variable computed using an NLA system; and
+     *  - for each NLA system, a method to compute the Jacobian of its objective
+     *    function with respect to its unknowns.
+     *
+     * @param jacobianGenerated Whether Jacobian code is generated.
+     */
+    void setJacobianGenerated(bool jacobianGenerated);
+
+    /**
+     * @brief Test if the sparsity pattern of Jacobians is generated.
+     *
+     * Test if this @ref Generator generates the sparsity pattern of Jacobians.
+     *
+     * @sa setJacobianSparsityPatternGenerated
+     *
+     * @return @c true if the sparsity pattern of Jacobians is generated,
+     * @c false otherwise.
+     */
+    bool isJacobianSparsityPatternGenerated() const;
+
+    /**
+     * @brief Set whether the sparsity pattern of Jacobians is generated.
+     *
+     * Set whether this @ref Generator generates the sparsity pattern of
+     * Jacobians, @c false by default.  The sparsity pattern is generated
+     * independently of the Jacobians themselves (see
+     * @ref setJacobianGenerated), in both compressed sparse row (CSR) and
+     * compressed sparse column (CSC) forms, using the @ref GeneratorProfile:
+     *  - for a model with ODEs, the sparsity pattern of the Jacobian of the
+     *    rates with respect to the states.  A rate depends on a state if the
+     *    state is used, directly or through the equations used to compute
+     *    the rate, including NLA systems.  External variables are assumed not
+     *    to depend on the states.  No sparsity pattern is generated if the
+     *    Jacobian is structurally zero; and
+     *  - for each NLA system, the sparsity pattern of the Jacobian of its
+     *    objective function with respect to its unknowns.
+     *
+     * @param jacobianSparsityPatternGenerated Whether the sparsity pattern of
+     * Jacobians is generated.
+     */
+    void setJacobianSparsityPatternGenerated(bool jacobianSparsityPatternGenerated);
+
+    /**
+     * @brief Test if the variables array is split.
+     *
+     * Test if this @ref Generator splits the variables array into a constants
+     * array, a computed constants array and an algebraic array.
+     *
+     * @sa setVariablesArraySplit
+     *
+     * @return @c true if the variables array is split, @c false otherwise.
+     */
+    bool isVariablesArraySplit() const;
+
+    /**
+     * @brief Set whether the variables array is split.
+     *
+     * Set whether this @ref Generator splits the variables array into a
+     * constants array, a computed constants array and an algebraic array,
+     * @c false by default.  When @c true, the count constant, the information
+     * about the variables and the method to create the variables array are
+     * replaced with their equivalent for each of the three arrays, and the
+     * methods to compute the model take the three arrays instead of the
+     * variables array.  This allows the constants and computed constants of a
+     * model to be shared by several instances of that model.  External
+     * variables are stored in the algebraic array.
+     *
+     * The method strings of the profile may refer to the variables array(s)
+     * using the [VARIABLES_PARAMETERS], [VARIABLES_ARGUMENTS],
+     * [VARIABLES_MEMBERS] and [VARIABLES_DATA] tags (see
+     * GeneratorProfile::setVariablesParameterString()).  The default method
+     * strings refer to the variables array itself, but they come with a
+     * version that uses those tags, which is what gets used when the variables
+     * array is split.  So, a method string that is not one of the default
+     * ones must use those tags to work with a split variables array.
+     *
+     * @param variablesArraySplit Whether the variables array is split.
+     */
+    void setVariablesArraySplit(bool variablesArraySplit);
+
+    /**
+     * @brief Test if gating coefficients code is generated.
+     *
+     * Test if this @ref Generator generates code to compute the gating
+     * coefficients of the states whose ODE is linear in the state.
+     *
+     * @sa setGatingCoefficientsGenerated
+     *
+     * @return @c true if gating coefficients code is generated, @c false
+     * otherwise.
+     */
+    bool isGatingCoefficientsGenerated() const;
+
+    /**
+     * @brief Set whether gating coefficients code is generated.
+     *
+     * Set whether this @ref Generator generates code to compute the gating
+     * coefficients of the states whose ODE is linear in the state (see
+     * @ref AnalyserEquation::isLinearInState), @c false by default.  Such an
+     * ODE can be written dy/dt = (y_inf-y)/tau, where y_inf is the steady
+     * state of y and tau its time constant, allowing it to be integrated using
+     * the Rush-Larsen method.  When @c true and at least one state has such an
+     * ODE, the following code is generated, using the @ref GeneratorProfile:
+     *  - the number of such states and their indices; and
+     *  - a method to compute the steady state and time constant of each of
+     *    those states, leaving the entries of the other states untouched.  The
+     *    method expects the variables to be up to date, i.e. the method to
+     *    compute the rates must have been called for the same variable of
+     *    integration and states.
+     *
+     * @param gatingCoefficientsGenerated Whether gating coefficients code is
+     * generated.
+     */
+    void setGatingCoefficientsGenerated(bool gatingCoefficientsGenerated);
+
+    /**
+     * @brief Test if root functions code is generated.
+     *
+     * Test if this @ref Generator generates code to compute the root functions
+     * of the conditions of the piecewise statements of a model.
+     *
+     * @sa setRootFunctionsGenerated
+     *
+     * @return @c true if root functions code is generated, @c false otherwise.
+     */
+    bool isRootFunctionsGenerated() const;
+
+    /**
+     * @brief Set whether root functions code is generated.
+     *
+     * Set whether this @ref Generator generates code to compute the root
+     * functions of the conditions of the piecewise statements of a model,
+     * @c false by default.  A piecewise statement introduces a discontinuity
+     * whenever one of its relational conditions, e.g. x >= y, switches, which
+     * an integrator can locate and restart from, rather than repeatedly
+     * reducing its step size, by looking for the zero crossing of x-y.  When
+     * @c true and the equations computed by the method to compute the rates
+     * or the method to compute the variables contain at least one such
+     * condition, the following code is generated, using the
+     * @ref GeneratorProfile:
+     *  - the number of root functions; and
+     *  - a method to compute the root functions, the index of a root function
+     *    being that of its condition, when the equations of the model (see
+     *    @ref AnalyserModel::equations) are traversed in order and their
+     *    piecewise statements are traversed depth first.  Conditions that
+     *    generate the same code share the same root function.
+     *
+     * @param rootFunctionsGenerated Whether root functions code is generated.
+     */
+    void setRootFunctionsGenerated(bool rootFunctionsGenerated);
+
+    /**
+     * @brief Test if Newton solvers are generated.
+     *
+     * Test if this @ref Generator generates a Newton solver for the small NLA
+     * systems of a model.
+     *
+     * @sa setNewtonSolversGenerated
+     *
+     * @return @c true if Newton solvers are generated, @c false otherwise.
+     */
+    bool isNewtonSolversGenerated() const;
+
+    /**
+     * @brief Set whether Newton solvers are generated.
+     *
+     * Set whether this @ref Generator generates a Newton solver for the small
+     * NLA systems of a model, @c false by default.  When @c true, the root of
+     * an NLA system with up to three unknowns is found by a Newton iteration
+     * that is generated in its find root method, using the
+     * @ref GeneratorProfile, rather than by calling the NLA solve method.  The
+     * iteration calls the objective function method directly and solves for
+     * the Newton step using Cramer's rule, which avoids the overhead of a
+     * generic NLA solver for the small systems that are most common.  The
+     * Jacobian of the objective function is computed by the objective
+     * Jacobian method, if generated (see @ref setJacobianGenerated), or
+     * approximated using finite differences otherwise.  Larger NLA systems
+     * still call the NLA solve method.
+     *
+     * The iteration stops as soon as all the values of the objective function
+     * are within 1.0e-10 of zero or after 50 iterations, whichever comes first.
+     * No error is reported if it doesn't converge, e.g. because of a poor
+     * initial guess or a singular Jacobian, in which case the unknowns are set
+     * to their last, possibly NaN, iterate.  A model for which this is a
+     * concern should be generated without Newton solvers.
+     *
+     * @param newtonSolversGenerated Whether Newton solvers are generated.
+     */
+    void setNewtonSolversGenerated(bool newtonSolversGenerated);
+
     /**
      * @brief Get the interface code for the @ref AnalyserModel.
      *
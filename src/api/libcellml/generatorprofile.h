@@ -30,18 +30,24 @@ namespace libcellml {
  */
 class LIBCELLML_EXPORT GeneratorProfile
 {
+    friend class Generator;
+
 public:
     /**
      * @brief The type of a profile.
      *
      * A profile can be of one of the following types:
-     *  - C: a profile that targets the C language; or
-     *  - PYTHON: a profile that targets the Python language.
+     *  - C: a profile that targets the C language;
+     *  - PYTHON: a profile that targets the Python language; or
+     *  - NUMPY: a profile that targets the Python language using NumPy, with
+     *    each state, rate and variable being a NumPy array over cells, so that
+     *    a single call evaluates a whole population of cells.
      */
     enum class Profile
     {
         C,
-        PYTHON
+        PYTHON,
+        NUMPY
     };
 
     ~GeneratorProfile(); /**< Destructor, @private. */
@@ -2509,6 +2515,153 @@ public:
      */
     void setImplementationVariableCountString(const std::string &implementationVariableCountString);
 
+    /**
+     * @brief Get the @c std::string for the interface of the constant count
+     * constant.
+     *
+     * Return the @c std::string for the interface of the constant count
+     * constant.
+     *
+     * @return The @c std::string for the interface of the constant count
+     * constant.
+     */
+    std::string interfaceConstantCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface of the constant count
+     * constant.
+     *
+     * Set the @c std::string for the interface of the constant count constant.
+     *
+     * @param interfaceConstantCountString The @c std::string to use for the
+     * interface of the constant count constant.
+     */
+    void setInterfaceConstantCountString(const std::string &interfaceConstantCountString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of the constant
+     * count constant.
+     *
+     * Return the @c std::string for the implementation of the constant count
+     * constant.
+     *
+     * @return The @c std::string for the implementation of the constant count
+     * constant.
+     */
+    std::string implementationConstantCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of the constant
+     * count constant.
+     *
+     * Set the @c std::string for the implementation of the constant count
+     * constant. To be useful, the string should contain the [CONSTANT_COUNT]
+     * tag, which will be replaced with the number of constants in the model.
+     *
+     * @param implementationConstantCountString The @c std::string to use for
+     * the implementation of the constant count constant.
+     */
+    void setImplementationConstantCountString(const std::string &implementationConstantCountString);
+
+    /**
+     * @brief Get the @c std::string for the interface of the computed constant
+     * count constant.
+     *
+     * Return the @c std::string for the interface of the computed constant
+     * count constant.
+     *
+     * @return The @c std::string for the interface of the computed constant
+     * count constant.
+     */
+    std::string interfaceComputedConstantCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface of the computed constant
+     * count constant.
+     *
+     * Set the @c std::string for the interface of the computed constant count
+     * constant.
+     *
+     * @param interfaceComputedConstantCountString The @c std::string to use for
+     * the interface of the computed constant count constant.
+     */
+    void setInterfaceComputedConstantCountString(const std::string &interfaceComputedConstantCountString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of the computed
+     * constant count constant.
+     *
+     * Return the @c std::string for the implementation of the computed constant
+     * count constant.
+     *
+     * @return The @c std::string for the implementation of the computed
+     * constant count constant.
+     */
+    std::string implementationComputedConstantCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of the computed
+     * constant count constant.
+     *
+     * Set the @c std::string for the implementation of the computed constant
+     * count constant. To be useful, the string should contain the
+     * [COMPUTED_CONSTANT_COUNT] tag, which will be replaced with the number of
+     * computed constants in the model.
+     *
+     * @param implementationComputedConstantCountString The @c std::string to
+     * use for the implementation of the computed constant count constant.
+     */
+    void setImplementationComputedConstantCountString(const std::string &implementationComputedConstantCountString);
+
+    /**
+     * @brief Get the @c std::string for the interface of the algebraic count
+     * constant.
+     *
+     * Return the @c std::string for the interface of the algebraic count
+     * constant.
+     *
+     * @return The @c std::string for the interface of the algebraic count
+     * constant.
+     */
+    std::string interfaceAlgebraicCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface of the algebraic count
+     * constant.
+     *
+     * Set the @c std::string for the interface of the algebraic count constant.
+     *
+     * @param interfaceAlgebraicCountString The @c std::string to use for the
+     * interface of the algebraic count constant.
+     */
+    void setInterfaceAlgebraicCountString(const std::string &interfaceAlgebraicCountString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of the algebraic
+     * count constant.
+     *
+     * Return the @c std::string for the implementation of the algebraic count
+     * constant.
+     *
+     * @return The @c std::string for the implementation of the algebraic count
+     * constant.
+     */
+    std::string implementationAlgebraicCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of the algebraic
+     * count constant.
+     *
+     * Set the @c std::string for the implementation of the algebraic count
+     * constant. To be useful, the string should contain the [ALGEBRAIC_COUNT]
+     * tag, which will be replaced with the number of algebraic and external
+     * variables in the model.
+     *
+     * @param implementationAlgebraicCountString The @c std::string to use for
+     * the implementation of the algebraic count constant.
+     */
+    void setImplementationAlgebraicCountString(const std::string &implementationAlgebraicCountString);
+
     /**
      * @brief Get the @c std::string for the data structure for the variable
      * type object.
@@ -2852,6 +3005,158 @@ public:
      */
     void setImplementationVariableInfoString(const std::string &implementationVariableInfoString);
 
+    /**
+     * @brief Get the @c std::string for the interface of some information about
+     * the different constants.
+     *
+     * Return the @c std::string for the interface of some information about the
+     * different constants.
+     *
+     * @return The @c std::string for the interface of some information about
+     * the different constants.
+     */
+    std::string interfaceConstantInfoString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface of some information about
+     * the different constants.
+     *
+     * Set the @c std::string for the interface of some information about the
+     * different constants.
+     *
+     * @param interfaceConstantInfoString The @c std::string to use for the
+     * interface of some information about the different constants.
+     */
+    void setInterfaceConstantInfoString(const std::string &interfaceConstantInfoString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of some information
+     * about the different constants.
+     *
+     * Return the @c std::string for the implementation of some information
+     * about the different constants.
+     *
+     * @return The @c std::string for the implementation of some information
+     * about the different constants.
+     */
+    std::string implementationConstantInfoString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of some information
+     * about the different constants.
+     *
+     * Set the @c std::string for the implementation of some information about
+     * the different constants. To be useful, the string should contain the
+     * [CODE] tag, which will be replaced with some information about the
+     * different constants.
+     *
+     * @param implementationConstantInfoString The @c std::string to use for the
+     * implementation of some information about the different constants.
+     */
+    void setImplementationConstantInfoString(const std::string &implementationConstantInfoString);
+
+    /**
+     * @brief Get the @c std::string for the interface of some information about
+     * the different computed constants.
+     *
+     * Return the @c std::string for the interface of some information about the
+     * different computed constants.
+     *
+     * @return The @c std::string for the interface of some information about
+     * the different computed constants.
+     */
+    std::string interfaceComputedConstantInfoString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface of some information about
+     * the different computed constants.
+     *
+     * Set the @c std::string for the interface of some information about the
+     * different computed constants.
+     *
+     * @param interfaceComputedConstantInfoString The @c std::string to use for
+     * the interface of some information about the different computed constants.
+     */
+    void setInterfaceComputedConstantInfoString(const std::string &interfaceComputedConstantInfoString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of some information
+     * about the different computed constants.
+     *
+     * Return the @c std::string for the implementation of some information
+     * about the different computed constants.
+     *
+     * @return The @c std::string for the implementation of some information
+     * about the different computed constants.
+     */
+    std::string implementationComputedConstantInfoString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of some information
+     * about the different computed constants.
+     *
+     * Set the @c std::string for the implementation of some information about
+     * the different computed constants. To be useful, the string should contain
+     * the [CODE] tag, which will be replaced with some information about the
+     * different computed constants.
+     *
+     * @param implementationComputedConstantInfoString The @c std::string to use
+     * for the implementation of some information about the different computed
+     * constants.
+     */
+    void setImplementationComputedConstantInfoString(const std::string &implementationComputedConstantInfoString);
+
+    /**
+     * @brief Get the @c std::string for the interface of some information about
+     * the different algebraic variables.
+     *
+     * Return the @c std::string for the interface of some information about the
+     * different algebraic variables.
+     *
+     * @return The @c std::string for the interface of some information about
+     * the different algebraic variables.
+     */
+    std::string interfaceAlgebraicInfoString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface of some information about
+     * the different algebraic variables.
+     *
+     * Set the @c std::string for the interface of some information about the
+     * different algebraic variables.
+     *
+     * @param interfaceAlgebraicInfoString The @c std::string to use for the
+     * interface of some information about the different algebraic variables.
+     */
+    void setInterfaceAlgebraicInfoString(const std::string &interfaceAlgebraicInfoString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of some information
+     * about the different algebraic variables.
+     *
+     * Return the @c std::string for the implementation of some information
+     * about the different algebraic variables.
+     *
+     * @return The @c std::string for the implementation of some information
+     * about the different algebraic variables.
+     */
+    std::string implementationAlgebraicInfoString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of some information
+     * about the different algebraic variables.
+     *
+     * Set the @c std::string for the implementation of some information about
+     * the different algebraic variables. To be useful, the string should
+     * contain the [CODE] tag, which will be replaced with some information
+     * about the different algebraic and external variables.
+     *
+     * @param implementationAlgebraicInfoString The @c std::string to use for
+     * the implementation of some information about the different algebraic
+     * variables.
+     */
+    void setImplementationAlgebraicInfoString(const std::string &implementationAlgebraicInfoString);
+
     /**
      * @brief Get the @c std::string for an entry in an array for some
      * information about a variable.
@@ -2956,6 +3261,145 @@ public:
      */
     void setVariablesArrayString(const std::string &variablesArrayString);
 
+    /**
+     * @brief Get the @c std::string for the name of the constants array.
+     *
+     * Return the @c std::string for the name of the constants array.
+     *
+     * @return The @c std::string for the name of the constants array.
+     */
+    std::string constantsArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the constants array.
+     *
+     * Set the @c std::string for the name of the constants array.
+     *
+     * @param constantsArrayString The @c std::string to use for the name of the
+     * constants array.
+     */
+    void setConstantsArrayString(const std::string &constantsArrayString);
+
+    /**
+     * @brief Get the @c std::string for the name of the computed constants
+     * array.
+     *
+     * Return the @c std::string for the name of the computed constants array.
+     *
+     * @return The @c std::string for the name of the computed constants array.
+     */
+    std::string computedConstantsArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the computed constants
+     * array.
+     *
+     * Set the @c std::string for the name of the computed constants array.
+     *
+     * @param computedConstantsArrayString The @c std::string to use for the
+     * name of the computed constants array.
+     */
+    void setComputedConstantsArrayString(const std::string &computedConstantsArrayString);
+
+    /**
+     * @brief Get the @c std::string for the name of the algebraic array.
+     *
+     * Return the @c std::string for the name of the algebraic array.
+     *
+     * @return The @c std::string for the name of the algebraic array.
+     */
+    std::string algebraicArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the algebraic array.
+     *
+     * Set the @c std::string for the name of the algebraic array.
+     *
+     * @param algebraicArrayString The @c std::string to use for the name of the
+     * algebraic array.
+     */
+    void setAlgebraicArrayString(const std::string &algebraicArrayString);
+
+    /**
+     * @brief Get the @c std::string for a parameter for a variables array.
+     *
+     * Return the @c std::string for a parameter for a variables array.
+     *
+     * @return The @c std::string for a parameter for a variables array.
+     */
+    std::string variablesParameterString() const;
+
+    /**
+     * @brief Set the @c std::string for a parameter for a variables array.
+     *
+     * Set the @c std::string for a parameter for a variables array. To be
+     * useful, the string should contain the [ARRAY] tag, which will be replaced
+     * with the name of the array. The parameters for the variables array(s) are
+     * used to replace the [VARIABLES_PARAMETERS] tag in method strings while
+     * the names of the variables array(s) are used to replace the
+     * [VARIABLES_ARGUMENTS] tag.
+     *
+     * @param variablesParameterString The @c std::string to use for a parameter
+     * for a variables array.
+     */
+    void setVariablesParameterString(const std::string &variablesParameterString);
+
+    /**
+     * @brief Get the @c std::string for a member for a variables array in the
+     * root finding information object.
+     *
+     * Return the @c std::string for a member for a variables array in the root
+     * finding information object.
+     *
+     * @return The @c std::string for a member for a variables array in the root
+     * finding information object.
+     */
+    std::string variablesMemberString() const;
+
+    /**
+     * @brief Set the @c std::string for a member for a variables array in the
+     * root finding information object.
+     *
+     * Set the @c std::string for a member for a variables array in the root
+     * finding information object. To be useful, the string should contain the
+     * [ARRAY] tag, which will be replaced with the name of the array. The
+     * members for the variables array(s) are used to replace the
+     * [VARIABLES_MEMBERS] tag in the root finding information object string.
+     *
+     * @param variablesMemberString The @c std::string to use for a member for a
+     * variables array in the root finding information object.
+     */
+    void setVariablesMemberString(const std::string &variablesMemberString);
+
+    /**
+     * @brief Get the @c std::string for the retrieval of a variables array from
+     * the data of an objective function.
+     *
+     * Return the @c std::string for the retrieval of a variables array from the
+     * data of an objective function.
+     *
+     * @return The @c std::string for the retrieval of a variables array from
+     * the data of an objective function.
+     */
+    std::string variablesDataString() const;
+
+    /**
+     * @brief Set the @c std::string for the retrieval of a variables array from
+     * the data of an objective function.
+     *
+     * Set the @c std::string for the retrieval of a variables array from the
+     * data of an objective function. To be useful, the string should contain
+     * the [ARRAY] tag, which will be replaced with the name of the array, and
+     * it may contain the [INDEX] tag, which will be replaced with the position
+     * of the array in the data. The retrievals of the variables array(s) are
+     * used to replace the [VARIABLES_DATA] tag in the objective function and
+     * objective Jacobian method strings.
+     *
+     * @param variablesDataString The @c std::string to use for the retrieval of
+     * a variables array from the data of an objective function.
+     */
+    void setVariablesDataString(const std::string &variablesDataString);
+
     /**
      * @brief Get the @c std::string for the type definition of an external
      * variable method.
@@ -3185,33 +3629,132 @@ public:
                                           const std::string &objectiveFunctionMethodString);
 
     /**
-     * @brief Get the @c std::string for the @c u array used in the objective
-     * function and find root methods.
+     * @brief Get the @c std::string for the objective Jacobian method.
      *
-     * Return the @c std::string for the @c u array used in the objective function
-     * and find root methods. The @c u array is used to keep track of the value of
-     * the different unknown variables in a system of non-linear algebraic equations.
+     * Return the @c std::string for the objective Jacobian method.
      *
-     * @return The @c std::string for the @c u array used in the objective function
-     * and find root methods.
+     * @param forDifferentialModel Whether the objective Jacobian method is for
+     * a differential model, as opposed to an algebraic model.
+     *
+     * @return The @c std::string for the objective Jacobian method.
      */
-    std::string uArrayString() const;
+    std::string objectiveJacobianMethodString(bool forDifferentialModel) const;
 
     /**
-     * @brief Set the @c std::string for the @c u array used in the objective
-     * function and find root methods.
+     * @brief Set the @c std::string for the objective Jacobian method.
      *
-     * Set the @c std::string for the @c u array used in the objective function and
-     * find root methods. The @c u array is used to keep track of the value of the
-     * different unknown variables in a system of non-linear algebraic equations.
+     * Set the @c std::string for the objective Jacobian method, i.e. the method
+     * that computes the Jacobian of the objective function of an NLA system.
+     * To be useful, the string should contain the [INDEX] and [CODE] tags,
+     * which will be replaced with the index of the NLA system and some code to
+     * compute the Jacobian of its objective function, respectively.
      *
-     * @param uArrayString The @c std::string to use for the @c u array used in the
-     * objective function and find root methods.
+     * @param forDifferentialModel Whether the objective Jacobian method is for
+     * a differential model, as opposed to an algebraic model.
+     * @param objectiveJacobianMethodString The @c std::string to use for the
+     * objective Jacobian method.
      */
-    void setUArrayString(const std::string &uArrayString);
+    void setObjectiveJacobianMethodString(bool forDifferentialModel,
+                                          const std::string &objectiveJacobianMethodString);
 
     /**
-     * @brief Get the @c std::string for the @f array used in the objective
+     * @brief Get the @c std::string for the finite difference objective
+     * Jacobian method.
+     *
+     * Return the @c std::string for the finite difference objective Jacobian
+     * method.
+     *
+     * @return The @c std::string for the finite difference objective Jacobian
+     * method.
+     */
+    std::string finiteDifferenceObjectiveJacobianMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the finite difference objective
+     * Jacobian method.
+     *
+     * Set the @c std::string for the finite difference objective Jacobian
+     * method, i.e. the method that approximates the Jacobian of the objective
+     * function of an NLA system using finite differences.  It is used by the
+     * Newton solver of an NLA system (see @ref setNewtonSolveCallString) when
+     * the objective Jacobian method is not generated for that NLA system.
+     * Unlike the objective Jacobian method, it is also given the @c f array,
+     * i.e. the values of the objective function at @c u, which the Newton
+     * solver has just computed.  To be useful, the string should contain the
+     * [INDEX] and [SIZE] tags, which will be replaced with the index of the NLA
+     * system and the size of the @c u array, respectively.
+     *
+     * @param finiteDifferenceObjectiveJacobianMethodString The @c std::string
+     * to use for the finite difference objective Jacobian method.
+     */
+    void setFiniteDifferenceObjectiveJacobianMethodString(const std::string &finiteDifferenceObjectiveJacobianMethodString);
+
+    /**
+     * @brief Get the @c std::string for the Newton solver of an NLA system.
+     *
+     * Return the @c std::string for the Newton solver of an NLA system.
+     *
+     * @param forDifferentialModel Whether the Newton solver is for a
+     * differential model, as opposed to an algebraic model.
+     *
+     * @return The @c std::string for the Newton solver of an NLA system.
+     */
+    std::string newtonSolveCallString(bool forDifferentialModel) const;
+
+    /**
+     * @brief Set the @c std::string for the Newton solver of an NLA system.
+     *
+     * Set the @c std::string for the Newton solver of an NLA system, i.e. the
+     * code that is used instead of the call to the NLA solve method when the
+     * Newton solvers are generated (see @ref Generator::setNewtonSolversGenerated).
+     * To be useful, the string should contain the [INDEX], [SIZE] and [CODE]
+     * tags, which will be replaced with the index of the NLA system, the size
+     * of the @c u array and some code to update the @c u array using the
+     * objective function and the Jacobian of the objective function,
+     * respectively.  The string may also contain the [F_ARGUMENT] tag, which
+     * will be replaced with the @c f array followed by a comma when the
+     * Jacobian of the objective function is approximated using finite
+     * differences (see @ref setFiniteDifferenceObjectiveJacobianMethodString)
+     * and with an empty string otherwise.
+     *
+     * @sa uArrayString, setUArrayString
+     *
+     * @param forDifferentialModel Whether the Newton solver is for a
+     * differential model, as opposed to an algebraic model.
+     * @param newtonSolveCallString The @c std::string to use for the Newton
+     * solver of an NLA system.
+     */
+    void setNewtonSolveCallString(bool forDifferentialModel,
+                                  const std::string &newtonSolveCallString);
+
+    /**
+     * @brief Get the @c std::string for the @c u array used in the objective
+     * function and find root methods.
+     *
+     * Return the @c std::string for the @c u array used in the objective function
+     * and find root methods. The @c u array is used to keep track of the value of
+     * the different unknown variables in a system of non-linear algebraic equations.
+     *
+     * @return The @c std::string for the @c u array used in the objective function
+     * and find root methods.
+     */
+    std::string uArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for the @c u array used in the objective
+     * function and find root methods.
+     *
+     * Set the @c std::string for the @c u array used in the objective function and
+     * find root methods. The @c u array is used to keep track of the value of the
+     * different unknown variables in a system of non-linear algebraic equations.
+     *
+     * @param uArrayString The @c std::string to use for the @c u array used in the
+     * objective function and find root methods.
+     */
+    void setUArrayString(const std::string &uArrayString);
+
+    /**
+     * @brief Get the @c std::string for the @f array used in the objective
      * function and find root methods.
      *
      * Return the @c std::string for the @f array used in the objective function
@@ -3236,6 +3779,373 @@ public:
      */
     void setFArrayString(const std::string &fArrayString);
 
+    /**
+     * @brief Get the @c std::string for the Jacobian array.
+     *
+     * Return the @c std::string for the Jacobian array used in the compute
+     * Jacobian and objective Jacobian methods.
+     *
+     * @return The @c std::string for the Jacobian array.
+     */
+    std::string jacobianArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for the Jacobian array.
+     *
+     * Set the @c std::string for the Jacobian array used in the compute
+     * Jacobian and objective Jacobian methods.  The Jacobian is stored in
+     * row-major order, i.e. the partial derivative of the i-th function with
+     * respect to the j-th unknown is at index i*n+j, with n the number of
+     * unknowns.
+     *
+     * @param jacobianArrayString The @c std::string to use for the Jacobian
+     * array.
+     */
+    void setJacobianArrayString(const std::string &jacobianArrayString);
+
+    /**
+     * @brief Get the @c std::string for the name of the steady states array.
+     *
+     * Return the @c std::string for the name of the steady states array.
+     *
+     * @return The @c std::string for the name of the steady states array.
+     */
+    std::string steadyStatesArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the steady states array.
+     *
+     * Set the @c std::string for the name of the steady states array.
+     *
+     * @param steadyStatesArrayString The @c std::string to use for the name of
+     * the steady states array.
+     */
+    void setSteadyStatesArrayString(const std::string &steadyStatesArrayString);
+
+    /**
+     * @brief Get the @c std::string for the name of the time constants array.
+     *
+     * Return the @c std::string for the name of the time constants array.
+     *
+     * @return The @c std::string for the name of the time constants array.
+     */
+    std::string timeConstantsArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the time constants array.
+     *
+     * Set the @c std::string for the name of the time constants array.
+     *
+     * @param timeConstantsArrayString The @c std::string to use for the name of
+     * the time constants array.
+     */
+    void setTimeConstantsArrayString(const std::string &timeConstantsArrayString);
+
+    /**
+     * @brief Get the @c std::string for the name of the event conditions array.
+     *
+     * Return the @c std::string for the name of the event conditions array.
+     *
+     * @return The @c std::string for the name of the event conditions array.
+     */
+    std::string conditionsArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the event conditions array.
+     *
+     * Set the @c std::string for the name of the event conditions array.
+     *
+     * @param conditionsArrayString The @c std::string to use for the name of
+     * the event conditions array.
+     */
+    void setConditionsArrayString(const std::string &conditionsArrayString);
+
+    /**
+     * @brief Get the @c std::string for the name of the events array.
+     *
+     * Return the @c std::string for the name of the events array.
+     *
+     * @return The @c std::string for the name of the events array.
+     */
+    std::string eventsArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the events array.
+     *
+     * Set the @c std::string for the name of the events array.
+     *
+     * @param eventsArrayString The @c std::string to use for the name of the
+     * events array.
+     */
+    void setEventsArrayString(const std::string &eventsArrayString);
+
+    /**
+     * @brief Get the @c std::string for the name of the reset values array.
+     *
+     * Return the @c std::string for the name of the reset values array.
+     *
+     * @return The @c std::string for the name of the reset values array.
+     */
+    std::string resetValuesArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the reset values array.
+     *
+     * Set the @c std::string for the name of the reset values array.
+     *
+     * @param resetValuesArrayString The @c std::string to use for the name of
+     * the reset values array.
+     */
+    void setResetValuesArrayString(const std::string &resetValuesArrayString);
+
+    /**
+     * @brief Get the @c std::string for the name of the root functions array.
+     *
+     * Return the @c std::string for the name of the root functions array.
+     *
+     * @return The @c std::string for the name of the root functions array.
+     */
+    std::string rootFunctionsArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the root functions array.
+     *
+     * Set the @c std::string for the name of the root functions array.
+     *
+     * @param rootFunctionsArrayString The @c std::string to use for the name of
+     * the root functions array.
+     */
+    void setRootFunctionsArrayString(const std::string &rootFunctionsArrayString);
+
+    /**
+     * @brief Get the @c std::string for the interface of the sparsity pattern
+     * of the Jacobian.
+     *
+     * Return the @c std::string for the interface of the sparsity pattern of
+     * the Jacobian.
+     *
+     * @return The @c std::string for the interface of the sparsity pattern of
+     * the Jacobian.
+     */
+    std::string interfaceJacobianSparsityPatternString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface of the sparsity pattern
+     * of the Jacobian.
+     *
+     * Set the @c std::string for the interface of the sparsity pattern of the
+     * Jacobian.
+     *
+     * @param interfaceJacobianSparsityPatternString The @c std::string to use
+     * for the interface of the sparsity pattern of the Jacobian.
+     */
+    void setInterfaceJacobianSparsityPatternString(const std::string &interfaceJacobianSparsityPatternString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of the sparsity
+     * pattern of the Jacobian.
+     *
+     * Return the @c std::string for the implementation of the sparsity
+     * pattern of the Jacobian.
+     *
+     * @return The @c std::string for the implementation of the sparsity
+     * pattern of the Jacobian.
+     */
+    std::string implementationJacobianSparsityPatternString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of the sparsity
+     * pattern of the Jacobian.
+     *
+     * Set the @c std::string for the implementation of the sparsity pattern
+     * of the Jacobian, i.e. of the partial derivatives of the rates with
+     * respect to the states. To be useful, the string should contain the
+     * [NONZERO_COUNT], [ROW_POINTERS], [COLUMN_INDICES], [COLUMN_POINTERS]
+     * and [ROW_INDICES] tags, which will be replaced with the number of
+     * structurally nonzero entries of the Jacobian, and with the row pointers
+     * and column indices of its compressed sparse row (CSR) form and the
+     * column pointers and row indices of its compressed sparse column (CSC)
+     * form, respectively.
+     *
+     * @param implementationJacobianSparsityPatternString The @c std::string
+     * to use for the implementation of the sparsity pattern of the Jacobian.
+     */
+    void setImplementationJacobianSparsityPatternString(const std::string &implementationJacobianSparsityPatternString);
+
+    /**
+     * @brief Get the @c std::string for the sparsity pattern of the objective
+     * Jacobian.
+     *
+     * Return the @c std::string for the sparsity pattern of the objective
+     * Jacobian.
+     *
+     * @return The @c std::string for the sparsity pattern of the objective
+     * Jacobian.
+     */
+    std::string objectiveJacobianSparsityPatternString() const;
+
+    /**
+     * @brief Set the @c std::string for the sparsity pattern of the objective
+     * Jacobian.
+     *
+     * Set the @c std::string for the sparsity pattern of the Jacobian of the
+     * objective function of an NLA system. To be useful, the string should
+     * contain the [INDEX] tag, which will be replaced with the index of the
+     * NLA system, as well as the same tags as for the implementation of the
+     * sparsity pattern of the Jacobian.
+     *
+     * @sa setImplementationJacobianSparsityPatternString
+     *
+     * @param objectiveJacobianSparsityPatternString The @c std::string to use
+     * for the sparsity pattern of the objective Jacobian.
+     */
+    void setObjectiveJacobianSparsityPatternString(const std::string &objectiveJacobianSparsityPatternString);
+
+    /**
+     * @brief Get the @c std::string for the interface of the indices of the
+     * states whose ODE is linear in the state.
+     *
+     * Return the @c std::string for the interface of the indices of the states
+     * whose ODE is linear in the state.
+     *
+     * @return The @c std::string for the interface of the indices of the states
+     * whose ODE is linear in the state.
+     */
+    std::string interfaceGatingStateIndicesString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface of the indices of the
+     * states whose ODE is linear in the state.
+     *
+     * Set the @c std::string for the interface of the indices of the states
+     * whose ODE is linear in the state.
+     *
+     * @param interfaceGatingStateIndicesString The @c std::string to use for
+     * the interface of the indices of the states whose ODE is linear in the
+     * state.
+     */
+    void setInterfaceGatingStateIndicesString(const std::string &interfaceGatingStateIndicesString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of the indices of
+     * the states whose ODE is linear in the state.
+     *
+     * Return the @c std::string for the implementation of the indices of the
+     * states whose ODE is linear in the state.
+     *
+     * @return The @c std::string for the implementation of the indices of the
+     * states whose ODE is linear in the state.
+     */
+    std::string implementationGatingStateIndicesString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of the indices of
+     * the states whose ODE is linear in the state.
+     *
+     * Set the @c std::string for the implementation of the indices of the
+     * states whose ODE is linear in the state. To be useful, the string should
+     * contain the [GATING_STATE_COUNT] and [GATING_STATE_INDICES] tags, which
+     * will be replaced with the number of states whose ODE is linear in the
+     * state and with their indices, respectively.
+     *
+     * @param implementationGatingStateIndicesString The @c std::string to use
+     * for the implementation of the indices of the states whose ODE is linear
+     * in the state.
+     */
+    void setImplementationGatingStateIndicesString(const std::string &implementationGatingStateIndicesString);
+
+    /**
+     * @brief Get the @c std::string for the interface of the number of events.
+     *
+     * Return the @c std::string for the interface of the number of events.
+     *
+     * @return The @c std::string for the interface of the number of events.
+     */
+    std::string interfaceEventCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface of the number of events.
+     *
+     * Set the @c std::string for the interface of the number of events.
+     *
+     * @param interfaceEventCountString The @c std::string to use for the
+     * interface of the number of events.
+     */
+    void setInterfaceEventCountString(const std::string &interfaceEventCountString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of the number of
+     * events.
+     *
+     * Return the @c std::string for the implementation of the number of events.
+     *
+     * @return The @c std::string for the implementation of the number of
+     * events.
+     */
+    std::string implementationEventCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of the number of
+     * events.
+     *
+     * Set the @c std::string for the implementation of the number of events. To
+     * be useful, the string should contain the [EVENT_COUNT] tag, which will be
+     * replaced with the number of events.
+     *
+     * @param implementationEventCountString The @c std::string to use for the
+     * implementation of the number of events.
+     */
+    void setImplementationEventCountString(const std::string &implementationEventCountString);
+
+    /**
+     * @brief Get the @c std::string for the interface of the number of root
+     * functions.
+     *
+     * Return the @c std::string for the interface of the number of root
+     * functions.
+     *
+     * @return The @c std::string for the interface of the number of root
+     * functions.
+     */
+    std::string interfaceRootFunctionCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface of the number of root
+     * functions.
+     *
+     * Set the @c std::string for the interface of the number of root functions.
+     *
+     * @param interfaceRootFunctionCountString The @c std::string to use for the
+     * interface of the number of root functions.
+     */
+    void setInterfaceRootFunctionCountString(const std::string &interfaceRootFunctionCountString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of the number of
+     * root functions.
+     *
+     * Return the @c std::string for the implementation of the number of root
+     * functions.
+     *
+     * @return The @c std::string for the implementation of the number of root
+     * functions.
+     */
+    std::string implementationRootFunctionCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of the number of
+     * root functions.
+     *
+     * Set the @c std::string for the implementation of the number of root
+     * functions. To be useful, the string should contain the
+     * [ROOT_FUNCTION_COUNT] tag, which will be replaced with the number of root
+     * functions.
+     *
+     * @param implementationRootFunctionCountString The @c std::string to use
+     * for the implementation of the number of root functions.
+     */
+    void setImplementationRootFunctionCountString(const std::string &implementationRootFunctionCountString);
+
     /**
      * @brief Get the @c std::string for the interface to create the states
      * array.
@@ -3325,6 +4235,150 @@ public:
      */
     void setImplementationCreateVariablesArrayMethodString(const std::string &implementationCreateVariablesArrayMethodString);
 
+    /**
+     * @brief Get the @c std::string for the interface to create the constants
+     * array.
+     *
+     * Return the @c std::string for the interface to create the constants
+     * array.
+     *
+     * @return The @c std::string for the interface to create the constants
+     * array.
+     */
+    std::string interfaceCreateConstantsArrayMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to create the constants
+     * array.
+     *
+     * Set the @c std::string for the interface to create the constants array.
+     *
+     * @param interfaceCreateConstantsArrayMethodString The @c std::string to
+     * use for the interface to create the constants array.
+     */
+    void setInterfaceCreateConstantsArrayMethodString(const std::string &interfaceCreateConstantsArrayMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to create the
+     * constants array.
+     *
+     * Return the @c std::string for the implementation to create the constants
+     * array.
+     *
+     * @return The @c std::string for the implementation to create the constants
+     * array.
+     */
+    std::string implementationCreateConstantsArrayMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to create the
+     * constants array.
+     *
+     * Set the @c std::string for the implementation to create the constants
+     * array.
+     *
+     * @param implementationCreateConstantsArrayMethodString The @c std::string
+     * to use for the implementation to create the constants array.
+     */
+    void setImplementationCreateConstantsArrayMethodString(const std::string &implementationCreateConstantsArrayMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to create the computed
+     * constants array.
+     *
+     * Return the @c std::string for the interface to create the computed
+     * constants array.
+     *
+     * @return The @c std::string for the interface to create the computed
+     * constants array.
+     */
+    std::string interfaceCreateComputedConstantsArrayMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to create the computed
+     * constants array.
+     *
+     * Set the @c std::string for the interface to create the computed constants
+     * array.
+     *
+     * @param interfaceCreateComputedConstantsArrayMethodString The @c
+     * std::string to use for the interface to create the computed constants
+     * array.
+     */
+    void setInterfaceCreateComputedConstantsArrayMethodString(const std::string &interfaceCreateComputedConstantsArrayMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to create the
+     * computed constants array.
+     *
+     * Return the @c std::string for the implementation to create the computed
+     * constants array.
+     *
+     * @return The @c std::string for the implementation to create the computed
+     * constants array.
+     */
+    std::string implementationCreateComputedConstantsArrayMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to create the
+     * computed constants array.
+     *
+     * Set the @c std::string for the implementation to create the computed
+     * constants array.
+     *
+     * @param implementationCreateComputedConstantsArrayMethodString The @c
+     * std::string to use for the implementation to create the computed
+     * constants array.
+     */
+    void setImplementationCreateComputedConstantsArrayMethodString(const std::string &implementationCreateComputedConstantsArrayMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to create the algebraic
+     * array.
+     *
+     * Return the @c std::string for the interface to create the algebraic
+     * array.
+     *
+     * @return The @c std::string for the interface to create the algebraic
+     * array.
+     */
+    std::string interfaceCreateAlgebraicArrayMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to create the algebraic
+     * array.
+     *
+     * Set the @c std::string for the interface to create the algebraic array.
+     *
+     * @param interfaceCreateAlgebraicArrayMethodString The @c std::string to
+     * use for the interface to create the algebraic array.
+     */
+    void setInterfaceCreateAlgebraicArrayMethodString(const std::string &interfaceCreateAlgebraicArrayMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to create the
+     * algebraic array.
+     *
+     * Return the @c std::string for the implementation to create the algebraic
+     * array.
+     *
+     * @return The @c std::string for the implementation to create the algebraic
+     * array.
+     */
+    std::string implementationCreateAlgebraicArrayMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to create the
+     * algebraic array.
+     *
+     * Set the @c std::string for the implementation to create the algebraic
+     * array.
+     *
+     * @param implementationCreateAlgebraicArrayMethodString The @c std::string
+     * to use for the implementation to create the algebraic array.
+     */
+    void setImplementationCreateAlgebraicArrayMethodString(const std::string &implementationCreateAlgebraicArrayMethodString);
+
     /**
      * @brief Get the @c std::string for the interface to delete an array.
      *
@@ -3597,6 +4651,239 @@ public:
                                                        bool withExternalVariables,
                                                        const std::string &implementationComputeVariablesMethodString);
 
+    /**
+     * @brief Get the @c std::string for the interface to compute the Jacobian.
+     *
+     * Return the @c std::string for the interface to compute the Jacobian.
+     *
+     * @return The @c std::string for the interface to compute the Jacobian.
+     */
+    std::string interfaceComputeJacobianMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to compute the Jacobian.
+     *
+     * Set the @c std::string for the interface to compute the Jacobian.
+     *
+     * @param interfaceComputeJacobianMethodString The @c std::string to use
+     * for the interface to compute the Jacobian.
+     */
+    void setInterfaceComputeJacobianMethodString(const std::string &interfaceComputeJacobianMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to compute the
+     * Jacobian.
+     *
+     * Return the @c std::string for the implementation to compute the
+     * Jacobian.
+     *
+     * @return The @c std::string for the implementation to compute the
+     * Jacobian.
+     */
+    std::string implementationComputeJacobianMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to compute the
+     * Jacobian.
+     *
+     * Set the @c std::string for the implementation to compute the Jacobian,
+     * i.e. the partial derivatives of the rates with respect to the states. To
+     * be useful, the string should contain the [CODE] tag, which will be
+     * replaced with some code to compute the Jacobian.
+     *
+     * @param implementationComputeJacobianMethodString The @c std::string to
+     * use for the implementation to compute the Jacobian.
+     */
+    void setImplementationComputeJacobianMethodString(const std::string &implementationComputeJacobianMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to compute the gating
+     * coefficients.
+     *
+     * Return the @c std::string for the interface to compute the gating
+     * coefficients.
+     *
+     * @return The @c std::string for the interface to compute the gating
+     * coefficients.
+     */
+    std::string interfaceComputeGatingCoefficientsMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to compute the gating
+     * coefficients.
+     *
+     * Set the @c std::string for the interface to compute the gating
+     * coefficients.
+     *
+     * @param interfaceComputeGatingCoefficientsMethodString The @c std::string
+     * to use for the interface to compute the gating coefficients.
+     */
+    void setInterfaceComputeGatingCoefficientsMethodString(const std::string &interfaceComputeGatingCoefficientsMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to compute the
+     * gating coefficients.
+     *
+     * Return the @c std::string for the implementation to compute the gating
+     * coefficients.
+     *
+     * @return The @c std::string for the implementation to compute the gating
+     * coefficients.
+     */
+    std::string implementationComputeGatingCoefficientsMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to compute the
+     * gating coefficients.
+     *
+     * Set the @c std::string for the implementation to compute the gating
+     * coefficients. To be useful, the string should contain the [CODE] tag,
+     * which will be replaced with some code to compute the gating coefficients.
+     *
+     * @param implementationComputeGatingCoefficientsMethodString The @c
+     * std::string to use for the implementation to compute the gating
+     * coefficients.
+     */
+    void setImplementationComputeGatingCoefficientsMethodString(const std::string &implementationComputeGatingCoefficientsMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to compute the event
+     * conditions.
+     *
+     * Return the @c std::string for the interface to compute the event
+     * conditions.
+     *
+     * @return The @c std::string for the interface to compute the event
+     * conditions.
+     */
+    std::string interfaceComputeEventConditionsMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to compute the event
+     * conditions.
+     *
+     * Set the @c std::string for the interface to compute the event conditions.
+     *
+     * @param interfaceComputeEventConditionsMethodString The @c std::string to
+     * use for the interface to compute the event conditions.
+     */
+    void setInterfaceComputeEventConditionsMethodString(const std::string &interfaceComputeEventConditionsMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to compute the event
+     * conditions.
+     *
+     * Return the @c std::string for the implementation to compute the event
+     * conditions.
+     *
+     * @return The @c std::string for the implementation to compute the event
+     * conditions.
+     */
+    std::string implementationComputeEventConditionsMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to compute the event
+     * conditions.
+     *
+     * Set the @c std::string for the implementation to compute the event
+     * conditions. To be useful, the string should contain the [CODE] tag, which
+     * will be replaced with some code to compute the event conditions.
+     *
+     * @param implementationComputeEventConditionsMethodString The @c
+     * std::string to use for the implementation to compute the event
+     * conditions.
+     */
+    void setImplementationComputeEventConditionsMethodString(const std::string &implementationComputeEventConditionsMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to apply the resets.
+     *
+     * Return the @c std::string for the interface to apply the resets.
+     *
+     * @return The @c std::string for the interface to apply the resets.
+     */
+    std::string interfaceApplyResetsMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to apply the resets.
+     *
+     * Set the @c std::string for the interface to apply the resets.
+     *
+     * @param interfaceApplyResetsMethodString The @c std::string to use for the
+     * interface to apply the resets.
+     */
+    void setInterfaceApplyResetsMethodString(const std::string &interfaceApplyResetsMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to apply the resets.
+     *
+     * Return the @c std::string for the implementation to apply the resets.
+     *
+     * @return The @c std::string for the implementation to apply the resets.
+     */
+    std::string implementationApplyResetsMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to apply the resets.
+     *
+     * Set the @c std::string for the implementation to apply the resets. To be
+     * useful, the string should contain the [RESET_VARIABLE_COUNT] and [CODE]
+     * tags, which will be replaced with the number of variables that can be
+     * reset and with some code to apply the resets, respectively.
+     *
+     * @param implementationApplyResetsMethodString The @c std::string to use
+     * for the implementation to apply the resets.
+     */
+    void setImplementationApplyResetsMethodString(const std::string &implementationApplyResetsMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to compute the root
+     * functions.
+     *
+     * Return the @c std::string for the interface to compute the root
+     * functions.
+     *
+     * @return The @c std::string for the interface to compute the root
+     * functions.
+     */
+    std::string interfaceComputeRootFunctionsMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to compute the root
+     * functions.
+     *
+     * Set the @c std::string for the interface to compute the root functions.
+     *
+     * @param interfaceComputeRootFunctionsMethodString The @c std::string to
+     * use for the interface to compute the root functions.
+     */
+    void setInterfaceComputeRootFunctionsMethodString(const std::string &interfaceComputeRootFunctionsMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to compute the root
+     * functions.
+     *
+     * Return the @c std::string for the implementation to compute the root
+     * functions.
+     *
+     * @return The @c std::string for the implementation to compute the root
+     * functions.
+     */
+    std::string implementationComputeRootFunctionsMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to compute the root
+     * functions.
+     *
+     * Set the @c std::string for the implementation to compute the root
+     * functions. To be useful, the string should contain the [CODE] tag, which
+     * will be replaced with some code to compute the root functions.
+     *
+     * @param implementationComputeRootFunctionsMethodString The @c std::string
+     * to use for the implementation to compute the root functions.
+     */
+    void setImplementationComputeRootFunctionsMethodString(const std::string &implementationComputeRootFunctionsMethodString);
+
     /**
      * @brief Get the @c std::string for an empty method.
      *
@@ -3767,6 +5054,8 @@ public:
 private:
     explicit GeneratorProfile(Profile profile = Profile::C); /**< Constructor, @private. */
 
+    std::string variablesTagsString(const std::string &string) const; /**< Getter for the version of a default method string that uses the variables tags, @private. */
+
     struct GeneratorProfileImpl;
     GeneratorProfileImpl *mPimpl; /**< Private member to implementation pointer, @private. */
 };
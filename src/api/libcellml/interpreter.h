@@ -0,0 +1,224 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "libcellml/exportdefinitions.h"
+#include "libcellml/types.h"
+
+namespace libcellml {
+
+/**
+ * @brief The Interpreter class.
+ *
+ * The Interpreter class evaluates an @ref AnalyserModel without generating,
+ * compiling and loading any code.  The equations of the model are compiled
+ * into a compact register-based bytecode, which operands are directly
+ * resolved to the states, rates and variables arrays of the interpreter.  The
+ * bytecode is then executed by the @ref initialiseVariables,
+ * @ref computeComputedConstants, @ref computeRates and @ref computeVariables
+ * methods, which behave like their counterparts in the code generated by the
+ * @ref Generator.  NLA systems are solved using a built-in Newton solver.
+ *
+ * External variables are not computed by the interpreter.  Instead, their
+ * value is to be set using @ref setVariable.
+ */
+class LIBCELLML_EXPORT Interpreter
+{
+public:
+    ~Interpreter(); /**< Destructor, @private. */
+    Interpreter(const Interpreter &rhs) = delete; /**< Copy constructor, @private. */
+    Interpreter(Interpreter &&rhs) noexcept = delete; /**< Move constructor, @private. */
+    Interpreter &operator=(Interpreter rhs) = delete; /**< Assignment operator, @private. */
+
+    /**
+     * @brief Create an @ref Interpreter object.
+     *
+     * Factory method to create an @ref Interpreter. Create an interpreter
+     * with::
+     *
+     * @code
+     *   auto interpreter = libcellml::Interpreter::create();
+     * @endcode
+     *
+     * @return A smart pointer to an @ref Interpreter object.
+     */
+    static InterpreterPtr create() noexcept;
+
+    /**
+     * @brief Get the @ref AnalyserModel.
+     *
+     * Get the @ref AnalyserModel used by this @ref Interpreter.
+     *
+     * @return The @ref AnalyserModel used.
+     */
+    AnalyserModelPtr model();
+
+    /**
+     * @brief Set the @ref AnalyserModel.
+     *
+     * Set the @ref AnalyserModel to be used by this @ref Interpreter.  The
+     * equations of the model are compiled and the states, rates and variables
+     * arrays are (re)allocated and filled with NaN.  Nothing is compiled if
+     * the model is not valid, in which case all the arrays are empty.
+     *
+     * @param model The @ref AnalyserModel to set.
+     */
+    void setModel(const AnalyserModelPtr &model);
+
+    /**
+     * @brief Get the value of the variable of integration.
+     *
+     * Get the value of the variable of integration, as last passed to
+     * @ref computeRates or @ref computeVariables.
+     *
+     * @return The value of the variable of integration.
+     */
+    double voi() const;
+
+    /**
+     * @brief Get the states.
+     *
+     * Get the value of the states of the model.
+     *
+     * @return The value of the states.
+     */
+    std::vector<double> states() const;
+
+    /**
+     * @brief Get the value of the state at @p index.
+     *
+     * Get the value of the state at @p index.  If @p index is not valid, NaN
+     * is returned.
+     *
+     * @param index The index of the state.
+     *
+     * @return The value of the state.
+     */
+    double state(size_t index) const;
+
+    /**
+     * @brief Set the value of the state at @p index.
+     *
+     * Set the value of the state at @p index, e.g. as computed by an ODE
+     * solver.  Nothing is done if @p index is not valid.
+     *
+     * @param index The index of the state.
+     * @param value The value of the state.
+     */
+    void setState(size_t index, double value);
+
+    /**
+     * @brief Get the rates.
+     *
+     * Get the value of the rates of the model.
+     *
+     * @return The value of the rates.
+     */
+    std::vector<double> rates() const;
+
+    /**
+     * @brief Get the value of the rate at @p index.
+     *
+     * Get the value of the rate at @p index.  If @p index is not valid, NaN
+     * is returned.
+     *
+     * @param index The index of the rate.
+     *
+     * @return The value of the rate.
+     */
+    double rate(size_t index) const;
+
+    /**
+     * @brief Get the variables.
+     *
+     * Get the value of the (non-state) variables of the model.
+     *
+     * @return The value of the variables.
+     */
+    std::vector<double> variables() const;
+
+    /**
+     * @brief Get the value of the variable at @p index.
+     *
+     * Get the value of the variable at @p index.  If @p index is not valid,
+     * NaN is returned.
+     *
+     * @param index The index of the variable.
+     *
+     * @return The value of the variable.
+     */
+    double variable(size_t index) const;
+
+    /**
+     * @brief Set the value of the variable at @p index.
+     *
+     * Set the value of the variable at @p index, e.g. the value of an
+     * external variable.  Nothing is done if @p index is not valid.
+     *
+     * @param index The index of the variable.
+     * @param value The value of the variable.
+     */
+    void setVariable(size_t index, double value);
+
+    /**
+     * @brief Initialise the variables.
+     *
+     * Initialise the states, constants and variables that have an initial
+     * value, as well as the initial guess of the variables computed using an
+     * NLA system.
+     */
+    void initialiseVariables();
+
+    /**
+     * @brief Compute the computed constants.
+     *
+     * Compute the variables that only depend on constants.
+     */
+    void computeComputedConstants();
+
+    /**
+     * @brief Compute the rates.
+     *
+     * Compute the rates, and the variables they depend on, at @p voi, using
+     * the current value of the states.  This does nothing if the model has no
+     * ODEs.
+     *
+     * @param voi The value of the variable of integration.
+     */
+    void computeRates(double voi = 0.0);
+
+    /**
+     * @brief Compute the variables.
+     *
+     * Compute the variables that have not been computed by
+     * @ref computeComputedConstants or @ref computeRates, as well as the ones
+     * that depend on the states and rates, at @p voi.
+     *
+     * @param voi The value of the variable of integration.
+     */
+    void computeVariables(double voi = 0.0);
+
+private:
+    Interpreter(); /**< Constructor, @private. */
+
+    struct InterpreterImpl;
+    InterpreterImpl *mPimpl; /**< Private member to implementation pointer, @private. */
+};
+
+} // namespace libcellml
@@ -37,6 +37,7 @@ class LIBCELLML_EXPORT Issue
     friend class Analyser;
     friend class Annotator;
     friend class Importer;
+    friend class Logger;
     friend class Parser;
     friend class Printer;
     friend class Validator;
@@ -202,6 +203,7 @@ public:
         ANALYSER_EXTERNAL_VARIABLE_DIFFERENT_MODEL,
         ANALYSER_EXTERNAL_VARIABLE_VOI,
         ANALYSER_EXTERNAL_VARIABLE_USE_PRIMARY_VARIABLE,
+        ANALYSER_RESET_VARIABLE_NOT_STATE,
 
         // Annotator issues:
         ANNOTATOR_ID_NOT_FOUND,
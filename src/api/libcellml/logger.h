@@ -125,6 +125,57 @@ public:
      */
     IssuePtr message(size_t index) const;
 
+    /**
+     * @brief Set the maximum number of issues stored by the logger.
+     *
+     * Set the maximum number of issues that this logger keeps.  Once
+     * @p limit issues have been stored, further issues are only counted: they
+     * are reflected by issueCount(), errorCount(), warningCount() and
+     * messageCount(), but their description is never formatted and they
+     * cannot be retrieved, i.e. issue(), error(), warning() and message()
+     * return @c nullptr for them.  A @p limit of zero turns the logger into a
+     * counter only.  By default, there is no limit.
+     *
+     * The limit applies to issues added after it is set.
+     *
+     * @param limit The maximum number of issues to store.
+     */
+    void setIssueStorageLimit(size_t limit);
+
+    /**
+     * @brief Get the maximum number of issues stored by the logger.
+     *
+     * Get the maximum number of issues stored by the logger.
+     *
+     * @sa setIssueStorageLimit
+     *
+     * @return The maximum number of issues stored by the logger.
+     */
+    size_t issueStorageLimit() const;
+
+    /**
+     * @brief Set the profiler used by the logger.
+     *
+     * Set the @ref Profiler that collects timing and counting data for the
+     * phases run by this logger, e.g. @ref Profiler::Phase::VALIDATE_MATH for
+     * a @ref Validator.  A @c nullptr @p profiler, the default, disables
+     * profiling.
+     *
+     * @param profiler The @ref Profiler to use.
+     */
+    void setProfiler(const ProfilerPtr &profiler);
+
+    /**
+     * @brief Get the profiler used by the logger.
+     *
+     * Get the @ref Profiler used by the logger.
+     *
+     * @sa setProfiler
+     *
+     * @return The @ref Profiler used by the logger, @c nullptr if none.
+     */
+    ProfilerPtr profiler() const;
+
 protected:
     class LoggerImpl; /**< Forward declaration for pImpl idiom, @private. */
 
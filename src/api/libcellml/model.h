@@ -39,6 +39,13 @@ class LIBCELLML_EXPORT Model: public ComponentEntity
                               public std::enable_shared_from_this<Model>
 #endif
 {
+    friend class Annotator;
+    friend class Units;
+#ifndef SWIG
+    friend void invalidateIds(Entity *entity); /**< Friend function for tracking identifiers, @private. */
+    friend void invalidateId(Entity *entity, const std::string &oldId); /**< Friend function for tracking identifiers, @private. */
+#endif
+
 public:
     ~Model() override; /**< Destructor, @private. */
     Model(const Model &rhs) = delete; /**< Copy constructor, @private. */
@@ -332,7 +339,10 @@ public:
      *
      * Creates a full separate copy of this model.  The component
      * hierarchy and variable equivalence maps will also be copied
-     * from this model to the destination model.
+     * from this model to the destination model.  The maths of components
+     * and resets, and the unit definitions of units, are shared between
+     * this model and its clone until either of them modifies them, while
+     * all the other entities are copied.
      *
      * @return a new @c ModelPtr to the cloned model.
      */
@@ -76,6 +76,12 @@ protected:
     explicit ParentedEntity(ParentedEntityImpl *pImpl); /**< Constructor for derived classes, @private. */
 
 private:
+#ifndef SWIG
+    friend void invalidateIds(Entity *entity); /**< Friend function for tracking identifiers, @private. */
+    friend void invalidateId(Entity *entity, const std::string &oldId); /**< Friend function for tracking identifiers, @private. */
+#endif
+
+    ParentedEntityImpl *pFunc(); /**< Getter for private implementation pointer, @private. */
     const ParentedEntityImpl *pFunc() const; /**< Const getter for private implementation pointer, @private. */
 };
 
@@ -0,0 +1,176 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include "libcellml/exportdefinitions.h"
+#include "libcellml/types.h"
+
+namespace libcellml {
+
+/**
+ * @brief The Profiler class.
+ *
+ * The Profiler class collects, for each phase of the libCellML pipeline, the
+ * number of times that phase was entered, the wall time spent in it and,
+ * optionally, the number of memory allocations made while in it.
+ *
+ * A profiler is opt-in: it only collects data when it has been set on a
+ * @ref Parser, @ref Validator, @ref Analyser, @ref Importer, @ref Printer
+ * or @ref Generator (see @ref Logger::setProfiler and
+ * @ref Generator::setProfiler).  Without a profiler, the cost of the
+ * instrumentation is a single pointer test per phase.
+ *
+ * The same profiler can be shared by several objects, in which case it
+ * accumulates their data.  A profiler is not thread-safe.
+ */
+class LIBCELLML_EXPORT Profiler
+{
+    friend class ProfilerScope;
+
+public:
+    /**
+     * @brief The phases of the libCellML pipeline.
+     *
+     * The phases of the libCellML pipeline that are profiled.  Phases nest,
+     * e.g. the time spent in @c VALIDATE_MATH is also included in the time
+     * spent in @c VALIDATE_MODEL.  A phase that is re-entered recursively is
+     * counted on each call, but timed only once.
+     */
+    enum class Phase
+    {
+        PARSE_MODEL, /**< Parsing of a model, see @ref Parser::parseModel. */
+        VALIDATE_MODEL, /**< Validation of a model, see @ref Validator::validateModel. */
+        VALIDATE_MATH, /**< Validation of a MathML block, including its validation against the MathML DTD. */
+        ANALYSE_MODEL, /**< Analysis of a model, see @ref Analyser::analyseModel. */
+        ANALYSE_EQUATION_UNITS, /**< Units analysis of an equation, counted once per equation. */
+        CHECK_EQUATIONS, /**< Checking of the equations of a model to determine the type of its variables, counted once per pass over the equations. */
+        RESOLVE_IMPORTS, /**< Resolution of the imports of a model, see @ref Importer::resolveImports. */
+        FETCH_MODEL, /**< Fetching and parsing of an imported model. */
+        FLATTEN_MODEL, /**< Flattening of a model, see @ref Importer::flattenModel. */
+        PRINT_MODEL, /**< Printing of a model, see @ref Printer::printModel. */
+        GENERATE_INTERFACE_CODE, /**< Generation of interface code, see @ref Generator::interfaceCode. */
+        GENERATE_IMPLEMENTATION_CODE, /**< Generation of implementation code, see @ref Generator::implementationCode. */
+        ADD_NLA_SYSTEMS_CODE /**< Generation of the code for the NLA systems of a model. */
+    };
+
+    /**
+     * @brief The type of an allocation counter.
+     *
+     * An allocation counter returns the total number of memory allocations
+     * made so far by the application, e.g. as counted by a replacement of the
+     * global @c operator @c new.
+     */
+    using AllocationCounter = std::function<size_t()>;
+
+    ~Profiler(); /**< Destructor, @private. */
+    Profiler(const Profiler &rhs) = delete; /**< Copy constructor, @private. */
+    Profiler(Profiler &&rhs) noexcept = delete; /**< Move constructor, @private. */
+    Profiler &operator=(Profiler rhs) = delete; /**< Assignment operator, @private. */
+
+    /**
+     * @brief Create a @ref Profiler object.
+     *
+     * Factory method to create a @ref Profiler.  Create a profiler with::
+     *
+     *   auto profiler = libcellml::Profiler::create();
+     *
+     * @return A smart pointer to a @ref Profiler object.
+     */
+    static ProfilerPtr create() noexcept;
+
+    /**
+     * @brief Get the number of times the given @p phase was entered.
+     *
+     * Return the number of times the given @p phase was entered since this
+     * profiler was created or last reset.
+     *
+     * @param phase The @ref Phase of interest.
+     *
+     * @return The number of calls.
+     */
+    size_t callCount(Phase phase) const;
+
+    /**
+     * @brief Get the wall time spent in the given @p phase.
+     *
+     * Return the wall time, in seconds, spent in the given @p phase since this
+     * profiler was created or last reset.
+     *
+     * @param phase The @ref Phase of interest.
+     *
+     * @return The elapsed time in seconds.
+     */
+    double elapsedTime(Phase phase) const;
+
+    /**
+     * @brief Get the number of memory allocations made in the given @p phase.
+     *
+     * Return the number of memory allocations made in the given @p phase
+     * since this profiler was created or last reset.  Allocations can only be
+     * counted if an allocation counter has been set, otherwise zero is
+     * returned.
+     *
+     * @sa setAllocationCounter
+     *
+     * @param phase The @ref Phase of interest.
+     *
+     * @return The number of memory allocations.
+     */
+    size_t allocationCount(Phase phase) const;
+
+    /**
+     * @brief Set the allocation counter.
+     *
+     * libCellML does not replace the global allocation functions, so memory
+     * allocations can only be counted with the help of the application.  Set
+     * the @p counter that this profiler queries when entering and leaving a
+     * phase.  An empty @p counter disables the counting of allocations.
+     *
+     * @param counter The @ref AllocationCounter to use.
+     */
+    void setAllocationCounter(const AllocationCounter &counter);
+
+    /**
+     * @brief Reset this profiler.
+     *
+     * Reset the call counts, elapsed times and allocation counts of all the
+     * phases.  The allocation counter, if any, is kept.
+     */
+    void reset();
+
+    /**
+     * @brief Get the string version of a @ref Phase.
+     *
+     * Return the string version of a @ref Phase.
+     *
+     * @param phase The phase for which we want the string version.
+     *
+     * @return The string version of the @ref Phase.
+     */
+    static std::string phaseAsString(Phase phase);
+
+private:
+    Profiler(); /**< Constructor, @private. */
+
+    struct ProfilerImpl;
+    ProfilerImpl *mPimpl; /**< Private member to implementation pointer, @private. */
+};
+
+} // namespace libcellml
@@ -36,6 +36,8 @@ class AnalyserExternalVariable; /**< Forward declaration of AnalyserExternalVari
 using AnalyserExternalVariablePtr = std::shared_ptr<AnalyserExternalVariable>; /**< Type definition for shared analyser external variable pointer. */
 class AnalyserModel; /**< Forward declaration of AnalyserModel class. */
 using AnalyserModelPtr = std::shared_ptr<AnalyserModel>; /**< Type definition for shared analyser model pointer. */
+class AnalyserReset; /**< Forward declaration of AnalyserReset class. */
+using AnalyserResetPtr = std::shared_ptr<AnalyserReset>; /**< Type definition for shared analyser reset pointer. */
 class AnalyserVariable; /**< Forward declaration of AnalyserVariable class. */
 using AnalyserVariablePtr = std::shared_ptr<AnalyserVariable>; /**< Type definition for shared analyser variable pointer. */
 class Annotator; /**< Forward declaration of Annotator class. */
@@ -50,6 +52,8 @@ class GeneratorProfile; /**< Forward declaration of GeneratorProfile class. */
 using GeneratorProfilePtr = std::shared_ptr<GeneratorProfile>; /**< Type definition for shared generator variable pointer. */
 class Importer; /**< Forward declaration of Importer class. */
 using ImporterPtr = std::shared_ptr<Importer>; /**< Type definition for shared importer pointer. */
+class Interpreter; /**< Forward declaration of Interpreter class. */
+using InterpreterPtr = std::shared_ptr<Interpreter>; /**< Type definition for shared interpreter pointer. */
 class Issue; /**< Forward declaration of Issue class. */
 using IssuePtr = std::shared_ptr<Issue>; /**< Type definition for shared issue pointer. */
 class Logger; /**< Forward declaration of Parser class. */
@@ -58,6 +62,8 @@ class Parser; /**< Forward declaration of Parser class. */
 using ParserPtr = std::shared_ptr<Parser>; /**< Type definition for shared parser pointer. */
 class Printer; /**< Forward declaration of Printer class. */
 using PrinterPtr = std::shared_ptr<Printer>; /**< Type definition for shared printer pointer. */
+class Profiler; /**< Forward declaration of Profiler class. */
+using ProfilerPtr = std::shared_ptr<Profiler>; /**< Type definition for shared profiler pointer. */
 class Strict; /**< Forward declaration of Strict class. */
 using StrictPtr = std::shared_ptr<Strict>; /**< Type definition for shared strict pointer. */
 class Validator; /**< Forward declaration of Validator class. */
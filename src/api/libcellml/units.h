@@ -49,7 +49,9 @@ class LIBCELLML_EXPORT Units: public NamedEntity, public ImportedEntity
                               public std::enable_shared_from_this<Units>
 #endif
 {
+    friend class ImportedEntity;
     friend class Model;
+    friend class NamedEntity;
 
 public:
     ~Units() override; /**< Destructor, @private. */
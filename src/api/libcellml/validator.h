@@ -58,12 +58,41 @@ public:
      */
     void validateModel(const ModelPtr &model);
 
+    /**
+     * @brief Set the number of errors after which validation stops.
+     *
+     * Set the number of errors after which validateModel() stops, e.g. a
+     * @p limit of one stops validation at the first error.  This is useful
+     * when only the validity of a model matters rather than the full list of
+     * its issues.  Validation stops at the first opportunity once @p limit
+     * errors have been found, so a few more errors may be reported.  When a
+     * limit is set, the cheapest checks are run first and math is validated
+     * last, so issues may be reported in a different order than when
+     * validating without a limit.  A @p limit of zero means that there is no
+     * limit, which is also the default.
+     *
+     * @param limit The number of errors after which validation stops.
+     */
+    void setErrorLimit(size_t limit);
+
+    /**
+     * @brief Get the number of errors after which validation stops.
+     *
+     * Get the number of errors after which validation stops.
+     *
+     * @sa setErrorLimit
+     *
+     * @return The number of errors after which validation stops.
+     */
+    size_t errorLimit() const;
+
 private:
     Validator(); /**< Constructor, @private. */
 
     class ValidatorImpl; /**< Forward declaration for pImpl idiom, @private. */
 
     ValidatorImpl *pFunc(); /**< Getter for private implementation pointer, @private. */
+    const ValidatorImpl *pFunc() const; /**< Const getter for private implementation pointer, @private. */
 };
 
 } // namespace libcellml
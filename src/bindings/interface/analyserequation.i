@@ -43,6 +43,10 @@
 %feature("docstring") libcellml::AnalyserEquation::isStateRateBased
 "Tests if this :class:`AnalyserEquation` object relies on states and/or rates.";
 
+%feature("docstring") libcellml::AnalyserEquation::isLinearInState
+"Tests if this :class:`AnalyserEquation` object is an ODE of the form dy/dt = a-b*y, where neither a nor b depends on
+the state y and b is not zero.";
+
 %feature("docstring") libcellml::AnalyserEquation::variableCount
 "Returns the number of variables computed by this :class:`AnalyserEquation` object.";
 
@@ -43,6 +43,9 @@
 %feature("docstring") libcellml::AnalyserModel::variable
 "Returns the variable, specified by index, contained by this :class:`AnalyserModel` object.";
 
+%feature("docstring") libcellml::AnalyserModel::analyserVariable
+"Returns the :class:`AnalyserVariable` for the given variable, or for a variable equivalent to it.";
+
 %feature("docstring") libcellml::AnalyserModel::equationCount
 "Returns the number of equations contained by this :class:`AnalyserModel` object.";
 
@@ -52,6 +55,15 @@
 %feature("docstring") libcellml::AnalyserModel::equation
 "Returns the equation, specified by index, contained by this :class:`AnalyserModel` object.";
 
+%feature("docstring") libcellml::AnalyserModel::resetCount
+"Returns the number of resets contained by this :class:`AnalyserModel` object.";
+
+%feature("docstring") libcellml::AnalyserModel::resets
+"Returns the resets contained by this :class:`AnalyserModel` object.";
+
+%feature("docstring") libcellml::AnalyserModel::reset
+"Returns the reset, specified by index, contained by this :class:`AnalyserModel` object.";
+
 %feature("docstring") libcellml::AnalyserModel::needEqFunction
 "Tests if this :class:`AnalyserModel` object needs an \"equal to\" function.";
 
@@ -132,6 +144,7 @@
 %}
 
 %template(AnalyserEquationVector) std::vector<libcellml::AnalyserEquationPtr>;
+%template(AnalyserResetVector) std::vector<libcellml::AnalyserResetPtr>;
 %template(AnalyserVariableVector) std::vector<libcellml::AnalyserVariablePtr>;
 
 %pythoncode %{
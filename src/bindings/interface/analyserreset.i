@@ -0,0 +1,41 @@
+%module(package="libcellml") analyserreset
+
+#define LIBCELLML_EXPORT
+
+%include <std_shared_ptr.i>
+
+%import "types.i"
+
+%feature("docstring") libcellml::AnalyserReset
+"Creates an :class:`AnalyserReset` object.";
+
+%feature("docstring") libcellml::AnalyserReset::reset
+"Returns the :class:`Reset`.";
+
+%feature("docstring") libcellml::AnalyserReset::order
+"Returns the order.";
+
+%feature("docstring") libcellml::AnalyserReset::variable
+"Returns the :class:`AnalyserVariable` that is reset.";
+
+%feature("docstring") libcellml::AnalyserReset::testVariable
+"Returns the test :class:`AnalyserVariable`.";
+
+%feature("docstring") libcellml::AnalyserReset::conditionAst
+"Returns the :class:`AnalyserEquationAst` of the condition, which crosses zero when the reset is triggered.";
+
+%feature("docstring") libcellml::AnalyserReset::resetValueAst
+"Returns the :class:`AnalyserEquationAst` of the reset value.";
+
+%{
+#include "libcellml/analyserreset.h"
+%}
+
+%pythoncode %{
+# libCellML generated wrapper code starts here.
+%}
+
+%shared_ptr(libcellml::AnalyserReset);
+
+%include "libcellml/types.h"
+%include "libcellml/analyserreset.h"
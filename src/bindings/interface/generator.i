@@ -23,6 +23,49 @@
 %feature("docstring") libcellml::Generator::setModel
 "Sets the model to use for code generation.";
 
+%feature("docstring") libcellml::Generator::profiler
+"Returns the :class:`Profiler` used by this generator, if any.";
+
+%feature("docstring") libcellml::Generator::setProfiler
+"Sets the :class:`Profiler` used by this generator, :code:`None` to disable profiling.";
+
+%feature("docstring") libcellml::Generator::isJacobianGenerated
+"Tests if code to compute Jacobians is generated.";
+
+%feature("docstring") libcellml::Generator::setJacobianGenerated
+"Sets whether code to compute Jacobians is generated.";
+
+%feature("docstring") libcellml::Generator::isJacobianSparsityPatternGenerated
+"Tests if the sparsity pattern of Jacobians is generated.";
+
+%feature("docstring") libcellml::Generator::setJacobianSparsityPatternGenerated
+"Sets whether the sparsity pattern of Jacobians is generated.";
+
+%feature("docstring") libcellml::Generator::isVariablesArraySplit
+"Tests if the variables array is split into a constants, a computed constants and an algebraic array.";
+
+%feature("docstring") libcellml::Generator::setVariablesArraySplit
+"Sets whether the variables array is split into a constants, a computed constants and an algebraic array.";
+
+%feature("docstring") libcellml::Generator::isGatingCoefficientsGenerated
+"Tests if code to compute the steady state and time constant of the states whose ODE is linear in the state is generated.";
+
+%feature("docstring") libcellml::Generator::setGatingCoefficientsGenerated
+"Sets whether code to compute the steady state and time constant of the states whose ODE is linear in the state is
+generated.";
+
+%feature("docstring") libcellml::Generator::isRootFunctionsGenerated
+"Tests if code to compute the root functions of the conditions of the piecewise statements is generated.";
+
+%feature("docstring") libcellml::Generator::setRootFunctionsGenerated
+"Sets whether code to compute the root functions of the conditions of the piecewise statements is generated.";
+
+%feature("docstring") libcellml::Generator::isNewtonSolversGenerated
+"Tests if a Newton solver is generated for the NLA systems with up to three unknowns.";
+
+%feature("docstring") libcellml::Generator::setNewtonSolversGenerated
+"Sets whether a Newton solver is generated for the NLA systems with up to three unknowns.";
+
 %feature("docstring") libcellml::Generator::interfaceCode
 "Returns the interface code.";
 
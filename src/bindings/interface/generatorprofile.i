@@ -690,6 +690,46 @@ used respectively.";
 "Sets the string for the implementation of the variable count constant. To be useful, the string should contain
 the <VARIABLE_COUNT> tag, which will be replaced with the number of states in the model.";
 
+%feature("docstring") libcellml::GeneratorProfile::interfaceConstantCountString
+"Returns the string for the interface of the constant count constant.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceConstantCountString
+"Sets the string for the interface of the constant count constant.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationConstantCountString
+"Returns the string for the implementation of the constant count constant.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationConstantCountString
+"Sets the string for the implementation of the constant count constant. To be useful, the string should contain the
+<CONSTANT_COUNT> tag, which will be replaced with the number of constants in the model.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceComputedConstantCountString
+"Returns the string for the interface of the computed constant count constant.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceComputedConstantCountString
+"Sets the string for the interface of the computed constant count constant.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputedConstantCountString
+"Returns the string for the implementation of the computed constant count constant.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputedConstantCountString
+"Sets the string for the implementation of the computed constant count constant. To be useful, the string should
+contain the <COMPUTED_CONSTANT_COUNT> tag, which will be replaced with the number of computed constants in the
+model.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceAlgebraicCountString
+"Returns the string for the interface of the algebraic count constant.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceAlgebraicCountString
+"Sets the string for the interface of the algebraic count constant.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationAlgebraicCountString
+"Returns the string for the implementation of the algebraic count constant.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationAlgebraicCountString
+"Sets the string for the implementation of the algebraic count constant. To be useful, the string should contain the
+<ALGEBRAIC_COUNT> tag, which will be replaced with the number of algebraic and external variables in the model.";
+
 %feature("docstring") libcellml::GeneratorProfile::variableTypeObjectString
 "Returns the string for the data structure for the variable type object.";
 
@@ -781,6 +821,47 @@ should contain the <CODE> tag, which will be replaced with some information abou
 string should contain the <CODE> tag, which will be replaced with some information about the different
 variables.";
 
+%feature("docstring") libcellml::GeneratorProfile::interfaceConstantInfoString
+"Returns the string for the interface of some information about the different constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceConstantInfoString
+"Sets the string for the interface of some information about the different constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationConstantInfoString
+"Returns the string for the implementation of some information about the different constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationConstantInfoString
+"Sets the string for the implementation of some information about the different constants. To be useful, the string
+should contain the <CODE> tag, which will be replaced with some information about the different constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceComputedConstantInfoString
+"Returns the string for the interface of some information about the different computed constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceComputedConstantInfoString
+"Sets the string for the interface of some information about the different computed constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputedConstantInfoString
+"Returns the string for the implementation of some information about the different computed constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputedConstantInfoString
+"Sets the string for the implementation of some information about the different computed constants. To be useful, the
+string should contain the <CODE> tag, which will be replaced with some information about the different computed
+constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceAlgebraicInfoString
+"Returns the string for the interface of some information about the different algebraic variables.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceAlgebraicInfoString
+"Sets the string for the interface of some information about the different algebraic variables.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationAlgebraicInfoString
+"Returns the string for the implementation of some information about the different algebraic variables.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationAlgebraicInfoString
+"Sets the string for the implementation of some information about the different algebraic variables. To be useful, the
+string should contain the <CODE> tag, which will be replaced with some information about the different algebraic and
+external variables.";
+
 %feature("docstring") libcellml::GeneratorProfile::variableInfoEntryString
 "Returns the string for an entry in an array for some information about a variable.";
 
@@ -813,6 +894,51 @@ and units of a variable respectively.";
 %feature("docstring") libcellml::GeneratorProfile::setVariablesArrayString
 "Sets the string for the name of the variables array.";
 
+%feature("docstring") libcellml::GeneratorProfile::constantsArrayString
+"Returns the string for the name of the constants array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setConstantsArrayString
+"Sets the string for the name of the constants array.";
+
+%feature("docstring") libcellml::GeneratorProfile::computedConstantsArrayString
+"Returns the string for the name of the computed constants array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setComputedConstantsArrayString
+"Sets the string for the name of the computed constants array.";
+
+%feature("docstring") libcellml::GeneratorProfile::algebraicArrayString
+"Returns the string for the name of the algebraic array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setAlgebraicArrayString
+"Sets the string for the name of the algebraic array.";
+
+%feature("docstring") libcellml::GeneratorProfile::variablesParameterString
+"Returns the string for a parameter for a variables array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setVariablesParameterString
+"Sets the string for a parameter for a variables array. To be useful, the string should contain the <ARRAY> tag, which
+will be replaced with the name of the array. The parameters for the variables array(s) are used to replace the
+<VARIABLES_PARAMETERS> tag in method strings while the names of the variables array(s) are used to replace the
+<VARIABLES_ARGUMENTS> tag.";
+
+%feature("docstring") libcellml::GeneratorProfile::variablesMemberString
+"Returns the string for a member for a variables array in the root finding information object.";
+
+%feature("docstring") libcellml::GeneratorProfile::setVariablesMemberString
+"Sets the string for a member for a variables array in the root finding information object. To be useful, the string
+should contain the <ARRAY> tag, which will be replaced with the name of the array. The members for the variables
+array(s) are used to replace the <VARIABLES_MEMBERS> tag in the root finding information object string.";
+
+%feature("docstring") libcellml::GeneratorProfile::variablesDataString
+"Returns the string for the retrieval of a variables array from the data of an objective function.";
+
+%feature("docstring") libcellml::GeneratorProfile::setVariablesDataString
+"Sets the string for the retrieval of a variables array from the data of an objective function. To be useful, the
+string should contain the <ARRAY> tag, which will be replaced with the name of the array, and it may contain the
+<INDEX> tag, which will be replaced with the position of the array in the data. The retrievals of the variables
+array(s) are used to replace the <VARIABLES_DATA> tag in the objective function and objective Jacobian method
+strings.";
+
 %feature("docstring") libcellml::GeneratorProfile::externalVariableMethodTypeDefinitionString
 "Returns the string for the type definition of an external variable method.";
 
@@ -861,6 +987,24 @@ and units of a variable respectively.";
 %feature("docstring") libcellml::GeneratorProfile::setObjectiveFunctionMethodString
 "Sets the string for the objective function method.";
 
+%feature("docstring") libcellml::GeneratorProfile::objectiveJacobianMethodString
+"Returns the string for the objective Jacobian method.";
+
+%feature("docstring") libcellml::GeneratorProfile::setObjectiveJacobianMethodString
+"Sets the string for the objective Jacobian method.";
+
+%feature("docstring") libcellml::GeneratorProfile::finiteDifferenceObjectiveJacobianMethodString
+"Returns the string for the finite difference objective Jacobian method.";
+
+%feature("docstring") libcellml::GeneratorProfile::setFiniteDifferenceObjectiveJacobianMethodString
+"Sets the string for the finite difference objective Jacobian method.";
+
+%feature("docstring") libcellml::GeneratorProfile::newtonSolveCallString
+"Returns the string for the Newton solver of an NLA system.";
+
+%feature("docstring") libcellml::GeneratorProfile::setNewtonSolveCallString
+"Sets the string for the Newton solver of an NLA system.";
+
 %feature("docstring") libcellml::GeneratorProfile::uArrayString
 "Returns the string for the u array used in the objective function and find root methods.";
 
@@ -873,6 +1017,108 @@ and units of a variable respectively.";
 %feature("docstring") libcellml::GeneratorProfile::setFArrayString
 "Sets the string for the f array used in the objective function and find root methods.";
 
+%feature("docstring") libcellml::GeneratorProfile::jacobianArrayString
+"Returns the string for the Jacobian array used in the objective Jacobian and compute Jacobian methods.";
+
+%feature("docstring") libcellml::GeneratorProfile::setJacobianArrayString
+"Sets the string for the Jacobian array used in the objective Jacobian and compute Jacobian methods.";
+
+%feature("docstring") libcellml::GeneratorProfile::steadyStatesArrayString
+"Returns the string for the name of the steady states array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setSteadyStatesArrayString
+"Sets the string for the name of the steady states array.";
+
+%feature("docstring") libcellml::GeneratorProfile::timeConstantsArrayString
+"Returns the string for the name of the time constants array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setTimeConstantsArrayString
+"Sets the string for the name of the time constants array.";
+
+%feature("docstring") libcellml::GeneratorProfile::conditionsArrayString
+"Returns the string for the name of the event conditions array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setConditionsArrayString
+"Sets the string for the name of the event conditions array.";
+
+%feature("docstring") libcellml::GeneratorProfile::eventsArrayString
+"Returns the string for the name of the events array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setEventsArrayString
+"Sets the string for the name of the events array.";
+
+%feature("docstring") libcellml::GeneratorProfile::resetValuesArrayString
+"Returns the string for the name of the reset values array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setResetValuesArrayString
+"Sets the string for the name of the reset values array.";
+
+%feature("docstring") libcellml::GeneratorProfile::rootFunctionsArrayString
+"Returns the string for the name of the root functions array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setRootFunctionsArrayString
+"Sets the string for the name of the root functions array.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceJacobianSparsityPatternString
+"Returns the string for the interface of the sparsity pattern of the Jacobian.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceJacobianSparsityPatternString
+"Sets the string for the interface of the sparsity pattern of the Jacobian.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationJacobianSparsityPatternString
+"Returns the string for the implementation of the sparsity pattern of the Jacobian.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationJacobianSparsityPatternString
+"Sets the string for the implementation of the sparsity pattern of the Jacobian. To be useful, the string should
+contain the <NONZERO_COUNT>, <ROW_POINTERS>, <COLUMN_INDICES>, <COLUMN_POINTERS> and <ROW_INDICES> tags.";
+
+%feature("docstring") libcellml::GeneratorProfile::objectiveJacobianSparsityPatternString
+"Returns the string for the sparsity pattern of the objective Jacobian.";
+
+%feature("docstring") libcellml::GeneratorProfile::setObjectiveJacobianSparsityPatternString
+"Sets the string for the sparsity pattern of the objective Jacobian. To be useful, the string should contain the
+<INDEX>, <NONZERO_COUNT>, <ROW_POINTERS>, <COLUMN_INDICES>, <COLUMN_POINTERS> and <ROW_INDICES> tags.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceGatingStateIndicesString
+"Returns the string for the interface of the indices of the states whose ODE is linear in the state.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceGatingStateIndicesString
+"Sets the string for the interface of the indices of the states whose ODE is linear in the state.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationGatingStateIndicesString
+"Returns the string for the implementation of the indices of the states whose ODE is linear in the state.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationGatingStateIndicesString
+"Sets the string for the implementation of the indices of the states whose ODE is linear in the state. To be useful,
+the string should contain the <GATING_STATE_COUNT> and <GATING_STATE_INDICES> tags, which will be replaced with the
+number of states whose ODE is linear in the state and with their indices, respectively.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceEventCountString
+"Returns the string for the interface of the number of events.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceEventCountString
+"Sets the string for the interface of the number of events.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationEventCountString
+"Returns the string for the implementation of the number of events.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationEventCountString
+"Sets the string for the implementation of the number of events. To be useful, the string should contain the
+<EVENT_COUNT> tag, which will be replaced with the number of events.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceRootFunctionCountString
+"Returns the string for the interface of the number of root functions.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceRootFunctionCountString
+"Sets the string for the interface of the number of root functions.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationRootFunctionCountString
+"Returns the string for the implementation of the number of root functions.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationRootFunctionCountString
+"Sets the string for the implementation of the number of root functions. To be useful, the string should contain the
+<ROOT_FUNCTION_COUNT> tag, which will be replaced with the number of root functions.";
+
 %feature("docstring") libcellml::GeneratorProfile::setReturnCreatedArrayString
 "Sets the string for returning a created array. To be useful, the string should contain the <ARRAY_SIZE> tag,
 which will be replaced with the size of the array to be created.";
@@ -905,6 +1151,42 @@ tag, which will be replaced with some code to create the variables array.";
 "Sets the string for the implementation to create the variables array. To be useful, the string should contain the
 <CODE> tag, which will be replaced with some code to create the variables array.";
 
+%feature("docstring") libcellml::GeneratorProfile::interfaceCreateConstantsArrayMethodString
+"Returns the string for the interface to create the constants array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceCreateConstantsArrayMethodString
+"Sets the string for the interface to create the constants array.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationCreateConstantsArrayMethodString
+"Returns the string for the implementation to create the constants array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationCreateConstantsArrayMethodString
+"Sets the string for the implementation to create the constants array.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceCreateComputedConstantsArrayMethodString
+"Returns the string for the interface to create the computed constants array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceCreateComputedConstantsArrayMethodString
+"Sets the string for the interface to create the computed constants array.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationCreateComputedConstantsArrayMethodString
+"Returns the string for the implementation to create the computed constants array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationCreateComputedConstantsArrayMethodString
+"Sets the string for the implementation to create the computed constants array.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceCreateAlgebraicArrayMethodString
+"Returns the string for the interface to create the algebraic array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceCreateAlgebraicArrayMethodString
+"Sets the string for the interface to create the algebraic array.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationCreateAlgebraicArrayMethodString
+"Returns the string for the implementation to create the algebraic array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationCreateAlgebraicArrayMethodString
+"Sets the string for the implementation to create the algebraic array.";
+
 %feature("docstring") libcellml::GeneratorProfile::interfaceDeleteArrayMethodString
 "Returns the string for the interface to delete an array.";
 
@@ -965,6 +1247,71 @@ tag, which will be replaced with some code to create the variables array.";
 %feature("docstring") libcellml::GeneratorProfile::setImplementationComputeVariablesMethodString
 "Sets the string for the implementation to compute variables.";
 
+%feature("docstring") libcellml::GeneratorProfile::interfaceComputeJacobianMethodString
+"Returns the string for the interface to compute the Jacobian.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceComputeJacobianMethodString
+"Sets the string for the interface to compute the Jacobian.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeJacobianMethodString
+"Returns the string for the implementation to compute the Jacobian.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeJacobianMethodString
+"Sets the string for the implementation to compute the Jacobian.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceComputeGatingCoefficientsMethodString
+"Returns the string for the interface to compute the gating coefficients.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceComputeGatingCoefficientsMethodString
+"Sets the string for the interface to compute the gating coefficients.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeGatingCoefficientsMethodString
+"Returns the string for the implementation to compute the gating coefficients.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeGatingCoefficientsMethodString
+"Sets the string for the implementation to compute the gating coefficients. To be useful, the string should contain the
+<CODE> tag, which will be replaced with some code to compute the gating coefficients.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceComputeEventConditionsMethodString
+"Returns the string for the interface to compute the event conditions.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceComputeEventConditionsMethodString
+"Sets the string for the interface to compute the event conditions.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeEventConditionsMethodString
+"Returns the string for the implementation to compute the event conditions.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeEventConditionsMethodString
+"Sets the string for the implementation to compute the event conditions. To be useful, the string should contain the
+<CODE> tag, which will be replaced with some code to compute the event conditions.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceApplyResetsMethodString
+"Returns the string for the interface to apply the resets.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceApplyResetsMethodString
+"Sets the string for the interface to apply the resets.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationApplyResetsMethodString
+"Returns the string for the implementation to apply the resets.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationApplyResetsMethodString
+"Sets the string for the implementation to apply the resets. To be useful, the string should contain the
+<RESET_VARIABLE_COUNT> and <CODE> tags, which will be replaced with the number of variables that can be reset and with
+some code to apply the resets, respectively.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceComputeRootFunctionsMethodString
+"Returns the string for the interface to compute the root functions.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceComputeRootFunctionsMethodString
+"Sets the string for the interface to compute the root functions.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeRootFunctionsMethodString
+"Returns the string for the implementation to compute the root functions.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeRootFunctionsMethodString
+"Sets the string for the implementation to compute the root functions. To be useful, the string should contain the
+<CODE> tag, which will be replaced with some code to compute the root functions.";
+
 %feature("docstring") libcellml::GeneratorProfile::emptyMethodString
 "Returns the string for an empty method.";
 
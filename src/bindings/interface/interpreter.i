@@ -0,0 +1,70 @@
+%module(package="libcellml") interpreter
+
+#define LIBCELLML_EXPORT
+
+%include <std_vector.i>
+
+%import "analysermodel.i"
+%import "createconstructor.i"
+
+%feature("docstring") libcellml::Interpreter
+"Creates an :class:`Interpreter` object.";
+
+%feature("docstring") libcellml::Interpreter::model
+"Returns the model to interpret.";
+
+%feature("docstring") libcellml::Interpreter::setModel
+"Sets the model to interpret.";
+
+%feature("docstring") libcellml::Interpreter::voi
+"Returns the value of the variable of integration.";
+
+%feature("docstring") libcellml::Interpreter::states
+"Returns the value of the states.";
+
+%feature("docstring") libcellml::Interpreter::state
+"Returns the value of the state at the given index.";
+
+%feature("docstring") libcellml::Interpreter::setState
+"Sets the value of the state at the given index.";
+
+%feature("docstring") libcellml::Interpreter::rates
+"Returns the value of the rates.";
+
+%feature("docstring") libcellml::Interpreter::rate
+"Returns the value of the rate at the given index.";
+
+%feature("docstring") libcellml::Interpreter::variables
+"Returns the value of the variables.";
+
+%feature("docstring") libcellml::Interpreter::variable
+"Returns the value of the variable at the given index.";
+
+%feature("docstring") libcellml::Interpreter::setVariable
+"Sets the value of the variable at the given index, e.g. the value of an external variable.";
+
+%feature("docstring") libcellml::Interpreter::initialiseVariables
+"Initialises the states, constants and variables that have an initial value.";
+
+%feature("docstring") libcellml::Interpreter::computeComputedConstants
+"Computes the computed constants.";
+
+%feature("docstring") libcellml::Interpreter::computeRates
+"Computes the rates at the given value of the variable of integration.";
+
+%feature("docstring") libcellml::Interpreter::computeVariables
+"Computes the variables at the given value of the variable of integration.";
+
+%{
+#include "libcellml/interpreter.h"
+%}
+
+%pythoncode %{
+# libCellML generated wrapper code starts here.
+%}
+
+%template() std::vector<double>;
+
+%create_constructor(Interpreter)
+
+%include "libcellml/interpreter.h"
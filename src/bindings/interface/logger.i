@@ -37,6 +37,18 @@
 %feature("docstring") libcellml::Logger::messageCount
 "Returns the number of issues of level MESSAGE currently stored in the logger.";
 
+%feature("docstring") libcellml::Logger::setIssueStorageLimit
+"Sets the maximum number of issues stored by the logger, further issues are only counted.";
+
+%feature("docstring") libcellml::Logger::issueStorageLimit
+"Returns the maximum number of issues stored by the logger.";
+
+%feature("docstring") libcellml::Logger::setProfiler
+"Sets the :class:`Profiler` used by the logger, :code:`None` to disable profiling.";
+
+%feature("docstring") libcellml::Logger::profiler
+"Returns the :class:`Profiler` used by the logger, if any.";
+
 #if defined(SWIGPYTHON)
     // Treat negative size_t as invalid index (instead of unknown method)
     %extend libcellml::Logger {
@@ -0,0 +1,45 @@
+%module(package="libcellml") profiler
+
+#define LIBCELLML_EXPORT
+
+%include <std_shared_ptr.i>
+%include <std_string.i>
+
+%import "createconstructor.i"
+%import "types.i"
+
+%feature("docstring") libcellml::Profiler
+"Creates a :class:`Profiler` object.";
+
+%feature("docstring") libcellml::Profiler::callCount
+"Returns the number of times the given :enum:`Profiler::Phase` was entered.";
+
+%feature("docstring") libcellml::Profiler::elapsedTime
+"Returns the wall time, in seconds, spent in the given :enum:`Profiler::Phase`.";
+
+%feature("docstring") libcellml::Profiler::allocationCount
+"Returns the number of memory allocations made in the given :enum:`Profiler::Phase`.";
+
+%feature("docstring") libcellml::Profiler::reset
+"Resets the call counts, elapsed times and allocation counts of all the phases.";
+
+%feature("docstring") libcellml::Profiler::phaseAsString
+"Returns the :enum:`Profiler::Phase` as a string.";
+
+%{
+#include "libcellml/profiler.h"
+%}
+
+%pythoncode %{
+# libCellML generated wrapper code starts here.
+%}
+
+// Allocations can only be counted from C++, where the global allocation
+// functions can be replaced.
+%ignore libcellml::Profiler::AllocationCounter;
+%ignore libcellml::Profiler::setAllocationCounter;
+
+%create_constructor(Profiler)
+
+%include "libcellml/types.h"
+%include "libcellml/profiler.h"
@@ -18,6 +18,7 @@ Provides support for shared pointers declared in types.h.
 %shared_ptr(libcellml::AnalyserEquationAst)
 %shared_ptr(libcellml::AnalyserExternalVariable)
 %shared_ptr(libcellml::AnalyserModel)
+%shared_ptr(libcellml::AnalyserReset)
 %shared_ptr(libcellml::AnalyserVariable)
 %shared_ptr(libcellml::Annotator)
 %shared_ptr(libcellml::AnyCellmlElement)
@@ -29,6 +30,7 @@ Provides support for shared pointers declared in types.h.
 %shared_ptr(libcellml::Importer)
 %shared_ptr(libcellml::ImportSource)
 %shared_ptr(libcellml::ImportedEntity)
+%shared_ptr(libcellml::Interpreter)
 %shared_ptr(libcellml::Issue)
 %shared_ptr(libcellml::Logger)
 %shared_ptr(libcellml::Model)
@@ -36,6 +38,7 @@ Provides support for shared pointers declared in types.h.
 %shared_ptr(libcellml::ParentedEntity)
 %shared_ptr(libcellml::Parser)
 %shared_ptr(libcellml::Printer)
+%shared_ptr(libcellml::Profiler)
 %shared_ptr(libcellml::Reset)
 %shared_ptr(libcellml::Strict)
 %shared_ptr(libcellml::UnitsItem)
@@ -169,7 +172,7 @@ Provides support for shared pointers declared in types.h.
   if (!SWIG_IsOK(ecode)) {
     %argument_fail(ecode, "$type", $symname, $argnum);
   } else {
-    if (val < %static_cast($type::C, int) || %static_cast($type::PYTHON, int) < val) {
+    if (val < %static_cast($type::C, int) || %static_cast($type::NUMPY, int) < val) {
       %argument_fail(ecode, "$type is not a valid value for the enumeration.", $symname, $argnum);
     }
     $1 = %static_cast(val, $basetype);
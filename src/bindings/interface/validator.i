@@ -13,6 +13,12 @@
 "Validate the given `model` and its encapsulated entities using the CellML 2.0
 Specification. Any errors will be logged in the `Validator`.";
 
+%feature("docstring") libcellml::Validator::setErrorLimit
+"Sets the number of errors after which validation stops, checking the cheapest things first.";
+
+%feature("docstring") libcellml::Validator::errorLimit
+"Returns the number of errors after which validation stops.";
+
 %{
 #include "libcellml/validator.h"
 %}
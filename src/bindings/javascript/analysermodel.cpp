@@ -48,9 +48,13 @@ EMSCRIPTEN_BINDINGS(libcellml_analysermodel)
         .function("variableCount", &libcellml::AnalyserModel::variableCount)
         .function("variables", &libcellml::AnalyserModel::variables)
         .function("variable", &libcellml::AnalyserModel::variable)
+        .function("analyserVariable", &libcellml::AnalyserModel::analyserVariable)
         .function("equationCount", &libcellml::AnalyserModel::equationCount)
         .function("equations", &libcellml::AnalyserModel::equations)
         .function("equation", &libcellml::AnalyserModel::equation)
+        .function("resetCount", &libcellml::AnalyserModel::resetCount)
+        .function("resets", &libcellml::AnalyserModel::resets)
+        .function("reset", &libcellml::AnalyserModel::reset)
         .function("needEqFunction", &libcellml::AnalyserModel::needEqFunction)
         .function("needNeqFunction", &libcellml::AnalyserModel::needNeqFunction)
         .function("needLtFunction", &libcellml::AnalyserModel::needLtFunction)
@@ -0,0 +1,34 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <emscripten/bind.h>
+
+#include "libcellml/analyserreset.h"
+
+using namespace emscripten;
+
+EMSCRIPTEN_BINDINGS(libcellml_analyserreset)
+{
+    class_<libcellml::AnalyserReset>("AnalyserReset")
+        .smart_ptr<std::shared_ptr<libcellml::AnalyserReset>>("AnalyserReset")
+        .function("reset", &libcellml::AnalyserReset::reset)
+        .function("order", &libcellml::AnalyserReset::order)
+        .function("variable", &libcellml::AnalyserReset::variable)
+        .function("testVariable", &libcellml::AnalyserReset::testVariable)
+        .function("conditionAst", &libcellml::AnalyserReset::conditionAst)
+        .function("resetValueAst", &libcellml::AnalyserReset::resetValueAst)
+    ;
+}
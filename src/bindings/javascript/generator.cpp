@@ -30,6 +30,20 @@ EMSCRIPTEN_BINDINGS(libcellml_generator)
         .function("setProfile", &libcellml::Generator::setProfile)
         .function("model", &libcellml::Generator::model)
         .function("setModel", &libcellml::Generator::setModel)
+        .function("profiler", &libcellml::Generator::profiler)
+        .function("setProfiler", &libcellml::Generator::setProfiler)
+        .function("isJacobianGenerated", &libcellml::Generator::isJacobianGenerated)
+        .function("setJacobianGenerated", &libcellml::Generator::setJacobianGenerated)
+        .function("isJacobianSparsityPatternGenerated", &libcellml::Generator::isJacobianSparsityPatternGenerated)
+        .function("setJacobianSparsityPatternGenerated", &libcellml::Generator::setJacobianSparsityPatternGenerated)
+        .function("isVariablesArraySplit", &libcellml::Generator::isVariablesArraySplit)
+        .function("setVariablesArraySplit", &libcellml::Generator::setVariablesArraySplit)
+        .function("isGatingCoefficientsGenerated", &libcellml::Generator::isGatingCoefficientsGenerated)
+        .function("setGatingCoefficientsGenerated", &libcellml::Generator::setGatingCoefficientsGenerated)
+        .function("isRootFunctionsGenerated", &libcellml::Generator::isRootFunctionsGenerated)
+        .function("setRootFunctionsGenerated", &libcellml::Generator::setRootFunctionsGenerated)
+        .function("isNewtonSolversGenerated", &libcellml::Generator::isNewtonSolversGenerated)
+        .function("setNewtonSolversGenerated", &libcellml::Generator::setNewtonSolversGenerated)
         .function("interfaceCode", &libcellml::Generator::interfaceCode)
         .function("implementationCode", &libcellml::Generator::implementationCode)
         .class_function("equationCode", select_overload<std::string(const libcellml::AnalyserEquationAstPtr &)>(&libcellml::Generator::equationCode))
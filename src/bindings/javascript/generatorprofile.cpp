@@ -26,6 +26,7 @@ EMSCRIPTEN_BINDINGS(libcellml_generatorprofile)
     enum_<libcellml::GeneratorProfile::Profile>("GeneratorProfile.Profile")
         .value("C", libcellml::GeneratorProfile::Profile::C)
         .value("PYTHON", libcellml::GeneratorProfile::Profile::PYTHON)
+        .value("NUMPY", libcellml::GeneratorProfile::Profile::NUMPY)
     ;
 
     class_<libcellml::GeneratorProfile>("GeneratorProfile")
@@ -255,6 +256,18 @@ EMSCRIPTEN_BINDINGS(libcellml_generatorprofile)
         .function("setInterfaceVariableCountString", &libcellml::GeneratorProfile::setInterfaceVariableCountString)
         .function("implementationVariableCountString", &libcellml::GeneratorProfile::implementationVariableCountString)
         .function("setImplementationVariableCountString", &libcellml::GeneratorProfile::setImplementationVariableCountString)
+        .function("interfaceConstantCountString", &libcellml::GeneratorProfile::interfaceConstantCountString)
+        .function("setInterfaceConstantCountString", &libcellml::GeneratorProfile::setInterfaceConstantCountString)
+        .function("implementationConstantCountString", &libcellml::GeneratorProfile::implementationConstantCountString)
+        .function("setImplementationConstantCountString", &libcellml::GeneratorProfile::setImplementationConstantCountString)
+        .function("interfaceComputedConstantCountString", &libcellml::GeneratorProfile::interfaceComputedConstantCountString)
+        .function("setInterfaceComputedConstantCountString", &libcellml::GeneratorProfile::setInterfaceComputedConstantCountString)
+        .function("implementationComputedConstantCountString", &libcellml::GeneratorProfile::implementationComputedConstantCountString)
+        .function("setImplementationComputedConstantCountString", &libcellml::GeneratorProfile::setImplementationComputedConstantCountString)
+        .function("interfaceAlgebraicCountString", &libcellml::GeneratorProfile::interfaceAlgebraicCountString)
+        .function("setInterfaceAlgebraicCountString", &libcellml::GeneratorProfile::setInterfaceAlgebraicCountString)
+        .function("implementationAlgebraicCountString", &libcellml::GeneratorProfile::implementationAlgebraicCountString)
+        .function("setImplementationAlgebraicCountString", &libcellml::GeneratorProfile::setImplementationAlgebraicCountString)
         .function("variableTypeObjectString", &libcellml::GeneratorProfile::variableTypeObjectString)
         .function("setVariableTypeObjectString", &libcellml::GeneratorProfile::setVariableTypeObjectString)
         .function("variableOfIntegrationVariableTypeString", &libcellml::GeneratorProfile::variableOfIntegrationVariableTypeString)
@@ -283,6 +296,18 @@ EMSCRIPTEN_BINDINGS(libcellml_generatorprofile)
         .function("setInterfaceVariableInfoString", &libcellml::GeneratorProfile::setInterfaceVariableInfoString)
         .function("implementationVariableInfoString", &libcellml::GeneratorProfile::implementationVariableInfoString)
         .function("setImplementationVariableInfoString", &libcellml::GeneratorProfile::setImplementationVariableInfoString)
+        .function("interfaceConstantInfoString", &libcellml::GeneratorProfile::interfaceConstantInfoString)
+        .function("setInterfaceConstantInfoString", &libcellml::GeneratorProfile::setInterfaceConstantInfoString)
+        .function("implementationConstantInfoString", &libcellml::GeneratorProfile::implementationConstantInfoString)
+        .function("setImplementationConstantInfoString", &libcellml::GeneratorProfile::setImplementationConstantInfoString)
+        .function("interfaceComputedConstantInfoString", &libcellml::GeneratorProfile::interfaceComputedConstantInfoString)
+        .function("setInterfaceComputedConstantInfoString", &libcellml::GeneratorProfile::setInterfaceComputedConstantInfoString)
+        .function("implementationComputedConstantInfoString", &libcellml::GeneratorProfile::implementationComputedConstantInfoString)
+        .function("setImplementationComputedConstantInfoString", &libcellml::GeneratorProfile::setImplementationComputedConstantInfoString)
+        .function("interfaceAlgebraicInfoString", &libcellml::GeneratorProfile::interfaceAlgebraicInfoString)
+        .function("setInterfaceAlgebraicInfoString", &libcellml::GeneratorProfile::setInterfaceAlgebraicInfoString)
+        .function("implementationAlgebraicInfoString", &libcellml::GeneratorProfile::implementationAlgebraicInfoString)
+        .function("setImplementationAlgebraicInfoString", &libcellml::GeneratorProfile::setImplementationAlgebraicInfoString)
         .function("variableInfoEntryString", &libcellml::GeneratorProfile::variableInfoEntryString)
         .function("setVariableInfoEntryString", &libcellml::GeneratorProfile::setVariableInfoEntryString)
         .function("voiString", &libcellml::GeneratorProfile::voiString)
@@ -293,6 +318,18 @@ EMSCRIPTEN_BINDINGS(libcellml_generatorprofile)
         .function("setRatesArrayString", &libcellml::GeneratorProfile::setRatesArrayString)
         .function("variablesArrayString", &libcellml::GeneratorProfile::variablesArrayString)
         .function("setVariablesArrayString", &libcellml::GeneratorProfile::setVariablesArrayString)
+        .function("constantsArrayString", &libcellml::GeneratorProfile::constantsArrayString)
+        .function("setConstantsArrayString", &libcellml::GeneratorProfile::setConstantsArrayString)
+        .function("computedConstantsArrayString", &libcellml::GeneratorProfile::computedConstantsArrayString)
+        .function("setComputedConstantsArrayString", &libcellml::GeneratorProfile::setComputedConstantsArrayString)
+        .function("algebraicArrayString", &libcellml::GeneratorProfile::algebraicArrayString)
+        .function("setAlgebraicArrayString", &libcellml::GeneratorProfile::setAlgebraicArrayString)
+        .function("variablesParameterString", &libcellml::GeneratorProfile::variablesParameterString)
+        .function("setVariablesParameterString", &libcellml::GeneratorProfile::setVariablesParameterString)
+        .function("variablesMemberString", &libcellml::GeneratorProfile::variablesMemberString)
+        .function("setVariablesMemberString", &libcellml::GeneratorProfile::setVariablesMemberString)
+        .function("variablesDataString", &libcellml::GeneratorProfile::variablesDataString)
+        .function("setVariablesDataString", &libcellml::GeneratorProfile::setVariablesDataString)
         .function("externalVariableMethodTypeDefinitionString", &libcellml::GeneratorProfile::externalVariableMethodTypeDefinitionString)
         .function("setExternalVariableMethodTypeDefinitionString", &libcellml::GeneratorProfile::setExternalVariableMethodTypeDefinitionString)
         .function("externalVariableMethodCallString", &libcellml::GeneratorProfile::externalVariableMethodCallString)
@@ -309,10 +346,48 @@ EMSCRIPTEN_BINDINGS(libcellml_generatorprofile)
         .function("setNlaSolveCallString", &libcellml::GeneratorProfile::setNlaSolveCallString)
         .function("objectiveFunctionMethodString", &libcellml::GeneratorProfile::objectiveFunctionMethodString)
         .function("setObjectiveFunctionMethodString", &libcellml::GeneratorProfile::setObjectiveFunctionMethodString)
+        .function("objectiveJacobianMethodString", &libcellml::GeneratorProfile::objectiveJacobianMethodString)
+        .function("setObjectiveJacobianMethodString", &libcellml::GeneratorProfile::setObjectiveJacobianMethodString)
+        .function("finiteDifferenceObjectiveJacobianMethodString", &libcellml::GeneratorProfile::finiteDifferenceObjectiveJacobianMethodString)
+        .function("setFiniteDifferenceObjectiveJacobianMethodString", &libcellml::GeneratorProfile::setFiniteDifferenceObjectiveJacobianMethodString)
+        .function("newtonSolveCallString", &libcellml::GeneratorProfile::newtonSolveCallString)
+        .function("setNewtonSolveCallString", &libcellml::GeneratorProfile::setNewtonSolveCallString)
         .function("uArrayString", &libcellml::GeneratorProfile::uArrayString)
         .function("setUArrayString", &libcellml::GeneratorProfile::setUArrayString)
         .function("fArrayString", &libcellml::GeneratorProfile::fArrayString)
         .function("setFArrayString", &libcellml::GeneratorProfile::setFArrayString)
+        .function("jacobianArrayString", &libcellml::GeneratorProfile::jacobianArrayString)
+        .function("setJacobianArrayString", &libcellml::GeneratorProfile::setJacobianArrayString)
+        .function("steadyStatesArrayString", &libcellml::GeneratorProfile::steadyStatesArrayString)
+        .function("setSteadyStatesArrayString", &libcellml::GeneratorProfile::setSteadyStatesArrayString)
+        .function("timeConstantsArrayString", &libcellml::GeneratorProfile::timeConstantsArrayString)
+        .function("setTimeConstantsArrayString", &libcellml::GeneratorProfile::setTimeConstantsArrayString)
+        .function("conditionsArrayString", &libcellml::GeneratorProfile::conditionsArrayString)
+        .function("setConditionsArrayString", &libcellml::GeneratorProfile::setConditionsArrayString)
+        .function("eventsArrayString", &libcellml::GeneratorProfile::eventsArrayString)
+        .function("setEventsArrayString", &libcellml::GeneratorProfile::setEventsArrayString)
+        .function("resetValuesArrayString", &libcellml::GeneratorProfile::resetValuesArrayString)
+        .function("setResetValuesArrayString", &libcellml::GeneratorProfile::setResetValuesArrayString)
+        .function("rootFunctionsArrayString", &libcellml::GeneratorProfile::rootFunctionsArrayString)
+        .function("setRootFunctionsArrayString", &libcellml::GeneratorProfile::setRootFunctionsArrayString)
+        .function("interfaceJacobianSparsityPatternString", &libcellml::GeneratorProfile::interfaceJacobianSparsityPatternString)
+        .function("setInterfaceJacobianSparsityPatternString", &libcellml::GeneratorProfile::setInterfaceJacobianSparsityPatternString)
+        .function("implementationJacobianSparsityPatternString", &libcellml::GeneratorProfile::implementationJacobianSparsityPatternString)
+        .function("setImplementationJacobianSparsityPatternString", &libcellml::GeneratorProfile::setImplementationJacobianSparsityPatternString)
+        .function("objectiveJacobianSparsityPatternString", &libcellml::GeneratorProfile::objectiveJacobianSparsityPatternString)
+        .function("setObjectiveJacobianSparsityPatternString", &libcellml::GeneratorProfile::setObjectiveJacobianSparsityPatternString)
+        .function("interfaceGatingStateIndicesString", &libcellml::GeneratorProfile::interfaceGatingStateIndicesString)
+        .function("setInterfaceGatingStateIndicesString", &libcellml::GeneratorProfile::setInterfaceGatingStateIndicesString)
+        .function("implementationGatingStateIndicesString", &libcellml::GeneratorProfile::implementationGatingStateIndicesString)
+        .function("setImplementationGatingStateIndicesString", &libcellml::GeneratorProfile::setImplementationGatingStateIndicesString)
+        .function("interfaceEventCountString", &libcellml::GeneratorProfile::interfaceEventCountString)
+        .function("setInterfaceEventCountString", &libcellml::GeneratorProfile::setInterfaceEventCountString)
+        .function("implementationEventCountString", &libcellml::GeneratorProfile::implementationEventCountString)
+        .function("setImplementationEventCountString", &libcellml::GeneratorProfile::setImplementationEventCountString)
+        .function("interfaceRootFunctionCountString", &libcellml::GeneratorProfile::interfaceRootFunctionCountString)
+        .function("setInterfaceRootFunctionCountString", &libcellml::GeneratorProfile::setInterfaceRootFunctionCountString)
+        .function("implementationRootFunctionCountString", &libcellml::GeneratorProfile::implementationRootFunctionCountString)
+        .function("setImplementationRootFunctionCountString", &libcellml::GeneratorProfile::setImplementationRootFunctionCountString)
         .function("interfaceCreateStatesArrayMethodString", &libcellml::GeneratorProfile::interfaceCreateStatesArrayMethodString)
         .function("setInterfaceCreateStatesArrayMethodString", &libcellml::GeneratorProfile::setInterfaceCreateStatesArrayMethodString)
         .function("implementationCreateStatesArrayMethodString", &libcellml::GeneratorProfile::implementationCreateStatesArrayMethodString)
@@ -321,6 +396,18 @@ EMSCRIPTEN_BINDINGS(libcellml_generatorprofile)
         .function("setInterfaceCreateVariablesArrayMethodString", &libcellml::GeneratorProfile::setInterfaceCreateVariablesArrayMethodString)
         .function("implementationCreateVariablesArrayMethodString", &libcellml::GeneratorProfile::implementationCreateVariablesArrayMethodString)
         .function("setImplementationCreateVariablesArrayMethodString", &libcellml::GeneratorProfile::setImplementationCreateVariablesArrayMethodString)
+        .function("interfaceCreateConstantsArrayMethodString", &libcellml::GeneratorProfile::interfaceCreateConstantsArrayMethodString)
+        .function("setInterfaceCreateConstantsArrayMethodString", &libcellml::GeneratorProfile::setInterfaceCreateConstantsArrayMethodString)
+        .function("implementationCreateConstantsArrayMethodString", &libcellml::GeneratorProfile::implementationCreateConstantsArrayMethodString)
+        .function("setImplementationCreateConstantsArrayMethodString", &libcellml::GeneratorProfile::setImplementationCreateConstantsArrayMethodString)
+        .function("interfaceCreateComputedConstantsArrayMethodString", &libcellml::GeneratorProfile::interfaceCreateComputedConstantsArrayMethodString)
+        .function("setInterfaceCreateComputedConstantsArrayMethodString", &libcellml::GeneratorProfile::setInterfaceCreateComputedConstantsArrayMethodString)
+        .function("implementationCreateComputedConstantsArrayMethodString", &libcellml::GeneratorProfile::implementationCreateComputedConstantsArrayMethodString)
+        .function("setImplementationCreateComputedConstantsArrayMethodString", &libcellml::GeneratorProfile::setImplementationCreateComputedConstantsArrayMethodString)
+        .function("interfaceCreateAlgebraicArrayMethodString", &libcellml::GeneratorProfile::interfaceCreateAlgebraicArrayMethodString)
+        .function("setInterfaceCreateAlgebraicArrayMethodString", &libcellml::GeneratorProfile::setInterfaceCreateAlgebraicArrayMethodString)
+        .function("implementationCreateAlgebraicArrayMethodString", &libcellml::GeneratorProfile::implementationCreateAlgebraicArrayMethodString)
+        .function("setImplementationCreateAlgebraicArrayMethodString", &libcellml::GeneratorProfile::setImplementationCreateAlgebraicArrayMethodString)
         .function("interfaceDeleteArrayMethodString", &libcellml::GeneratorProfile::interfaceDeleteArrayMethodString)
         .function("setInterfaceDeleteArrayMethodString", &libcellml::GeneratorProfile::setInterfaceDeleteArrayMethodString)
         .function("implementationDeleteArrayMethodString", &libcellml::GeneratorProfile::implementationDeleteArrayMethodString)
@@ -341,6 +428,26 @@ EMSCRIPTEN_BINDINGS(libcellml_generatorprofile)
         .function("setInterfaceComputeVariablesMethodString", &libcellml::GeneratorProfile::setInterfaceComputeVariablesMethodString)
         .function("implementationComputeVariablesMethodString", &libcellml::GeneratorProfile::implementationComputeVariablesMethodString)
         .function("setImplementationComputeVariablesMethodString", &libcellml::GeneratorProfile::setImplementationComputeVariablesMethodString)
+        .function("interfaceComputeJacobianMethodString", &libcellml::GeneratorProfile::interfaceComputeJacobianMethodString)
+        .function("setInterfaceComputeJacobianMethodString", &libcellml::GeneratorProfile::setInterfaceComputeJacobianMethodString)
+        .function("implementationComputeJacobianMethodString", &libcellml::GeneratorProfile::implementationComputeJacobianMethodString)
+        .function("setImplementationComputeJacobianMethodString", &libcellml::GeneratorProfile::setImplementationComputeJacobianMethodString)
+        .function("interfaceComputeGatingCoefficientsMethodString", &libcellml::GeneratorProfile::interfaceComputeGatingCoefficientsMethodString)
+        .function("setInterfaceComputeGatingCoefficientsMethodString", &libcellml::GeneratorProfile::setInterfaceComputeGatingCoefficientsMethodString)
+        .function("implementationComputeGatingCoefficientsMethodString", &libcellml::GeneratorProfile::implementationComputeGatingCoefficientsMethodString)
+        .function("setImplementationComputeGatingCoefficientsMethodString", &libcellml::GeneratorProfile::setImplementationComputeGatingCoefficientsMethodString)
+        .function("interfaceComputeEventConditionsMethodString", &libcellml::GeneratorProfile::interfaceComputeEventConditionsMethodString)
+        .function("setInterfaceComputeEventConditionsMethodString", &libcellml::GeneratorProfile::setInterfaceComputeEventConditionsMethodString)
+        .function("implementationComputeEventConditionsMethodString", &libcellml::GeneratorProfile::implementationComputeEventConditionsMethodString)
+        .function("setImplementationComputeEventConditionsMethodString", &libcellml::GeneratorProfile::setImplementationComputeEventConditionsMethodString)
+        .function("interfaceApplyResetsMethodString", &libcellml::GeneratorProfile::interfaceApplyResetsMethodString)
+        .function("setInterfaceApplyResetsMethodString", &libcellml::GeneratorProfile::setInterfaceApplyResetsMethodString)
+        .function("implementationApplyResetsMethodString", &libcellml::GeneratorProfile::implementationApplyResetsMethodString)
+        .function("setImplementationApplyResetsMethodString", &libcellml::GeneratorProfile::setImplementationApplyResetsMethodString)
+        .function("interfaceComputeRootFunctionsMethodString", &libcellml::GeneratorProfile::interfaceComputeRootFunctionsMethodString)
+        .function("setInterfaceComputeRootFunctionsMethodString", &libcellml::GeneratorProfile::setInterfaceComputeRootFunctionsMethodString)
+        .function("implementationComputeRootFunctionsMethodString", &libcellml::GeneratorProfile::implementationComputeRootFunctionsMethodString)
+        .function("setImplementationComputeRootFunctionsMethodString", &libcellml::GeneratorProfile::setImplementationComputeRootFunctionsMethodString)
         .function("emptyMethodString", &libcellml::GeneratorProfile::emptyMethodString)
         .function("setEmptyMethodString", &libcellml::GeneratorProfile::setEmptyMethodString)
         .function("indentString", &libcellml::GeneratorProfile::indentString)
@@ -35,6 +35,7 @@ EMSCRIPTEN_BINDINGS(libcellml_issue) {
         .value("ANALYSER_EXTERNAL_VARIABLE_USE_PRIMARY_VARIABLE", libcellml::Issue::ReferenceRule::ANALYSER_EXTERNAL_VARIABLE_USE_PRIMARY_VARIABLE)
         .value("ANALYSER_EXTERNAL_VARIABLE_VOI", libcellml::Issue::ReferenceRule::ANALYSER_EXTERNAL_VARIABLE_VOI)
         .value("ANALYSER_ODE_NOT_FIRST_ORDER", libcellml::Issue::ReferenceRule::ANALYSER_ODE_NOT_FIRST_ORDER)
+        .value("ANALYSER_RESET_VARIABLE_NOT_STATE", libcellml::Issue::ReferenceRule::ANALYSER_RESET_VARIABLE_NOT_STATE)
         .value("ANALYSER_STATE_NOT_INITIALISED", libcellml::Issue::ReferenceRule::ANALYSER_STATE_NOT_INITIALISED)
         .value("ANALYSER_STATE_RATE_AS_ALGEBRAIC", libcellml::Issue::ReferenceRule::ANALYSER_STATE_RATE_AS_ALGEBRAIC)
         .value("ANALYSER_UNITS", libcellml::Issue::ReferenceRule::ANALYSER_UNITS)
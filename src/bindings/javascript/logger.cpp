@@ -31,5 +31,9 @@ EMSCRIPTEN_BINDINGS(libcellml_logger)
         .function("warning", &libcellml::Logger::warning)
         .function("messageCount", &libcellml::Logger::messageCount)
         .function("message", &libcellml::Logger::message)
+        .function("setIssueStorageLimit", &libcellml::Logger::setIssueStorageLimit)
+        .function("issueStorageLimit", &libcellml::Logger::issueStorageLimit)
+        .function("setProfiler", &libcellml::Logger::setProfiler)
+        .function("profiler", &libcellml::Logger::profiler)
     ;
 }
@@ -0,0 +1,49 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <emscripten/bind.h>
+
+#include "libcellml/profiler.h"
+
+using namespace emscripten;
+
+EMSCRIPTEN_BINDINGS(libcellml_profiler)
+{
+    enum_<libcellml::Profiler::Phase>("Profiler.Phase")
+        .value("PARSE_MODEL", libcellml::Profiler::Phase::PARSE_MODEL)
+        .value("VALIDATE_MODEL", libcellml::Profiler::Phase::VALIDATE_MODEL)
+        .value("VALIDATE_MATH", libcellml::Profiler::Phase::VALIDATE_MATH)
+        .value("ANALYSE_MODEL", libcellml::Profiler::Phase::ANALYSE_MODEL)
+        .value("ANALYSE_EQUATION_UNITS", libcellml::Profiler::Phase::ANALYSE_EQUATION_UNITS)
+        .value("CHECK_EQUATIONS", libcellml::Profiler::Phase::CHECK_EQUATIONS)
+        .value("RESOLVE_IMPORTS", libcellml::Profiler::Phase::RESOLVE_IMPORTS)
+        .value("FETCH_MODEL", libcellml::Profiler::Phase::FETCH_MODEL)
+        .value("FLATTEN_MODEL", libcellml::Profiler::Phase::FLATTEN_MODEL)
+        .value("PRINT_MODEL", libcellml::Profiler::Phase::PRINT_MODEL)
+        .value("GENERATE_INTERFACE_CODE", libcellml::Profiler::Phase::GENERATE_INTERFACE_CODE)
+        .value("GENERATE_IMPLEMENTATION_CODE", libcellml::Profiler::Phase::GENERATE_IMPLEMENTATION_CODE)
+        .value("ADD_NLA_SYSTEMS_CODE", libcellml::Profiler::Phase::ADD_NLA_SYSTEMS_CODE)
+    ;
+
+    class_<libcellml::Profiler>("Profiler")
+        .smart_ptr_constructor("Profiler", &libcellml::Profiler::create)
+        .function("callCount", &libcellml::Profiler::callCount)
+        .function("elapsedTime", &libcellml::Profiler::elapsedTime)
+        .function("allocationCount", &libcellml::Profiler::allocationCount)
+        .function("reset", &libcellml::Profiler::reset)
+        .class_function("phaseAsString", &libcellml::Profiler::phaseAsString)
+    ;
+}
@@ -22,11 +22,13 @@ using namespace emscripten;
 
 EMSCRIPTEN_BINDINGS(libcellml_types)
 {
+    register_vector<double>("VectorDouble");
     register_vector<std::string>("VectorString");
     register_vector<libcellml::AnyCellmlElementPtr>("VectorAnyCellmlElementPtr");
     register_vector<libcellml::VariablePtr>("VectorVariablePtr");
     register_vector<libcellml::AnalyserVariablePtr>("VectorAnalyserVariablePtr");
     register_vector<libcellml::AnalyserEquationPtr>("VectorAnalyserEquation");
+    register_vector<libcellml::AnalyserResetPtr>("VectorAnalyserReset");
 
     class_<libcellml::UnitsItem>("UnitsItem")
         .smart_ptr_constructor("UnitsItem", select_overload<libcellml::UnitsItemPtr(const libcellml::UnitsPtr &, size_t)>(&libcellml::UnitsItem::create))
@@ -25,5 +25,7 @@ EMSCRIPTEN_BINDINGS(libcellml_validator) {
     class_<libcellml::Validator, base<libcellml::Logger>>("Validator")
         .smart_ptr_constructor("Validator", &libcellml::Validator::create)
         .function("validateModel", &libcellml::Validator::validateModel)
+        .function("setErrorLimit", &libcellml::Validator::setErrorLimit)
+        .function("errorLimit", &libcellml::Validator::errorLimit)
     ;
 }
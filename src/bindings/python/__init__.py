@@ -14,6 +14,7 @@ from libcellml.analyserequation import AnalyserEquation
 from libcellml.analyserequationast import AnalyserEquationAst
 from libcellml.analyserexternalvariable import AnalyserExternalVariable
 from libcellml.analysermodel import AnalyserModel
+from libcellml.analyserreset import AnalyserReset
 from libcellml.analyservariable import AnalyserVariable
 from libcellml.annotator import Annotator
 from libcellml.component import Component
@@ -22,10 +23,12 @@ from libcellml.generator import Generator
 from libcellml.generatorprofile import GeneratorProfile
 from libcellml.importer import Importer
 from libcellml.importsource import ImportSource
+from libcellml.interpreter import Interpreter
 from libcellml.issue import Issue
 from libcellml.model import Model
 from libcellml.parser import Parser
 from libcellml.printer import Printer
+from libcellml.profiler import Profiler
 from libcellml.reset import Reset
 from libcellml.types import UnitsItem, VariablePair, AnyCellmlElement
 from libcellml.units import Units
@@ -175,6 +178,7 @@ convert(AnalyserVariable, 'Type', [
 convert(GeneratorProfile, 'Profile', [
     'C',
     'PYTHON',
+    'NUMPY',
 ])
 convert(Issue, 'Cause', [
     'COMPONENT',
@@ -321,6 +325,7 @@ convert(Issue, 'ReferenceRule', [
     'ANALYSER_EXTERNAL_VARIABLE_DIFFERENT_MODEL',
     'ANALYSER_EXTERNAL_VARIABLE_VOI',
     'ANALYSER_EXTERNAL_VARIABLE_USE_PRIMARY_VARIABLE',
+    'ANALYSER_RESET_VARIABLE_NOT_STATE',
     'ANNOTATOR_ID_NOT_FOUND',
     'ANNOTATOR_ID_NOT_UNIQUE',
     'ANNOTATOR_NO_MODEL',
@@ -328,6 +333,21 @@ convert(Issue, 'ReferenceRule', [
     'ANNOTATOR_NULL_MODEL',
     'UNSPECIFIED'
 ])
+convert(Profiler, 'Phase', [
+    'PARSE_MODEL',
+    'VALIDATE_MODEL',
+    'VALIDATE_MATH',
+    'ANALYSE_MODEL',
+    'ANALYSE_EQUATION_UNITS',
+    'CHECK_EQUATIONS',
+    'RESOLVE_IMPORTS',
+    'FETCH_MODEL',
+    'FLATTEN_MODEL',
+    'PRINT_MODEL',
+    'GENERATE_INTERFACE_CODE',
+    'GENERATE_IMPLEMENTATION_CODE',
+    'ADD_NLA_SYSTEMS_CODE',
+])
 convert(Units, 'Prefix', [
     'YOTTA',
     'ZETTA',
@@ -37,6 +37,10 @@ namespace libcellml {
 
 std::vector<VariablePtr>::const_iterator Component::ComponentImpl::findVariable(const std::string &name) const
 {
+    if (mVariableNames->count(name) == 0) {
+        return mVariables.end();
+    }
+
     return std::find_if(mVariables.begin(), mVariables.end(),
                         [=](const VariablePtr &v) -> bool { return v->name() == name; });
 }
@@ -47,6 +51,21 @@ std::vector<VariablePtr>::const_iterator Component::ComponentImpl::findVariable(
                         [=](const VariablePtr &v) -> bool { return v->equals(variable); });
 }
 
+VariablePtr Component::ComponentImpl::lookupVariable(const std::string &name) const
+{
+    auto variable = mVariableNames->unique(name);
+    if (variable != nullptr) {
+        return static_cast<Variable *>(variable)->shared_from_this();
+    }
+
+    auto result = findVariable(name);
+    if (result != mVariables.end()) {
+        return *result;
+    }
+
+    return nullptr;
+}
+
 std::vector<ResetPtr>::const_iterator Component::ComponentImpl::findReset(const ResetPtr &reset) const
 {
     return std::find_if(mResets.begin(), mResets.end(),
@@ -186,22 +205,22 @@ void Component::setSourceComponent(ImportSourcePtr &importSource, const std::str
 
 void Component::appendMath(const std::string &math)
 {
-    pFunc()->mMath.append(math);
+    pFunc()->mMath.write().append(math);
 }
 
 std::string Component::math() const
 {
-    return pFunc()->mMath;
+    return pFunc()->mMath.read();
 }
 
 void Component::setMath(const std::string &math)
 {
-    pFunc()->mMath = math;
+    pFunc()->mMath.assign(math);
 }
 
 void Component::removeMath()
 {
-    pFunc()->mMath.clear();
+    pFunc()->mMath.reset();
 }
 
 bool Component::addVariable(const VariablePtr &variable)
@@ -219,7 +238,9 @@ bool Component::addVariable(const VariablePtr &variable)
     }
 
     variable->pFunc()->setParent(thisComponent);
+    variable->pFunc()->mNameIndex = pFunc()->mVariableNames;
     pFunc()->mVariables.push_back(variable);
+    pFunc()->mVariableNames->add(variable.get(), variable->name());
     return true;
 }
 
@@ -228,6 +249,7 @@ bool Component::removeVariable(size_t index)
     if (index < pFunc()->mVariables.size()) {
         auto variable = pFunc()->mVariables[index];
         pFunc()->mVariables.erase(pFunc()->mVariables.begin() + ptrdiff_t(index));
+        pFunc()->mVariableNames->remove(variable.get(), variable->name());
         variable->pFunc()->removeParent();
         return true;
     }
@@ -240,6 +262,7 @@ bool Component::removeVariable(const std::string &name)
     auto result = pFunc()->findVariable(name);
     if (result != pFunc()->mVariables.end()) {
         (*result)->pFunc()->removeParent();
+        pFunc()->mVariableNames->remove(result->get(), name);
         pFunc()->mVariables.erase(result);
         return true;
     }
@@ -251,6 +274,7 @@ bool Component::removeVariable(const VariablePtr &variable)
 {
     auto result = pFunc()->findVariable(variable);
     if (result != pFunc()->mVariables.end()) {
+        pFunc()->mVariableNames->remove(result->get(), (*result)->name());
         pFunc()->mVariables.erase(result);
         variable->pFunc()->removeParent();
         return true;
@@ -265,6 +289,7 @@ void Component::removeAllVariables()
         variable->pFunc()->removeParent();
     }
     pFunc()->mVariables.clear();
+    pFunc()->mVariableNames->clear();
 }
 
 VariablePtr Component::variable(size_t index) const
@@ -278,12 +303,7 @@ VariablePtr Component::variable(size_t index) const
 
 VariablePtr Component::variable(const std::string &name) const
 {
-    auto result = pFunc()->findVariable(name);
-    if (result != pFunc()->mVariables.end()) {
-        return *result;
-    }
-
-    return nullptr;
+    return pFunc()->lookupVariable(name);
 }
 
 VariablePtr Component::takeVariable(size_t index)
@@ -317,7 +337,7 @@ bool Component::hasVariable(const VariablePtr &variable) const
 
 bool Component::hasVariable(const std::string &name) const
 {
-    return pFunc()->findVariable(name) != pFunc()->mVariables.end();
+    return pFunc()->mVariableNames->count(name) != 0;
 }
 
 bool Component::addReset(const ResetPtr &reset)
@@ -404,7 +424,7 @@ ComponentPtr Component::clone() const
 
     c->setId(id());
     c->setName(name());
-    c->setMath(math());
+    c->pFunc()->mMath.share(pFunc()->mMath);
 
     if (isImport()) {
         c->setImportSource(importSource());
@@ -475,7 +495,7 @@ bool Component::doEquals(const EntityPtr &other) const
 {
     if (ComponentEntity::doEquals(other)) {
         auto component = std::dynamic_pointer_cast<Component>(other);
-        return (component != nullptr) && areEqual(pFunc()->mMath, component->math())
+        return (component != nullptr) && areEqual(pFunc()->mMath.read(), component->math())
                && pFunc()->equalResets(component) && pFunc()->equalVariables(component)
                && ImportedEntity::doEquals(component);
     }
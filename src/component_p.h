@@ -34,14 +34,28 @@ class Component::ComponentImpl: public ComponentEntityImpl
 {
 public:
     Component *mComponent = nullptr;
-    std::string mMath;
+    CopyOnWrite<std::string> mMath; /**< The MathML string, shared with clones until written. */
     std::vector<ResetPtr> mResets;
     std::vector<VariablePtr> mVariables;
+    NameIndexPtr mVariableNames = std::make_shared<NameIndex>(); /**< Name index of the variables in mVariables. */
 
     std::vector<ResetPtr>::const_iterator findReset(const ResetPtr &reset) const;
     std::vector<VariablePtr>::const_iterator findVariable(const std::string &name) const;
     std::vector<VariablePtr>::const_iterator findVariable(const VariablePtr &variable) const;
 
+    /**
+     * @brief Look up the variable with the given @p name.
+     *
+     * Look up the variable with the given @p name using the name index.  If
+     * more than one variable has the given @p name then the first one is
+     * returned.
+     *
+     * @param name The name of the variable to look up.
+     *
+     * @return The variable with the given @p name, @c nullptr if there is none.
+     */
+    VariablePtr lookupVariable(const std::string &name) const;
+
     bool equalVariables(const ComponentPtr &other) const;
     bool equalResets(const ComponentPtr &other) const;
 
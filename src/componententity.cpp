@@ -31,6 +31,10 @@ namespace libcellml {
 
 std::vector<ComponentPtr>::const_iterator ComponentEntity::ComponentEntityImpl::findComponent(const std::string &name) const
 {
+    if (mComponentNames->count(name) == 0) {
+        return mComponents.end();
+    }
+
     return std::find_if(mComponents.begin(), mComponents.end(),
                         [=](const ComponentPtr &c) -> bool { return c->name() == name; });
 }
@@ -41,6 +45,21 @@ std::vector<ComponentPtr>::const_iterator ComponentEntity::ComponentEntityImpl::
                         [=](const ComponentPtr &c) -> bool { return c->equals(component); });
 }
 
+ComponentPtr ComponentEntity::ComponentEntityImpl::lookupComponent(const std::string &name) const
+{
+    auto component = mComponentNames->unique(name);
+    if (component != nullptr) {
+        return static_cast<Component *>(component)->shared_from_this();
+    }
+
+    auto result = findComponent(name);
+    if (result != mComponents.end()) {
+        return *result;
+    }
+
+    return nullptr;
+}
+
 ComponentEntity::ComponentEntityImpl *ComponentEntity::pFunc()
 {
     return reinterpret_cast<ComponentEntity::ComponentEntityImpl *>(Entity::pFunc());
@@ -68,6 +87,8 @@ bool ComponentEntity::addComponent(const ComponentPtr &component)
 bool ComponentEntity::doAddComponent(const ComponentPtr &component)
 {
     pFunc()->mComponents.push_back(component);
+    pFunc()->mComponentNames->add(component.get(), component->name());
+    component->pFunc()->mNameIndex = pFunc()->mComponentNames;
     return true;
 }
 
@@ -77,6 +98,7 @@ bool ComponentEntity::removeComponent(const std::string &name, bool searchEncaps
     auto result = pFunc()->findComponent(name);
     if (result != pFunc()->mComponents.end()) {
         (*result)->pFunc()->removeParent();
+        pFunc()->mComponentNames->remove(result->get(), name);
         pFunc()->mComponents.erase(result);
         status = true;
     } else if (searchEncapsulated) {
@@ -94,6 +116,7 @@ bool ComponentEntity::removeComponent(size_t index)
     if (index < pFunc()->mComponents.size()) {
         auto component = pFunc()->mComponents[index];
         pFunc()->mComponents.erase(pFunc()->mComponents.begin() + ptrdiff_t(index));
+        pFunc()->mComponentNames->remove(component.get(), component->name());
         component->pFunc()->removeParent();
         status = true;
     }
@@ -107,6 +130,7 @@ bool ComponentEntity::removeComponent(const ComponentPtr &component, bool search
     auto result = pFunc()->findComponent(component);
     if (result != pFunc()->mComponents.end()) {
         component->pFunc()->removeParent();
+        pFunc()->mComponentNames->remove(result->get(), (*result)->name());
         pFunc()->mComponents.erase(result);
         status = true;
     } else if (searchEncapsulated) {
@@ -124,6 +148,7 @@ void ComponentEntity::removeAllComponents()
         component->pFunc()->removeParent();
     }
     pFunc()->mComponents.clear();
+    pFunc()->mComponentNames->clear();
 }
 
 size_t ComponentEntity::componentCount() const
@@ -134,8 +159,7 @@ size_t ComponentEntity::componentCount() const
 bool ComponentEntity::containsComponent(const std::string &name, bool searchEncapsulated) const
 {
     bool status = false;
-    auto result = pFunc()->findComponent(name);
-    if (result != pFunc()->mComponents.end()) {
+    if (pFunc()->mComponentNames->count(name) != 0) {
         status = true;
     } else if (searchEncapsulated) {
         for (size_t i = 0; i < componentCount() && !status; ++i) {
@@ -173,11 +197,8 @@ ComponentPtr ComponentEntity::component(size_t index) const
 
 ComponentPtr ComponentEntity::component(const std::string &name, bool searchEncapsulated) const
 {
-    ComponentPtr foundComponent = nullptr;
-    auto result = pFunc()->findComponent(name);
-    if (result != pFunc()->mComponents.end()) {
-        foundComponent = *result;
-    } else if (searchEncapsulated) {
+    ComponentPtr foundComponent = pFunc()->lookupComponent(name);
+    if ((foundComponent == nullptr) && searchEncapsulated) {
         for (size_t i = 0; i < componentCount() && !foundComponent; ++i) {
             foundComponent = component(i)->component(name, searchEncapsulated);
         }
@@ -192,6 +213,7 @@ ComponentPtr ComponentEntity::takeComponent(size_t index)
     if (index < pFunc()->mComponents.size()) {
         component = pFunc()->mComponents.at(index);
         pFunc()->mComponents.erase(pFunc()->mComponents.begin() + ptrdiff_t(index));
+        pFunc()->mComponentNames->remove(component.get(), component->name());
         component->pFunc()->removeParent();
     }
 
@@ -205,6 +227,7 @@ ComponentPtr ComponentEntity::takeComponent(const std::string &name, bool search
     if (result != pFunc()->mComponents.end()) {
         foundComponent = *result;
         pFunc()->mComponents.erase(result);
+        pFunc()->mComponentNames->remove(foundComponent.get(), name);
         foundComponent->pFunc()->removeParent();
     } else if (searchEncapsulated) {
         for (size_t i = 0; i < componentCount() && !foundComponent; ++i) {
@@ -226,6 +249,8 @@ bool ComponentEntity::replaceComponent(size_t index, const ComponentPtr &newComp
 
     if (removeComponent(index)) {
         pFunc()->mComponents.insert(pFunc()->mComponents.begin() + ptrdiff_t(index), newComponent);
+        pFunc()->mComponentNames->add(newComponent.get(), newComponent->name());
+        newComponent->pFunc()->mNameIndex = pFunc()->mComponentNames;
         newComponent->pFunc()->setParent(parent);
         status = true;
     }
@@ -260,7 +285,10 @@ bool ComponentEntity::replaceComponent(const ComponentPtr &oldComponent, const C
 
 void ComponentEntity::setEncapsulationId(const std::string &id)
 {
-    pFunc()->mEncapsulationId = id;
+    if (pFunc()->mEncapsulationId != id) {
+        pFunc()->mEncapsulationId = id;
+        invalidateIds(this);
+    }
 }
 
 std::string ComponentEntity::encapsulationId() const
@@ -270,7 +298,7 @@ std::string ComponentEntity::encapsulationId() const
 
 void ComponentEntity::removeEncapsulationId()
 {
-    pFunc()->mEncapsulationId = "";
+    setEncapsulationId("");
 }
 
 bool ComponentEntity::doEquals(const EntityPtr &other) const
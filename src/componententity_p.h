@@ -20,6 +20,7 @@ limitations under the License.
 
 #include "libcellml/componententity.h"
 
+#include "internaltypes.h"
 #include "namedentity_p.h"
 
 namespace libcellml {
@@ -35,10 +36,24 @@ class ComponentEntity::ComponentEntityImpl: public NamedEntityImpl
 {
 public:
     std::vector<ComponentPtr> mComponents;
+    NameIndexPtr mComponentNames = std::make_shared<NameIndex>(); /**< Name index of the components in mComponents. */
     std::string mEncapsulationId;
 
     std::vector<ComponentPtr>::const_iterator findComponent(const std::string &name) const;
     std::vector<ComponentPtr>::const_iterator findComponent(const ComponentPtr &component) const;
+
+    /**
+     * @brief Look up the child component with the given @p name.
+     *
+     * Look up the child component with the given @p name using the name
+     * index.  If more than one child component has the given @p name then
+     * the first one is returned.  Encapsulated components are not searched.
+     *
+     * @param name The name of the component to look up.
+     *
+     * @return The component with the given @p name, @c nullptr if there is none.
+     */
+    ComponentPtr lookupComponent(const std::string &name) const;
 };
 
 } // namespace libcellml
@@ -26,5 +26,6 @@ namespace libcellml {
  */
 static const char C_GENERATOR_PROFILE_SHA1[] = "${C_GENERATOR_PROFILE_SHA1_VALUE}";
 static const char PYTHON_GENERATOR_PROFILE_SHA1[] = "${PYTHON_GENERATOR_PROFILE_SHA1_VALUE}";
+static const char NUMPY_GENERATOR_PROFILE_SHA1[] = "${NUMPY_GENERATOR_PROFILE_SHA1_VALUE}";
 
 } // namespace libcellml
@@ -187,31 +187,14 @@ void printStack(const IndexStack &stack)
     Debug() << "]";
 }
 
-void printEquivalenceMap(const EquivalenceMap &map)
+void printVariableCloneMap(const VariableCloneMap &map)
 {
-    Debug() << "Print out of equivalence map";
+    Debug() << "Print out of variable clone map";
     for (const auto &iter : map) {
-        auto key = iter.first;
-        Debug(false) << "key: ";
-        printStack(key);
-        auto vector = iter.second;
-        for (const auto &vectorIt : vector) {
-            Debug(false) << "value: ";
-            printStack(vectorIt);
-        }
-    }
-}
-
-void printEquivalenceMapWithModelInfo(const EquivalenceMap &map, const ModelPtr &model)
-{
-    for (const auto &iter : map) {
-        auto key = iter.first;    Debug(false) << "key: ";
-        printStackWithModelInfo(key, model);
-        auto vector = iter.second;
-        for (const auto &vectorIt : vector) {
-            Debug(false) << "value: ";
-            printStackWithModelInfo(vectorIt, model);
-        }
+        Debug(false) << "original: ";
+        printNamedPath(iter.first);
+        Debug(false) << "clone: ";
+        printNamedPath(iter.second);
     }
 }
 
@@ -99,8 +99,7 @@ void printAstAsTree(const AnalyserEquationAstPtr &ast);
 void printAstAsCode(const AnalyserEquationAstPtr &ast);
 void printComponentMap(const ComponentMap &map);
 void printConnectionMap(const ConnectionMap &map);
-void printEquivalenceMap(const EquivalenceMap &map);
-void printEquivalenceMapWithModelInfo(const EquivalenceMap &map, const ModelPtr &model);
+void printVariableCloneMap(const VariableCloneMap &map);
 void printHistory(const History &history);
 void printHistoryEpoch(const HistoryEpochPtr &historyEpoch);
 void printImportLibrary(const ImportLibrary &importlibrary);
@@ -0,0 +1,798 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "differentiator.h"
+
+#include <algorithm>
+
+#include "libcellml/analyserequation.h"
+#include "libcellml/analysermodel.h"
+#include "libcellml/analyservariable.h"
+
+#include "utilities.h"
+
+#include "libcellml/undefines.h"
+
+namespace libcellml {
+
+static bool isNumber(const AnalyserEquationAstPtr &ast, double &value)
+{
+    return (ast->type() == AnalyserEquationAst::Type::CN)
+           && convertToDouble(ast->value(), value);
+}
+
+static bool isNumberEqualTo(const AnalyserEquationAstPtr &ast, double expectedValue)
+{
+    double value;
+
+    return isNumber(ast, value) && areEqual(value, expectedValue);
+}
+
+static bool isUnaryMinus(const AnalyserEquationAstPtr &ast)
+{
+    return (ast->type() == AnalyserEquationAst::Type::MINUS)
+           && (ast->rightChild() == nullptr);
+}
+
+static bool startsWithMinus(const AnalyserEquationAstPtr &ast)
+{
+    // Determine whether the code generated for the given AST starts with a
+    // minus sign, in which case negating it requires some care to avoid
+    // generating something like "--x".
+
+    double value;
+
+    if (isNumber(ast, value)) {
+        return value < 0.0;
+    }
+
+    if (isUnaryMinus(ast)) {
+        return true;
+    }
+
+    if ((ast->type() == AnalyserEquationAst::Type::TIMES)
+        || (ast->type() == AnalyserEquationAst::Type::DIVIDE)) {
+        return startsWithMinus(ast->leftChild());
+    }
+
+    return false;
+}
+
+Differentiator::Differentiator(const AnalyserModelPtr &model, bool chainRule)
+    : mModel(model)
+    , mChainRule(chainRule)
+{
+}
+
+AnalyserEquationAstPtr Differentiator::derivative(const AnalyserEquationAstPtr &ast,
+                                                  const AnalyserVariablePtr &variable,
+                                                  bool rate)
+{
+    if ((variable != mVariable) || (rate != mRate)) {
+        mVariable = variable;
+        mRate = rate;
+
+        mDerivatives.clear();
+    }
+
+    return differentiate(ast);
+}
+
+AnalyserEquationAstPtr Differentiator::timeConstant(const AnalyserEquationPtr &equation)
+{
+    auto derivative = this->derivative(equation->ast()->rightChild(), equation->variable(0));
+
+    if (derivative == nullptr) {
+        return nullptr;
+    }
+
+    // Negate our derivative, distributing the minus sign over a difference
+    // whose left operand is negated, as is typically the case for a gating
+    // equation (i.e. d(alpha*(1-y)-beta*y)/dy = -alpha-beta).
+
+    AnalyserEquationAstPtr opposite;
+
+    if ((derivative->type() == AnalyserEquationAst::Type::MINUS)
+        && (derivative->rightChild() != nullptr)
+        && isUnaryMinus(derivative->leftChild())) {
+        opposite = plus(derivative->leftChild()->leftChild(), derivative->rightChild());
+    } else {
+        opposite = negate(derivative);
+    }
+
+    return divide(cn(1.0), opposite);
+}
+
+bool Differentiator::isLinearInState(const AnalyserEquationPtr &equation)
+{
+    // An ODE dy/dt = f(y) is linear in its state if df/dy is not zero and
+    // doesn't depend on y.  The derivative of a step function of y is only
+    // valid almost everywhere, so an ODE that relies on one is not linear in
+    // its state (e.g. dy/dt = y+floor(y)).
+
+    if (equation->type() != AnalyserEquation::Type::ODE) {
+        return false;
+    }
+
+    auto state = equation->variable(0);
+
+    mHasStepFunction = false;
+
+    auto derivative = this->derivative(equation->ast()->rightChild(), state);
+
+    if (!mIsSupported || mHasStepFunction || (derivative == nullptr)) {
+        return false;
+    }
+
+    std::vector<AnalyserEquationPtr> checkedEquations;
+
+    return !dependsOnVariable(derivative, state, checkedEquations);
+}
+
+bool Differentiator::dependsOnVariable(const AnalyserEquationAstPtr &ast,
+                                       const AnalyserVariablePtr &variable,
+                                       std::vector<AnalyserEquationPtr> &checkedEquations) const
+{
+    // Determine whether the given AST depends on the given variable, either
+    // directly or through the equations used to compute its algebraic
+    // variables and rates.
+
+    if (ast == nullptr) {
+        return false;
+    }
+
+    auto astType = ast->type();
+
+    if (astType == AnalyserEquationAst::Type::DIFF) {
+        return dependsOnVariable(mModel->analyserVariable(ast->rightChild()->variable())->equation(0),
+                                 variable, checkedEquations);
+    }
+
+    if (astType == AnalyserEquationAst::Type::CI) {
+        auto astVariable = mModel->analyserVariable(ast->variable());
+
+        if (astVariable == variable) {
+            return true;
+        }
+
+        if (astVariable->type() == AnalyserVariable::Type::ALGEBRAIC) {
+            return dependsOnVariable(astVariable->equation(0), variable, checkedEquations);
+        }
+
+        return false;
+    }
+
+    return dependsOnVariable(ast->leftChild(), variable, checkedEquations)
+           || dependsOnVariable(ast->rightChild(), variable, checkedEquations);
+}
+
+bool Differentiator::dependsOnVariable(const AnalyserEquationPtr &equation,
+                                       const AnalyserVariablePtr &variable,
+                                       std::vector<AnalyserEquationPtr> &checkedEquations) const
+{
+    // Note: an equation that is not an ODE or an algebraic equation (i.e. an
+    //       NLA or an external equation) is assumed to depend on the given
+    //       variable.
+
+    if (std::find(checkedEquations.begin(), checkedEquations.end(), equation) != checkedEquations.end()) {
+        return false;
+    }
+
+    checkedEquations.push_back(equation);
+
+    auto equationType = equation->type();
+
+    if ((equationType != AnalyserEquation::Type::ODE)
+        && (equationType != AnalyserEquation::Type::ALGEBRAIC)) {
+        return true;
+    }
+
+    return dependsOnVariable(equation->ast()->rightChild(), variable, checkedEquations);
+}
+
+bool Differentiator::isSupported() const
+{
+    return mIsSupported;
+}
+
+bool Differentiator::needLtFunction() const
+{
+    return mNeedLtFunction;
+}
+
+AnalyserEquationAstPtr Differentiator::variableDerivative(const AnalyserVariablePtr &variable,
+                                                          bool rate)
+{
+    if ((variable == mVariable) && (rate == mRate)) {
+        return cn(1.0);
+    }
+
+    if (!mChainRule) {
+        return nullptr;
+    }
+
+    // Differentiate the variable through its defining equation, if it is a
+    // rate or an algebraic variable. Variables that are computed using an NLA
+    // system or that are external cannot be differentiated through, while
+    // other states, constants, computed constants and the variable of
+    // integration don't depend on mVariable.
+
+    auto type = variable->type();
+
+    if (type == AnalyserVariable::Type::EXTERNAL) {
+        mIsSupported = false;
+
+        return nullptr;
+    }
+
+    if (((type == AnalyserVariable::Type::STATE) && rate)
+        || (type == AnalyserVariable::Type::ALGEBRAIC)) {
+        auto key = std::make_pair(variable, rate);
+        auto derivative = mDerivatives.find(key);
+
+        if (derivative != mDerivatives.end()) {
+            return derivative->second;
+        }
+
+        AnalyserEquationAstPtr res;
+        auto equation = variable->equation(0);
+        auto equationType = equation->type();
+
+        if ((equationType == AnalyserEquation::Type::ODE)
+            || (equationType == AnalyserEquation::Type::ALGEBRAIC)) {
+            res = differentiate(equation->ast()->rightChild());
+        } else {
+            mIsSupported = false;
+        }
+
+        mDerivatives.emplace(key, res);
+
+        return res;
+    }
+
+    return nullptr;
+}
+
+AnalyserEquationAstPtr Differentiator::differentiate(const AnalyserEquationAstPtr &ast)
+{
+    auto astLeftChild = ast->leftChild();
+    auto astRightChild = ast->rightChild();
+
+    switch (ast->type()) {
+    case AnalyserEquationAst::Type::PLUS:
+        if (astRightChild == nullptr) {
+            return differentiate(astLeftChild);
+        }
+
+        return plus(differentiate(astLeftChild), differentiate(astRightChild));
+    case AnalyserEquationAst::Type::MINUS:
+        if (astRightChild == nullptr) {
+            return negate(differentiate(astLeftChild));
+        }
+
+        return minus(differentiate(astLeftChild), differentiate(astRightChild));
+    case AnalyserEquationAst::Type::TIMES:
+        return plus(times(differentiate(astLeftChild), astRightChild),
+                    times(astLeftChild, differentiate(astRightChild)));
+    case AnalyserEquationAst::Type::DIVIDE: {
+        auto leftDerivative = differentiate(astLeftChild);
+        auto rightDerivative = differentiate(astRightChild);
+
+        if (rightDerivative == nullptr) {
+            return divide(leftDerivative, astRightChild);
+        }
+
+        return divide(minus(times(leftDerivative, astRightChild),
+                            times(astLeftChild, rightDerivative)),
+                      square(astRightChild));
+    }
+    case AnalyserEquationAst::Type::POWER: {
+        auto baseDerivative = differentiate(astLeftChild);
+        auto exponentDerivative = differentiate(astRightChild);
+
+        if (exponentDerivative == nullptr) {
+            double exponent;
+
+            return times(times(astRightChild,
+                               power(astLeftChild, isNumber(astRightChild, exponent) ?
+                                                       cn(exponent - 1.0) :
+                                                       minus(astRightChild, cn(1.0)))),
+                         baseDerivative);
+        }
+
+        return times(ast, plus(times(exponentDerivative, unary(AnalyserEquationAst::Type::LN, astLeftChild)),
+                               divide(times(astRightChild, baseDerivative), astLeftChild)));
+    }
+    case AnalyserEquationAst::Type::ROOT: {
+        if (astRightChild == nullptr) {
+            return divide(differentiate(astLeftChild), times(cn(2.0), ast));
+        }
+
+        auto degree = astLeftChild->leftChild();
+
+        if (differentiate(degree) != nullptr) {
+            mIsSupported = false;
+
+            return nullptr;
+        }
+
+        return divide(times(ast, differentiate(astRightChild)), times(degree, astRightChild));
+    }
+    case AnalyserEquationAst::Type::LOG: {
+        if (astRightChild == nullptr) {
+            return divide(differentiate(astLeftChild),
+                          times(astLeftChild, unary(AnalyserEquationAst::Type::LN, cn(10.0))));
+        }
+
+        auto base = astLeftChild->leftChild();
+
+        if (differentiate(base) != nullptr) {
+            mIsSupported = false;
+
+            return nullptr;
+        }
+
+        return divide(differentiate(astRightChild),
+                      times(astRightChild, unary(AnalyserEquationAst::Type::LN, base)));
+    }
+    case AnalyserEquationAst::Type::MIN:
+    case AnalyserEquationAst::Type::MAX: {
+        auto leftDerivative = differentiate(astLeftChild);
+        auto rightDerivative = differentiate(astRightChild);
+
+        if ((leftDerivative == nullptr) && (rightDerivative == nullptr)) {
+            return nullptr;
+        }
+
+        return (ast->type() == AnalyserEquationAst::Type::MIN) ?
+                   choice(lessThan(astLeftChild, astRightChild), leftDerivative, rightDerivative) :
+                   choice(lessThan(astRightChild, astLeftChild), leftDerivative, rightDerivative);
+    }
+    case AnalyserEquationAst::Type::REM: {
+        // rem(a, b) = a-b*trunc(a/b) and trunc(a/b) = (a-rem(a, b))/b, with
+        // trunc(a/b) having a zero derivative almost everywhere.
+
+        auto leftDerivative = differentiate(astLeftChild);
+        auto rightDerivative = differentiate(astRightChild);
+
+        if ((leftDerivative != nullptr) || (rightDerivative != nullptr)) {
+            mHasStepFunction = true;
+        }
+
+        return minus(leftDerivative,
+                     times(divide(minus(astLeftChild, ast), astRightChild), rightDerivative));
+    }
+    case AnalyserEquationAst::Type::CEILING:
+    case AnalyserEquationAst::Type::FLOOR:
+        // Ceiling and floor have a zero derivative almost everywhere.
+
+        if (differentiate(astLeftChild) != nullptr) {
+            mHasStepFunction = true;
+        }
+
+        return nullptr;
+    case AnalyserEquationAst::Type::DIFF:
+        return variableDerivative(mModel->analyserVariable(astRightChild->variable()), true);
+    case AnalyserEquationAst::Type::PIECEWISE:
+        return piecewiseDerivative(ast);
+    case AnalyserEquationAst::Type::CI:
+        return variableDerivative(mModel->analyserVariable(ast->variable()), false);
+    case AnalyserEquationAst::Type::ABS:
+    case AnalyserEquationAst::Type::EXP:
+    case AnalyserEquationAst::Type::LN:
+    case AnalyserEquationAst::Type::SIN:
+    case AnalyserEquationAst::Type::COS:
+    case AnalyserEquationAst::Type::TAN:
+    case AnalyserEquationAst::Type::SEC:
+    case AnalyserEquationAst::Type::CSC:
+    case AnalyserEquationAst::Type::COT:
+    case AnalyserEquationAst::Type::SINH:
+    case AnalyserEquationAst::Type::COSH:
+    case AnalyserEquationAst::Type::TANH:
+    case AnalyserEquationAst::Type::SECH:
+    case AnalyserEquationAst::Type::CSCH:
+    case AnalyserEquationAst::Type::COTH:
+    case AnalyserEquationAst::Type::ASIN:
+    case AnalyserEquationAst::Type::ACOS:
+    case AnalyserEquationAst::Type::ATAN:
+    case AnalyserEquationAst::Type::ASEC:
+    case AnalyserEquationAst::Type::ACSC:
+    case AnalyserEquationAst::Type::ACOT:
+    case AnalyserEquationAst::Type::ASINH:
+    case AnalyserEquationAst::Type::ACOSH:
+    case AnalyserEquationAst::Type::ATANH:
+    case AnalyserEquationAst::Type::ASECH:
+    case AnalyserEquationAst::Type::ACSCH:
+    case AnalyserEquationAst::Type::ACOTH:
+        return functionDerivative(ast);
+    default:
+        // Numbers, constants, as well as relational and logical operators,
+        // have a zero derivative.
+
+        return nullptr;
+    }
+}
+
+AnalyserEquationAstPtr Differentiator::functionDerivative(const AnalyserEquationAstPtr &ast)
+{
+    // Differentiate a one-parameter function using the chain rule, i.e.
+    // (f(u))' = f'(u)*u'. Only functions that are always available in the
+    // generated code are used to express f'(u).
+
+    auto u = ast->leftChild();
+    auto du = differentiate(u);
+
+    if (du == nullptr) {
+        return nullptr;
+    }
+
+    auto one = cn(1.0);
+
+    switch (ast->type()) {
+    case AnalyserEquationAst::Type::ABS:
+        return times(choice(lessThan(u, cn(0.0)), cn(-1.0), one), du);
+    case AnalyserEquationAst::Type::EXP:
+        return times(ast, du);
+    case AnalyserEquationAst::Type::LN:
+        return divide(du, u);
+    case AnalyserEquationAst::Type::SIN:
+        return times(unary(AnalyserEquationAst::Type::COS, u), du);
+    case AnalyserEquationAst::Type::COS:
+        return negate(times(unary(AnalyserEquationAst::Type::SIN, u), du));
+    case AnalyserEquationAst::Type::TAN:
+        return divide(du, square(unary(AnalyserEquationAst::Type::COS, u)));
+    case AnalyserEquationAst::Type::SEC:
+        return times(times(ast, unary(AnalyserEquationAst::Type::TAN, u)), du);
+    case AnalyserEquationAst::Type::CSC:
+        return negate(times(divide(ast, unary(AnalyserEquationAst::Type::TAN, u)), du));
+    case AnalyserEquationAst::Type::COT:
+        return negate(divide(du, square(unary(AnalyserEquationAst::Type::SIN, u))));
+    case AnalyserEquationAst::Type::SINH:
+        return times(unary(AnalyserEquationAst::Type::COSH, u), du);
+    case AnalyserEquationAst::Type::COSH:
+        return times(unary(AnalyserEquationAst::Type::SINH, u), du);
+    case AnalyserEquationAst::Type::TANH:
+    case AnalyserEquationAst::Type::COTH:
+        return times(minus(one, square(ast)), du);
+    case AnalyserEquationAst::Type::SECH:
+        return negate(times(times(ast, unary(AnalyserEquationAst::Type::TANH, u)), du));
+    case AnalyserEquationAst::Type::CSCH:
+        return negate(times(divide(ast, unary(AnalyserEquationAst::Type::TANH, u)), du));
+    case AnalyserEquationAst::Type::ASIN:
+        return divide(du, squareRoot(minus(one, square(u))));
+    case AnalyserEquationAst::Type::ACOS:
+        return negate(divide(du, squareRoot(minus(one, square(u)))));
+    case AnalyserEquationAst::Type::ATAN:
+        return divide(du, plus(one, square(u)));
+    case AnalyserEquationAst::Type::ASEC:
+        return divide(du, times(unary(AnalyserEquationAst::Type::ABS, u), squareRoot(minus(square(u), one))));
+    case AnalyserEquationAst::Type::ACSC:
+        return negate(divide(du, times(unary(AnalyserEquationAst::Type::ABS, u), squareRoot(minus(square(u), one)))));
+    case AnalyserEquationAst::Type::ACOT:
+        return negate(divide(du, plus(one, square(u))));
+    case AnalyserEquationAst::Type::ASINH:
+        return divide(du, squareRoot(plus(square(u), one)));
+    case AnalyserEquationAst::Type::ACOSH:
+        return divide(du, squareRoot(minus(square(u), one)));
+    case AnalyserEquationAst::Type::ASECH:
+        return negate(divide(du, times(u, squareRoot(minus(one, square(u))))));
+    case AnalyserEquationAst::Type::ACSCH:
+        return negate(divide(du, times(unary(AnalyserEquationAst::Type::ABS, u), squareRoot(plus(one, square(u))))));
+    default: // AnalyserEquationAst::Type::ATANH and AnalyserEquationAst::Type::ACOTH.
+        return divide(du, minus(one, square(u)));
+    }
+}
+
+AnalyserEquationAstPtr Differentiator::piecewiseDerivative(const AnalyserEquationAstPtr &ast)
+{
+    // Differentiate the value of each piece of a piecewise statement, keeping
+    // its conditions as they are.
+
+    bool isZero = true;
+    auto res = AnalyserEquationAst::create();
+
+    res->setType(AnalyserEquationAst::Type::PIECEWISE);
+
+    for (const auto &child : {ast->leftChild(), ast->rightChild()}) {
+        if (child == nullptr) {
+            continue;
+        }
+
+        AnalyserEquationAstPtr childDerivative;
+
+        if (child->type() == AnalyserEquationAst::Type::PIECEWISE) {
+            childDerivative = piecewiseDerivative(child);
+
+            if (childDerivative == nullptr) {
+                childDerivative = cn(0.0);
+            } else {
+                isZero = false;
+            }
+        } else {
+            auto valueDerivative = differentiate(child->leftChild());
+
+            if (valueDerivative == nullptr) {
+                valueDerivative = cn(0.0);
+            } else {
+                isZero = false;
+            }
+
+            childDerivative = unary(child->type(), valueDerivative);
+
+            if (child->type() == AnalyserEquationAst::Type::PIECE) {
+                childDerivative->setRightChild(child->rightChild());
+            }
+        }
+
+        if (child == ast->leftChild()) {
+            res->setLeftChild(childDerivative);
+        } else {
+            res->setRightChild(childDerivative);
+        }
+    }
+
+    return isZero ? nullptr : res;
+}
+
+AnalyserEquationAstPtr Differentiator::cn(double value) const
+{
+    auto res = AnalyserEquationAst::create();
+
+    res->setType(AnalyserEquationAst::Type::CN);
+    res->setValue(convertToString(value));
+
+    return res;
+}
+
+AnalyserEquationAstPtr Differentiator::unary(AnalyserEquationAst::Type type,
+                                             const AnalyserEquationAstPtr &child) const
+{
+    auto res = AnalyserEquationAst::create();
+
+    res->setType(type);
+    res->setLeftChild(child);
+
+    return res;
+}
+
+AnalyserEquationAstPtr Differentiator::binary(AnalyserEquationAst::Type type,
+                                              const AnalyserEquationAstPtr &leftChild,
+                                              const AnalyserEquationAstPtr &rightChild) const
+{
+    auto res = unary(type, leftChild);
+
+    res->setRightChild(rightChild);
+
+    return res;
+}
+
+AnalyserEquationAstPtr Differentiator::plus(const AnalyserEquationAstPtr &left,
+                                            const AnalyserEquationAstPtr &right) const
+{
+    if (left == nullptr) {
+        return right;
+    }
+
+    if (right == nullptr) {
+        return left;
+    }
+
+    double leftValue;
+    double rightValue;
+
+    if (isNumber(left, leftValue) && isNumber(right, rightValue)) {
+        return cn(leftValue + rightValue);
+    }
+
+    if (isUnaryMinus(right)) {
+        return minus(left, right->leftChild());
+    }
+
+    if (isUnaryMinus(left)) {
+        return minus(right, left->leftChild());
+    }
+
+    return binary(AnalyserEquationAst::Type::PLUS, left, right);
+}
+
+AnalyserEquationAstPtr Differentiator::minus(const AnalyserEquationAstPtr &left,
+                                             const AnalyserEquationAstPtr &right) const
+{
+    if (right == nullptr) {
+        return left;
+    }
+
+    if (left == nullptr) {
+        return negate(right);
+    }
+
+    double leftValue;
+    double rightValue;
+
+    if (isNumber(left, leftValue) && isNumber(right, rightValue)) {
+        return cn(leftValue - rightValue);
+    }
+
+    if (isUnaryMinus(right)) {
+        return plus(left, right->leftChild());
+    }
+
+    return binary(AnalyserEquationAst::Type::MINUS, left, right);
+}
+
+AnalyserEquationAstPtr Differentiator::negate(const AnalyserEquationAstPtr &ast) const
+{
+    if (ast == nullptr) {
+        return nullptr;
+    }
+
+    double value;
+
+    if (isNumber(ast, value)) {
+        return cn(-value);
+    }
+
+    if (isUnaryMinus(ast)) {
+        return ast->leftChild();
+    }
+
+    if ((ast->type() == AnalyserEquationAst::Type::PLUS)
+        && (ast->rightChild() == nullptr)) {
+        return negate(ast->leftChild());
+    }
+
+    if (startsWithMinus(ast)) {
+        // We have a product or a quotient which left operand starts with a
+        // minus sign, so negate that operand instead.
+
+        return binary(ast->type(), negate(ast->leftChild()), ast->rightChild());
+    }
+
+    return unary(AnalyserEquationAst::Type::MINUS, ast);
+}
+
+AnalyserEquationAstPtr Differentiator::times(const AnalyserEquationAstPtr &left,
+                                             const AnalyserEquationAstPtr &right) const
+{
+    if ((left == nullptr) || (right == nullptr)) {
+        return nullptr;
+    }
+
+    double leftValue;
+    double rightValue;
+    auto leftIsNumber = isNumber(left, leftValue);
+    auto rightIsNumber = isNumber(right, rightValue);
+
+    if (leftIsNumber && rightIsNumber) {
+        return cn(leftValue * rightValue);
+    }
+
+    if (rightIsNumber) {
+        return times(right, left);
+    }
+
+    if (leftIsNumber && areEqual(leftValue, 0.0)) {
+        return nullptr;
+    }
+
+    if (leftIsNumber && areEqual(leftValue, 1.0)) {
+        return right;
+    }
+
+    if (leftIsNumber && areEqual(leftValue, -1.0)) {
+        return negate(right);
+    }
+
+    if ((right->type() == AnalyserEquationAst::Type::TIMES)
+        && isNumber(right->leftChild(), rightValue)) {
+        // Gather numbers on the left, e.g. 2*(3*x) = 6*x and x*(3*y) = 3*(x*y).
+
+        return leftIsNumber ?
+                   times(cn(leftValue * rightValue), right->rightChild()) :
+                   times(right->leftChild(), times(left, right->rightChild()));
+    }
+
+    if ((left->type() == AnalyserEquationAst::Type::TIMES)
+        && isNumber(left->leftChild(), leftValue)) {
+        // (2*x)*y = 2*(x*y).
+
+        return times(left->leftChild(), times(left->rightChild(), right));
+    }
+
+    if (isUnaryMinus(left)) {
+        return negate(times(left->leftChild(), right));
+    }
+
+    if (isUnaryMinus(right)) {
+        return negate(times(left, right->leftChild()));
+    }
+
+    return binary(AnalyserEquationAst::Type::TIMES, left, right);
+}
+
+AnalyserEquationAstPtr Differentiator::divide(const AnalyserEquationAstPtr &left,
+                                              const AnalyserEquationAstPtr &right) const
+{
+    if (left == nullptr) {
+        return nullptr;
+    }
+
+    double leftValue;
+    double rightValue;
+
+    if (isNumber(left, leftValue) && isNumber(right, rightValue)
+        && !areEqual(rightValue, 0.0)) {
+        return cn(leftValue / rightValue);
+    }
+
+    if (isNumberEqualTo(right, 1.0)) {
+        return left;
+    }
+
+    if (isUnaryMinus(left)) {
+        return negate(divide(left->leftChild(), right));
+    }
+
+    if (isUnaryMinus(right)) {
+        return negate(divide(left, right->leftChild()));
+    }
+
+    return binary(AnalyserEquationAst::Type::DIVIDE, left, right);
+}
+
+AnalyserEquationAstPtr Differentiator::power(const AnalyserEquationAstPtr &base,
+                                             const AnalyserEquationAstPtr &exponent) const
+{
+    if (isNumberEqualTo(exponent, 0.0)) {
+        return cn(1.0);
+    }
+
+    if (isNumberEqualTo(exponent, 1.0)) {
+        return base;
+    }
+
+    return binary(AnalyserEquationAst::Type::POWER, base, exponent);
+}
+
+AnalyserEquationAstPtr Differentiator::square(const AnalyserEquationAstPtr &ast) const
+{
+    return times(ast, ast);
+}
+
+AnalyserEquationAstPtr Differentiator::squareRoot(const AnalyserEquationAstPtr &ast) const
+{
+    return unary(AnalyserEquationAst::Type::ROOT, ast);
+}
+
+AnalyserEquationAstPtr Differentiator::lessThan(const AnalyserEquationAstPtr &left,
+                                                const AnalyserEquationAstPtr &right)
+{
+    mNeedLtFunction = true;
+
+    return binary(AnalyserEquationAst::Type::LT, left, right);
+}
+
+AnalyserEquationAstPtr Differentiator::choice(const AnalyserEquationAstPtr &condition,
+                                              const AnalyserEquationAstPtr &ifValue,
+                                              const AnalyserEquationAstPtr &elseValue) const
+{
+    auto piece = binary(AnalyserEquationAst::Type::PIECE, (ifValue != nullptr) ? ifValue : cn(0.0), condition);
+    auto otherwise = unary(AnalyserEquationAst::Type::OTHERWISE, (elseValue != nullptr) ? elseValue : cn(0.0));
+
+    return binary(AnalyserEquationAst::Type::PIECEWISE, piece, otherwise);
+}
+
+} // namespace libcellml
@@ -0,0 +1,184 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "libcellml/analyserequationast.h"
+#include "libcellml/types.h"
+
+namespace libcellml {
+
+/**
+ * @brief The Differentiator class.
+ *
+ * The Differentiator class symbolically differentiates an
+ * @ref AnalyserEquationAst with respect to a state, a rate or an algebraic
+ * variable of an @ref AnalyserModel.  The resulting AST can be turned into code
+ * by the @ref Generator and only relies on mathematical functions that are
+ * always available in generated code.
+ *
+ * A derivative that is identically zero is returned as @c nullptr.  Subtrees
+ * of the original AST are shared by the resulting AST, so the original AST
+ * must outlive it.
+ */
+class Differentiator
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * Create a differentiator for the equations of @p model.  If
+     * @p chainRule is @c true, a variable that is computed using an algebraic
+     * equation, or a rate that is computed using an ODE, is differentiated
+     * through its defining equation.  Otherwise, it is considered to be a
+     * constant, unless it is the variable with respect to which we
+     * differentiate.
+     *
+     * @param model The @ref AnalyserModel the ASTs belong to.
+     * @param chainRule Whether to apply the chain rule through the equations
+     * of @p model.
+     */
+    Differentiator(const AnalyserModelPtr &model, bool chainRule);
+
+    /**
+     * @brief Differentiate an AST.
+     *
+     * Return the derivative of @p ast with respect to @p variable or, if
+     * @p rate is @c true, with respect to the rate of @p variable, which must
+     * then be a state.
+     *
+     * @param ast The @ref AnalyserEquationAst to differentiate.
+     * @param variable The @ref AnalyserVariable with respect to which to
+     * differentiate.
+     * @param rate Whether to differentiate with respect to the rate of
+     * @p variable.
+     *
+     * @return The derivative, or @c nullptr if it is zero.
+     */
+    AnalyserEquationAstPtr derivative(const AnalyserEquationAstPtr &ast,
+                                      const AnalyserVariablePtr &variable,
+                                      bool rate = false);
+
+    /**
+     * @brief Get the time constant of an ODE.
+     *
+     * Return the time constant of @p equation, an ODE dy/dt = f that must be
+     * linear in its state (see @ref AnalyserEquation::isLinearInState), i.e.
+     * -1/(df/dy).
+     *
+     * @param equation The @ref AnalyserEquation for which we want the time
+     * constant.
+     *
+     * @return The time constant, or @c nullptr if the rate of @p equation
+     * doesn't depend on its state.
+     */
+    AnalyserEquationAstPtr timeConstant(const AnalyserEquationPtr &equation);
+
+    /**
+     * @brief Test if an ODE is linear in its state.
+     *
+     * Test if @p equation is an ODE dy/dt = f where df/dy is not zero and
+     * doesn't depend on y (see @ref AnalyserEquation::isLinearInState).  The
+     * differentiator must apply the chain rule.
+     *
+     * @param equation The @ref AnalyserEquation to test.
+     *
+     * @return @c true if @p equation is linear in its state, @c false
+     * otherwise.
+     */
+    bool isLinearInState(const AnalyserEquationPtr &equation);
+
+    /**
+     * @brief Test if all the derivatives could be computed.
+     *
+     * Test if all the derivatives computed so far are valid.  A derivative
+     * cannot be computed if it depends, through the chain rule, on a variable
+     * that is computed using an NLA system or that is external, or if the
+     * degree of a root or the base of a logarithm depends on the variable
+     * with respect to which we differentiate.
+     *
+     * @return @c true if all the derivatives are valid, @c false otherwise.
+     */
+    bool isSupported() const;
+
+    /**
+     * @brief Test if the "less than" function is needed.
+     *
+     * Test if any of the derivatives computed so far uses the "less than"
+     * operator, which the @ref Generator may have to provide as a function.
+     *
+     * @return @c true if the "less than" function is needed, @c false
+     * otherwise.
+     */
+    bool needLtFunction() const;
+
+private:
+    AnalyserModelPtr mModel; /**< The model the ASTs belong to. */
+    bool mChainRule; /**< Whether to apply the chain rule through the equations of the model. */
+
+    AnalyserVariablePtr mVariable; /**< The variable with respect to which we currently differentiate. */
+    bool mRate = false; /**< Whether we currently differentiate with respect to the rate of mVariable. */
+    std::map<std::pair<AnalyserVariablePtr, bool>, AnalyserEquationAstPtr> mDerivatives; /**< The derivatives of the variables and rates already differentiated with respect to mVariable. */
+
+    bool mIsSupported = true; /**< Whether all the derivatives are valid. */
+    bool mNeedLtFunction = false; /**< Whether some derivative uses the "less than" operator. */
+    bool mHasStepFunction = false; /**< Whether some derivative involves a step function (i.e. ceiling, floor or rem) of mVariable, which derivative is only valid almost everywhere. */
+
+    bool dependsOnVariable(const AnalyserEquationAstPtr &ast,
+                           const AnalyserVariablePtr &variable,
+                           std::vector<AnalyserEquationPtr> &checkedEquations) const;
+    bool dependsOnVariable(const AnalyserEquationPtr &equation,
+                           const AnalyserVariablePtr &variable,
+                           std::vector<AnalyserEquationPtr> &checkedEquations) const;
+
+    AnalyserEquationAstPtr variableDerivative(const AnalyserVariablePtr &variable,
+                                              bool rate);
+    AnalyserEquationAstPtr differentiate(const AnalyserEquationAstPtr &ast);
+    AnalyserEquationAstPtr functionDerivative(const AnalyserEquationAstPtr &ast);
+    AnalyserEquationAstPtr piecewiseDerivative(const AnalyserEquationAstPtr &ast);
+
+    AnalyserEquationAstPtr cn(double value) const;
+    AnalyserEquationAstPtr unary(AnalyserEquationAst::Type type,
+                                 const AnalyserEquationAstPtr &child) const;
+    AnalyserEquationAstPtr binary(AnalyserEquationAst::Type type,
+                                  const AnalyserEquationAstPtr &leftChild,
+                                  const AnalyserEquationAstPtr &rightChild) const;
+
+    AnalyserEquationAstPtr plus(const AnalyserEquationAstPtr &left,
+                                const AnalyserEquationAstPtr &right) const;
+    AnalyserEquationAstPtr minus(const AnalyserEquationAstPtr &left,
+                                 const AnalyserEquationAstPtr &right) const;
+    AnalyserEquationAstPtr negate(const AnalyserEquationAstPtr &ast) const;
+    AnalyserEquationAstPtr times(const AnalyserEquationAstPtr &left,
+                                 const AnalyserEquationAstPtr &right) const;
+    AnalyserEquationAstPtr divide(const AnalyserEquationAstPtr &left,
+                                  const AnalyserEquationAstPtr &right) const;
+    AnalyserEquationAstPtr power(const AnalyserEquationAstPtr &base,
+                                 const AnalyserEquationAstPtr &exponent) const;
+    AnalyserEquationAstPtr square(const AnalyserEquationAstPtr &ast) const;
+    AnalyserEquationAstPtr squareRoot(const AnalyserEquationAstPtr &ast) const;
+    AnalyserEquationAstPtr lessThan(const AnalyserEquationAstPtr &left,
+                                    const AnalyserEquationAstPtr &right);
+    AnalyserEquationAstPtr choice(const AnalyserEquationAstPtr &condition,
+                                  const AnalyserEquationAstPtr &ifValue,
+                                  const AnalyserEquationAstPtr &elseValue) const;
+};
+
+} // namespace libcellml
@@ -18,11 +18,80 @@ limitations under the License.
 
 #include <utility>
 
+#include "libcellml/component.h"
+#include "libcellml/model.h"
+#include "libcellml/reset.h"
+#include "libcellml/units.h"
+#include "libcellml/variable.h"
+
 #include "entity_p.h"
+#include "model_p.h"
+#include "parentedentity_p.h"
 
 namespace libcellml {
 
-using EntityWeakPtr = std::weak_ptr<Entity>; /**< Type definition for weak entity pointer. */
+void invalidateIds(Entity *entity)
+{
+    auto model = ParentedEntity::ParentedEntityImpl::flagIds(dynamic_cast<ParentedEntity *>(entity));
+
+    if (model != nullptr) {
+        model->pFunc()->invalidateIds();
+    }
+}
+
+void invalidateId(Entity *entity, const std::string &oldId)
+{
+    auto model = ParentedEntity::ParentedEntityImpl::flagIds(dynamic_cast<ParentedEntity *>(entity));
+
+    if (model == nullptr) {
+        return;
+    }
+
+    auto component = dynamic_cast<Component *>(entity);
+    auto reset = dynamic_cast<Reset *>(entity);
+    auto units = dynamic_cast<Units *>(entity);
+    auto variable = dynamic_cast<Variable *>(entity);
+    IdChange idChange;
+
+    if (component != nullptr) {
+        idChange.mType = CellmlElementType::COMPONENT;
+        idChange.mEntity = component->shared_from_this();
+    } else if (reset != nullptr) {
+        // A reset doesn't know its shared pointer, but its component does.
+
+        auto resetComponent = std::dynamic_pointer_cast<Component>(reset->parent());
+
+        for (size_t i = 0; i < resetComponent->resetCount(); ++i) {
+            if (resetComponent->reset(i).get() == reset) {
+                idChange.mEntity = resetComponent->reset(i);
+
+                break;
+            }
+        }
+
+        idChange.mType = CellmlElementType::RESET;
+    } else if (units != nullptr) {
+        idChange.mType = CellmlElementType::UNITS;
+        idChange.mEntity = units->shared_from_this();
+    } else if (variable != nullptr) {
+        idChange.mType = CellmlElementType::VARIABLE;
+        idChange.mEntity = variable->shared_from_this();
+    } else {
+        idChange.mType = CellmlElementType::MODEL;
+        idChange.mEntity = model->shared_from_this();
+    }
+
+    if (idChange.mEntity.expired()) {
+        model->pFunc()->invalidateIds();
+
+        return;
+    }
+
+    idChange.mOldId = oldId;
+    idChange.mId = entity->id();
+
+    model->pFunc()->recordIdChange(std::move(idChange));
+}
 
 Entity::Entity(Entity::EntityImpl *derivedPimpl)
     : mPimpl(derivedPimpl)
@@ -33,7 +102,12 @@ Entity::~Entity() = default;
 
 void Entity::setId(const std::string &id)
 {
-    pFunc()->mId = id;
+    if (pFunc()->mId != id) {
+        auto oldId = pFunc()->mId;
+
+        pFunc()->mId = id;
+        invalidateId(this, oldId);
+    }
 }
 
 std::string Entity::id() const
@@ -43,7 +117,7 @@ std::string Entity::id() const
 
 void Entity::removeId()
 {
-    pFunc()->mId = "";
+    setId("");
 }
 
 bool Entity::equals(const EntityPtr &other) const
@@ -16,10 +16,40 @@ limitations under the License.
 
 #pragma once
 
+#include <string>
+
 #include "libcellml/entity.h"
 
 namespace libcellml {
 
+/**
+ * @brief Move to a new revision of the identifiers of the model owning the
+ * given @p entity.
+ *
+ * To be called whenever an identifier of the @p entity, or of one of its
+ * descendants, has changed in a way that cannot be recorded through
+ * invalidateId(), e.g. an identifier that is not the identifier of an entity
+ * or the @p entity getting a new descendant with identifiers.  Nothing is done
+ * if the @p entity is not owned by a model.  The identifiers of import sources
+ * are not tracked since an import source may be shared by several models.
+ *
+ * @param entity The entity which identifiers have changed.
+ */
+void invalidateIds(Entity *entity);
+
+/**
+ * @brief Record that the identifier of the given @p entity has changed.
+ *
+ * Record, in the model owning the @p entity, that the identifier of the
+ * @p entity has changed from @p oldId to its current identifier, so that a
+ * list of the identifiers of the model can be updated in place rather than
+ * rebuilt.  Nothing is done if the @p entity is not owned by a model.
+ *
+ * @param entity The entity which identifier has changed.
+ * @param oldId The previous identifier of the @p entity.
+ */
+void invalidateId(Entity *entity, const std::string &oldId);
+
 /**
  * @brief The Entity::EntityImpl class.
  *
@@ -16,21 +16,25 @@ limitations under the License.
 
 #include "libcellml/generator.h"
 
+#include <algorithm>
 #include <regex>
 #include <sstream>
 
 #include "libcellml/analyserequation.h"
 #include "libcellml/analyserequationast.h"
 #include "libcellml/analysermodel.h"
+#include "libcellml/analyserreset.h"
 #include "libcellml/analyservariable.h"
 #include "libcellml/component.h"
 #include "libcellml/units.h"
 #include "libcellml/version.h"
 
 #include "commonutils.h"
+#include "differentiator.h"
 #include "generator_p.h"
 #include "generatorprofilesha1values.h"
 #include "generatorprofiletools.h"
+#include "profiler_p.h"
 #include "utilities.h"
 
 #include "libcellml/undefines.h"
@@ -40,6 +44,39 @@ namespace libcellml {
 void Generator::GeneratorImpl::reset()
 {
     mCode = {};
+
+    mHasJacobian = false;
+    mJacobianCode = {};
+    mObjectiveJacobianCodes.clear();
+    mJacobianNeedLtFunction = false;
+
+    mGatingStateIndices.clear();
+    mGatingCoefficientsCode = {};
+    mGatingCoefficientsNeedLtFunction = false;
+
+    mRootFunctionAsts.clear();
+
+    // Split our variables, if requested, keeping track of the index of each
+    // variable in its array.
+
+    mConstants.clear();
+    mComputedConstants.clear();
+    mAlgebraic.clear();
+    mVariableIndices.clear();
+
+    if (mVariablesArraySplit) {
+        for (const auto &variable : mModel->variables()) {
+            auto &variables = (variable->type() == AnalyserVariable::Type::CONSTANT) ?
+                                  mConstants :
+                                  (variable->type() == AnalyserVariable::Type::COMPUTED_CONSTANT) ?
+                                  mComputedConstants :
+                                  mAlgebraic;
+
+            mVariableIndices[variable] = variables.size();
+
+            variables.push_back(variable);
+        }
+    }
 }
 
 bool Generator::GeneratorImpl::modelHasOdes() const
@@ -66,53 +103,79 @@ bool Generator::GeneratorImpl::modelHasNlas() const
 
 AnalyserVariablePtr Generator::GeneratorImpl::analyserVariable(const VariablePtr &variable) const
 {
-    // Find and return the analyser variable associated with the given variable.
+    // Return the analyser variable associated with the given variable.
 
-    AnalyserVariablePtr res;
-    auto modelVoi = mModel->voi();
-    VariablePtr modelVoiVariable = (modelVoi != nullptr) ? modelVoi->variable() : nullptr;
+    return mModel->analyserVariable(variable);
+}
 
-    if ((modelVoiVariable != nullptr)
-        && mModel->areEquivalentVariables(variable, modelVoiVariable)) {
-        res = modelVoi;
-    } else {
-        for (const auto &modelState : mModel->states()) {
-            if (mModel->areEquivalentVariables(variable, modelState->variable())) {
-                res = modelState;
+std::string Generator::GeneratorImpl::variablesArrayString(const AnalyserVariablePtr &variable) const
+{
+    // Return the name of the array in which the given (non-state) variable is
+    // stored.
 
-                break;
-            }
-        }
+    if (!mVariablesArraySplit) {
+        return mProfile->variablesArrayString();
+    }
 
-        if (res == nullptr) {
-            // Normally, we would have:
-            //
-            //     for (const auto &modelVariable : mModel->variables()) {
-            //         if (mModel->areEquivalentVariables(variable, modelVariable->variable())) {
-            //             res = modelVariable;
-            //
-            //             break;
-            //         }
-            //     }
-            //
-            // but we always have variables, so llvm-cov will complain that the
-            // false branch of our for loop is never reached. The below code is
-            // a bit more verbose but at least it makes llvm-cov happy.
-
-            auto modelVariables = mModel->variables();
-            auto modelVariable = modelVariables.begin();
-
-            do {
-                if (mModel->areEquivalentVariables(variable, (*modelVariable)->variable())) {
-                    res = *modelVariable;
-                } else {
-                    ++modelVariable;
-                }
-            } while (res == nullptr);
+    switch (variable->type()) {
+    case AnalyserVariable::Type::CONSTANT:
+        return mProfile->constantsArrayString();
+    case AnalyserVariable::Type::COMPUTED_CONSTANT:
+        return mProfile->computedConstantsArrayString();
+    default: // AnalyserVariable::Type::ALGEBRAIC and AnalyserVariable::Type::EXTERNAL.
+        return mProfile->algebraicArrayString();
+    }
+}
+
+size_t Generator::GeneratorImpl::variableIndex(const AnalyserVariablePtr &variable) const
+{
+    // Return the index of the given (non-state) variable in its array.
+
+    return mVariablesArraySplit ?
+               mVariableIndices.at(variable) :
+               variable->index();
+}
+
+std::string Generator::GeneratorImpl::replaceVariablesTags(const std::string &string) const
+{
+    // Replace the tags that stand for our variables array(s), i.e. either the
+    // variables array or the constants, computed constants and algebraic
+    // arrays.  Our default method strings refer to the variables array itself,
+    // so if our variables array is split, we use their version with tags
+    // instead, if it is one of them.
+    // Note: in the data of an objective function, our variables array(s) come
+    //       after the variable of integration, states and rates, if any.
+
+    auto arrayStrings = mVariablesArraySplit ?
+                            std::vector<std::string> {mProfile->constantsArrayString(),
+                                                      mProfile->computedConstantsArrayString(),
+                                                      mProfile->algebraicArrayString()} :
+                            std::vector<std::string> {mProfile->variablesArrayString()};
+    auto separator = mProfile->arrayElementSeparatorString() + " ";
+    size_t dataIndex = modelHasOdes() ? 3 : 0;
+    std::string parametersCode;
+    std::string argumentsCode;
+    std::string membersCode;
+    std::string dataCode;
+
+    for (size_t i = 0; i < arrayStrings.size(); ++i) {
+        if (i != 0) {
+            parametersCode += separator;
+            argumentsCode += separator;
         }
+
+        parametersCode += replaceAll(mProfile->variablesParameterString(), "[ARRAY]", arrayStrings[i]);
+        argumentsCode += arrayStrings[i];
+        membersCode += replaceAll(mProfile->variablesMemberString(), "[ARRAY]", arrayStrings[i]);
+        dataCode += replaceAll(replaceAll(mProfile->variablesDataString(), "[ARRAY]", arrayStrings[i]),
+                               "[INDEX]", convertToString(dataIndex + i));
     }
 
-    return res;
+    return replaceAll(replaceAll(replaceAll(replaceAll(mVariablesArraySplit ? mProfile->variablesTagsString(string) : string,
+                                                       "[VARIABLES_PARAMETERS]", parametersCode),
+                                            "[VARIABLES_ARGUMENTS]", argumentsCode),
+                                 "[VARIABLES_MEMBERS]", membersCode),
+                      "[VARIABLES_DATA]", dataCode);
 }
 
 double Generator::GeneratorImpl::scalingFactor(const VariablePtr &variable) const
@@ -242,7 +305,9 @@ bool Generator::GeneratorImpl::modifiedProfile() const
 
     return (mProfile->profile() == GeneratorProfile::Profile::C) ?
                sha1(profileContents) != C_GENERATOR_PROFILE_SHA1 :
-               sha1(profileContents) != PYTHON_GENERATOR_PROFILE_SHA1;
+               (mProfile->profile() == GeneratorProfile::Profile::PYTHON) ?
+               sha1(profileContents) != PYTHON_GENERATOR_PROFILE_SHA1 :
+               sha1(profileContents) != NUMPY_GENERATOR_PROFILE_SHA1;
 }
 
 std::string Generator::GeneratorImpl::newLineIfNeeded()
@@ -260,7 +325,9 @@ void Generator::GeneratorImpl::addOriginCommentCode()
 
         profileInformation += (mProfile->profile() == GeneratorProfile::Profile::C) ?
                                   "C" :
-                                  "Python";
+                                  (mProfile->profile() == GeneratorProfile::Profile::PYTHON) ?
+                                  "Python" :
+                                  "NumPy";
         profileInformation += " profile of";
 
         mCode += replace(mProfile->commentString(),
@@ -338,8 +405,32 @@ void Generator::GeneratorImpl::addStateAndVariableCountCode(bool interface)
                                                  "[STATE_COUNT]", std::to_string(mModel->stateCount()));
     }
 
-    if ((interface && !mProfile->interfaceVariableCountString().empty())
-        || (!interface && !mProfile->implementationVariableCountString().empty())) {
+    if (mVariablesArraySplit) {
+        if ((interface && !mProfile->interfaceConstantCountString().empty())
+            || (!interface && !mProfile->implementationConstantCountString().empty())) {
+            stateAndVariableCountCode += interface ?
+                                             mProfile->interfaceConstantCountString() :
+                                             replace(mProfile->implementationConstantCountString(),
+                                                     "[CONSTANT_COUNT]", std::to_string(mConstants.size()));
+        }
+
+        if ((interface && !mProfile->interfaceComputedConstantCountString().empty())
+            || (!interface && !mProfile->implementationComputedConstantCountString().empty())) {
+            stateAndVariableCountCode += interface ?
+                                             mProfile->interfaceComputedConstantCountString() :
+                                             replace(mProfile->implementationComputedConstantCountString(),
+                                                     "[COMPUTED_CONSTANT_COUNT]", std::to_string(mComputedConstants.size()));
+        }
+
+        if ((interface && !mProfile->interfaceAlgebraicCountString().empty())
+            || (!interface && !mProfile->implementationAlgebraicCountString().empty())) {
+            stateAndVariableCountCode += interface ?
+                                             mProfile->interfaceAlgebraicCountString() :
+                                             replace(mProfile->implementationAlgebraicCountString(),
+                                                     "[ALGEBRAIC_COUNT]", std::to_string(mAlgebraic.size()));
+        }
+    } else if ((interface && !mProfile->interfaceVariableCountString().empty())
+               || (!interface && !mProfile->implementationVariableCountString().empty())) {
         stateAndVariableCountCode += interface ?
                                          mProfile->interfaceVariableCountString() :
                                          replace(mProfile->implementationVariableCountString(),
@@ -422,7 +513,11 @@ void Generator::GeneratorImpl::addInterfaceVoiStateAndVariableInfoCode()
         interfaceVoiStateAndVariableInfoCode += mProfile->interfaceStateInfoString();
     }
 
-    if (!mProfile->interfaceVariableInfoString().empty()) {
+    if (mVariablesArraySplit) {
+        interfaceVoiStateAndVariableInfoCode += mProfile->interfaceConstantInfoString()
+                                                + mProfile->interfaceComputedConstantInfoString()
+                                                + mProfile->interfaceAlgebraicInfoString();
+    } else if (!mProfile->interfaceVariableInfoString().empty()) {
         interfaceVoiStateAndVariableInfoCode += mProfile->interfaceVariableInfoString();
     }
 
@@ -483,9 +578,10 @@ void Generator::GeneratorImpl::addImplementationStateInfoCode()
     }
 }
 
-void Generator::GeneratorImpl::addImplementationVariableInfoCode()
+void Generator::GeneratorImpl::addImplementationVariableInfoCode(const std::string &variableInfoString,
+                                                                 const std::vector<AnalyserVariablePtr> &variables)
 {
-    if (!mProfile->implementationVariableInfoString().empty()
+    if (!variableInfoString.empty()
         && !mProfile->variableInfoEntryString().empty()
         && !mProfile->arrayElementSeparatorString().empty()
         && !mProfile->variableOfIntegrationVariableTypeString().empty()
@@ -496,7 +592,7 @@ void Generator::GeneratorImpl::addImplementationVariableInfoCode()
         && !mProfile->externalVariableTypeString().empty()) {
         std::string infoElementsCode;
 
-        for (const auto &variable : mModel->variables()) {
+        for (const auto &variable : variables) {
             if (!infoElementsCode.empty()) {
                 infoElementsCode += mProfile->arrayElementSeparatorString() + "\n";
             }
@@ -537,11 +633,22 @@ void Generator::GeneratorImpl::addImplementationVariableInfoCode()
         }
 
         mCode += newLineIfNeeded()
-                 + replace(mProfile->implementationVariableInfoString(),
+                 + replace(variableInfoString,
                            "[CODE]", infoElementsCode);
     }
 }
 
+void Generator::GeneratorImpl::addImplementationVariableInfoCode()
+{
+    if (mVariablesArraySplit) {
+        addImplementationVariableInfoCode(mProfile->implementationConstantInfoString(), mConstants);
+        addImplementationVariableInfoCode(mProfile->implementationComputedConstantInfoString(), mComputedConstants);
+        addImplementationVariableInfoCode(mProfile->implementationAlgebraicInfoString(), mAlgebraic);
+    } else {
+        addImplementationVariableInfoCode(mProfile->implementationVariableInfoString(), mModel->variables());
+    }
+}
+
 void Generator::GeneratorImpl::addArithmeticFunctionsCode()
 {
     if (mModel->needEqFunction() && !mProfile->hasEqOperator()
@@ -556,7 +663,8 @@ void Generator::GeneratorImpl::addArithmeticFunctionsCode()
                  + mProfile->neqFunctionString();
     }
 
-    if (mModel->needLtFunction() && !mProfile->hasLtOperator()
+    if ((mModel->needLtFunction() || mJacobianNeedLtFunction || mGatingCoefficientsNeedLtFunction)
+        && !mProfile->hasLtOperator()
         && !mProfile->ltFunctionString().empty()) {
         mCode += newLineIfNeeded()
                  + mProfile->ltFunctionString();
@@ -701,7 +809,11 @@ void Generator::GeneratorImpl::addInterfaceCreateDeleteArrayMethodsCode()
         interfaceCreateDeleteArraysCode += mProfile->interfaceCreateStatesArrayMethodString();
     }
 
-    if (!mProfile->interfaceCreateVariablesArrayMethodString().empty()) {
+    if (mVariablesArraySplit) {
+        interfaceCreateDeleteArraysCode += mProfile->interfaceCreateConstantsArrayMethodString()
+                                           + mProfile->interfaceCreateComputedConstantsArrayMethodString()
+                                           + mProfile->interfaceCreateAlgebraicArrayMethodString();
+    } else if (!mProfile->interfaceCreateVariablesArrayMethodString().empty()) {
         interfaceCreateDeleteArraysCode += mProfile->interfaceCreateVariablesArrayMethodString();
     }
 
@@ -723,7 +835,7 @@ void Generator::GeneratorImpl::addExternalVariableMethodTypeDefinitionCode()
 
         if (!externalVariableMethodTypeDefinitionString.empty()) {
             mCode += "\n"
-                     + externalVariableMethodTypeDefinitionString;
+                     + replaceVariablesTags(externalVariableMethodTypeDefinitionString);
         }
     }
 }
@@ -739,7 +851,16 @@ void Generator::GeneratorImpl::addImplementationCreateStatesArrayMethodCode()
 
 void Generator::GeneratorImpl::addImplementationCreateVariablesArrayMethodCode()
 {
-    if (!mProfile->implementationCreateVariablesArrayMethodString().empty()) {
+    if (mVariablesArraySplit) {
+        for (const auto &createArrayMethodString : {mProfile->implementationCreateConstantsArrayMethodString(),
+                                                    mProfile->implementationCreateComputedConstantsArrayMethodString(),
+                                                    mProfile->implementationCreateAlgebraicArrayMethodString()}) {
+            if (!createArrayMethodString.empty()) {
+                mCode += newLineIfNeeded()
+                         + createArrayMethodString;
+            }
+        }
+    } else if (!mProfile->implementationCreateVariablesArrayMethodString().empty()) {
         mCode += newLineIfNeeded()
                  + mProfile->implementationCreateVariablesArrayMethodString();
     }
@@ -753,52 +874,679 @@ void Generator::GeneratorImpl::addImplementationDeleteArrayMethodCode()
     }
 }
 
+std::string Generator::GeneratorImpl::generateJacobianEntryCode(size_t index,
+                                                                const AnalyserEquationAstPtr &ast) const
+{
+    return mProfile->indentString()
+           + mProfile->jacobianArrayString() + mProfile->openArrayString() + convertToString(index) + mProfile->closeArrayString()
+           + mProfile->equalityString()
+           + generateCode(ast)
+           + mProfile->commandSeparatorString() + "\n";
+}
+
+void Generator::GeneratorImpl::prepareJacobianCode()
+{
+    // Differentiate our rates with respect to our states and the objective
+    // functions of our NLA systems with respect to their unknowns.
+    // Note: this needs to be done before generating any code since some
+    //       derivatives may need the "less than" function.
+
+    if (!mJacobianGenerated) {
+        return;
+    }
+
+    if (modelHasOdes()) {
+        // Differentiate our rates through the equations they depend on, one
+        // state at a time, so that the derivatives of those equations can be
+        // reused from one rate to another.
+
+        Differentiator differentiator(mModel, true);
+        const auto &states = mModel->states();
+        auto stateCount = states.size();
+        std::vector<std::string> jacobianEntriesCode(stateCount * stateCount);
+        bool isSupported = true;
+
+        for (size_t j = 0; isSupported && (j < stateCount); ++j) {
+            for (size_t i = 0; isSupported && (i < stateCount); ++i) {
+                auto equation = states[i]->equation(0);
+
+                if (equation->type() == AnalyserEquation::Type::ODE) {
+                    auto derivative = differentiator.derivative(equation->ast()->rightChild(), states[j]);
+
+                    if (derivative != nullptr) {
+                        jacobianEntriesCode[i * stateCount + j] = generateJacobianEntryCode(i * stateCount + j, derivative);
+                    }
+
+                    isSupported = differentiator.isSupported();
+                } else {
+                    isSupported = false;
+                }
+            }
+        }
+
+        if (isSupported) {
+            mHasJacobian = true;
+
+            for (const auto &jacobianEntryCode : jacobianEntriesCode) {
+                mJacobianCode += jacobianEntryCode;
+            }
+
+            mJacobianNeedLtFunction = differentiator.needLtFunction();
+        }
+    }
+
+    if (modelHasNlas()) {
+        // Differentiate the objective function of each of our NLA systems
+        // with respect to its unknowns only, the other variables being
+        // constant within the objective function.
+
+        AnalyserEquationSet handledNlaEquations;
+
+        for (const auto &equation : mModel->equations()) {
+            if ((equation->type() == AnalyserEquation::Type::NLA)
+                && (handledNlaEquations.count(equation) == 0)) {
+                Differentiator differentiator(mModel, false);
+                std::vector<AnalyserEquationPtr> nlaEquations {equation};
+                const auto &variables = equation->variables();
+                auto variablesSize = variables.size();
+                std::string objectiveJacobianCode;
+
+                for (size_t i = 0; i < equation->nlaSiblingCount(); ++i) {
+                    nlaEquations.push_back(equation->nlaSibling(i));
+                }
+
+                for (size_t i = 0; i < nlaEquations.size(); ++i) {
+                    for (size_t k = 0; k < variablesSize; ++k) {
+                        auto derivative = differentiator.derivative(nlaEquations[i]->ast(), variables[k],
+                                                                    variables[k]->type() == AnalyserVariable::Type::STATE);
+
+                        if (derivative != nullptr) {
+                            objectiveJacobianCode += generateJacobianEntryCode(i * variablesSize + k, derivative);
+                        }
+                    }
+
+                    handledNlaEquations.insert(nlaEquations[i]);
+                }
+
+                if (differentiator.isSupported()) {
+                    mObjectiveJacobianCodes.emplace(equation->nlaSystemIndex(), objectiveJacobianCode);
+
+                    mJacobianNeedLtFunction = mJacobianNeedLtFunction || differentiator.needLtFunction();
+                }
+            }
+        }
+    }
+}
+
+void Generator::GeneratorImpl::addStateDependencies(const AnalyserEquationAstPtr &ast,
+                                                    std::set<size_t> &stateDependencies,
+                                                    std::map<AnalyserEquationPtr, std::set<size_t>> &equationsStateDependencies) const
+{
+    // Add the states that the given AST depends on, either directly or through
+    // the equations used to compute its algebraic variables and rates.
+
+    if (ast == nullptr) {
+        return;
+    }
+
+    auto astType = ast->type();
+
+    if ((astType == AnalyserEquationAst::Type::CI)
+        || (astType == AnalyserEquationAst::Type::DIFF)) {
+        auto diff = astType == AnalyserEquationAst::Type::DIFF;
+        auto variable = analyserVariable(diff ? ast->rightChild()->variable() : ast->variable());
+        auto variableType = variable->type();
+
+        if ((variableType == AnalyserVariable::Type::STATE) && !diff) {
+            stateDependencies.insert(variable->index());
+        } else if (diff || (variableType == AnalyserVariable::Type::ALGEBRAIC)) {
+            auto equationStateDependencies = this->equationStateDependencies(variable->equation(0), equationsStateDependencies);
+
+            stateDependencies.insert(equationStateDependencies.begin(), equationStateDependencies.end());
+        }
+
+        return;
+    }
+
+    addStateDependencies(ast->leftChild(), stateDependencies, equationsStateDependencies);
+    addStateDependencies(ast->rightChild(), stateDependencies, equationsStateDependencies);
+}
+
+std::set<size_t> Generator::GeneratorImpl::equationStateDependencies(const AnalyserEquationPtr &equation,
+                                                                     std::map<AnalyserEquationPtr, std::set<size_t>> &equationsStateDependencies) const
+{
+    // Return the states that the given equation depends on.
+    // Note: an NLA system is considered as a whole, i.e. all its unknowns
+    //       depend on the states that any of its equations depends on. Its
+    //       equations are therefore registered before being handled, so that
+    //       its own unknowns are not handled again.
+
+    auto equationStateDependencies = equationsStateDependencies.find(equation);
+
+    if (equationStateDependencies != equationsStateDependencies.end()) {
+        return equationStateDependencies->second;
+    }
+
+    std::vector<AnalyserEquationPtr> equations {equation};
+
+    if (equation->type() == AnalyserEquation::Type::NLA) {
+        for (const auto &nlaSibling : equation->nlaSiblings()) {
+            equations.push_back(nlaSibling);
+        }
+    }
+
+    for (const auto &someEquation : equations) {
+        equationsStateDependencies[someEquation] = {};
+    }
+
+    std::set<size_t> res;
+
+    for (const auto &someEquation : equations) {
+        addStateDependencies((someEquation->type() == AnalyserEquation::Type::NLA) ?
+                                 someEquation->ast() :
+                                 someEquation->ast()->rightChild(),
+                             res, equationsStateDependencies);
+    }
+
+    for (const auto &someEquation : equations) {
+        equationsStateDependencies[someEquation] = res;
+    }
+
+    return res;
+}
+
+void Generator::GeneratorImpl::addUnknownDependencies(const AnalyserEquationAstPtr &ast,
+                                                      const std::vector<AnalyserVariablePtr> &unknowns,
+                                                      std::set<size_t> &unknownDependencies) const
+{
+    // Add the (index of the) unknowns of an NLA system that the given AST
+    // directly depends on. An unknown that is a state stands for its rate.
+
+    if (ast == nullptr) {
+        return;
+    }
+
+    auto astType = ast->type();
+
+    if ((astType == AnalyserEquationAst::Type::CI)
+        || (astType == AnalyserEquationAst::Type::DIFF)) {
+        auto diff = astType == AnalyserEquationAst::Type::DIFF;
+        auto variable = analyserVariable(diff ? ast->rightChild()->variable() : ast->variable());
+
+        if (diff || (variable->type() != AnalyserVariable::Type::STATE)) {
+            auto unknown = std::find(unknowns.begin(), unknowns.end(), variable);
+
+            if (unknown != unknowns.end()) {
+                unknownDependencies.insert(size_t(unknown - unknowns.begin()));
+            }
+        }
+
+        return;
+    }
+
+    addUnknownDependencies(ast->leftChild(), unknowns, unknownDependencies);
+    addUnknownDependencies(ast->rightChild(), unknowns, unknownDependencies);
+}
+
+std::string Generator::GeneratorImpl::generateSparsityPatternCode(const std::string &sparsityPatternString,
+                                                                  const std::vector<std::set<size_t>> &rows,
+                                                                  size_t columnCount) const
+{
+    // Generate the sparsity pattern of the matrix which nonzero entries are
+    // given row by row, in both CSR and CSC forms, unless the matrix is empty.
+
+    auto separator = mProfile->arrayElementSeparatorString() + " ";
+    std::vector<std::vector<size_t>> columns(columnCount);
+    std::string rowPointers = "0";
+    std::string columnIndices;
+    size_t nonzeroCount = 0;
+
+    for (size_t i = 0; i < rows.size(); ++i) {
+        for (auto j : rows[i]) {
+            columnIndices += ((nonzeroCount == 0) ? "" : separator) + std::to_string(j);
+
+            columns[j].push_back(i);
+
+            ++nonzeroCount;
+        }
+
+        rowPointers += separator + std::to_string(nonzeroCount);
+    }
+
+    if (nonzeroCount == 0) {
+        return {};
+    }
+
+    std::string columnPointers = "0";
+    std::string rowIndices;
+    size_t rowIndexCount = 0;
+
+    for (const auto &column : columns) {
+        for (auto i : column) {
+            rowIndices += ((rowIndexCount == 0) ? "" : separator) + std::to_string(i);
+
+            ++rowIndexCount;
+        }
+
+        columnPointers += separator + std::to_string(rowIndexCount);
+    }
+
+    return replace(replace(replace(replace(replace(sparsityPatternString,
+                                                   "[NONZERO_COUNT]", std::to_string(nonzeroCount)),
+                                           "[ROW_POINTERS]", rowPointers),
+                                   "[COLUMN_INDICES]", columnIndices),
+                           "[COLUMN_POINTERS]", columnPointers),
+                   "[ROW_INDICES]", rowIndices);
+}
+
+bool Generator::GeneratorImpl::hasNonzeroEntries(const std::vector<std::set<size_t>> &rows) const
+{
+    return std::any_of(rows.begin(), rows.end(), [](const std::set<size_t> &row) {
+        return !row.empty();
+    });
+}
+
+void Generator::GeneratorImpl::addJacobianSparsityPatternCode(bool interface)
+{
+    auto sparsityPatternString = interface ?
+                                     mProfile->interfaceJacobianSparsityPatternString() :
+                                     mProfile->implementationJacobianSparsityPatternString();
+
+    if (mJacobianSparsityPatternGenerated
+        && modelHasOdes()
+        && !sparsityPatternString.empty()
+        && !mProfile->implementationJacobianSparsityPatternString().empty()) {
+        // Determine the states that each rate depends on, i.e. the structure
+        // of the Jacobian of our rates with respect to our states.
+
+        std::map<AnalyserEquationPtr, std::set<size_t>> equationsStateDependencies;
+        std::vector<std::set<size_t>> rows;
+
+        for (const auto &state : mModel->states()) {
+            rows.push_back(equationStateDependencies(state->equation(0), equationsStateDependencies));
+        }
+
+        // The interface is only needed if there is an implementation, i.e. if
+        // the Jacobian has some nonzero entries, but it doesn't need the
+        // implementation itself.
+
+        if (interface) {
+            if (hasNonzeroEntries(rows)) {
+                mCode += newLineIfNeeded()
+                         + sparsityPatternString;
+            }
+        } else {
+            auto sparsityPatternCode = generateSparsityPatternCode(sparsityPatternString, rows, mModel->stateCount());
+
+            if (!sparsityPatternCode.empty()) {
+                mCode += newLineIfNeeded()
+                         + sparsityPatternCode;
+            }
+        }
+    }
+}
+
+void Generator::GeneratorImpl::prepareGatingCoefficientsCode()
+{
+    // Compute the steady state and time constant of the states whose ODE is
+    // linear in the state, i.e. dy/dt = f = (y_inf-y)/tau, with
+    // tau = -1/(df/dy) and y_inf = y+f*tau.
+    // Note: this needs to be done before generating any code since some time
+    //       constants may need the "less than" function.
+
+    if (!mGatingCoefficientsGenerated || !modelHasOdes()) {
+        return;
+    }
+
+    const auto &states = mModel->states();
+
+    for (size_t i = 0; i < states.size(); ++i) {
+        auto equation = states[i]->equation(0);
+
+        if (equation->isLinearInState()) {
+            Differentiator differentiator(mModel, true);
+            auto index = mProfile->openArrayString() + convertToString(i) + mProfile->closeArrayString();
+            auto timeConstantCode = mProfile->timeConstantsArrayString() + index;
+
+            mGatingStateIndices.push_back(i);
+            mGatingCoefficientsCode += mProfile->indentString()
+                                       + timeConstantCode
+                                       + mProfile->equalityString()
+                                       + generateCode(differentiator.timeConstant(equation))
+                                       + mProfile->commandSeparatorString() + "\n"
+                                       + mProfile->indentString()
+                                       + mProfile->steadyStatesArrayString() + index
+                                       + mProfile->equalityString()
+                                       + mProfile->statesArrayString() + index
+                                       + mProfile->plusString()
+                                       + mProfile->ratesArrayString() + index
+                                       + mProfile->timesString()
+                                       + timeConstantCode
+                                       + mProfile->commandSeparatorString() + "\n";
+            mGatingCoefficientsNeedLtFunction = mGatingCoefficientsNeedLtFunction || differentiator.needLtFunction();
+        }
+    }
+}
+
+void Generator::GeneratorImpl::addGatingStateIndicesCode(bool interface)
+{
+    auto gatingStateIndicesString = interface ?
+                                        mProfile->interfaceGatingStateIndicesString() :
+                                        mProfile->implementationGatingStateIndicesString();
+
+    if (!mGatingStateIndices.empty()
+        && !gatingStateIndicesString.empty()) {
+        std::string gatingStateIndices;
+
+        for (auto index : mGatingStateIndices) {
+            gatingStateIndices += (gatingStateIndices.empty() ? "" : mProfile->arrayElementSeparatorString() + " ")
+                                  + convertToString(index);
+        }
+
+        mCode += newLineIfNeeded()
+                 + replace(replace(gatingStateIndicesString,
+                                   "[GATING_STATE_COUNT]", convertToString(mGatingStateIndices.size())),
+                           "[GATING_STATE_INDICES]", gatingStateIndices);
+    }
+}
+
+void Generator::GeneratorImpl::addEventCountCode(bool interface)
+{
+    auto eventCountString = interface ?
+                                mProfile->interfaceEventCountString() :
+                                mProfile->implementationEventCountString();
+
+    if ((mModel->resetCount() != 0)
+        && !eventCountString.empty()) {
+        mCode += newLineIfNeeded()
+                 + replace(eventCountString,
+                           "[EVENT_COUNT]", convertToString(mModel->resetCount()));
+    }
+}
+
+bool Generator::GeneratorImpl::isConstantAst(const AnalyserEquationAstPtr &ast) const
+{
+    // Determine whether the given AST only involves constants and computed
+    // constants, i.e. whether its value can never change during a simulation.
+
+    if (ast == nullptr) {
+        return true;
+    }
+
+    if (ast->type() == AnalyserEquationAst::Type::DIFF) {
+        return false;
+    }
+
+    if (ast->type() == AnalyserEquationAst::Type::CI) {
+        auto analyserVariable = Generator::GeneratorImpl::analyserVariable(ast->variable());
+
+        return (analyserVariable->type() == AnalyserVariable::Type::CONSTANT)
+               || (analyserVariable->type() == AnalyserVariable::Type::COMPUTED_CONSTANT);
+    }
+
+    return isConstantAst(ast->leftChild()) && isConstantAst(ast->rightChild());
+}
+
+void Generator::GeneratorImpl::addRootFunctionAsts(const AnalyserEquationAstPtr &ast, bool condition,
+                                                  std::set<std::string> &rootFunctionCodes)
+{
+    // Add a root function for each relational condition found in the given AST,
+    // i.e. x-y for a condition like x >= y, unless it is constant (and can
+    // therefore never switch) or an identical root function has already been
+    // added.
+
+    if (ast == nullptr) {
+        return;
+    }
+
+    switch (ast->type()) {
+    case AnalyserEquationAst::Type::EQ:
+    case AnalyserEquationAst::Type::NEQ:
+    case AnalyserEquationAst::Type::LT:
+    case AnalyserEquationAst::Type::LEQ:
+    case AnalyserEquationAst::Type::GT:
+    case AnalyserEquationAst::Type::GEQ:
+        if (condition && !isConstantAst(ast)) {
+            auto rootFunctionAst = AnalyserEquationAst::create();
+
+            rootFunctionAst->setType(AnalyserEquationAst::Type::MINUS);
+            rootFunctionAst->setLeftChild(ast->leftChild());
+            rootFunctionAst->setRightChild(ast->rightChild());
+
+            if (rootFunctionCodes.insert(generateCode(rootFunctionAst)).second) {
+                mRootFunctionAsts.push_back(rootFunctionAst);
+            }
+
+            condition = false;
+        }
+
+        break;
+    case AnalyserEquationAst::Type::PIECE:
+        addRootFunctionAsts(ast->leftChild(), false, rootFunctionCodes);
+        addRootFunctionAsts(ast->rightChild(), true, rootFunctionCodes);
+
+        return;
+    default:
+        break;
+    }
+
+    addRootFunctionAsts(ast->leftChild(), condition, rootFunctionCodes);
+    addRootFunctionAsts(ast->rightChild(), condition, rootFunctionCodes);
+}
+
+void Generator::GeneratorImpl::prepareRootFunctionsCode()
+{
+    // Retrieve the root functions of the conditions of the piecewise statements
+    // used in the equations that are computed in the methods to compute our
+    // rates and variables, i.e. not in our constant equations.
+
+    if (!mRootFunctionsGenerated) {
+        return;
+    }
+
+    std::set<std::string> rootFunctionCodes;
+
+    for (const auto &equation : mModel->equations()) {
+        if ((equation->type() == AnalyserEquation::Type::ODE)
+            || (equation->type() == AnalyserEquation::Type::NLA)
+            || (equation->type() == AnalyserEquation::Type::ALGEBRAIC)) {
+            addRootFunctionAsts(equation->ast(), false, rootFunctionCodes);
+        }
+    }
+}
+
+void Generator::GeneratorImpl::addRootFunctionCountCode(bool interface)
+{
+    auto rootFunctionCountString = interface ?
+                                       mProfile->interfaceRootFunctionCountString() :
+                                       mProfile->implementationRootFunctionCountString();
+
+    if (!mRootFunctionAsts.empty()
+        && !rootFunctionCountString.empty()) {
+        mCode += newLineIfNeeded()
+                 + replace(rootFunctionCountString,
+                           "[ROOT_FUNCTION_COUNT]", convertToString(mRootFunctionAsts.size()));
+    }
+}
+
 void Generator::GeneratorImpl::addRootFindingInfoObjectCode()
 {
     if (modelHasNlas()
         && !mProfile->rootFindingInfoObjectString(modelHasOdes()).empty()) {
         mCode += newLineIfNeeded()
-                 + mProfile->rootFindingInfoObjectString(modelHasOdes());
+                 + replaceVariablesTags(mProfile->rootFindingInfoObjectString(modelHasOdes()));
+    }
+}
+
+bool Generator::GeneratorImpl::isNewtonSolverGenerated(const AnalyserEquationPtr &equation) const
+{
+    // Determine whether the root of the NLA system of the given equation is to
+    // be found using a Newton solver rather than the NLA solve method, i.e.
+    // whether the NLA system is small enough and whether we have a way to
+    // compute the Jacobian of its objective function.
+
+    if (!mNewtonSolversGenerated
+        || (equation->variableCount() > MAX_NEWTON_SOLVER_SIZE)
+        || mProfile->newtonSolveCallString(modelHasOdes()).empty()) {
+        return false;
+    }
+
+    return ((mObjectiveJacobianCodes.count(equation->nlaSystemIndex()) != 0)
+            && !mProfile->objectiveJacobianMethodString(modelHasOdes()).empty())
+           || !mProfile->finiteDifferenceObjectiveJacobianMethodString().empty();
+}
+
+bool Generator::GeneratorImpl::modelNeedsNlaSolveMethod() const
+{
+    if (!modelHasNlas()) {
+        return false;
+    }
+
+    for (const auto &equation : mModel->equations()) {
+        if ((equation->type() == AnalyserEquation::Type::NLA)
+            && !isNewtonSolverGenerated(equation)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void Generator::GeneratorImpl::addExternNlaSolveMethodCode()
+{
+    if (modelNeedsNlaSolveMethod()
+        && !mProfile->externNlaSolveMethodString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->externNlaSolveMethodString();
+    }
+}
+
+std::string Generator::GeneratorImpl::generateDeterminantCode(const std::vector<std::vector<std::string>> &matrix) const
+{
+    // Generate the code for the determinant of the given matrix, using a
+    // Laplace expansion along its first row.
+
+    auto size = matrix.size();
+
+    if (size == 1) {
+        return matrix[0][0];
+    }
+
+    std::string res;
+
+    for (size_t j = 0; j < size; ++j) {
+        std::vector<std::vector<std::string>> minor;
+
+        for (size_t i = 1; i < size; ++i) {
+            std::vector<std::string> row;
+
+            for (size_t k = 0; k < size; ++k) {
+                if (k != j) {
+                    row.push_back(matrix[i][k]);
+                }
+            }
+
+            minor.push_back(row);
+        }
+
+        auto minorCode = generateDeterminantCode(minor);
+
+        if (j != 0) {
+            res += (j % 2 == 0) ? mProfile->plusString() : mProfile->minusString();
+        }
+
+        res += matrix[0][j] + mProfile->timesString()
+               + ((size > 2) ? "(" + minorCode + ")" : minorCode);
+    }
+
+    return res;
+}
+
+std::string Generator::GeneratorImpl::generateNewtonStepCode(size_t size) const
+{
+    // Generate the code for a Newton step, i.e. u = u-J^-1*f, with the Newton
+    // direction being computed using Cramer's rule, which is both cheap and
+    // branch-free for the small NLA systems that we handle.
+
+    auto arrayEntry = [&](const std::string &array, size_t index) {
+        return array + mProfile->openArrayString() + convertToString(index) + mProfile->closeArrayString();
+    };
+    std::vector<std::vector<std::string>> jacobian(size, std::vector<std::string>(size));
+
+    for (size_t i = 0; i < size; ++i) {
+        for (size_t j = 0; j < size; ++j) {
+            jacobian[i][j] = arrayEntry(mProfile->jacobianArrayString(), i * size + j);
+        }
+    }
+
+    auto determinantCode = generateDeterminantCode(jacobian);
+    std::string res;
+
+    if (size > 1) {
+        determinantCode = "(" + determinantCode + ")";
     }
-}
 
-void Generator::GeneratorImpl::addExternNlaSolveMethodCode()
-{
-    if (modelHasNlas()
-        && !mProfile->externNlaSolveMethodString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->externNlaSolveMethodString();
+    for (size_t i = 0; i < size; ++i) {
+        auto matrix = jacobian;
+
+        for (size_t j = 0; j < size; ++j) {
+            matrix[j][i] = arrayEntry(mProfile->fArrayString(), j);
+        }
+
+        auto numeratorCode = generateDeterminantCode(matrix);
+
+        if (size > 1) {
+            numeratorCode = "(" + numeratorCode + ")";
+        }
+
+        res += mProfile->indentString() + mProfile->indentString()
+               + arrayEntry(mProfile->uArrayString(), i)
+               + mProfile->equalityString()
+               + arrayEntry(mProfile->uArrayString(), i)
+               + mProfile->minusString() + numeratorCode
+               + mProfile->divideString() + determinantCode
+               + mProfile->commandSeparatorString() + "\n";
     }
+
+    return res;
 }
 
 void Generator::GeneratorImpl::addNlaSystemsCode()
 {
+    ProfilerScope profilerScope(mProfiler, Profiler::Phase::ADD_NLA_SYSTEMS_CODE);
+
     if (modelHasNlas()
         && !mProfile->objectiveFunctionMethodString(modelHasOdes()).empty()
         && !mProfile->findRootMethodString(modelHasOdes()).empty()
         && !mProfile->nlaSolveCallString(modelHasOdes()).empty()) {
-        std::vector<AnalyserEquationPtr> handledNlaEquations;
+        AnalyserEquationSet handledNlaEquations;
 
         for (const auto &equation : mModel->equations()) {
             if ((equation->type() == AnalyserEquation::Type::NLA)
-                && (std::find(handledNlaEquations.begin(), handledNlaEquations.end(), equation) == handledNlaEquations.end())) {
+                && (handledNlaEquations.count(equation) == 0)) {
                 std::string methodBody;
                 auto i = MAX_SIZE_T;
-                auto variables = equation->variables();
+                const auto &variables = equation->variables();
                 auto variablesSize = variables.size();
 
                 for (i = 0; i < variablesSize; ++i) {
-                    auto arrayString = (variables[i]->type() == AnalyserVariable::Type::STATE) ?
+                    auto isState = variables[i]->type() == AnalyserVariable::Type::STATE;
+                    auto arrayString = isState ?
                                            mProfile->ratesArrayString() :
-                                           mProfile->variablesArrayString();
+                                           variablesArrayString(variables[i]);
+                    auto index = isState ?
+                                     variables[i]->index() :
+                                     variableIndex(variables[i]);
 
                     methodBody += mProfile->indentString()
-                                  + arrayString + mProfile->openArrayString() + convertToString(variables[i]->index()) + mProfile->closeArrayString()
+                                  + arrayString + mProfile->openArrayString() + convertToString(index) + mProfile->closeArrayString()
                                   + mProfile->equalityString()
                                   + mProfile->uArrayString() + mProfile->openArrayString() + convertToString(i) + mProfile->closeArrayString()
                                   + mProfile->commandSeparatorString() + "\n";
                 }
 
+                auto unknownsCode = methodBody;
+
                 methodBody += newLineIfNeeded();
 
                 i = MAX_SIZE_T;
@@ -809,59 +1557,120 @@ void Generator::GeneratorImpl::addNlaSystemsCode()
                               + generateCode(equation->ast())
                               + mProfile->commandSeparatorString() + "\n";
 
-                handledNlaEquations.push_back(equation);
+                handledNlaEquations.insert(equation);
+
+                for (size_t j = 0; j < equation->nlaSiblingCount(); ++j) {
+                    auto nlaSibling = equation->nlaSibling(j);
 
-                for (const auto &nlaSibling : equation->nlaSiblings()) {
                     methodBody += mProfile->indentString()
                                   + mProfile->fArrayString() + mProfile->openArrayString() + convertToString(++i) + mProfile->closeArrayString()
                                   + mProfile->equalityString()
                                   + generateCode(nlaSibling->ast())
                                   + mProfile->commandSeparatorString() + "\n";
 
-                    handledNlaEquations.push_back(nlaSibling);
+                    handledNlaEquations.insert(nlaSibling);
                 }
 
                 mCode += newLineIfNeeded()
-                         + replace(replace(mProfile->objectiveFunctionMethodString(modelHasOdes()),
+                         + replace(replace(replaceVariablesTags(mProfile->objectiveFunctionMethodString(modelHasOdes())),
                                            "[INDEX]", convertToString(equation->nlaSystemIndex())),
                                    "[CODE]", generateMethodBodyCode(methodBody));
 
+                auto objectiveJacobianCode = mObjectiveJacobianCodes.find(equation->nlaSystemIndex());
+                auto objectiveJacobianGenerated = (objectiveJacobianCode != mObjectiveJacobianCodes.end())
+                                                  && !mProfile->objectiveJacobianMethodString(modelHasOdes()).empty();
+                auto newtonSolverGenerated = isNewtonSolverGenerated(equation);
+
+                if (objectiveJacobianGenerated) {
+                    mCode += newLineIfNeeded()
+                             + replace(replace(replaceVariablesTags(mProfile->objectiveJacobianMethodString(modelHasOdes())),
+                                               "[INDEX]", convertToString(equation->nlaSystemIndex())),
+                                       "[CODE]", generateMethodBodyCode(unknownsCode + "\n" + objectiveJacobianCode->second));
+                } else if (newtonSolverGenerated) {
+                    mCode += newLineIfNeeded()
+                             + replaceAll(replaceAll(mProfile->finiteDifferenceObjectiveJacobianMethodString(),
+                                                     "[INDEX]", convertToString(equation->nlaSystemIndex())),
+                                          "[SIZE]", convertToString(variablesSize));
+                }
+
+                if (mJacobianSparsityPatternGenerated
+                    && !mProfile->objectiveJacobianSparsityPatternString().empty()) {
+                    std::vector<std::set<size_t>> rows(1 + equation->nlaSiblingCount());
+
+                    addUnknownDependencies(equation->ast(), variables, rows[0]);
+
+                    for (size_t j = 0; j < equation->nlaSiblingCount(); ++j) {
+                        addUnknownDependencies(equation->nlaSibling(j)->ast(), variables, rows[j + 1]);
+                    }
+
+                    auto sparsityPatternCode = generateSparsityPatternCode(replaceAll(mProfile->objectiveJacobianSparsityPatternString(),
+                                                                                      "[INDEX]", convertToString(equation->nlaSystemIndex())),
+                                                                           rows, variablesSize);
+
+                    if (!sparsityPatternCode.empty()) {
+                        mCode += newLineIfNeeded()
+                                 + sparsityPatternCode;
+                    }
+                }
+
                 methodBody = {};
 
                 for (i = 0; i < variablesSize; ++i) {
-                    auto arrayString = (variables[i]->type() == AnalyserVariable::Type::STATE) ?
+                    auto isState = variables[i]->type() == AnalyserVariable::Type::STATE;
+                    auto arrayString = isState ?
                                            mProfile->ratesArrayString() :
-                                           mProfile->variablesArrayString();
+                                           variablesArrayString(variables[i]);
+                    auto index = isState ?
+                                     variables[i]->index() :
+                                     variableIndex(variables[i]);
 
                     methodBody += mProfile->indentString()
                                   + mProfile->uArrayString() + mProfile->openArrayString() + convertToString(i) + mProfile->closeArrayString()
                                   + mProfile->equalityString()
-                                  + arrayString + mProfile->openArrayString() + convertToString(variables[i]->index()) + mProfile->closeArrayString()
+                                  + arrayString + mProfile->openArrayString() + convertToString(index) + mProfile->closeArrayString()
                                   + mProfile->commandSeparatorString() + "\n";
                 }
 
-                methodBody += newLineIfNeeded()
-                              + mProfile->indentString()
-                              + replace(replace(mProfile->nlaSolveCallString(modelHasOdes()),
-                                                "[INDEX]", convertToString(equation->nlaSystemIndex())),
-                                        "[SIZE]", convertToString(equation->variableCount()));
+                if (newtonSolverGenerated) {
+                    // Note: the finite difference objective Jacobian method
+                    //       reuses the values of the objective function that
+                    //       the Newton solver has just computed.
+
+                    methodBody += newLineIfNeeded()
+                                  + mProfile->indentString()
+                                  + replace(replaceAll(replaceAll(replaceAll(replaceVariablesTags(mProfile->newtonSolveCallString(modelHasOdes())),
+                                                                             "[INDEX]", convertToString(equation->nlaSystemIndex())),
+                                                                  "[SIZE]", convertToString(variablesSize)),
+                                                       "[F_ARGUMENT]", objectiveJacobianGenerated ? "" : mProfile->fArrayString() + ", "),
+                                            "[CODE]", generateNewtonStepCode(variablesSize));
+                } else {
+                    methodBody += newLineIfNeeded()
+                                  + mProfile->indentString()
+                                  + replace(replace(replaceVariablesTags(mProfile->nlaSolveCallString(modelHasOdes())),
+                                                    "[INDEX]", convertToString(equation->nlaSystemIndex())),
+                                            "[SIZE]", convertToString(equation->variableCount()));
+                }
 
                 methodBody += newLineIfNeeded();
 
                 for (i = 0; i < variablesSize; ++i) {
-                    auto arrayString = (variables[i]->type() == AnalyserVariable::Type::STATE) ?
+                    auto isState = variables[i]->type() == AnalyserVariable::Type::STATE;
+                    auto arrayString = isState ?
                                            mProfile->ratesArrayString() :
-                                           mProfile->variablesArrayString();
+                                           variablesArrayString(variables[i]);
+                    auto index = isState ?
+                                     variables[i]->index() :
+                                     variableIndex(variables[i]);
 
                     methodBody += mProfile->indentString()
-                                  + arrayString + mProfile->openArrayString() + convertToString(variables[i]->index()) + mProfile->closeArrayString()
+                                  + arrayString + mProfile->openArrayString() + convertToString(index) + mProfile->closeArrayString()
                                   + mProfile->equalityString()
                                   + mProfile->uArrayString() + mProfile->openArrayString() + convertToString(i) + mProfile->closeArrayString()
                                   + mProfile->commandSeparatorString() + "\n";
                 }
 
                 mCode += newLineIfNeeded()
-                         + replace(replace(replace(mProfile->findRootMethodString(modelHasOdes()),
+                         + replace(replace(replace(replaceVariablesTags(mProfile->findRootMethodString(modelHasOdes())),
                                                    "[INDEX]", convertToString(equation->nlaSystemIndex())),
                                            "[SIZE]", convertToString(variablesSize)),
                                    "[CODE]", generateMethodBodyCode(methodBody));
@@ -903,7 +1712,7 @@ std::string Generator::GeneratorImpl::generateDoubleOrConstantVariableNameCode(c
     auto initValueVariable = owningComponent(variable)->variable(variable->initialValue());
     auto analyserInitialValueVariable = analyserVariable(initValueVariable);
 
-    return mProfile->variablesArrayString() + mProfile->openArrayString() + convertToString(analyserInitialValueVariable->index()) + mProfile->closeArrayString();
+    return variablesArrayString(analyserInitialValueVariable) + mProfile->openArrayString() + convertToString(variableIndex(analyserInitialValueVariable)) + mProfile->closeArrayString();
 }
 
 std::string Generator::GeneratorImpl::generateVariableNameCode(const VariablePtr &variable,
@@ -924,17 +1733,15 @@ std::string Generator::GeneratorImpl::generateVariableNameCode(const VariablePtr
         return mProfile->voiString();
     }
 
-    std::string arrayName;
-
     if (analyserVariable->type() == AnalyserVariable::Type::STATE) {
-        arrayName = state ?
-                        mProfile->statesArrayString() :
-                        mProfile->ratesArrayString();
-    } else {
-        arrayName = mProfile->variablesArrayString();
+        auto arrayName = state ?
+                             mProfile->statesArrayString() :
+                             mProfile->ratesArrayString();
+
+        return arrayName + mProfile->openArrayString() + convertToString(analyserVariable->index()) + mProfile->closeArrayString();
     }
 
-    return arrayName + mProfile->openArrayString() + convertToString(analyserVariable->index()) + mProfile->closeArrayString();
+    return variablesArrayString(analyserVariable) + mProfile->openArrayString() + convertToString(variableIndex(analyserVariable)) + mProfile->closeArrayString();
 }
 
 std::string Generator::GeneratorImpl::generateOperatorCode(const std::string &op,
@@ -1658,31 +2465,6 @@ std::string Generator::GeneratorImpl::generateCode(const AnalyserEquationAstPtr
     return code;
 }
 
-bool Generator::GeneratorImpl::isToBeComputedAgain(const AnalyserEquationPtr &equation) const
-{
-    // NLA and algebraic equations that are state/rate-based and external
-    // equations are to be computed again (in the computeVariables() method).
-
-    switch (equation->type()) {
-    case AnalyserEquation::Type::NLA:
-    case AnalyserEquation::Type::ALGEBRAIC:
-        return equation->isStateRateBased();
-    case AnalyserEquation::Type::EXTERNAL:
-        return true;
-    default:
-        return false;
-    }
-}
-
-bool Generator::GeneratorImpl::isSomeConstant(const AnalyserEquationPtr &equation,
-                                              bool includeComputedConstants) const
-{
-    auto type = equation->type();
-
-    return (type == AnalyserEquation::Type::TRUE_CONSTANT)
-           || (!includeComputedConstants && (type == AnalyserEquation::Type::VARIABLE_BASED_CONSTANT));
-}
-
 std::string Generator::GeneratorImpl::generateZeroInitialisationCode(const AnalyserVariablePtr &variable) const
 {
     return mProfile->indentString()
@@ -1709,77 +2491,53 @@ std::string Generator::GeneratorImpl::generateInitialisationCode(const AnalyserV
            + mProfile->commandSeparatorString() + "\n";
 }
 
-std::string Generator::GeneratorImpl::generateEquationCode(const AnalyserEquationPtr &equation,
-                                                           std::vector<AnalyserEquationPtr> &remainingEquations,
-                                                           std::vector<AnalyserEquationPtr> &equationsForDependencies,
-                                                           bool includeComputedConstants)
+std::string Generator::GeneratorImpl::generateEquationCode(const AnalyserEquationPtr &equation)
 {
-    std::string res;
-
-    if (std::find(remainingEquations.begin(), remainingEquations.end(), equation) != remainingEquations.end()) {
-        // Stop tracking the equation and its NLA siblings, if any.
-        // Note: we need to do this as soon as possible to avoid recursive
-        //       calls, something that would happen if we were to do this at the
-        //       end of this if statement.
+    // Generate the equation code, based on the equation type.
 
-        remainingEquations.erase(std::find(remainingEquations.begin(), remainingEquations.end(), equation));
+    std::string res;
 
-        for (const auto &nlaSibling : equation->nlaSiblings()) {
-            remainingEquations.erase(std::find(remainingEquations.begin(), remainingEquations.end(), nlaSibling));
+    switch (equation->type()) {
+    case AnalyserEquation::Type::EXTERNAL:
+        for (const auto &variable : equation->variables()) {
+            res += mProfile->indentString()
+                   + generateVariableNameCode(variable->variable())
+                   + mProfile->equalityString()
+                   + replace(replaceVariablesTags(mProfile->externalVariableMethodCallString(modelHasOdes())),
+                             "[INDEX]", convertToString(variableIndex(variable)))
+                   + mProfile->commandSeparatorString() + "\n";
         }
 
-        // Generate any dependency that this equation may have.
-
-        if (!isSomeConstant(equation, includeComputedConstants)) {
-            for (const auto &dependency : equation->dependencies()) {
-                if ((dependency->type() != AnalyserEquation::Type::ODE)
-                    && !isSomeConstant(dependency, includeComputedConstants)
-                    && (equationsForDependencies.empty()
-                        || isToBeComputedAgain(dependency)
-                        || (std::find(equationsForDependencies.begin(), equationsForDependencies.end(), dependency) != equationsForDependencies.end()))) {
-                    res += generateEquationCode(dependency, remainingEquations, equationsForDependencies, includeComputedConstants);
-                }
-            }
+        break;
+    case AnalyserEquation::Type::NLA:
+        if (!mProfile->findRootCallString(modelHasOdes()).empty()) {
+            res += mProfile->indentString()
+                   + replace(replaceVariablesTags(mProfile->findRootCallString(modelHasOdes())),
+                             "[INDEX]", convertToString(equation->nlaSystemIndex()));
         }
 
-        // Generate the equation code itself, based on the equation type.
-
-        switch (equation->type()) {
-        case AnalyserEquation::Type::EXTERNAL:
-            for (const auto &variable : equation->variables()) {
-                res += mProfile->indentString()
-                       + generateVariableNameCode(variable->variable())
-                       + mProfile->equalityString()
-                       + replace(mProfile->externalVariableMethodCallString(modelHasOdes()),
-                                 "[INDEX]", convertToString(variable->index()))
-                       + mProfile->commandSeparatorString() + "\n";
-            }
-
-            break;
-        case AnalyserEquation::Type::NLA:
-            if (!mProfile->findRootCallString(modelHasOdes()).empty()) {
-                res += mProfile->indentString()
-                       + replace(mProfile->findRootCallString(modelHasOdes()),
-                                 "[INDEX]", convertToString(equation->nlaSystemIndex()));
-            }
-
-            break;
-        default:
-            res += mProfile->indentString() + generateCode(equation->ast()) + mProfile->commandSeparatorString() + "\n";
+        break;
+    default:
+        res += mProfile->indentString() + generateCode(equation->ast()) + mProfile->commandSeparatorString() + "\n";
 
-            break;
-        }
+        break;
     }
 
     return res;
 }
 
-std::string Generator::GeneratorImpl::generateEquationCode(const AnalyserEquationPtr &equation,
-                                                           std::vector<AnalyserEquationPtr> &remainingEquations)
+std::string Generator::GeneratorImpl::generateEquationsCode(const std::vector<AnalyserEquationPtr> &equations)
 {
-    std::vector<AnalyserEquationPtr> dummyEquationsForComputeVariables;
+    // Generate the code for the given equations, which are expected to have
+    // been scheduled (see scheduleEquation()).
+
+    std::string res;
+
+    for (const auto &equation : equations) {
+        res += generateEquationCode(equation);
+    }
 
-    return generateEquationCode(equation, remainingEquations, dummyEquationsForComputeVariables, true);
+    return res;
 }
 
 void Generator::GeneratorImpl::addInterfaceComputeModelMethodsCode()
@@ -1789,25 +2547,50 @@ void Generator::GeneratorImpl::addInterfaceComputeModelMethodsCode()
     std::string interfaceComputeModelMethodsCode;
 
     if (!interfaceInitialiseVariablesMethodString.empty()) {
-        interfaceComputeModelMethodsCode += interfaceInitialiseVariablesMethodString;
+        interfaceComputeModelMethodsCode += replaceVariablesTags(interfaceInitialiseVariablesMethodString);
     }
 
     if (!mProfile->interfaceComputeComputedConstantsMethodString().empty()) {
-        interfaceComputeModelMethodsCode += mProfile->interfaceComputeComputedConstantsMethodString();
+        interfaceComputeModelMethodsCode += replaceVariablesTags(mProfile->interfaceComputeComputedConstantsMethodString());
     }
 
     auto interfaceComputeRatesMethodString = mProfile->interfaceComputeRatesMethodString(mModel->hasExternalVariables());
 
     if (modelHasOdes()
         && !interfaceComputeRatesMethodString.empty()) {
-        interfaceComputeModelMethodsCode += interfaceComputeRatesMethodString;
+        interfaceComputeModelMethodsCode += replaceVariablesTags(interfaceComputeRatesMethodString);
     }
 
     auto interfaceComputeVariablesMethodString = mProfile->interfaceComputeVariablesMethodString(modelHasOdes(),
                                                                                                  mModel->hasExternalVariables());
 
     if (!interfaceComputeVariablesMethodString.empty()) {
-        interfaceComputeModelMethodsCode += interfaceComputeVariablesMethodString;
+        interfaceComputeModelMethodsCode += replaceVariablesTags(interfaceComputeVariablesMethodString);
+    }
+
+    if (mHasJacobian
+        && !mProfile->interfaceComputeJacobianMethodString().empty()) {
+        interfaceComputeModelMethodsCode += replaceVariablesTags(mProfile->interfaceComputeJacobianMethodString());
+    }
+
+    if (!mGatingStateIndices.empty()
+        && !mProfile->interfaceComputeGatingCoefficientsMethodString().empty()) {
+        interfaceComputeModelMethodsCode += replaceVariablesTags(mProfile->interfaceComputeGatingCoefficientsMethodString());
+    }
+
+    if (mModel->resetCount() != 0) {
+        if (!mProfile->interfaceComputeEventConditionsMethodString().empty()) {
+            interfaceComputeModelMethodsCode += replaceVariablesTags(mProfile->interfaceComputeEventConditionsMethodString());
+        }
+
+        if (!mProfile->interfaceApplyResetsMethodString().empty()) {
+            interfaceComputeModelMethodsCode += replaceVariablesTags(mProfile->interfaceApplyResetsMethodString());
+        }
+    }
+
+    if (!mRootFunctionAsts.empty()
+        && !mProfile->interfaceComputeRootFunctionsMethodString().empty()) {
+        interfaceComputeModelMethodsCode += replaceVariablesTags(mProfile->interfaceComputeRootFunctionsMethodString());
     }
 
     if (!interfaceComputeModelMethodsCode.empty()) {
@@ -1817,7 +2600,7 @@ void Generator::GeneratorImpl::addInterfaceComputeModelMethodsCode()
     mCode += interfaceComputeModelMethodsCode;
 }
 
-void Generator::GeneratorImpl::addImplementationInitialiseVariablesMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations)
+void Generator::GeneratorImpl::addImplementationInitialiseVariablesMethodCode(AnalyserEquationSet &remainingEquations)
 {
     auto implementationInitialiseVariablesMethodString = mProfile->implementationInitialiseVariablesMethodString(modelHasOdes(),
                                                                                                                  mModel->hasExternalVariables());
@@ -1857,11 +2640,7 @@ void Generator::GeneratorImpl::addImplementationInitialiseVariablesMethodCode(st
 
         // Initialise our true constants.
 
-        for (const auto &equation : mModel->equations()) {
-            if (equation->type() == AnalyserEquation::Type::TRUE_CONSTANT) {
-                methodBody += generateEquationCode(equation, remainingEquations);
-            }
-        }
+        methodBody += generateEquationsCode(equationsToInitialiseVariables(mModel, remainingEquations));
 
         // Initialise our states.
 
@@ -1880,91 +2659,266 @@ void Generator::GeneratorImpl::addImplementationInitialiseVariablesMethodCode(st
 
         // Initialise our external variables.
 
-        if (mModel->hasExternalVariables()) {
-            auto equations = mModel->equations();
-            std::vector<AnalyserEquationPtr> remainingExternalEquations;
-
-            std::copy_if(equations.begin(), equations.end(),
-                         std::back_inserter(remainingExternalEquations),
-                         [](const AnalyserEquationPtr &equation) { return equation->type() == AnalyserEquation::Type::EXTERNAL; });
-
-            for (const auto &equation : mModel->equations()) {
-                if (equation->type() == AnalyserEquation::Type::EXTERNAL) {
-                    methodBody += generateEquationCode(equation, remainingExternalEquations);
-                }
-            }
-        }
+        methodBody += generateEquationsCode(equationsToInitialiseExternalVariables(mModel));
 
         mCode += newLineIfNeeded()
-                 + replace(implementationInitialiseVariablesMethodString,
+                 + replace(replaceVariablesTags(implementationInitialiseVariablesMethodString),
                            "[CODE]", generateMethodBodyCode(methodBody));
     }
 }
 
-void Generator::GeneratorImpl::addImplementationComputeComputedConstantsMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations)
+void Generator::GeneratorImpl::addImplementationComputeComputedConstantsMethodCode(AnalyserEquationSet &remainingEquations)
 {
     if (!mProfile->implementationComputeComputedConstantsMethodString().empty()) {
-        std::string methodBody;
-
-        for (const auto &equation : mModel->equations()) {
-            if (equation->type() == AnalyserEquation::Type::VARIABLE_BASED_CONSTANT) {
-                methodBody += generateEquationCode(equation, remainingEquations);
-            }
-        }
+        auto methodBody = generateEquationsCode(equationsToComputeComputedConstants(mModel, remainingEquations));
 
         mCode += newLineIfNeeded()
-                 + replace(mProfile->implementationComputeComputedConstantsMethodString(),
+                 + replace(replaceVariablesTags(mProfile->implementationComputeComputedConstantsMethodString()),
                            "[CODE]", generateMethodBodyCode(methodBody));
     }
 }
 
-void Generator::GeneratorImpl::addImplementationComputeRatesMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations)
+void Generator::GeneratorImpl::addImplementationComputeRatesMethodCode(AnalyserEquationSet &remainingEquations)
 {
     auto implementationComputeRatesMethodString = mProfile->implementationComputeRatesMethodString(mModel->hasExternalVariables());
 
     if (modelHasOdes()
         && !implementationComputeRatesMethodString.empty()) {
-        std::string methodBody;
-
-        for (const auto &equation : mModel->equations()) {
-            // A rate is computed either through an ODE equation or through an
-            // NLA equation in case the rate is not on its own on either the LHS
-            // or RHS of the equation.
-
-            if ((equation->type() == AnalyserEquation::Type::ODE)
-                || ((equation->type() == AnalyserEquation::Type::NLA)
-                    && (equation->variableCount() == 1)
-                    && (equation->variable(0)->type() == AnalyserVariable::Type::STATE))) {
-                methodBody += generateEquationCode(equation, remainingEquations);
-            }
-        }
+        auto methodBody = generateEquationsCode(equationsToComputeRates(mModel, remainingEquations));
 
         mCode += newLineIfNeeded()
-                 + replace(implementationComputeRatesMethodString,
+                 + replace(replaceVariablesTags(implementationComputeRatesMethodString),
                            "[CODE]", generateMethodBodyCode(methodBody));
     }
 }
 
-void Generator::GeneratorImpl::addImplementationComputeVariablesMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations)
+void Generator::GeneratorImpl::addImplementationComputeVariablesMethodCode(AnalyserEquationSet &remainingEquations)
 {
     auto implementationComputeVariablesMethodString = mProfile->implementationComputeVariablesMethodString(modelHasOdes(),
                                                                                                            mModel->hasExternalVariables());
 
     if (!implementationComputeVariablesMethodString.empty()) {
+        auto methodBody = generateEquationsCode(equationsToComputeVariables(mModel, remainingEquations));
+
+        mCode += newLineIfNeeded()
+                 + replace(replaceVariablesTags(implementationComputeVariablesMethodString),
+                           "[CODE]", generateMethodBodyCode(methodBody));
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationComputeJacobianMethodCode()
+{
+    if (mHasJacobian
+        && !mProfile->implementationComputeJacobianMethodString().empty()) {
+        mCode += newLineIfNeeded()
+                 + replace(replaceVariablesTags(mProfile->implementationComputeJacobianMethodString()),
+                           "[CODE]", generateMethodBodyCode(mJacobianCode));
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationComputeGatingCoefficientsMethodCode()
+{
+    if (!mGatingStateIndices.empty()
+        && !mProfile->implementationComputeGatingCoefficientsMethodString().empty()) {
+        mCode += newLineIfNeeded()
+                 + replace(replaceVariablesTags(mProfile->implementationComputeGatingCoefficientsMethodString()),
+                           "[CODE]", generateMethodBodyCode(mGatingCoefficientsCode));
+    }
+}
+
+AnalyserEquationSet Generator::GeneratorImpl::nonExternalEquations() const
+{
+    // Return the equations that may be needed to evaluate an expression outside
+    // of the methods to compute our rates and variables, e.g. the condition or
+    // the reset value of a reset, i.e. all our equations except our external
+    // ones since the value of an external variable is provided by the caller.
+
+    AnalyserEquationSet res;
+
+    for (const auto &equation : mModel->equations()) {
+        if (equation->type() != AnalyserEquation::Type::EXTERNAL) {
+            res.insert(equation);
+        }
+    }
+
+    return res;
+}
+
+std::string Generator::GeneratorImpl::generateAlgebraicVariablesCode(const AnalyserEquationAstPtr &ast,
+                                                                 AnalyserEquationSet &remainingEquations)
+{
+    // Generate the code for the equations (and their dependencies) that compute
+    // the algebraic variables used in the given AST.
+
+    if (ast == nullptr) {
+        return {};
+    }
+
+    std::string res;
+
+    if (ast->type() == AnalyserEquationAst::Type::CI) {
+        auto analyserVariable = Generator::GeneratorImpl::analyserVariable(ast->variable());
+
+        if (analyserVariable->type() == AnalyserVariable::Type::ALGEBRAIC) {
+            AnalyserEquationSet dummyEquationsForDependencies;
+            std::vector<AnalyserEquationPtr> equations;
+
+            for (const auto &equation : analyserVariable->equations()) {
+                scheduleEquation(equation, remainingEquations, dummyEquationsForDependencies, false, equations);
+            }
+
+            res += generateEquationsCode(equations);
+        }
+    }
+
+    return res
+           + generateAlgebraicVariablesCode(ast->leftChild(), remainingEquations)
+           + generateAlgebraicVariablesCode(ast->rightChild(), remainingEquations);
+}
+
+void Generator::GeneratorImpl::addImplementationComputeEventConditionsMethodCode()
+{
+    if ((mModel->resetCount() != 0)
+        && !mProfile->implementationComputeEventConditionsMethodString().empty()) {
+        // Compute the algebraic variables needed by our conditions before
+        // computing the conditions themselves.
+
+        const auto &resets = mModel->resets();
+        auto remainingEquations = nonExternalEquations();
+        std::string methodBody;
+
+        for (const auto &reset : resets) {
+            methodBody += generateAlgebraicVariablesCode(reset->conditionAst(), remainingEquations);
+        }
+
+        if (!methodBody.empty()) {
+            methodBody += "\n";
+        }
+
+        for (size_t i = 0; i < resets.size(); ++i) {
+            methodBody += mProfile->indentString()
+                          + mProfile->conditionsArrayString() + mProfile->openArrayString() + convertToString(i) + mProfile->closeArrayString()
+                          + mProfile->equalityString()
+                          + generateCode(resets[i]->conditionAst())
+                          + mProfile->commandSeparatorString() + "\n";
+        }
+
+        mCode += newLineIfNeeded()
+                 + replace(replaceVariablesTags(mProfile->implementationComputeEventConditionsMethodString()),
+                           "[CODE]", methodBody);
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationApplyResetsMethodCode()
+{
+    if ((mModel->resetCount() != 0)
+        && !mProfile->implementationApplyResetsMethodString().empty()) {
+        // Group our resets by the variable they reset, sorting them by order so
+        // that, should several of them be active at the same time, the one
+        // with the lowest order is the one that gets applied.
+
+        const auto &resets = mModel->resets();
+        std::vector<AnalyserVariablePtr> variables;
+        std::map<AnalyserVariablePtr, std::vector<size_t>> variableEvents;
+
+        for (size_t i = 0; i < resets.size(); ++i) {
+            auto variable = resets[i]->variable();
+
+            if (variableEvents.count(variable) == 0) {
+                variables.push_back(variable);
+            }
+
+            variableEvents[variable].push_back(i);
+        }
+
+        for (auto &events : variableEvents) {
+            std::stable_sort(events.second.begin(), events.second.end(), [&](size_t event1, size_t event2) {
+                return resets[event1]->order() < resets[event2]->order();
+            });
+        }
+
+        // Compute the algebraic variables needed by our reset values.
+
+        auto remainingEquations = nonExternalEquations();
         std::string methodBody;
-        auto equations = mModel->equations();
-        std::vector<AnalyserEquationPtr> newRemainingEquations {std::begin(equations), std::end(equations)};
 
-        for (const auto &equation : equations) {
-            if ((std::find(remainingEquations.begin(), remainingEquations.end(), equation) != remainingEquations.end())
-                || isToBeComputedAgain(equation)) {
-                methodBody += generateEquationCode(equation, newRemainingEquations, remainingEquations, false);
+        for (const auto &reset : resets) {
+            methodBody += generateAlgebraicVariablesCode(reset->resetValueAst(), remainingEquations);
+        }
+
+        if (!methodBody.empty()) {
+            methodBody += "\n";
+        }
+
+        // Compute the new value of our variables, i.e. the reset value of the
+        // active reset with the lowest order or the current value of the
+        // variable if none of its resets is active, before updating them.
+        // Note: we update our variables only once all their new value has
+        //       been computed since a reset value may depend on the value of
+        //       a variable that is also being reset.
+
+        std::string updateCode;
+
+        for (size_t i = 0; i < variables.size(); ++i) {
+            auto variableCode = generateVariableNameCode(variables[i]->variable());
+            auto resetValueCode = mProfile->resetValuesArrayString() + mProfile->openArrayString() + convertToString(i) + mProfile->closeArrayString();
+            const auto &events = variableEvents[variables[i]];
+            auto newValueCode = variableCode;
+
+            for (auto event = events.rbegin(); event != events.rend(); ++event) {
+                newValueCode = generatePiecewiseIfCode(mProfile->eventsArrayString() + mProfile->openArrayString() + convertToString(*event) + mProfile->closeArrayString(),
+                                                       generateCode(resets[*event]->resetValueAst()))
+                               + generatePiecewiseElseCode(newValueCode);
             }
+
+            methodBody += mProfile->indentString()
+                          + resetValueCode
+                          + mProfile->equalityString()
+                          + newValueCode
+                          + mProfile->commandSeparatorString() + "\n";
+            updateCode += mProfile->indentString()
+                          + variableCode
+                          + mProfile->equalityString()
+                          + resetValueCode
+                          + mProfile->commandSeparatorString() + "\n";
         }
 
         mCode += newLineIfNeeded()
-                 + replace(implementationComputeVariablesMethodString,
-                           "[CODE]", generateMethodBodyCode(methodBody));
+                 + replace(replace(replaceVariablesTags(mProfile->implementationApplyResetsMethodString()),
+                                   "[RESET_VARIABLE_COUNT]", convertToString(variables.size())),
+                           "[CODE]", methodBody + "\n" + updateCode);
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationComputeRootFunctionsMethodCode()
+{
+    if (!mRootFunctionAsts.empty()
+        && !mProfile->implementationComputeRootFunctionsMethodString().empty()) {
+        // Compute the algebraic variables needed by our root functions before
+        // computing the root functions themselves.
+
+        auto remainingEquations = nonExternalEquations();
+        std::string methodBody;
+
+        for (const auto &rootFunctionAst : mRootFunctionAsts) {
+            methodBody += generateAlgebraicVariablesCode(rootFunctionAst, remainingEquations);
+        }
+
+        if (!methodBody.empty()) {
+            methodBody += "\n";
+        }
+
+        for (size_t i = 0; i < mRootFunctionAsts.size(); ++i) {
+            methodBody += mProfile->indentString()
+                          + mProfile->rootFunctionsArrayString() + mProfile->openArrayString() + convertToString(i) + mProfile->closeArrayString()
+                          + mProfile->equalityString()
+                          + generateCode(mRootFunctionAsts[i])
+                          + mProfile->commandSeparatorString() + "\n";
+        }
+
+        mCode += newLineIfNeeded()
+                 + replace(replaceVariablesTags(mProfile->implementationComputeRootFunctionsMethodString()),
+                           "[CODE]", methodBody);
     }
 }
 
@@ -2003,8 +2957,80 @@ void Generator::setModel(const AnalyserModelPtr &model)
     mPimpl->mModel = model;
 }
 
+ProfilerPtr Generator::profiler() const
+{
+    return mPimpl->mProfiler;
+}
+
+void Generator::setProfiler(const ProfilerPtr &profiler)
+{
+    mPimpl->mProfiler = profiler;
+}
+
+bool Generator::isJacobianGenerated() const
+{
+    return mPimpl->mJacobianGenerated;
+}
+
+void Generator::setJacobianGenerated(bool jacobianGenerated)
+{
+    mPimpl->mJacobianGenerated = jacobianGenerated;
+}
+
+bool Generator::isJacobianSparsityPatternGenerated() const
+{
+    return mPimpl->mJacobianSparsityPatternGenerated;
+}
+
+void Generator::setJacobianSparsityPatternGenerated(bool jacobianSparsityPatternGenerated)
+{
+    mPimpl->mJacobianSparsityPatternGenerated = jacobianSparsityPatternGenerated;
+}
+
+bool Generator::isVariablesArraySplit() const
+{
+    return mPimpl->mVariablesArraySplit;
+}
+
+void Generator::setVariablesArraySplit(bool variablesArraySplit)
+{
+    mPimpl->mVariablesArraySplit = variablesArraySplit;
+}
+
+bool Generator::isGatingCoefficientsGenerated() const
+{
+    return mPimpl->mGatingCoefficientsGenerated;
+}
+
+void Generator::setGatingCoefficientsGenerated(bool gatingCoefficientsGenerated)
+{
+    mPimpl->mGatingCoefficientsGenerated = gatingCoefficientsGenerated;
+}
+
+bool Generator::isRootFunctionsGenerated() const
+{
+    return mPimpl->mRootFunctionsGenerated;
+}
+
+void Generator::setRootFunctionsGenerated(bool rootFunctionsGenerated)
+{
+    mPimpl->mRootFunctionsGenerated = rootFunctionsGenerated;
+}
+
+bool Generator::isNewtonSolversGenerated() const
+{
+    return mPimpl->mNewtonSolversGenerated;
+}
+
+void Generator::setNewtonSolversGenerated(bool newtonSolversGenerated)
+{
+    mPimpl->mNewtonSolversGenerated = newtonSolversGenerated;
+}
+
 std::string Generator::interfaceCode() const
 {
+    ProfilerScope profilerScope(mPimpl->mProfiler, Profiler::Phase::GENERATE_INTERFACE_CODE);
+
     if ((mPimpl->mModel == nullptr)
         || (mPimpl->mProfile == nullptr)
         || !mPimpl->mModel->isValid()
@@ -2015,6 +3041,9 @@ std::string Generator::interfaceCode() const
     // Get ourselves ready.
 
     mPimpl->reset();
+    mPimpl->prepareJacobianCode();
+    mPimpl->prepareGatingCoefficientsCode();
+    mPimpl->prepareRootFunctionsCode();
 
     // Add code for the origin comment.
 
@@ -2042,6 +3071,22 @@ std::string Generator::interfaceCode() const
 
     mPimpl->addInterfaceVoiStateAndVariableInfoCode();
 
+    // Add code for the interface of the sparsity pattern of our Jacobian.
+
+    mPimpl->addJacobianSparsityPatternCode(true);
+
+    // Add code for the interface of the indices of our gating states.
+
+    mPimpl->addGatingStateIndicesCode(true);
+
+    // Add code for the interface of the number of events.
+
+    mPimpl->addEventCountCode(true);
+
+    // Add code for the interface of the number of root functions.
+
+    mPimpl->addRootFunctionCountCode(true);
+
     // Add code for the interface to create and delete arrays.
 
     mPimpl->addInterfaceCreateDeleteArrayMethodsCode();
@@ -2059,6 +3104,8 @@ std::string Generator::interfaceCode() const
 
 std::string Generator::implementationCode() const
 {
+    ProfilerScope profilerScope(mPimpl->mProfiler, Profiler::Phase::GENERATE_IMPLEMENTATION_CODE);
+
     if ((mPimpl->mModel == nullptr)
         || (mPimpl->mProfile == nullptr)
         || !mPimpl->mModel->isValid()) {
@@ -2068,6 +3115,9 @@ std::string Generator::implementationCode() const
     // Get ourselves ready.
 
     mPimpl->reset();
+    mPimpl->prepareJacobianCode();
+    mPimpl->prepareGatingCoefficientsCode();
+    mPimpl->prepareRootFunctionsCode();
 
     // Add code for the origin comment.
 
@@ -2100,6 +3150,22 @@ std::string Generator::implementationCode() const
     mPimpl->addImplementationStateInfoCode();
     mPimpl->addImplementationVariableInfoCode();
 
+    // Add code for the implementation of the sparsity pattern of our Jacobian.
+
+    mPimpl->addJacobianSparsityPatternCode();
+
+    // Add code for the implementation of the indices of our gating states.
+
+    mPimpl->addGatingStateIndicesCode();
+
+    // Add code for the implementation of the number of events.
+
+    mPimpl->addEventCountCode();
+
+    // Add code for the implementation of the number of root functions.
+
+    mPimpl->addRootFunctionCountCode();
+
     // Add code for the arithmetic and trigonometric functions.
 
     mPimpl->addArithmeticFunctionsCode();
@@ -2119,8 +3185,8 @@ std::string Generator::implementationCode() const
 
     // Add code for the implementation to initialise our variables.
 
-    auto equations = mPimpl->mModel->equations();
-    std::vector<AnalyserEquationPtr> remainingEquations {std::begin(equations), std::end(equations)};
+    const auto &equations = mPimpl->mModel->equations();
+    AnalyserEquationSet remainingEquations {std::begin(equations), std::end(equations)};
 
     mPimpl->addImplementationInitialiseVariablesMethodCode(remainingEquations);
 
@@ -2143,6 +3209,26 @@ std::string Generator::implementationCode() const
 
     mPimpl->addImplementationComputeVariablesMethodCode(remainingEquations);
 
+    // Add code for the implementation to compute our Jacobian, if requested.
+
+    mPimpl->addImplementationComputeJacobianMethodCode();
+
+    // Add code for the implementation to compute our gating coefficients, if
+    // requested.
+
+    mPimpl->addImplementationComputeGatingCoefficientsMethodCode();
+
+    // Add code for the implementation to compute our event conditions and to
+    // apply our resets, if our model has some resets.
+
+    mPimpl->addImplementationComputeEventConditionsMethodCode();
+    mPimpl->addImplementationApplyResetsMethodCode();
+
+    // Add code for the implementation to compute our root functions, if
+    // requested.
+
+    mPimpl->addImplementationComputeRootFunctionsMethodCode();
+
     return mPimpl->mCode;
 }
 
@@ -16,6 +16,9 @@ limitations under the License.
 
 #pragma once
 
+#include <map>
+#include <set>
+
 #include "libcellml/generator.h"
 
 #include "libcellml/generatorprofile.h"
@@ -24,6 +27,8 @@ limitations under the License.
 
 namespace libcellml {
 
+static const size_t MAX_NEWTON_SOLVER_SIZE = 3;
+
 std::string generateDoubleCode(const std::string &value);
 
 /**
@@ -39,6 +44,36 @@ struct Generator::GeneratorImpl
 
     GeneratorProfilePtr mProfile = GeneratorProfile::create();
 
+    ProfilerPtr mProfiler;
+
+    bool mJacobianGenerated = false;
+
+    bool mHasJacobian = false;
+    std::string mJacobianCode;
+    std::map<size_t, std::string> mObjectiveJacobianCodes;
+    bool mJacobianNeedLtFunction = false;
+
+    bool mJacobianSparsityPatternGenerated = false;
+
+    bool mGatingCoefficientsGenerated = false;
+
+    std::vector<size_t> mGatingStateIndices;
+    std::string mGatingCoefficientsCode;
+    bool mGatingCoefficientsNeedLtFunction = false;
+
+    bool mRootFunctionsGenerated = false;
+
+    std::vector<AnalyserEquationAstPtr> mRootFunctionAsts;
+
+    bool mNewtonSolversGenerated = false;
+
+    bool mVariablesArraySplit = false;
+
+    std::vector<AnalyserVariablePtr> mConstants;
+    std::vector<AnalyserVariablePtr> mComputedConstants;
+    std::vector<AnalyserVariablePtr> mAlgebraic;
+    std::map<AnalyserVariablePtr, size_t> mVariableIndices;
+
     void reset();
 
     bool modelHasOdes() const;
@@ -46,6 +81,10 @@ struct Generator::GeneratorImpl
 
     AnalyserVariablePtr analyserVariable(const VariablePtr &variable) const;
 
+    std::string variablesArrayString(const AnalyserVariablePtr &variable) const;
+    size_t variableIndex(const AnalyserVariablePtr &variable) const;
+    std::string replaceVariablesTags(const std::string &string) const;
+
     double scalingFactor(const VariablePtr &variable) const;
 
     bool isNegativeNumber(const AnalyserEquationAstPtr &ast) const;
@@ -94,6 +133,8 @@ struct Generator::GeneratorImpl
     void addInterfaceVoiStateAndVariableInfoCode();
     void addImplementationVoiInfoCode();
     void addImplementationStateInfoCode();
+    void addImplementationVariableInfoCode(const std::string &variableInfoString,
+                                           const std::vector<AnalyserVariablePtr> &variables);
     void addImplementationVariableInfoCode();
 
     void addArithmeticFunctionsCode();
@@ -105,8 +146,41 @@ struct Generator::GeneratorImpl
     void addImplementationCreateVariablesArrayMethodCode();
     void addImplementationDeleteArrayMethodCode();
 
+    std::string generateJacobianEntryCode(size_t index,
+                                          const AnalyserEquationAstPtr &ast) const;
+    void prepareJacobianCode();
+
+    void addStateDependencies(const AnalyserEquationAstPtr &ast,
+                              std::set<size_t> &stateDependencies,
+                              std::map<AnalyserEquationPtr, std::set<size_t>> &equationsStateDependencies) const;
+    std::set<size_t> equationStateDependencies(const AnalyserEquationPtr &equation,
+                                               std::map<AnalyserEquationPtr, std::set<size_t>> &equationsStateDependencies) const;
+    void addUnknownDependencies(const AnalyserEquationAstPtr &ast,
+                                const std::vector<AnalyserVariablePtr> &unknowns,
+                                std::set<size_t> &unknownDependencies) const;
+    bool hasNonzeroEntries(const std::vector<std::set<size_t>> &rows) const;
+    std::string generateSparsityPatternCode(const std::string &sparsityPatternString,
+                                            const std::vector<std::set<size_t>> &rows,
+                                            size_t columnCount) const;
+    void addJacobianSparsityPatternCode(bool interface = false);
+
+    void prepareGatingCoefficientsCode();
+    void addGatingStateIndicesCode(bool interface = false);
+
+    void addEventCountCode(bool interface = false);
+
+    bool isConstantAst(const AnalyserEquationAstPtr &ast) const;
+    void addRootFunctionAsts(const AnalyserEquationAstPtr &ast, bool condition,
+                             std::set<std::string> &rootFunctionCodes);
+    void prepareRootFunctionsCode();
+    void addRootFunctionCountCode(bool interface = false);
+
     void addRootFindingInfoObjectCode();
+    bool isNewtonSolverGenerated(const AnalyserEquationPtr &equation) const;
+    bool modelNeedsNlaSolveMethod() const;
     void addExternNlaSolveMethodCode();
+    std::string generateDeterminantCode(const std::vector<std::vector<std::string>> &matrix) const;
+    std::string generateNewtonStepCode(size_t size) const;
     void addNlaSystemsCode();
 
     std::string generateMethodBodyCode(const std::string &methodBody) const;
@@ -127,24 +201,24 @@ struct Generator::GeneratorImpl
     std::string generatePiecewiseElseCode(const std::string &value) const;
     std::string generateCode(const AnalyserEquationAstPtr &ast) const;
 
-    bool isToBeComputedAgain(const AnalyserEquationPtr &equation) const;
-    bool isSomeConstant(const AnalyserEquationPtr &equation,
-                        bool includeComputedConstants) const;
-
     std::string generateZeroInitialisationCode(const AnalyserVariablePtr &variable) const;
     std::string generateInitialisationCode(const AnalyserVariablePtr &variable) const;
-    std::string generateEquationCode(const AnalyserEquationPtr &equation,
-                                     std::vector<AnalyserEquationPtr> &remainingEquations,
-                                     std::vector<AnalyserEquationPtr> &equationsForDependencies,
-                                     bool includeComputedConstants);
-    std::string generateEquationCode(const AnalyserEquationPtr &equation,
-                                     std::vector<AnalyserEquationPtr> &remainingEquations);
+    std::string generateEquationCode(const AnalyserEquationPtr &equation);
+    std::string generateEquationsCode(const std::vector<AnalyserEquationPtr> &equations);
 
     void addInterfaceComputeModelMethodsCode();
-    void addImplementationInitialiseVariablesMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations);
-    void addImplementationComputeComputedConstantsMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations);
-    void addImplementationComputeRatesMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations);
-    void addImplementationComputeVariablesMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations);
+    void addImplementationInitialiseVariablesMethodCode(AnalyserEquationSet &remainingEquations);
+    void addImplementationComputeComputedConstantsMethodCode(AnalyserEquationSet &remainingEquations);
+    void addImplementationComputeRatesMethodCode(AnalyserEquationSet &remainingEquations);
+    void addImplementationComputeVariablesMethodCode(AnalyserEquationSet &remainingEquations);
+    void addImplementationComputeJacobianMethodCode();
+    void addImplementationComputeGatingCoefficientsMethodCode();
+    AnalyserEquationSet nonExternalEquations() const;
+    std::string generateAlgebraicVariablesCode(const AnalyserEquationAstPtr &ast,
+                                               AnalyserEquationSet &remainingEquations);
+    void addImplementationComputeEventConditionsMethodCode();
+    void addImplementationApplyResetsMethodCode();
+    void addImplementationComputeRootFunctionsMethodCode();
 };
 
 } // namespace libcellml
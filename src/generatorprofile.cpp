@@ -187,6 +187,15 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mInterfaceVariableCountString;
     std::string mImplementationVariableCountString;
 
+    std::string mInterfaceConstantCountString;
+    std::string mImplementationConstantCountString;
+
+    std::string mInterfaceComputedConstantCountString;
+    std::string mImplementationComputedConstantCountString;
+
+    std::string mInterfaceAlgebraicCountString;
+    std::string mImplementationAlgebraicCountString;
+
     std::string mVariableTypeObjectFamWoevString;
     std::string mVariableTypeObjectFamWevString;
     std::string mVariableTypeObjectFdmWoevString;
@@ -210,6 +219,15 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mInterfaceVariableInfoString;
     std::string mImplementationVariableInfoString;
 
+    std::string mInterfaceConstantInfoString;
+    std::string mImplementationConstantInfoString;
+
+    std::string mInterfaceComputedConstantInfoString;
+    std::string mImplementationComputedConstantInfoString;
+
+    std::string mInterfaceAlgebraicInfoString;
+    std::string mImplementationAlgebraicInfoString;
+
     std::string mVariableInfoEntryString;
 
     std::string mVoiString;
@@ -217,6 +235,13 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mStatesArrayString;
     std::string mRatesArrayString;
     std::string mVariablesArrayString;
+    std::string mConstantsArrayString;
+    std::string mComputedConstantsArrayString;
+    std::string mAlgebraicArrayString;
+
+    std::string mVariablesParameterString;
+    std::string mVariablesMemberString;
+    std::string mVariablesDataString;
 
     std::string mExternalVariableMethodTypeDefinitionFamString;
     std::string mExternalVariableMethodTypeDefinitionFdmString;
@@ -235,8 +260,33 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mNlaSolveCallFdmString;
     std::string mObjectiveFunctionMethodFamString;
     std::string mObjectiveFunctionMethodFdmString;
+    std::string mObjectiveJacobianMethodFamString;
+    std::string mObjectiveJacobianMethodFdmString;
+    std::string mFiniteDifferenceObjectiveJacobianMethodString;
+    std::string mNewtonSolveCallFamString;
+    std::string mNewtonSolveCallFdmString;
     std::string mUArrayString;
     std::string mFArrayString;
+    std::string mJacobianArrayString;
+    std::string mSteadyStatesArrayString;
+    std::string mTimeConstantsArrayString;
+    std::string mConditionsArrayString;
+    std::string mEventsArrayString;
+    std::string mResetValuesArrayString;
+    std::string mRootFunctionsArrayString;
+
+    std::string mInterfaceJacobianSparsityPatternString;
+    std::string mImplementationJacobianSparsityPatternString;
+    std::string mObjectiveJacobianSparsityPatternString;
+
+    std::string mInterfaceGatingStateIndicesString;
+    std::string mImplementationGatingStateIndicesString;
+
+    std::string mInterfaceEventCountString;
+    std::string mImplementationEventCountString;
+
+    std::string mInterfaceRootFunctionCountString;
+    std::string mImplementationRootFunctionCountString;
 
     std::string mInterfaceCreateStatesArrayMethodString;
     std::string mImplementationCreateStatesArrayMethodString;
@@ -244,6 +294,15 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mInterfaceCreateVariablesArrayMethodString;
     std::string mImplementationCreateVariablesArrayMethodString;
 
+    std::string mInterfaceCreateConstantsArrayMethodString;
+    std::string mImplementationCreateConstantsArrayMethodString;
+
+    std::string mInterfaceCreateComputedConstantsArrayMethodString;
+    std::string mImplementationCreateComputedConstantsArrayMethodString;
+
+    std::string mInterfaceCreateAlgebraicArrayMethodString;
+    std::string mImplementationCreateAlgebraicArrayMethodString;
+
     std::string mInterfaceDeleteArrayMethodString;
     std::string mImplementationDeleteArrayMethodString;
 
@@ -280,6 +339,21 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mInterfaceComputeVariablesMethodFdmWevString;
     std::string mImplementationComputeVariablesMethodFdmWevString;
 
+    std::string mInterfaceComputeJacobianMethodString;
+    std::string mImplementationComputeJacobianMethodString;
+
+    std::string mInterfaceComputeGatingCoefficientsMethodString;
+    std::string mImplementationComputeGatingCoefficientsMethodString;
+
+    std::string mInterfaceComputeEventConditionsMethodString;
+    std::string mImplementationComputeEventConditionsMethodString;
+
+    std::string mInterfaceApplyResetsMethodString;
+    std::string mImplementationApplyResetsMethodString;
+
+    std::string mInterfaceComputeRootFunctionsMethodString;
+    std::string mImplementationComputeRootFunctionsMethodString;
+
     std::string mEmptyMethodString;
 
     std::string mIndentString;
@@ -296,7 +370,13 @@ struct GeneratorProfile::GeneratorProfileImpl
 
     std::string mCommandSeparatorString;
 
+    // Our default method strings, as they refer to the variables array, and as
+    // they use the tags that stand for the variables array(s).
+
+    std::map<std::string, std::string> mVariablesTagsStrings;
+
     void loadProfile(GeneratorProfile::Profile profile);
+    void expandVariablesTags();
 };
 
 void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profile profile)
@@ -508,6 +588,15 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mInterfaceVariableCountString = "extern const size_t VARIABLE_COUNT;\n";
         mImplementationVariableCountString = "const size_t VARIABLE_COUNT = [VARIABLE_COUNT];\n";
 
+        mInterfaceConstantCountString = "extern const size_t CONSTANT_COUNT;\n";
+        mImplementationConstantCountString = "const size_t CONSTANT_COUNT = [CONSTANT_COUNT];\n";
+
+        mInterfaceComputedConstantCountString = "extern const size_t COMPUTED_CONSTANT_COUNT;\n";
+        mImplementationComputedConstantCountString = "const size_t COMPUTED_CONSTANT_COUNT = [COMPUTED_CONSTANT_COUNT];\n";
+
+        mInterfaceAlgebraicCountString = "extern const size_t ALGEBRAIC_COUNT;\n";
+        mImplementationAlgebraicCountString = "const size_t ALGEBRAIC_COUNT = [ALGEBRAIC_COUNT];\n";
+
         mVariableTypeObjectFamWoevString = "typedef enum {\n"
                                            "    CONSTANT,\n"
                                            "    COMPUTED_CONSTANT,\n"
@@ -562,6 +651,21 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                                             "[CODE]"
                                             "};\n";
 
+        mInterfaceConstantInfoString = "extern const VariableInfo CONSTANT_INFO[];\n";
+        mImplementationConstantInfoString = "const VariableInfo CONSTANT_INFO[] = {\n"
+                                            "[CODE]"
+                                            "};\n";
+
+        mInterfaceComputedConstantInfoString = "extern const VariableInfo COMPUTED_CONSTANT_INFO[];\n";
+        mImplementationComputedConstantInfoString = "const VariableInfo COMPUTED_CONSTANT_INFO[] = {\n"
+                                                    "[CODE]"
+                                                    "};\n";
+
+        mInterfaceAlgebraicInfoString = "extern const VariableInfo ALGEBRAIC_INFO[];\n";
+        mImplementationAlgebraicInfoString = "const VariableInfo ALGEBRAIC_INFO[] = {\n"
+                                             "[CODE]"
+                                             "};\n";
+
         mVariableInfoEntryString = "{\"[NAME]\", \"[UNITS]\", \"[COMPONENT]\", [TYPE]}";
 
         mVoiString = "voi";
@@ -569,36 +673,43 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mStatesArrayString = "states";
         mRatesArrayString = "rates";
         mVariablesArrayString = "variables";
+        mConstantsArrayString = "constants";
+        mComputedConstantsArrayString = "computedConstants";
+        mAlgebraicArrayString = "algebraic";
 
-        mExternalVariableMethodTypeDefinitionFamString = "typedef double (* ExternalVariable)(double *variables, size_t index);\n";
-        mExternalVariableMethodTypeDefinitionFdmString = "typedef double (* ExternalVariable)(double voi, double *states, double *rates, double *variables, size_t index);\n";
+        mVariablesParameterString = "double *[ARRAY]";
+        mVariablesMemberString = "    double *[ARRAY];\n";
+        mVariablesDataString = "    double *[ARRAY] = ((RootFindingInfo *) data)->[ARRAY];\n";
 
-        mExternalVariableMethodCallFamString = "externalVariable(variables, [INDEX])";
-        mExternalVariableMethodCallFdmString = "externalVariable(voi, states, rates, variables, [INDEX])";
+        mExternalVariableMethodTypeDefinitionFamString = "typedef double (* ExternalVariable)([VARIABLES_PARAMETERS], size_t index);\n";
+        mExternalVariableMethodTypeDefinitionFdmString = "typedef double (* ExternalVariable)(double voi, double *states, double *rates, [VARIABLES_PARAMETERS], size_t index);\n";
+
+        mExternalVariableMethodCallFamString = "externalVariable([VARIABLES_ARGUMENTS], [INDEX])";
+        mExternalVariableMethodCallFdmString = "externalVariable(voi, states, rates, [VARIABLES_ARGUMENTS], [INDEX])";
 
         mRootFindingInfoObjectFamString = "typedef struct {\n"
-                                          "    double *variables;\n"
+                                          "[VARIABLES_MEMBERS]"
                                           "} RootFindingInfo;\n";
         mRootFindingInfoObjectFdmString = "typedef struct {\n"
                                           "    double voi;\n"
                                           "    double *states;\n"
                                           "    double *rates;\n"
-                                          "    double *variables;\n"
+                                          "[VARIABLES_MEMBERS]"
                                           "} RootFindingInfo;\n";
         mExternNlaSolveMethodString = "extern void nlaSolve(void (*objectiveFunction)(double *, double *, void *),\n"
                                       "                     double *u, size_t n, void *data);\n";
-        mFindRootCallFamString = "findRoot[INDEX](variables);\n";
-        mFindRootCallFdmString = "findRoot[INDEX](voi, states, rates, variables);\n";
-        mFindRootMethodFamString = "void findRoot[INDEX](double *variables)\n"
+        mFindRootCallFamString = "findRoot[INDEX]([VARIABLES_ARGUMENTS]);\n";
+        mFindRootCallFdmString = "findRoot[INDEX](voi, states, rates, [VARIABLES_ARGUMENTS]);\n";
+        mFindRootMethodFamString = "void findRoot[INDEX]([VARIABLES_PARAMETERS])\n"
                                    "{\n"
-                                   "    RootFindingInfo rfi = { variables };\n"
+                                   "    RootFindingInfo rfi = { [VARIABLES_ARGUMENTS] };\n"
                                    "    double u[[SIZE]];\n"
                                    "\n"
                                    "[CODE]"
                                    "}\n";
-        mFindRootMethodFdmString = "void findRoot[INDEX](double voi, double *states, double *rates, double *variables)\n"
+        mFindRootMethodFdmString = "void findRoot[INDEX](double voi, double *states, double *rates, [VARIABLES_PARAMETERS])\n"
                                    "{\n"
-                                   "    RootFindingInfo rfi = { voi, states, rates, variables };\n"
+                                   "    RootFindingInfo rfi = { voi, states, rates, [VARIABLES_ARGUMENTS] };\n"
                                    "    double u[[SIZE]];\n"
                                    "\n"
                                    "[CODE]"
@@ -607,7 +718,7 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mNlaSolveCallFdmString = "nlaSolve(objectiveFunction[INDEX], u, [SIZE], &rfi);\n";
         mObjectiveFunctionMethodFamString = "void objectiveFunction[INDEX](double *u, double *f, void *data)\n"
                                             "{\n"
-                                            "    double *variables = ((RootFindingInfo *) data)->variables;\n"
+                                            "[VARIABLES_DATA]"
                                             "\n"
                                             "[CODE]"
                                             "}\n";
@@ -616,12 +727,118 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                                             "    double voi = ((RootFindingInfo *) data)->voi;\n"
                                             "    double *states = ((RootFindingInfo *) data)->states;\n"
                                             "    double *rates = ((RootFindingInfo *) data)->rates;\n"
-                                            "    double *variables = ((RootFindingInfo *) data)->variables;\n"
+                                            "[VARIABLES_DATA]"
+                                            "\n"
+                                            "[CODE]"
+                                            "}\n";
+        mObjectiveJacobianMethodFamString = "void objectiveJacobian[INDEX](double *u, double *jacobian, void *data)\n"
+                                            "{\n"
+                                            "[VARIABLES_DATA]"
                                             "\n"
                                             "[CODE]"
                                             "}\n";
+        mObjectiveJacobianMethodFdmString = "void objectiveJacobian[INDEX](double *u, double *jacobian, void *data)\n"
+                                            "{\n"
+                                            "    double voi = ((RootFindingInfo *) data)->voi;\n"
+                                            "    double *states = ((RootFindingInfo *) data)->states;\n"
+                                            "    double *rates = ((RootFindingInfo *) data)->rates;\n"
+                                            "[VARIABLES_DATA]"
+                                            "\n"
+                                            "[CODE]"
+                                            "}\n";
+        mFiniteDifferenceObjectiveJacobianMethodString = "void objectiveJacobian[INDEX](double *u, double *f, double *jacobian, void *data)\n"
+                                                         "{\n"
+                                                         "    double fh[[SIZE]];\n"
+                                                         "\n"
+                                                         "    for (size_t j = 0; j < [SIZE]; ++j) {\n"
+                                                         "        double uj = u[j];\n"
+                                                         "        double h = 1.0e-8*fmax(1.0, fabs(uj));\n"
+                                                         "\n"
+                                                         "        u[j] = uj+h;\n"
+                                                         "\n"
+                                                         "        objectiveFunction[INDEX](u, fh, data);\n"
+                                                         "\n"
+                                                         "        u[j] = uj;\n"
+                                                         "\n"
+                                                         "        for (size_t i = 0; i < [SIZE]; ++i) {\n"
+                                                         "            jacobian[i*[SIZE]+j] = (fh[i]-f[i])/h;\n"
+                                                         "        }\n"
+                                                         "    }\n"
+                                                         "}\n";
+        mNewtonSolveCallFamString = "for (int iteration = 0; iteration < 50; ++iteration) {\n"
+                                    "        double f[[SIZE]];\n"
+                                    "        double jacobian[[SIZE]*[SIZE]];\n"
+                                    "        int converged = 1;\n"
+                                    "\n"
+                                    "        objectiveFunction[INDEX](u, f, &rfi);\n"
+                                    "\n"
+                                    "        for (size_t i = 0; i < [SIZE]; ++i) {\n"
+                                    "            converged = converged && (fabs(f[i]) <= 1.0e-10);\n"
+                                    "        }\n"
+                                    "\n"
+                                    "        if (converged) {\n"
+                                    "            break;\n"
+                                    "        }\n"
+                                    "\n"
+                                    "        objectiveJacobian[INDEX](u, [F_ARGUMENT]jacobian, &rfi);\n"
+                                    "\n"
+                                    "[CODE]"
+                                    "    }\n";
+        mNewtonSolveCallFdmString = "for (int iteration = 0; iteration < 50; ++iteration) {\n"
+                                    "        double f[[SIZE]];\n"
+                                    "        double jacobian[[SIZE]*[SIZE]];\n"
+                                    "        int converged = 1;\n"
+                                    "\n"
+                                    "        objectiveFunction[INDEX](u, f, &rfi);\n"
+                                    "\n"
+                                    "        for (size_t i = 0; i < [SIZE]; ++i) {\n"
+                                    "            converged = converged && (fabs(f[i]) <= 1.0e-10);\n"
+                                    "        }\n"
+                                    "\n"
+                                    "        if (converged) {\n"
+                                    "            break;\n"
+                                    "        }\n"
+                                    "\n"
+                                    "        objectiveJacobian[INDEX](u, [F_ARGUMENT]jacobian, &rfi);\n"
+                                    "\n"
+                                    "[CODE]"
+                                    "    }\n";
         mUArrayString = "u";
         mFArrayString = "f";
+        mJacobianArrayString = "jacobian";
+        mSteadyStatesArrayString = "steadyStates";
+        mTimeConstantsArrayString = "timeConstants";
+        mConditionsArrayString = "conditions";
+        mEventsArrayString = "events";
+        mResetValuesArrayString = "resetValues";
+        mRootFunctionsArrayString = "g";
+
+        mInterfaceJacobianSparsityPatternString = "extern const size_t JACOBIAN_NONZERO_COUNT;\n"
+                                                  "extern const size_t JACOBIAN_ROW_POINTERS[];\n"
+                                                  "extern const size_t JACOBIAN_COLUMN_INDICES[];\n"
+                                                  "extern const size_t JACOBIAN_COLUMN_POINTERS[];\n"
+                                                  "extern const size_t JACOBIAN_ROW_INDICES[];\n";
+        mImplementationJacobianSparsityPatternString = "const size_t JACOBIAN_NONZERO_COUNT = [NONZERO_COUNT];\n"
+                                                       "const size_t JACOBIAN_ROW_POINTERS[] = {[ROW_POINTERS]};\n"
+                                                       "const size_t JACOBIAN_COLUMN_INDICES[] = {[COLUMN_INDICES]};\n"
+                                                       "const size_t JACOBIAN_COLUMN_POINTERS[] = {[COLUMN_POINTERS]};\n"
+                                                       "const size_t JACOBIAN_ROW_INDICES[] = {[ROW_INDICES]};\n";
+        mObjectiveJacobianSparsityPatternString = "static const size_t OBJECTIVE_JACOBIAN_[INDEX]_NONZERO_COUNT = [NONZERO_COUNT];\n"
+                                                  "static const size_t OBJECTIVE_JACOBIAN_[INDEX]_ROW_POINTERS[] = {[ROW_POINTERS]};\n"
+                                                  "static const size_t OBJECTIVE_JACOBIAN_[INDEX]_COLUMN_INDICES[] = {[COLUMN_INDICES]};\n"
+                                                  "static const size_t OBJECTIVE_JACOBIAN_[INDEX]_COLUMN_POINTERS[] = {[COLUMN_POINTERS]};\n"
+                                                  "static const size_t OBJECTIVE_JACOBIAN_[INDEX]_ROW_INDICES[] = {[ROW_INDICES]};\n";
+
+        mInterfaceGatingStateIndicesString = "extern const size_t GATING_STATE_COUNT;\n"
+                                             "extern const size_t GATING_STATE_INDICES[];\n";
+        mImplementationGatingStateIndicesString = "const size_t GATING_STATE_COUNT = [GATING_STATE_COUNT];\n"
+                                                  "const size_t GATING_STATE_INDICES[] = {[GATING_STATE_INDICES]};\n";
+
+        mInterfaceEventCountString = "extern const size_t EVENT_COUNT;\n";
+        mImplementationEventCountString = "const size_t EVENT_COUNT = [EVENT_COUNT];\n";
+
+        mInterfaceRootFunctionCountString = "extern const size_t ROOT_FUNCTION_COUNT;\n";
+        mImplementationRootFunctionCountString = "const size_t ROOT_FUNCTION_COUNT = [ROOT_FUNCTION_COUNT];\n";
 
         mInterfaceCreateStatesArrayMethodString = "double * createStatesArray();\n";
         mImplementationCreateStatesArrayMethodString = "double * createStatesArray()\n"
@@ -647,76 +864,144 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                                                           "    return res;\n"
                                                           "}\n";
 
+        mInterfaceCreateConstantsArrayMethodString = "double * createConstantsArray();\n";
+        mImplementationCreateConstantsArrayMethodString = "double * createConstantsArray()\n"
+                                                          "{\n"
+                                                          "    double *res = (double *) malloc(CONSTANT_COUNT*sizeof(double));\n"
+                                                          "\n"
+                                                          "    for (size_t i = 0; i < CONSTANT_COUNT; ++i) {\n"
+                                                          "        res[i] = NAN;\n"
+                                                          "    }\n"
+                                                          "\n"
+                                                          "    return res;\n"
+                                                          "}\n";
+
+        mInterfaceCreateComputedConstantsArrayMethodString = "double * createComputedConstantsArray();\n";
+        mImplementationCreateComputedConstantsArrayMethodString = "double * createComputedConstantsArray()\n"
+                                                                  "{\n"
+                                                                  "    double *res = (double *) malloc(COMPUTED_CONSTANT_COUNT*sizeof(double));\n"
+                                                                  "\n"
+                                                                  "    for (size_t i = 0; i < COMPUTED_CONSTANT_COUNT; ++i) {\n"
+                                                                  "        res[i] = NAN;\n"
+                                                                  "    }\n"
+                                                                  "\n"
+                                                                  "    return res;\n"
+                                                                  "}\n";
+
+        mInterfaceCreateAlgebraicArrayMethodString = "double * createAlgebraicArray();\n";
+        mImplementationCreateAlgebraicArrayMethodString = "double * createAlgebraicArray()\n"
+                                                          "{\n"
+                                                          "    double *res = (double *) malloc(ALGEBRAIC_COUNT*sizeof(double));\n"
+                                                          "\n"
+                                                          "    for (size_t i = 0; i < ALGEBRAIC_COUNT; ++i) {\n"
+                                                          "        res[i] = NAN;\n"
+                                                          "    }\n"
+                                                          "\n"
+                                                          "    return res;\n"
+                                                          "}\n";
+
         mInterfaceDeleteArrayMethodString = "void deleteArray(double *array);\n";
         mImplementationDeleteArrayMethodString = "void deleteArray(double *array)\n"
                                                  "{\n"
                                                  "    free(array);\n"
                                                  "}\n";
 
-        mInterfaceInitialiseVariablesMethodFamWoevString = "void initialiseVariables(double *variables);\n";
-        mImplementationInitialiseVariablesMethodFamWoevString = "void initialiseVariables(double *variables)\n"
+        mInterfaceInitialiseVariablesMethodFamWoevString = "void initialiseVariables([VARIABLES_PARAMETERS]);\n";
+        mImplementationInitialiseVariablesMethodFamWoevString = "void initialiseVariables([VARIABLES_PARAMETERS])\n"
                                                                 "{\n"
                                                                 "[CODE]"
                                                                 "}\n";
 
-        mInterfaceInitialiseVariablesMethodFamWevString = "void initialiseVariables(double *variables, ExternalVariable externalVariable);\n";
-        mImplementationInitialiseVariablesMethodFamWevString = "void initialiseVariables(double *variables, ExternalVariable externalVariable)\n"
+        mInterfaceInitialiseVariablesMethodFamWevString = "void initialiseVariables([VARIABLES_PARAMETERS], ExternalVariable externalVariable);\n";
+        mImplementationInitialiseVariablesMethodFamWevString = "void initialiseVariables([VARIABLES_PARAMETERS], ExternalVariable externalVariable)\n"
                                                                "{\n"
                                                                "[CODE]"
                                                                "}\n";
 
-        mInterfaceInitialiseVariablesMethodFdmWoevString = "void initialiseVariables(double *states, double *rates, double *variables);\n";
-        mImplementationInitialiseVariablesMethodFdmWoevString = "void initialiseVariables(double *states, double *rates, double *variables)\n"
+        mInterfaceInitialiseVariablesMethodFdmWoevString = "void initialiseVariables(double *states, double *rates, [VARIABLES_PARAMETERS]);\n";
+        mImplementationInitialiseVariablesMethodFdmWoevString = "void initialiseVariables(double *states, double *rates, [VARIABLES_PARAMETERS])\n"
                                                                 "{\n"
                                                                 "[CODE]"
                                                                 "}\n";
 
-        mInterfaceInitialiseVariablesMethodFdmWevString = "void initialiseVariables(double voi, double *states, double *rates, double *variables, ExternalVariable externalVariable);\n";
-        mImplementationInitialiseVariablesMethodFdmWevString = "void initialiseVariables(double voi, double *states, double *rates, double *variables, ExternalVariable externalVariable)\n"
+        mInterfaceInitialiseVariablesMethodFdmWevString = "void initialiseVariables(double voi, double *states, double *rates, [VARIABLES_PARAMETERS], ExternalVariable externalVariable);\n";
+        mImplementationInitialiseVariablesMethodFdmWevString = "void initialiseVariables(double voi, double *states, double *rates, [VARIABLES_PARAMETERS], ExternalVariable externalVariable)\n"
                                                                "{\n"
                                                                "[CODE]"
                                                                "}\n";
 
-        mInterfaceComputeComputedConstantsMethodString = "void computeComputedConstants(double *variables);\n";
-        mImplementationComputeComputedConstantsMethodString = "void computeComputedConstants(double *variables)\n"
+        mInterfaceComputeComputedConstantsMethodString = "void computeComputedConstants([VARIABLES_PARAMETERS]);\n";
+        mImplementationComputeComputedConstantsMethodString = "void computeComputedConstants([VARIABLES_PARAMETERS])\n"
                                                               "{\n"
                                                               "[CODE]"
                                                               "}\n";
 
-        mInterfaceComputeRatesMethodWoevString = "void computeRates(double voi, double *states, double *rates, double *variables);\n";
-        mImplementationComputeRatesMethodWoevString = "void computeRates(double voi, double *states, double *rates, double *variables)\n{\n"
+        mInterfaceComputeRatesMethodWoevString = "void computeRates(double voi, double *states, double *rates, [VARIABLES_PARAMETERS]);\n";
+        mImplementationComputeRatesMethodWoevString = "void computeRates(double voi, double *states, double *rates, [VARIABLES_PARAMETERS])\n{\n"
                                                       "[CODE]"
                                                       "}\n";
 
-        mInterfaceComputeRatesMethodWevString = "void computeRates(double voi, double *states, double *rates, double *variables, ExternalVariable externalVariable);\n";
-        mImplementationComputeRatesMethodWevString = "void computeRates(double voi, double *states, double *rates, double *variables, ExternalVariable externalVariable)\n{\n"
+        mInterfaceComputeRatesMethodWevString = "void computeRates(double voi, double *states, double *rates, [VARIABLES_PARAMETERS], ExternalVariable externalVariable);\n";
+        mImplementationComputeRatesMethodWevString = "void computeRates(double voi, double *states, double *rates, [VARIABLES_PARAMETERS], ExternalVariable externalVariable)\n{\n"
                                                      "[CODE]"
                                                      "}\n";
 
-        mInterfaceComputeVariablesMethodFamWoevString = "void computeVariables(double *variables);\n";
-        mImplementationComputeVariablesMethodFamWoevString = "void computeVariables(double *variables)\n"
+        mInterfaceComputeVariablesMethodFamWoevString = "void computeVariables([VARIABLES_PARAMETERS]);\n";
+        mImplementationComputeVariablesMethodFamWoevString = "void computeVariables([VARIABLES_PARAMETERS])\n"
                                                              "{\n"
                                                              "[CODE]"
                                                              "}\n";
 
-        mInterfaceComputeVariablesMethodFamWevString = "void computeVariables(double *variables, ExternalVariable externalVariable);\n";
-        mImplementationComputeVariablesMethodFamWevString = "void computeVariables(double *variables, ExternalVariable externalVariable)\n"
+        mInterfaceComputeVariablesMethodFamWevString = "void computeVariables([VARIABLES_PARAMETERS], ExternalVariable externalVariable);\n";
+        mImplementationComputeVariablesMethodFamWevString = "void computeVariables([VARIABLES_PARAMETERS], ExternalVariable externalVariable)\n"
                                                             "{\n"
                                                             "[CODE]"
                                                             "}\n";
 
-        mInterfaceComputeVariablesMethodFdmWoevString = "void computeVariables(double voi, double *states, double *rates, double *variables);\n";
-        mImplementationComputeVariablesMethodFdmWoevString = "void computeVariables(double voi, double *states, double *rates, double *variables)\n"
+        mInterfaceComputeVariablesMethodFdmWoevString = "void computeVariables(double voi, double *states, double *rates, [VARIABLES_PARAMETERS]);\n";
+        mImplementationComputeVariablesMethodFdmWoevString = "void computeVariables(double voi, double *states, double *rates, [VARIABLES_PARAMETERS])\n"
                                                              "{\n"
                                                              "[CODE]"
                                                              "}\n";
 
-        mInterfaceComputeVariablesMethodFdmWevString = "void computeVariables(double voi, double *states, double *rates, double *variables, ExternalVariable externalVariable);\n";
-        mImplementationComputeVariablesMethodFdmWevString = "void computeVariables(double voi, double *states, double *rates, double *variables, ExternalVariable externalVariable)\n"
+        mInterfaceComputeVariablesMethodFdmWevString = "void computeVariables(double voi, double *states, double *rates, [VARIABLES_PARAMETERS], ExternalVariable externalVariable);\n";
+        mImplementationComputeVariablesMethodFdmWevString = "void computeVariables(double voi, double *states, double *rates, [VARIABLES_PARAMETERS], ExternalVariable externalVariable)\n"
                                                             "{\n"
                                                             "[CODE]"
                                                             "}\n";
 
+        mInterfaceComputeJacobianMethodString = "void computeJacobian(double voi, double *states, double *rates, [VARIABLES_PARAMETERS], double *jacobian);\n";
+        mImplementationComputeJacobianMethodString = "void computeJacobian(double voi, double *states, double *rates, [VARIABLES_PARAMETERS], double *jacobian)\n"
+                                                     "{\n"
+                                                     "[CODE]"
+                                                     "}\n";
+
+        mInterfaceComputeGatingCoefficientsMethodString = "void computeGatingCoefficients(double voi, double *states, double *rates, [VARIABLES_PARAMETERS], double *steadyStates, double *timeConstants);\n";
+        mImplementationComputeGatingCoefficientsMethodString = "void computeGatingCoefficients(double voi, double *states, double *rates, [VARIABLES_PARAMETERS], double *steadyStates, double *timeConstants)\n"
+                                                               "{\n"
+                                                               "[CODE]"
+                                                               "}\n";
+
+        mInterfaceComputeEventConditionsMethodString = "void computeEventConditions(double voi, double *states, double *rates, [VARIABLES_PARAMETERS], double *conditions);\n";
+        mImplementationComputeEventConditionsMethodString = "void computeEventConditions(double voi, double *states, double *rates, [VARIABLES_PARAMETERS], double *conditions)\n"
+                                                            "{\n"
+                                                            "[CODE]"
+                                                            "}\n";
+
+        mInterfaceApplyResetsMethodString = "void applyResets(double voi, double *states, double *rates, [VARIABLES_PARAMETERS], int *events);\n";
+        mImplementationApplyResetsMethodString = "void applyResets(double voi, double *states, double *rates, [VARIABLES_PARAMETERS], int *events)\n"
+                                                 "{\n"
+                                                 "    double resetValues[[RESET_VARIABLE_COUNT]];\n"
+                                                 "\n"
+                                                 "[CODE]"
+                                                 "}\n";
+
+        mInterfaceComputeRootFunctionsMethodString = "void computeRootFunctions(double voi, double *states, double *rates, [VARIABLES_PARAMETERS], double *g);\n";
+        mImplementationComputeRootFunctionsMethodString = "void computeRootFunctions(double voi, double *states, double *rates, [VARIABLES_PARAMETERS], double *g)\n"
+                                                          "{\n"
+                                                          "[CODE]"
+                                                          "}\n";
+
         mEmptyMethodString = "";
 
         mIndentString = "    ";
@@ -732,7 +1017,7 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mStringDelimiterString = "\"";
 
         mCommandSeparatorString = ";";
-    } else { // GeneratorProfile::Profile::PYTHON.
+    } else { // GeneratorProfile::Profile::PYTHON and GeneratorProfile::Profile::NUMPY.
         // Whether the profile requires an interface to be generated.
 
         mHasInterface = false;
@@ -937,6 +1222,15 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mInterfaceVariableCountString = "";
         mImplementationVariableCountString = "VARIABLE_COUNT = [VARIABLE_COUNT]\n";
 
+        mInterfaceConstantCountString = "";
+        mImplementationConstantCountString = "CONSTANT_COUNT = [CONSTANT_COUNT]\n";
+
+        mInterfaceComputedConstantCountString = "";
+        mImplementationComputedConstantCountString = "COMPUTED_CONSTANT_COUNT = [COMPUTED_CONSTANT_COUNT]\n";
+
+        mInterfaceAlgebraicCountString = "";
+        mImplementationAlgebraicCountString = "ALGEBRAIC_COUNT = [ALGEBRAIC_COUNT]\n";
+
         mVariableTypeObjectFamWoevString = "\n"
                                            "class VariableType(Enum):\n"
                                            "    CONSTANT = 0\n"
@@ -990,6 +1284,21 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                                             "[CODE]"
                                             "]\n";
 
+        mInterfaceConstantInfoString = "";
+        mImplementationConstantInfoString = "CONSTANT_INFO = [\n"
+                                            "[CODE]"
+                                            "]\n";
+
+        mInterfaceComputedConstantInfoString = "";
+        mImplementationComputedConstantInfoString = "COMPUTED_CONSTANT_INFO = [\n"
+                                                    "[CODE]"
+                                                    "]\n";
+
+        mInterfaceAlgebraicInfoString = "";
+        mImplementationAlgebraicInfoString = "ALGEBRAIC_INFO = [\n"
+                                             "[CODE]"
+                                             "]\n";
+
         mVariableInfoEntryString = "{\"name\": \"[NAME]\", \"units\": \"[UNITS]\", \"component\": \"[COMPONENT]\", \"type\": [TYPE]}";
 
         mVoiString = "voi";
@@ -997,35 +1306,42 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mStatesArrayString = "states";
         mRatesArrayString = "rates";
         mVariablesArrayString = "variables";
+        mConstantsArrayString = "constants";
+        mComputedConstantsArrayString = "computed_constants";
+        mAlgebraicArrayString = "algebraic";
+
+        mVariablesParameterString = "[ARRAY]";
+        mVariablesMemberString = "";
+        mVariablesDataString = "    [ARRAY] = data[[INDEX]]\n";
 
         mExternalVariableMethodTypeDefinitionFamString = "";
         mExternalVariableMethodTypeDefinitionFdmString = "";
 
-        mExternalVariableMethodCallFamString = "external_variable(variables, [INDEX])";
-        mExternalVariableMethodCallFdmString = "external_variable(voi, states, rates, variables, [INDEX])";
+        mExternalVariableMethodCallFamString = "external_variable([VARIABLES_ARGUMENTS], [INDEX])";
+        mExternalVariableMethodCallFdmString = "external_variable(voi, states, rates, [VARIABLES_ARGUMENTS], [INDEX])";
 
         mRootFindingInfoObjectFamString = "";
         mRootFindingInfoObjectFdmString = "";
         mExternNlaSolveMethodString = "\n"
                                       "from nlasolver import nla_solve"
                                       "\n";
-        mFindRootCallFamString = "find_root_[INDEX](variables)\n";
-        mFindRootCallFdmString = "find_root_[INDEX](voi, states, rates, variables)\n";
+        mFindRootCallFamString = "find_root_[INDEX]([VARIABLES_ARGUMENTS])\n";
+        mFindRootCallFdmString = "find_root_[INDEX](voi, states, rates, [VARIABLES_ARGUMENTS])\n";
         mFindRootMethodFamString = "\n"
-                                   "def find_root_[INDEX](variables):\n"
+                                   "def find_root_[INDEX]([VARIABLES_PARAMETERS]):\n"
                                    "    u = [nan]*[SIZE]\n"
                                    "\n"
                                    "[CODE]";
         mFindRootMethodFdmString = "\n"
-                                   "def find_root_[INDEX](voi, states, rates, variables):\n"
+                                   "def find_root_[INDEX](voi, states, rates, [VARIABLES_PARAMETERS]):\n"
                                    "    u = [nan]*[SIZE]\n"
                                    "\n"
                                    "[CODE]";
-        mNlaSolveCallFamString = "u = nla_solve(objective_function_[INDEX], u, [SIZE], [variables])\n";
-        mNlaSolveCallFdmString = "u = nla_solve(objective_function_[INDEX], u, [SIZE], [voi, states, rates, variables])\n";
+        mNlaSolveCallFamString = "u = nla_solve(objective_function_[INDEX], u, [SIZE], [[VARIABLES_ARGUMENTS]])\n";
+        mNlaSolveCallFdmString = "u = nla_solve(objective_function_[INDEX], u, [SIZE], [voi, states, rates, [VARIABLES_ARGUMENTS]])\n";
         mObjectiveFunctionMethodFamString = "\n"
                                             "def objective_function_[INDEX](u, f, data):\n"
-                                            "    variables = data[0]\n"
+                                            "[VARIABLES_DATA]"
                                             "\n"
                                             "[CODE]";
         mObjectiveFunctionMethodFdmString = "\n"
@@ -1033,11 +1349,98 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                                             "    voi = data[0]\n"
                                             "    states = data[1]\n"
                                             "    rates = data[2]\n"
-                                            "    variables = data[3]\n"
+                                            "[VARIABLES_DATA]"
                                             "\n"
                                             "[CODE]";
+        mObjectiveJacobianMethodFamString = "\n"
+                                            "def objective_jacobian_[INDEX](u, jacobian, data):\n"
+                                            "[VARIABLES_DATA]"
+                                            "\n"
+                                            "[CODE]";
+        mObjectiveJacobianMethodFdmString = "\n"
+                                            "def objective_jacobian_[INDEX](u, jacobian, data):\n"
+                                            "    voi = data[0]\n"
+                                            "    states = data[1]\n"
+                                            "    rates = data[2]\n"
+                                            "[VARIABLES_DATA]"
+                                            "\n"
+                                            "[CODE]";
+        mFiniteDifferenceObjectiveJacobianMethodString = "\n"
+                                                         "def objective_jacobian_[INDEX](u, f, jacobian, data):\n"
+                                                         "    fh = [nan]*[SIZE]\n"
+                                                         "\n"
+                                                         "    for j in range([SIZE]):\n"
+                                                         "        uj = u[j]\n"
+                                                         "        h = 1.0e-8*max(1.0, fabs(uj))\n"
+                                                         "\n"
+                                                         "        u[j] = uj+h\n"
+                                                         "\n"
+                                                         "        objective_function_[INDEX](u, fh, data)\n"
+                                                         "\n"
+                                                         "        u[j] = uj\n"
+                                                         "\n"
+                                                         "        for i in range([SIZE]):\n"
+                                                         "            jacobian[i*[SIZE]+j] = (fh[i]-f[i])/h\n";
+        mNewtonSolveCallFamString = "data = [[VARIABLES_ARGUMENTS]]\n"
+                                    "\n"
+                                    "    for iteration in range(50):\n"
+                                    "        f = [nan]*[SIZE]\n"
+                                    "        jacobian = [nan]*[SIZE]*[SIZE]\n"
+                                    "\n"
+                                    "        objective_function_[INDEX](u, f, data)\n"
+                                    "\n"
+                                    "        if all(fabs(f[i]) <= 1.0e-10 for i in range([SIZE])):\n"
+                                    "            break\n"
+                                    "\n"
+                                    "        objective_jacobian_[INDEX](u, [F_ARGUMENT]jacobian, data)\n"
+                                    "\n"
+                                    "[CODE]";
+        mNewtonSolveCallFdmString = "data = [voi, states, rates, [VARIABLES_ARGUMENTS]]\n"
+                                    "\n"
+                                    "    for iteration in range(50):\n"
+                                    "        f = [nan]*[SIZE]\n"
+                                    "        jacobian = [nan]*[SIZE]*[SIZE]\n"
+                                    "\n"
+                                    "        objective_function_[INDEX](u, f, data)\n"
+                                    "\n"
+                                    "        if all(fabs(f[i]) <= 1.0e-10 for i in range([SIZE])):\n"
+                                    "            break\n"
+                                    "\n"
+                                    "        objective_jacobian_[INDEX](u, [F_ARGUMENT]jacobian, data)\n"
+                                    "\n"
+                                    "[CODE]";
         mUArrayString = "u";
         mFArrayString = "f";
+        mJacobianArrayString = "jacobian";
+        mSteadyStatesArrayString = "steady_states";
+        mTimeConstantsArrayString = "time_constants";
+        mConditionsArrayString = "conditions";
+        mEventsArrayString = "events";
+        mResetValuesArrayString = "reset_values";
+        mRootFunctionsArrayString = "g";
+
+        mInterfaceJacobianSparsityPatternString = "";
+        mImplementationJacobianSparsityPatternString = "JACOBIAN_NONZERO_COUNT = [NONZERO_COUNT]\n"
+                                                       "JACOBIAN_ROW_POINTERS = [[ROW_POINTERS]]\n"
+                                                       "JACOBIAN_COLUMN_INDICES = [[COLUMN_INDICES]]\n"
+                                                       "JACOBIAN_COLUMN_POINTERS = [[COLUMN_POINTERS]]\n"
+                                                       "JACOBIAN_ROW_INDICES = [[ROW_INDICES]]\n";
+        mObjectiveJacobianSparsityPatternString = "\n"
+                                                  "OBJECTIVE_JACOBIAN_[INDEX]_NONZERO_COUNT = [NONZERO_COUNT]\n"
+                                                  "OBJECTIVE_JACOBIAN_[INDEX]_ROW_POINTERS = [[ROW_POINTERS]]\n"
+                                                  "OBJECTIVE_JACOBIAN_[INDEX]_COLUMN_INDICES = [[COLUMN_INDICES]]\n"
+                                                  "OBJECTIVE_JACOBIAN_[INDEX]_COLUMN_POINTERS = [[COLUMN_POINTERS]]\n"
+                                                  "OBJECTIVE_JACOBIAN_[INDEX]_ROW_INDICES = [[ROW_INDICES]]\n";
+
+        mInterfaceGatingStateIndicesString = "";
+        mImplementationGatingStateIndicesString = "GATING_STATE_COUNT = [GATING_STATE_COUNT]\n"
+                                                  "GATING_STATE_INDICES = [[GATING_STATE_INDICES]]\n";
+
+        mInterfaceEventCountString = "";
+        mImplementationEventCountString = "EVENT_COUNT = [EVENT_COUNT]\n";
+
+        mInterfaceRootFunctionCountString = "";
+        mImplementationRootFunctionCountString = "ROOT_FUNCTION_COUNT = [ROOT_FUNCTION_COUNT]\n";
 
         mInterfaceCreateStatesArrayMethodString = "";
         mImplementationCreateStatesArrayMethodString = "\n"
@@ -1049,64 +1452,106 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                                                           "def create_variables_array():\n"
                                                           "    return [nan]*VARIABLE_COUNT\n";
 
+        mInterfaceCreateConstantsArrayMethodString = "";
+        mImplementationCreateConstantsArrayMethodString = "\n"
+                                                          "def create_constants_array():\n"
+                                                          "    return [nan]*CONSTANT_COUNT\n";
+
+        mInterfaceCreateComputedConstantsArrayMethodString = "";
+        mImplementationCreateComputedConstantsArrayMethodString = "\n"
+                                                                  "def create_computed_constants_array():\n"
+                                                                  "    return [nan]*COMPUTED_CONSTANT_COUNT\n";
+
+        mInterfaceCreateAlgebraicArrayMethodString = "";
+        mImplementationCreateAlgebraicArrayMethodString = "\n"
+                                                          "def create_algebraic_array():\n"
+                                                          "    return [nan]*ALGEBRAIC_COUNT\n";
+
         mInterfaceDeleteArrayMethodString = "";
         mImplementationDeleteArrayMethodString = "";
 
         mInterfaceInitialiseVariablesMethodFamWoevString = "";
         mImplementationInitialiseVariablesMethodFamWoevString = "\n"
-                                                                "def initialise_variables(variables):\n"
+                                                                "def initialise_variables([VARIABLES_PARAMETERS]):\n"
                                                                 "[CODE]";
 
         mInterfaceInitialiseVariablesMethodFamWevString = "";
         mImplementationInitialiseVariablesMethodFamWevString = "\n"
-                                                               "def initialise_variables(variables, external_variable):\n"
+                                                               "def initialise_variables([VARIABLES_PARAMETERS], external_variable):\n"
                                                                "[CODE]";
 
         mInterfaceInitialiseVariablesMethodFdmWoevString = "";
         mImplementationInitialiseVariablesMethodFdmWoevString = "\n"
-                                                                "def initialise_variables(states, rates, variables):\n"
+                                                                "def initialise_variables(states, rates, [VARIABLES_PARAMETERS]):\n"
                                                                 "[CODE]";
 
         mInterfaceInitialiseVariablesMethodFdmWevString = "";
         mImplementationInitialiseVariablesMethodFdmWevString = "\n"
-                                                               "def initialise_variables(voi, states, rates, variables, external_variable):\n"
+                                                               "def initialise_variables(voi, states, rates, [VARIABLES_PARAMETERS], external_variable):\n"
                                                                "[CODE]";
 
         mInterfaceComputeComputedConstantsMethodString = "";
         mImplementationComputeComputedConstantsMethodString = "\n"
-                                                              "def compute_computed_constants(variables):\n"
+                                                              "def compute_computed_constants([VARIABLES_PARAMETERS]):\n"
                                                               "[CODE]";
 
         mInterfaceComputeRatesMethodWoevString = "";
         mImplementationComputeRatesMethodWoevString = "\n"
-                                                      "def compute_rates(voi, states, rates, variables):\n"
+                                                      "def compute_rates(voi, states, rates, [VARIABLES_PARAMETERS]):\n"
                                                       "[CODE]";
 
         mInterfaceComputeRatesMethodWevString = "";
         mImplementationComputeRatesMethodWevString = "\n"
-                                                     "def compute_rates(voi, states, rates, variables, external_variable):\n"
+                                                     "def compute_rates(voi, states, rates, [VARIABLES_PARAMETERS], external_variable):\n"
                                                      "[CODE]";
 
         mInterfaceComputeVariablesMethodFamWoevString = "";
         mImplementationComputeVariablesMethodFamWoevString = "\n"
-                                                             "def compute_variables(variables):\n"
+                                                             "def compute_variables([VARIABLES_PARAMETERS]):\n"
                                                              "[CODE]";
 
         mInterfaceComputeVariablesMethodFamWevString = "";
         mImplementationComputeVariablesMethodFamWevString = "\n"
-                                                            "def compute_variables(variables, external_variable):\n"
+                                                            "def compute_variables([VARIABLES_PARAMETERS], external_variable):\n"
                                                             "[CODE]";
 
         mInterfaceComputeVariablesMethodFdmWoevString = "";
         mImplementationComputeVariablesMethodFdmWoevString = "\n"
-                                                             "def compute_variables(voi, states, rates, variables):\n"
+                                                             "def compute_variables(voi, states, rates, [VARIABLES_PARAMETERS]):\n"
                                                              "[CODE]";
 
         mInterfaceComputeVariablesMethodFdmWevString = "";
         mImplementationComputeVariablesMethodFdmWevString = "\n"
-                                                            "def compute_variables(voi, states, rates, variables, external_variable):\n"
+                                                            "def compute_variables(voi, states, rates, [VARIABLES_PARAMETERS], external_variable):\n"
+                                                            "[CODE]";
+
+        mInterfaceComputeJacobianMethodString = "";
+        mImplementationComputeJacobianMethodString = "\n"
+                                                     "def compute_jacobian(voi, states, rates, [VARIABLES_PARAMETERS], jacobian):\n"
+                                                     "[CODE]";
+
+        mInterfaceComputeGatingCoefficientsMethodString = "";
+        mImplementationComputeGatingCoefficientsMethodString = "\n"
+                                                               "def compute_gating_coefficients(voi, states, rates, [VARIABLES_PARAMETERS], steady_states, time_constants):\n"
+                                                               "[CODE]";
+
+        mInterfaceComputeEventConditionsMethodString = "";
+        mImplementationComputeEventConditionsMethodString = "\n"
+                                                            "def compute_event_conditions(voi, states, rates, [VARIABLES_PARAMETERS], conditions):\n"
                                                             "[CODE]";
 
+        mInterfaceApplyResetsMethodString = "";
+        mImplementationApplyResetsMethodString = "\n"
+                                                 "def apply_resets(voi, states, rates, [VARIABLES_PARAMETERS], events):\n"
+                                                 "    reset_values = [nan]*[RESET_VARIABLE_COUNT]\n"
+                                                 "\n"
+                                                 "[CODE]";
+
+        mInterfaceComputeRootFunctionsMethodString = "";
+        mImplementationComputeRootFunctionsMethodString = "\n"
+                                                          "def compute_root_functions(voi, states, rates, [VARIABLES_PARAMETERS], g):\n"
+                                                          "[CODE]";
+
         mEmptyMethodString = "pass\n";
 
         mIndentString = "    ";
@@ -1122,6 +1567,310 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mStringDelimiterString = "\"";
 
         mCommandSeparatorString = "";
+
+        if (profile == GeneratorProfile::Profile::NUMPY) {
+            // A NumPy profile is a Python profile where each state, rate and
+            // variable is a NumPy array over cells, hence we use NumPy's
+            // universal functions rather than Python's scalar functions and
+            // operators.
+
+            // Relational and logical operators.
+
+            mEqString = "np.equal";
+            mNeqString = "np.not_equal";
+            mLtString = "np.less";
+            mLeqString = "np.less_equal";
+            mGtString = "np.greater";
+            mGeqString = "np.greater_equal";
+            mAndString = "np.logical_and";
+            mOrString = "np.logical_or";
+            mXorString = "np.logical_xor";
+            mNotString = "np.logical_not";
+
+            // Arithmetic operators.
+
+            mPowerString = "np.power";
+            mSquareRootString = "np.sqrt";
+            mAbsoluteValueString = "np.fabs";
+            mExponentialString = "np.exp";
+            mNaturalLogarithmString = "np.log";
+            mCommonLogarithmString = "np.log10";
+            mCeilingString = "np.ceil";
+            mFloorString = "np.floor";
+            mMinString = "np.minimum";
+            mMaxString = "np.maximum";
+            mRemString = "np.fmod";
+
+            // Trigonometric operators.
+
+            mSinString = "np.sin";
+            mCosString = "np.cos";
+            mTanString = "np.tan";
+            mSinhString = "np.sinh";
+            mCoshString = "np.cosh";
+            mTanhString = "np.tanh";
+            mAsinString = "np.arcsin";
+            mAcosString = "np.arccos";
+            mAtanString = "np.arctan";
+            mAsinhString = "np.arcsinh";
+            mAcoshString = "np.arccosh";
+            mAtanhString = "np.arctanh";
+
+            // Piecewise statement.
+
+            mConditionalOperatorIfString = "";
+            mConditionalOperatorElseString = "";
+            mPiecewiseIfString = "np.where([CONDITION], [IF_STATEMENT]";
+            mPiecewiseElseString = ", [ELSE_STATEMENT])";
+
+            mHasConditionalOperator = false;
+
+            // Constants.
+
+            mInfString = "np.inf";
+            mNanString = "np.nan";
+
+            // Arithmetic functions.
+
+            mEqFunctionString = "";
+            mNeqFunctionString = "";
+            mLtFunctionString = "";
+            mLeqFunctionString = "";
+            mGtFunctionString = "";
+            mGeqFunctionString = "";
+            mAndFunctionString = "";
+            mOrFunctionString = "";
+            mXorFunctionString = "";
+            mNotFunctionString = "";
+            mMinFunctionString = "";
+            mMaxFunctionString = "";
+
+            // Trigonometric functions.
+
+            mSecFunctionString = "\n"
+                                 "def sec(x):\n"
+                                 "    return 1.0/np.cos(x)\n";
+            mCscFunctionString = "\n"
+                                 "def csc(x):\n"
+                                 "    return 1.0/np.sin(x)\n";
+            mCotFunctionString = "\n"
+                                 "def cot(x):\n"
+                                 "    return 1.0/np.tan(x)\n";
+            mSechFunctionString = "\n"
+                                  "def sech(x):\n"
+                                  "    return 1.0/np.cosh(x)\n";
+            mCschFunctionString = "\n"
+                                  "def csch(x):\n"
+                                  "    return 1.0/np.sinh(x)\n";
+            mCothFunctionString = "\n"
+                                  "def coth(x):\n"
+                                  "    return 1.0/np.tanh(x)\n";
+            mAsecFunctionString = "\n"
+                                  "def asec(x):\n"
+                                  "    return np.arccos(1.0/x)\n";
+            mAcscFunctionString = "\n"
+                                  "def acsc(x):\n"
+                                  "    return np.arcsin(1.0/x)\n";
+            mAcotFunctionString = "\n"
+                                  "def acot(x):\n"
+                                  "    return np.arctan(1.0/x)\n";
+            mAsechFunctionString = "\n"
+                                   "def asech(x):\n"
+                                   "    one_over_x = 1.0/x\n"
+                                   "\n"
+                                   "    return np.log(one_over_x+np.sqrt(one_over_x*one_over_x-1.0))\n";
+            mAcschFunctionString = "\n"
+                                   "def acsch(x):\n"
+                                   "    one_over_x = 1.0/x\n"
+                                   "\n"
+                                   "    return np.log(one_over_x+np.sqrt(one_over_x*one_over_x+1.0))\n";
+            mAcothFunctionString = "\n"
+                                   "def acoth(x):\n"
+                                   "    one_over_x = 1.0/x\n"
+                                   "\n"
+                                   "    return 0.5*np.log((1.0+one_over_x)/(1.0-one_over_x))\n";
+
+            // Miscellaneous.
+
+            mImplementationHeaderString = "from enum import Enum\n"
+                                          "\n"
+                                          "import numpy as np\n"
+                                          "\n";
+
+            mImplementationVersionString = "__version__ = \"0.1.0\"\n";
+
+            mFindRootMethodFamString = "\n"
+                                       "def find_root_[INDEX]([VARIABLES_PARAMETERS]):\n"
+                                       "    u = [np.nan]*[SIZE]\n"
+                                       "\n"
+                                       "[CODE]";
+            mFindRootMethodFdmString = "\n"
+                                       "def find_root_[INDEX](voi, states, rates, [VARIABLES_PARAMETERS]):\n"
+                                       "    u = [np.nan]*[SIZE]\n"
+                                       "\n"
+                                       "[CODE]";
+
+            // Note: our unknowns are views on rows of our arrays, so we work on
+            //       copies of them, so that perturbing them or storing them in
+            //       our arrays doesn't alter the values that we saved.
+
+            mFiniteDifferenceObjectiveJacobianMethodString = "\n"
+                                                             "def objective_jacobian_[INDEX](u, f, jacobian, data):\n"
+                                                             "    fh = [np.nan]*[SIZE]\n"
+                                                             "\n"
+                                                             "    for j in range([SIZE]):\n"
+                                                             "        uj = u[j].copy()\n"
+                                                             "        h = 1.0e-8*np.maximum(1.0, np.fabs(uj))\n"
+                                                             "\n"
+                                                             "        u[j] = uj+h\n"
+                                                             "\n"
+                                                             "        objective_function_[INDEX](u, fh, data)\n"
+                                                             "\n"
+                                                             "        u[j] = uj\n"
+                                                             "\n"
+                                                             "        for i in range([SIZE]):\n"
+                                                             "            jacobian[i*[SIZE]+j] = (fh[i]-f[i])/h\n";
+            mNewtonSolveCallFamString = "u = [ui.copy() for ui in u]\n"
+                                        "    data = [[VARIABLES_ARGUMENTS]]\n"
+                                        "\n"
+                                        "    for iteration in range(50):\n"
+                                        "        f = [np.nan]*[SIZE]\n"
+                                        "        jacobian = [np.nan]*[SIZE]*[SIZE]\n"
+                                        "\n"
+                                        "        objective_function_[INDEX](u, f, data)\n"
+                                        "\n"
+                                        "        if all(np.all(np.fabs(f[i]) <= 1.0e-10) for i in range([SIZE])):\n"
+                                        "            break\n"
+                                        "\n"
+                                        "        objective_jacobian_[INDEX](u, [F_ARGUMENT]jacobian, data)\n"
+                                        "\n"
+                                        "[CODE]";
+            mNewtonSolveCallFdmString = "u = [ui.copy() for ui in u]\n"
+                                        "    data = [voi, states, rates, [VARIABLES_ARGUMENTS]]\n"
+                                        "\n"
+                                        "    for iteration in range(50):\n"
+                                        "        f = [np.nan]*[SIZE]\n"
+                                        "        jacobian = [np.nan]*[SIZE]*[SIZE]\n"
+                                        "\n"
+                                        "        objective_function_[INDEX](u, f, data)\n"
+                                        "\n"
+                                        "        if all(np.all(np.fabs(f[i]) <= 1.0e-10) for i in range([SIZE])):\n"
+                                        "            break\n"
+                                        "\n"
+                                        "        objective_jacobian_[INDEX](u, [F_ARGUMENT]jacobian, data)\n"
+                                        "\n"
+                                        "[CODE]";
+
+            mImplementationCreateStatesArrayMethodString = "\n"
+                                                           "def create_states_array(cell_count=1):\n"
+                                                           "    return np.full((STATE_COUNT, cell_count), np.nan)\n";
+            mImplementationCreateVariablesArrayMethodString = "\n"
+                                                              "def create_variables_array(cell_count=1):\n"
+                                                              "    return np.full((VARIABLE_COUNT, cell_count), np.nan)\n";
+            mImplementationCreateConstantsArrayMethodString = "\n"
+                                                              "def create_constants_array(cell_count=1):\n"
+                                                              "    return np.full((CONSTANT_COUNT, cell_count), np.nan)\n";
+            mImplementationCreateComputedConstantsArrayMethodString = "\n"
+                                                                      "def create_computed_constants_array(cell_count=1):\n"
+                                                                      "    return np.full((COMPUTED_CONSTANT_COUNT, cell_count), np.nan)\n";
+            mImplementationCreateAlgebraicArrayMethodString = "\n"
+                                                              "def create_algebraic_array(cell_count=1):\n"
+                                                              "    return np.full((ALGEBRAIC_COUNT, cell_count), np.nan)\n";
+
+            mImplementationApplyResetsMethodString = "\n"
+                                                     "def apply_resets(voi, states, rates, [VARIABLES_PARAMETERS], events):\n"
+                                                     "    reset_values = [np.nan]*[RESET_VARIABLE_COUNT]\n"
+                                                     "\n"
+                                                     "[CODE]";
+        }
+    }
+
+    expandVariablesTags();
+}
+
+void GeneratorProfile::GeneratorProfileImpl::expandVariablesTags()
+{
+    // Our default method strings use the tags that stand for the variables
+    // array(s), so that they can be used whether or not the variables array is
+    // split.  Expand those tags for the variables array, keeping track of the
+    // tagged version of our default method strings, so that it can be used
+    // instead when the variables array is split (see variablesTagsString()).
+    // Note: in the data of an objective function, the variables array comes
+    //       after the variable of integration, states and rates, if any.
+
+    mVariablesTagsStrings.clear();
+
+    auto parametersCode = replaceAll(mVariablesParameterString, "[ARRAY]", mVariablesArrayString);
+    auto membersCode = replaceAll(mVariablesMemberString, "[ARRAY]", mVariablesArrayString);
+    auto expand = [&](std::string &string, size_t dataIndex) {
+        auto res = replaceAll(replaceAll(replaceAll(replaceAll(string,
+                                                               "[VARIABLES_DATA]", replaceAll(replaceAll(mVariablesDataString, "[ARRAY]", mVariablesArrayString),
+                                                                                              "[INDEX]", convertToString(dataIndex))),
+                                                    "[VARIABLES_MEMBERS]", membersCode),
+                                         "[VARIABLES_PARAMETERS]", parametersCode),
+                              "[VARIABLES_ARGUMENTS]", mVariablesArrayString);
+
+        if (res != string) {
+            mVariablesTagsStrings[res] = string;
+
+            string = res;
+        }
+    };
+
+    for (auto string : {&mExternalVariableMethodCallFamString,
+                        &mExternalVariableMethodTypeDefinitionFamString,
+                        &mFindRootCallFamString,
+                        &mFindRootMethodFamString,
+                        &mImplementationComputeVariablesMethodFamWevString,
+                        &mImplementationComputeVariablesMethodFamWoevString,
+                        &mImplementationInitialiseVariablesMethodFamWevString,
+                        &mImplementationInitialiseVariablesMethodFamWoevString,
+                        &mInterfaceComputeVariablesMethodFamWevString,
+                        &mInterfaceComputeVariablesMethodFamWoevString,
+                        &mInterfaceInitialiseVariablesMethodFamWevString,
+                        &mInterfaceInitialiseVariablesMethodFamWoevString,
+                        &mNewtonSolveCallFamString,
+                        &mNlaSolveCallFamString,
+                        &mObjectiveFunctionMethodFamString,
+                        &mObjectiveJacobianMethodFamString,
+                        &mRootFindingInfoObjectFamString}) {
+        expand(*string, 0);
+    }
+
+    for (auto string : {&mExternalVariableMethodCallFdmString,
+                        &mExternalVariableMethodTypeDefinitionFdmString,
+                        &mFindRootCallFdmString,
+                        &mFindRootMethodFdmString,
+                        &mImplementationApplyResetsMethodString,
+                        &mImplementationComputeComputedConstantsMethodString,
+                        &mImplementationComputeEventConditionsMethodString,
+                        &mImplementationComputeGatingCoefficientsMethodString,
+                        &mImplementationComputeJacobianMethodString,
+                        &mImplementationComputeRatesMethodWevString,
+                        &mImplementationComputeRatesMethodWoevString,
+                        &mImplementationComputeRootFunctionsMethodString,
+                        &mImplementationComputeVariablesMethodFdmWevString,
+                        &mImplementationComputeVariablesMethodFdmWoevString,
+                        &mImplementationInitialiseVariablesMethodFdmWevString,
+                        &mImplementationInitialiseVariablesMethodFdmWoevString,
+                        &mInterfaceApplyResetsMethodString,
+                        &mInterfaceComputeComputedConstantsMethodString,
+                        &mInterfaceComputeEventConditionsMethodString,
+                        &mInterfaceComputeGatingCoefficientsMethodString,
+                        &mInterfaceComputeJacobianMethodString,
+                        &mInterfaceComputeRatesMethodWevString,
+                        &mInterfaceComputeRatesMethodWoevString,
+                        &mInterfaceComputeRootFunctionsMethodString,
+                        &mInterfaceComputeVariablesMethodFdmWevString,
+                        &mInterfaceComputeVariablesMethodFdmWoevString,
+                        &mInterfaceInitialiseVariablesMethodFdmWevString,
+                        &mInterfaceInitialiseVariablesMethodFdmWoevString,
+                        &mNewtonSolveCallFdmString,
+                        &mNlaSolveCallFdmString,
+                        &mObjectiveFunctionMethodFdmString,
+                        &mObjectiveJacobianMethodFdmString,
+                        &mRootFindingInfoObjectFdmString}) {
+        expand(*string, 3);
     }
 }
 
@@ -1141,6 +1890,19 @@ GeneratorProfilePtr GeneratorProfile::create(Profile profile) noexcept
     return std::shared_ptr<GeneratorProfile> {new GeneratorProfile {profile}};
 }
 
+std::string GeneratorProfile::variablesTagsString(const std::string &string) const
+{
+    // Return the version of the given method string that uses the tags that
+    // stand for the variables array(s), if it is one of our default method
+    // strings, or the given method string itself otherwise.
+
+    auto variablesTagsString = mPimpl->mVariablesTagsStrings.find(string);
+
+    return (variablesTagsString != mPimpl->mVariablesTagsStrings.end()) ?
+               variablesTagsString->second :
+               string;
+}
+
 GeneratorProfile::Profile GeneratorProfile::profile() const
 {
     return mPimpl->mProfile;
@@ -1148,7 +1910,8 @@ GeneratorProfile::Profile GeneratorProfile::profile() const
 
 static const std::map<GeneratorProfile::Profile, std::string> profileToString = {
     {GeneratorProfile::Profile::C, "c"},
-    {GeneratorProfile::Profile::PYTHON, "python"}};
+    {GeneratorProfile::Profile::PYTHON, "python"},
+    {GeneratorProfile::Profile::NUMPY, "numpy"}};
 
 std::string GeneratorProfile::profileAsString(Profile profile)
 {
@@ -2270,6 +3033,66 @@ void GeneratorProfile::setImplementationVariableCountString(const std::string &i
     mPimpl->mImplementationVariableCountString = implementationVariableCountString;
 }
 
+std::string GeneratorProfile::interfaceConstantCountString() const
+{
+    return mPimpl->mInterfaceConstantCountString;
+}
+
+void GeneratorProfile::setInterfaceConstantCountString(const std::string &interfaceConstantCountString)
+{
+    mPimpl->mInterfaceConstantCountString = interfaceConstantCountString;
+}
+
+std::string GeneratorProfile::implementationConstantCountString() const
+{
+    return mPimpl->mImplementationConstantCountString;
+}
+
+void GeneratorProfile::setImplementationConstantCountString(const std::string &implementationConstantCountString)
+{
+    mPimpl->mImplementationConstantCountString = implementationConstantCountString;
+}
+
+std::string GeneratorProfile::interfaceComputedConstantCountString() const
+{
+    return mPimpl->mInterfaceComputedConstantCountString;
+}
+
+void GeneratorProfile::setInterfaceComputedConstantCountString(const std::string &interfaceComputedConstantCountString)
+{
+    mPimpl->mInterfaceComputedConstantCountString = interfaceComputedConstantCountString;
+}
+
+std::string GeneratorProfile::implementationComputedConstantCountString() const
+{
+    return mPimpl->mImplementationComputedConstantCountString;
+}
+
+void GeneratorProfile::setImplementationComputedConstantCountString(const std::string &implementationComputedConstantCountString)
+{
+    mPimpl->mImplementationComputedConstantCountString = implementationComputedConstantCountString;
+}
+
+std::string GeneratorProfile::interfaceAlgebraicCountString() const
+{
+    return mPimpl->mInterfaceAlgebraicCountString;
+}
+
+void GeneratorProfile::setInterfaceAlgebraicCountString(const std::string &interfaceAlgebraicCountString)
+{
+    mPimpl->mInterfaceAlgebraicCountString = interfaceAlgebraicCountString;
+}
+
+std::string GeneratorProfile::implementationAlgebraicCountString() const
+{
+    return mPimpl->mImplementationAlgebraicCountString;
+}
+
+void GeneratorProfile::setImplementationAlgebraicCountString(const std::string &implementationAlgebraicCountString)
+{
+    mPimpl->mImplementationAlgebraicCountString = implementationAlgebraicCountString;
+}
+
 std::string GeneratorProfile::variableTypeObjectString(bool forDifferentialModel,
                                                        bool withExternalVariables) const
 {
@@ -2437,6 +3260,66 @@ void GeneratorProfile::setImplementationVariableInfoString(const std::string &im
     mPimpl->mImplementationVariableInfoString = implementationVariableInfoString;
 }
 
+std::string GeneratorProfile::interfaceConstantInfoString() const
+{
+    return mPimpl->mInterfaceConstantInfoString;
+}
+
+void GeneratorProfile::setInterfaceConstantInfoString(const std::string &interfaceConstantInfoString)
+{
+    mPimpl->mInterfaceConstantInfoString = interfaceConstantInfoString;
+}
+
+std::string GeneratorProfile::implementationConstantInfoString() const
+{
+    return mPimpl->mImplementationConstantInfoString;
+}
+
+void GeneratorProfile::setImplementationConstantInfoString(const std::string &implementationConstantInfoString)
+{
+    mPimpl->mImplementationConstantInfoString = implementationConstantInfoString;
+}
+
+std::string GeneratorProfile::interfaceComputedConstantInfoString() const
+{
+    return mPimpl->mInterfaceComputedConstantInfoString;
+}
+
+void GeneratorProfile::setInterfaceComputedConstantInfoString(const std::string &interfaceComputedConstantInfoString)
+{
+    mPimpl->mInterfaceComputedConstantInfoString = interfaceComputedConstantInfoString;
+}
+
+std::string GeneratorProfile::implementationComputedConstantInfoString() const
+{
+    return mPimpl->mImplementationComputedConstantInfoString;
+}
+
+void GeneratorProfile::setImplementationComputedConstantInfoString(const std::string &implementationComputedConstantInfoString)
+{
+    mPimpl->mImplementationComputedConstantInfoString = implementationComputedConstantInfoString;
+}
+
+std::string GeneratorProfile::interfaceAlgebraicInfoString() const
+{
+    return mPimpl->mInterfaceAlgebraicInfoString;
+}
+
+void GeneratorProfile::setInterfaceAlgebraicInfoString(const std::string &interfaceAlgebraicInfoString)
+{
+    mPimpl->mInterfaceAlgebraicInfoString = interfaceAlgebraicInfoString;
+}
+
+std::string GeneratorProfile::implementationAlgebraicInfoString() const
+{
+    return mPimpl->mImplementationAlgebraicInfoString;
+}
+
+void GeneratorProfile::setImplementationAlgebraicInfoString(const std::string &implementationAlgebraicInfoString)
+{
+    mPimpl->mImplementationAlgebraicInfoString = implementationAlgebraicInfoString;
+}
+
 std::string GeneratorProfile::variableInfoEntryString() const
 {
     return mPimpl->mVariableInfoEntryString;
@@ -2487,6 +3370,66 @@ void GeneratorProfile::setVariablesArrayString(const std::string &variablesArray
     mPimpl->mVariablesArrayString = variablesArrayString;
 }
 
+std::string GeneratorProfile::constantsArrayString() const
+{
+    return mPimpl->mConstantsArrayString;
+}
+
+void GeneratorProfile::setConstantsArrayString(const std::string &constantsArrayString)
+{
+    mPimpl->mConstantsArrayString = constantsArrayString;
+}
+
+std::string GeneratorProfile::computedConstantsArrayString() const
+{
+    return mPimpl->mComputedConstantsArrayString;
+}
+
+void GeneratorProfile::setComputedConstantsArrayString(const std::string &computedConstantsArrayString)
+{
+    mPimpl->mComputedConstantsArrayString = computedConstantsArrayString;
+}
+
+std::string GeneratorProfile::algebraicArrayString() const
+{
+    return mPimpl->mAlgebraicArrayString;
+}
+
+void GeneratorProfile::setAlgebraicArrayString(const std::string &algebraicArrayString)
+{
+    mPimpl->mAlgebraicArrayString = algebraicArrayString;
+}
+
+std::string GeneratorProfile::variablesParameterString() const
+{
+    return mPimpl->mVariablesParameterString;
+}
+
+void GeneratorProfile::setVariablesParameterString(const std::string &variablesParameterString)
+{
+    mPimpl->mVariablesParameterString = variablesParameterString;
+}
+
+std::string GeneratorProfile::variablesMemberString() const
+{
+    return mPimpl->mVariablesMemberString;
+}
+
+void GeneratorProfile::setVariablesMemberString(const std::string &variablesMemberString)
+{
+    mPimpl->mVariablesMemberString = variablesMemberString;
+}
+
+std::string GeneratorProfile::variablesDataString() const
+{
+    return mPimpl->mVariablesDataString;
+}
+
+void GeneratorProfile::setVariablesDataString(const std::string &variablesDataString)
+{
+    mPimpl->mVariablesDataString = variablesDataString;
+}
+
 std::string GeneratorProfile::externalVariableMethodTypeDefinitionString(bool forDifferentialModel) const
 {
     if (forDifferentialModel) {
@@ -2630,6 +3573,54 @@ void GeneratorProfile::setObjectiveFunctionMethodString(bool forDifferentialMode
     }
 }
 
+std::string GeneratorProfile::objectiveJacobianMethodString(bool forDifferentialModel) const
+{
+    if (forDifferentialModel) {
+        return mPimpl->mObjectiveJacobianMethodFdmString;
+    }
+
+    return mPimpl->mObjectiveJacobianMethodFamString;
+}
+
+void GeneratorProfile::setObjectiveJacobianMethodString(bool forDifferentialModel,
+                                                        const std::string &objectiveJacobianMethodString)
+{
+    if (forDifferentialModel) {
+        mPimpl->mObjectiveJacobianMethodFdmString = objectiveJacobianMethodString;
+    } else {
+        mPimpl->mObjectiveJacobianMethodFamString = objectiveJacobianMethodString;
+    }
+}
+
+std::string GeneratorProfile::finiteDifferenceObjectiveJacobianMethodString() const
+{
+    return mPimpl->mFiniteDifferenceObjectiveJacobianMethodString;
+}
+
+void GeneratorProfile::setFiniteDifferenceObjectiveJacobianMethodString(const std::string &finiteDifferenceObjectiveJacobianMethodString)
+{
+    mPimpl->mFiniteDifferenceObjectiveJacobianMethodString = finiteDifferenceObjectiveJacobianMethodString;
+}
+
+std::string GeneratorProfile::newtonSolveCallString(bool forDifferentialModel) const
+{
+    if (forDifferentialModel) {
+        return mPimpl->mNewtonSolveCallFdmString;
+    }
+
+    return mPimpl->mNewtonSolveCallFamString;
+}
+
+void GeneratorProfile::setNewtonSolveCallString(bool forDifferentialModel,
+                                                const std::string &newtonSolveCallString)
+{
+    if (forDifferentialModel) {
+        mPimpl->mNewtonSolveCallFdmString = newtonSolveCallString;
+    } else {
+        mPimpl->mNewtonSolveCallFamString = newtonSolveCallString;
+    }
+}
+
 std::string GeneratorProfile::uArrayString() const
 {
     return mPimpl->mUArrayString;
@@ -2650,6 +3641,166 @@ void GeneratorProfile::setFArrayString(const std::string &fArrayString)
     mPimpl->mFArrayString = fArrayString;
 }
 
+std::string GeneratorProfile::jacobianArrayString() const
+{
+    return mPimpl->mJacobianArrayString;
+}
+
+void GeneratorProfile::setJacobianArrayString(const std::string &jacobianArrayString)
+{
+    mPimpl->mJacobianArrayString = jacobianArrayString;
+}
+
+std::string GeneratorProfile::steadyStatesArrayString() const
+{
+    return mPimpl->mSteadyStatesArrayString;
+}
+
+void GeneratorProfile::setSteadyStatesArrayString(const std::string &steadyStatesArrayString)
+{
+    mPimpl->mSteadyStatesArrayString = steadyStatesArrayString;
+}
+
+std::string GeneratorProfile::timeConstantsArrayString() const
+{
+    return mPimpl->mTimeConstantsArrayString;
+}
+
+void GeneratorProfile::setTimeConstantsArrayString(const std::string &timeConstantsArrayString)
+{
+    mPimpl->mTimeConstantsArrayString = timeConstantsArrayString;
+}
+
+std::string GeneratorProfile::conditionsArrayString() const
+{
+    return mPimpl->mConditionsArrayString;
+}
+
+void GeneratorProfile::setConditionsArrayString(const std::string &conditionsArrayString)
+{
+    mPimpl->mConditionsArrayString = conditionsArrayString;
+}
+
+std::string GeneratorProfile::eventsArrayString() const
+{
+    return mPimpl->mEventsArrayString;
+}
+
+void GeneratorProfile::setEventsArrayString(const std::string &eventsArrayString)
+{
+    mPimpl->mEventsArrayString = eventsArrayString;
+}
+
+std::string GeneratorProfile::resetValuesArrayString() const
+{
+    return mPimpl->mResetValuesArrayString;
+}
+
+void GeneratorProfile::setResetValuesArrayString(const std::string &resetValuesArrayString)
+{
+    mPimpl->mResetValuesArrayString = resetValuesArrayString;
+}
+
+std::string GeneratorProfile::rootFunctionsArrayString() const
+{
+    return mPimpl->mRootFunctionsArrayString;
+}
+
+void GeneratorProfile::setRootFunctionsArrayString(const std::string &rootFunctionsArrayString)
+{
+    mPimpl->mRootFunctionsArrayString = rootFunctionsArrayString;
+}
+
+std::string GeneratorProfile::interfaceJacobianSparsityPatternString() const
+{
+    return mPimpl->mInterfaceJacobianSparsityPatternString;
+}
+
+void GeneratorProfile::setInterfaceJacobianSparsityPatternString(const std::string &interfaceJacobianSparsityPatternString)
+{
+    mPimpl->mInterfaceJacobianSparsityPatternString = interfaceJacobianSparsityPatternString;
+}
+
+std::string GeneratorProfile::implementationJacobianSparsityPatternString() const
+{
+    return mPimpl->mImplementationJacobianSparsityPatternString;
+}
+
+void GeneratorProfile::setImplementationJacobianSparsityPatternString(const std::string &implementationJacobianSparsityPatternString)
+{
+    mPimpl->mImplementationJacobianSparsityPatternString = implementationJacobianSparsityPatternString;
+}
+
+std::string GeneratorProfile::objectiveJacobianSparsityPatternString() const
+{
+    return mPimpl->mObjectiveJacobianSparsityPatternString;
+}
+
+void GeneratorProfile::setObjectiveJacobianSparsityPatternString(const std::string &objectiveJacobianSparsityPatternString)
+{
+    mPimpl->mObjectiveJacobianSparsityPatternString = objectiveJacobianSparsityPatternString;
+}
+
+std::string GeneratorProfile::interfaceGatingStateIndicesString() const
+{
+    return mPimpl->mInterfaceGatingStateIndicesString;
+}
+
+void GeneratorProfile::setInterfaceGatingStateIndicesString(const std::string &interfaceGatingStateIndicesString)
+{
+    mPimpl->mInterfaceGatingStateIndicesString = interfaceGatingStateIndicesString;
+}
+
+std::string GeneratorProfile::implementationGatingStateIndicesString() const
+{
+    return mPimpl->mImplementationGatingStateIndicesString;
+}
+
+void GeneratorProfile::setImplementationGatingStateIndicesString(const std::string &implementationGatingStateIndicesString)
+{
+    mPimpl->mImplementationGatingStateIndicesString = implementationGatingStateIndicesString;
+}
+
+std::string GeneratorProfile::interfaceEventCountString() const
+{
+    return mPimpl->mInterfaceEventCountString;
+}
+
+void GeneratorProfile::setInterfaceEventCountString(const std::string &interfaceEventCountString)
+{
+    mPimpl->mInterfaceEventCountString = interfaceEventCountString;
+}
+
+std::string GeneratorProfile::implementationEventCountString() const
+{
+    return mPimpl->mImplementationEventCountString;
+}
+
+void GeneratorProfile::setImplementationEventCountString(const std::string &implementationEventCountString)
+{
+    mPimpl->mImplementationEventCountString = implementationEventCountString;
+}
+
+std::string GeneratorProfile::interfaceRootFunctionCountString() const
+{
+    return mPimpl->mInterfaceRootFunctionCountString;
+}
+
+void GeneratorProfile::setInterfaceRootFunctionCountString(const std::string &interfaceRootFunctionCountString)
+{
+    mPimpl->mInterfaceRootFunctionCountString = interfaceRootFunctionCountString;
+}
+
+std::string GeneratorProfile::implementationRootFunctionCountString() const
+{
+    return mPimpl->mImplementationRootFunctionCountString;
+}
+
+void GeneratorProfile::setImplementationRootFunctionCountString(const std::string &implementationRootFunctionCountString)
+{
+    mPimpl->mImplementationRootFunctionCountString = implementationRootFunctionCountString;
+}
+
 std::string GeneratorProfile::interfaceCreateStatesArrayMethodString() const
 {
     return mPimpl->mInterfaceCreateStatesArrayMethodString;
@@ -2690,6 +3841,66 @@ void GeneratorProfile::setImplementationCreateVariablesArrayMethodString(const s
     mPimpl->mImplementationCreateVariablesArrayMethodString = implementationCreateVariablesArrayMethodString;
 }
 
+std::string GeneratorProfile::interfaceCreateConstantsArrayMethodString() const
+{
+    return mPimpl->mInterfaceCreateConstantsArrayMethodString;
+}
+
+void GeneratorProfile::setInterfaceCreateConstantsArrayMethodString(const std::string &interfaceCreateConstantsArrayMethodString)
+{
+    mPimpl->mInterfaceCreateConstantsArrayMethodString = interfaceCreateConstantsArrayMethodString;
+}
+
+std::string GeneratorProfile::implementationCreateConstantsArrayMethodString() const
+{
+    return mPimpl->mImplementationCreateConstantsArrayMethodString;
+}
+
+void GeneratorProfile::setImplementationCreateConstantsArrayMethodString(const std::string &implementationCreateConstantsArrayMethodString)
+{
+    mPimpl->mImplementationCreateConstantsArrayMethodString = implementationCreateConstantsArrayMethodString;
+}
+
+std::string GeneratorProfile::interfaceCreateComputedConstantsArrayMethodString() const
+{
+    return mPimpl->mInterfaceCreateComputedConstantsArrayMethodString;
+}
+
+void GeneratorProfile::setInterfaceCreateComputedConstantsArrayMethodString(const std::string &interfaceCreateComputedConstantsArrayMethodString)
+{
+    mPimpl->mInterfaceCreateComputedConstantsArrayMethodString = interfaceCreateComputedConstantsArrayMethodString;
+}
+
+std::string GeneratorProfile::implementationCreateComputedConstantsArrayMethodString() const
+{
+    return mPimpl->mImplementationCreateComputedConstantsArrayMethodString;
+}
+
+void GeneratorProfile::setImplementationCreateComputedConstantsArrayMethodString(const std::string &implementationCreateComputedConstantsArrayMethodString)
+{
+    mPimpl->mImplementationCreateComputedConstantsArrayMethodString = implementationCreateComputedConstantsArrayMethodString;
+}
+
+std::string GeneratorProfile::interfaceCreateAlgebraicArrayMethodString() const
+{
+    return mPimpl->mInterfaceCreateAlgebraicArrayMethodString;
+}
+
+void GeneratorProfile::setInterfaceCreateAlgebraicArrayMethodString(const std::string &interfaceCreateAlgebraicArrayMethodString)
+{
+    mPimpl->mInterfaceCreateAlgebraicArrayMethodString = interfaceCreateAlgebraicArrayMethodString;
+}
+
+std::string GeneratorProfile::implementationCreateAlgebraicArrayMethodString() const
+{
+    return mPimpl->mImplementationCreateAlgebraicArrayMethodString;
+}
+
+void GeneratorProfile::setImplementationCreateAlgebraicArrayMethodString(const std::string &implementationCreateAlgebraicArrayMethodString)
+{
+    mPimpl->mImplementationCreateAlgebraicArrayMethodString = implementationCreateAlgebraicArrayMethodString;
+}
+
 std::string GeneratorProfile::interfaceDeleteArrayMethodString() const
 {
     return mPimpl->mInterfaceDeleteArrayMethodString;
@@ -2916,6 +4127,106 @@ void GeneratorProfile::setImplementationComputeVariablesMethodString(bool forDif
     }
 }
 
+std::string GeneratorProfile::interfaceComputeJacobianMethodString() const
+{
+    return mPimpl->mInterfaceComputeJacobianMethodString;
+}
+
+void GeneratorProfile::setInterfaceComputeJacobianMethodString(const std::string &interfaceComputeJacobianMethodString)
+{
+    mPimpl->mInterfaceComputeJacobianMethodString = interfaceComputeJacobianMethodString;
+}
+
+std::string GeneratorProfile::implementationComputeJacobianMethodString() const
+{
+    return mPimpl->mImplementationComputeJacobianMethodString;
+}
+
+void GeneratorProfile::setImplementationComputeJacobianMethodString(const std::string &implementationComputeJacobianMethodString)
+{
+    mPimpl->mImplementationComputeJacobianMethodString = implementationComputeJacobianMethodString;
+}
+
+std::string GeneratorProfile::interfaceComputeGatingCoefficientsMethodString() const
+{
+    return mPimpl->mInterfaceComputeGatingCoefficientsMethodString;
+}
+
+void GeneratorProfile::setInterfaceComputeGatingCoefficientsMethodString(const std::string &interfaceComputeGatingCoefficientsMethodString)
+{
+    mPimpl->mInterfaceComputeGatingCoefficientsMethodString = interfaceComputeGatingCoefficientsMethodString;
+}
+
+std::string GeneratorProfile::implementationComputeGatingCoefficientsMethodString() const
+{
+    return mPimpl->mImplementationComputeGatingCoefficientsMethodString;
+}
+
+void GeneratorProfile::setImplementationComputeGatingCoefficientsMethodString(const std::string &implementationComputeGatingCoefficientsMethodString)
+{
+    mPimpl->mImplementationComputeGatingCoefficientsMethodString = implementationComputeGatingCoefficientsMethodString;
+}
+
+std::string GeneratorProfile::interfaceComputeEventConditionsMethodString() const
+{
+    return mPimpl->mInterfaceComputeEventConditionsMethodString;
+}
+
+void GeneratorProfile::setInterfaceComputeEventConditionsMethodString(const std::string &interfaceComputeEventConditionsMethodString)
+{
+    mPimpl->mInterfaceComputeEventConditionsMethodString = interfaceComputeEventConditionsMethodString;
+}
+
+std::string GeneratorProfile::implementationComputeEventConditionsMethodString() const
+{
+    return mPimpl->mImplementationComputeEventConditionsMethodString;
+}
+
+void GeneratorProfile::setImplementationComputeEventConditionsMethodString(const std::string &implementationComputeEventConditionsMethodString)
+{
+    mPimpl->mImplementationComputeEventConditionsMethodString = implementationComputeEventConditionsMethodString;
+}
+
+std::string GeneratorProfile::interfaceApplyResetsMethodString() const
+{
+    return mPimpl->mInterfaceApplyResetsMethodString;
+}
+
+void GeneratorProfile::setInterfaceApplyResetsMethodString(const std::string &interfaceApplyResetsMethodString)
+{
+    mPimpl->mInterfaceApplyResetsMethodString = interfaceApplyResetsMethodString;
+}
+
+std::string GeneratorProfile::implementationApplyResetsMethodString() const
+{
+    return mPimpl->mImplementationApplyResetsMethodString;
+}
+
+void GeneratorProfile::setImplementationApplyResetsMethodString(const std::string &implementationApplyResetsMethodString)
+{
+    mPimpl->mImplementationApplyResetsMethodString = implementationApplyResetsMethodString;
+}
+
+std::string GeneratorProfile::interfaceComputeRootFunctionsMethodString() const
+{
+    return mPimpl->mInterfaceComputeRootFunctionsMethodString;
+}
+
+void GeneratorProfile::setInterfaceComputeRootFunctionsMethodString(const std::string &interfaceComputeRootFunctionsMethodString)
+{
+    mPimpl->mInterfaceComputeRootFunctionsMethodString = interfaceComputeRootFunctionsMethodString;
+}
+
+std::string GeneratorProfile::implementationComputeRootFunctionsMethodString() const
+{
+    return mPimpl->mImplementationComputeRootFunctionsMethodString;
+}
+
+void GeneratorProfile::setImplementationComputeRootFunctionsMethodString(const std::string &implementationComputeRootFunctionsMethodString)
+{
+    mPimpl->mImplementationComputeRootFunctionsMethodString = implementationComputeRootFunctionsMethodString;
+}
+
 std::string GeneratorProfile::emptyMethodString() const
 {
     return mPimpl->mEmptyMethodString;
@@ -24,7 +24,8 @@ namespace libcellml {
  * The content of this file is generated, do not edit this file directly.
  * See docs/dev_utilities.rst for further information.
  */
-static const char C_GENERATOR_PROFILE_SHA1[] = "1ac959303d5e8d6623cbe0979cb608ef48aff653";
-static const char PYTHON_GENERATOR_PROFILE_SHA1[] = "41f70a8d0486fdb3638b310814ebaa7d3ddd6771";
+static const char C_GENERATOR_PROFILE_SHA1[] = "57fc51ea0fb9f3752727192e07b6eebda3beebba";
+static const char PYTHON_GENERATOR_PROFILE_SHA1[] = "4d2bdf89ba805114a56c884269719c34cbcfc3a6";
+static const char NUMPY_GENERATOR_PROFILE_SHA1[] = "ffb6082d21df217c25eb129d818c3f16fb28c226";
 
 } // namespace libcellml
@@ -445,6 +445,15 @@ std::string generatorProfileAsString(const GeneratorProfilePtr &generatorProfile
     profileContents += generatorProfile->interfaceVariableCountString()
                        + generatorProfile->implementationVariableCountString();
 
+    profileContents += generatorProfile->interfaceConstantCountString()
+                       + generatorProfile->implementationConstantCountString();
+
+    profileContents += generatorProfile->interfaceComputedConstantCountString()
+                       + generatorProfile->implementationComputedConstantCountString();
+
+    profileContents += generatorProfile->interfaceAlgebraicCountString()
+                       + generatorProfile->implementationAlgebraicCountString();
+
     profileContents += generatorProfile->variableTypeObjectString(false, false);
     profileContents += generatorProfile->variableTypeObjectString(false, true);
     profileContents += generatorProfile->variableTypeObjectString(true, false);
@@ -468,6 +477,15 @@ std::string generatorProfileAsString(const GeneratorProfilePtr &generatorProfile
     profileContents += generatorProfile->interfaceVariableInfoString()
                        + generatorProfile->implementationVariableInfoString();
 
+    profileContents += generatorProfile->interfaceConstantInfoString()
+                       + generatorProfile->implementationConstantInfoString();
+
+    profileContents += generatorProfile->interfaceComputedConstantInfoString()
+                       + generatorProfile->implementationComputedConstantInfoString();
+
+    profileContents += generatorProfile->interfaceAlgebraicInfoString()
+                       + generatorProfile->implementationAlgebraicInfoString();
+
     profileContents += generatorProfile->variableInfoEntryString();
 
     profileContents += generatorProfile->voiString();
@@ -476,6 +494,14 @@ std::string generatorProfileAsString(const GeneratorProfilePtr &generatorProfile
                        + generatorProfile->ratesArrayString()
                        + generatorProfile->variablesArrayString();
 
+    profileContents += generatorProfile->constantsArrayString()
+                       + generatorProfile->computedConstantsArrayString()
+                       + generatorProfile->algebraicArrayString();
+
+    profileContents += generatorProfile->variablesParameterString()
+                       + generatorProfile->variablesMemberString()
+                       + generatorProfile->variablesDataString();
+
     profileContents += generatorProfile->externalVariableMethodTypeDefinitionString(false)
                        + generatorProfile->externalVariableMethodTypeDefinitionString(true);
 
@@ -493,8 +519,36 @@ std::string generatorProfileAsString(const GeneratorProfilePtr &generatorProfile
                        + generatorProfile->nlaSolveCallString(true)
                        + generatorProfile->objectiveFunctionMethodString(false)
                        + generatorProfile->objectiveFunctionMethodString(true)
+                       + generatorProfile->objectiveJacobianMethodString(false)
+                       + generatorProfile->objectiveJacobianMethodString(true)
+                       + generatorProfile->finiteDifferenceObjectiveJacobianMethodString()
+                       + generatorProfile->newtonSolveCallString(false)
+                       + generatorProfile->newtonSolveCallString(true)
                        + generatorProfile->uArrayString()
-                       + generatorProfile->fArrayString();
+                       + generatorProfile->fArrayString()
+                       + generatorProfile->jacobianArrayString();
+
+    profileContents += generatorProfile->steadyStatesArrayString()
+                       + generatorProfile->timeConstantsArrayString();
+
+    profileContents += generatorProfile->conditionsArrayString()
+                       + generatorProfile->eventsArrayString()
+                       + generatorProfile->resetValuesArrayString();
+
+    profileContents += generatorProfile->rootFunctionsArrayString();
+
+    profileContents += generatorProfile->interfaceJacobianSparsityPatternString()
+                       + generatorProfile->implementationJacobianSparsityPatternString()
+                       + generatorProfile->objectiveJacobianSparsityPatternString();
+
+    profileContents += generatorProfile->interfaceGatingStateIndicesString()
+                       + generatorProfile->implementationGatingStateIndicesString();
+
+    profileContents += generatorProfile->interfaceEventCountString()
+                       + generatorProfile->implementationEventCountString();
+
+    profileContents += generatorProfile->interfaceRootFunctionCountString()
+                       + generatorProfile->implementationRootFunctionCountString();
 
     profileContents += generatorProfile->interfaceCreateStatesArrayMethodString()
                        + generatorProfile->implementationCreateStatesArrayMethodString();
@@ -502,6 +556,15 @@ std::string generatorProfileAsString(const GeneratorProfilePtr &generatorProfile
     profileContents += generatorProfile->interfaceCreateVariablesArrayMethodString()
                        + generatorProfile->implementationCreateVariablesArrayMethodString();
 
+    profileContents += generatorProfile->interfaceCreateConstantsArrayMethodString()
+                       + generatorProfile->implementationCreateConstantsArrayMethodString();
+
+    profileContents += generatorProfile->interfaceCreateComputedConstantsArrayMethodString()
+                       + generatorProfile->implementationCreateComputedConstantsArrayMethodString();
+
+    profileContents += generatorProfile->interfaceCreateAlgebraicArrayMethodString()
+                       + generatorProfile->implementationCreateAlgebraicArrayMethodString();
+
     profileContents += generatorProfile->interfaceDeleteArrayMethodString()
                        + generatorProfile->implementationDeleteArrayMethodString();
 
@@ -538,6 +601,21 @@ std::string generatorProfileAsString(const GeneratorProfilePtr &generatorProfile
     profileContents += generatorProfile->interfaceComputeVariablesMethodString(true, true)
                        + generatorProfile->implementationComputeVariablesMethodString(true, true);
 
+    profileContents += generatorProfile->interfaceComputeJacobianMethodString()
+                       + generatorProfile->implementationComputeJacobianMethodString();
+
+    profileContents += generatorProfile->interfaceComputeGatingCoefficientsMethodString()
+                       + generatorProfile->implementationComputeGatingCoefficientsMethodString();
+
+    profileContents += generatorProfile->interfaceComputeEventConditionsMethodString()
+                       + generatorProfile->implementationComputeEventConditionsMethodString();
+
+    profileContents += generatorProfile->interfaceApplyResetsMethodString()
+                       + generatorProfile->implementationApplyResetsMethodString();
+
+    profileContents += generatorProfile->interfaceComputeRootFunctionsMethodString()
+                       + generatorProfile->implementationComputeRootFunctionsMethodString();
+
     profileContents += generatorProfile->emptyMethodString();
 
     profileContents += generatorProfile->indentString();
@@ -18,6 +18,9 @@ limitations under the License.
 
 #include "libcellml/importsource.h"
 
+#include "entity_p.h"
+#include "units_p.h"
+
 namespace libcellml {
 
 /**
@@ -54,6 +57,11 @@ ImportSourcePtr ImportedEntity::importSource() const
 void ImportedEntity::setImportSource(const ImportSourcePtr &importSource)
 {
     mPimpl->mImportSource = importSource;
+    auto units = dynamic_cast<Units *>(this);
+    if (units != nullptr) {
+        units->pFunc()->invalidateResolvedUnits();
+    }
+    invalidateIds(dynamic_cast<Entity *>(this));
 }
 
 std::string ImportedEntity::importReference() const
@@ -64,6 +72,10 @@ std::string ImportedEntity::importReference() const
 void ImportedEntity::setImportReference(const std::string &reference)
 {
     mPimpl->mImportReference = reference;
+    auto units = dynamic_cast<Units *>(this);
+    if (units != nullptr) {
+        units->pFunc()->invalidateResolvedUnits();
+    }
 }
 
 bool ImportedEntity::isResolved() const
@@ -334,6 +334,8 @@ std::string resolvePath(const std::string &filename, const std::string &base)
 
 bool Importer::ImporterImpl::fetchModel(const ImportSourcePtr &importSource, const std::string &baseFile)
 {
+    ProfilerScope profilerScope(mProfiler, Profiler::Phase::FETCH_MODEL);
+
     std::string url = normaliseDirectorySeparator(importSource->url());
     if (mLibrary.count(url) == 0) {
         url = resolvePath(url, baseFile);
@@ -355,6 +357,7 @@ bool Importer::ImporterImpl::fetchModel(const ImportSourcePtr &importSource, con
         std::stringstream buffer;
         buffer << file.rdbuf();
         auto parser = Parser::create(mImporter->isStrict());
+        parser->setProfiler(mProfiler);
         model = parser->parseModel(buffer.str());
         if (!mImporter->isStrict() && (parser->messageCount() > 0)) {
             auto issue = Issue::IssueImpl::create();
@@ -474,7 +477,7 @@ bool Importer::ImporterImpl::fetchComponent(const ComponentPtr &importComponent,
             auto error = mImporter->error(index - 1);
             removeError(index - 1);
 
-            if (!encounteredRelatedError && isErrorRelatedToComponent(error, sourceComponent)) {
+            if (!encounteredRelatedError && (error != nullptr) && isErrorRelatedToComponent(error, sourceComponent)) {
                 encounteredRelatedError = true;
             }
         }
@@ -563,10 +566,12 @@ bool Importer::ImporterImpl::fetchUnits(const UnitsPtr &importUnits, const std::
     if (endIndex > startIndex) {
         for (size_t index = endIndex; startIndex < index; --index) {
             auto error = mImporter->error(index - 1);
-            auto errorUnits = error->item()->units();
             removeError(index - 1);
-            if (!encounteredRelatedError && (errorUnits != nullptr) && (errorUnits->name() == importUnits->importReference())) {
-                encounteredRelatedError = true;
+            if (!encounteredRelatedError && (error != nullptr)) {
+                auto errorUnits = error->item()->units();
+                if ((errorUnits != nullptr) && (errorUnits->name() == importUnits->importReference())) {
+                    encounteredRelatedError = true;
+                }
             }
         }
     }
@@ -638,6 +643,8 @@ bool Importer::ImporterImpl::fetchUnits(const UnitsPtr &importUnits, const std::
 
 bool Importer::resolveImports(ModelPtr &model, const std::string &basePath)
 {
+    ProfilerScope profilerScope(pFunc()->mProfiler, Profiler::Phase::RESOLVE_IMPORTS);
+
     bool status = true;
     History history;
 
@@ -658,7 +665,10 @@ bool Importer::resolveImports(ModelPtr &model, const std::string &basePath)
         history.clear();
         if (!pFunc()->fetchUnits(units, normalisedBasePath, history)) {
             // Get the last issue recorded and change its object to be the top-level importing item.
-            issue(issueCount() - 1)->mPimpl->mItem->mPimpl->setUnits(units);
+            auto lastIssue = issue(issueCount() - 1);
+            if (lastIssue != nullptr) {
+                lastIssue->mPimpl->mItem->mPimpl->setUnits(units);
+            }
             status = false;
         }
     }
@@ -666,7 +676,10 @@ bool Importer::resolveImports(ModelPtr &model, const std::string &basePath)
     for (const ComponentPtr &component : getImportedComponents(model)) {
         history.clear();
         if (!pFunc()->fetchComponent(component, normalisedBasePath, history)) {
-            issue(issueCount() - 1)->mPimpl->mItem->mPimpl->setComponent(component);
+            auto lastIssue = issue(issueCount() - 1);
+            if (lastIssue != nullptr) {
+                lastIssue->mPimpl->mItem->mPimpl->setComponent(component);
+            }
             status = false;
         }
     }
@@ -818,25 +831,16 @@ ComponentPtr flattenComponent(const ComponentEntityPtr &parent, ComponentPtr &co
         // Clone import model to not affect origin import model units.
         auto clonedImportModel = importModel->clone();
 
-        NameList compNames = componentNames(model);
-
-        // Determine the stack for the destination component.
-        IndexStack destinationComponentBaseIndexStack = indexStackOf(component);
-
-        // Determine the stack for the source component.
-        IndexStack importedComponentBaseIndexStack = indexStackOf(importedComponent);
-
-        // Generate equivalence map for the source component.
-        EquivalenceMap map;
-        recordVariableEquivalences(importedComponent, map, importedComponentBaseIndexStack);
-        generateEquivalenceMap(importedComponent, map, importedComponentBaseIndexStack);
-
-        // Rebase the generated equivalence map from the source component to the destination component.
-        auto rebasedMap = rebaseEquivalenceMap(map, importedComponentBaseIndexStack, destinationComponentBaseIndexStack);
+        UniqueNames compNames = componentNames(model);
 
         // Take a copy of the imported component which will be used to replace the import defined in this model.
         auto importedComponentCopy = importedComponent->clone();
         importedComponentCopy->setName(component->name());
+
+        // Map the variables of the source component to the variables of its copy.
+        VariableCloneMap map;
+        recordClonedVariables(importedComponent, importedComponentCopy, map);
+
         for (size_t i = 0; i < component->componentCount(); ++i) {
             importedComponentCopy->addComponent(component->component(i));
         }
@@ -869,7 +873,7 @@ ComponentPtr flattenComponent(const ComponentEntityPtr &parent, ComponentPtr &co
             std::string originalName = entry.first;
             size_t count = 0;
             std::string newName = originalName;
-            while (std::find(compNames.begin(), compNames.end(), newName) != compNames.end()) {
+            while (compNames.count(newName) != 0) {
                 newName = originalName + "_" + convertToString(++count);
             }
             if (originalName != newName) {
@@ -890,8 +894,8 @@ ComponentPtr flattenComponent(const ComponentEntityPtr &parent, ComponentPtr &co
         parent->replaceComponent(index, importedComponentCopy);
         auto flatModel = owningModel(importedComponentCopy);
 
-        // Apply the re-based equivalence map onto the modified model.
-        applyEquivalenceMapToModel(rebasedMap, flatModel);
+        // Transfer the equivalences internal to the source component onto its copy.
+        transferEquivalences(importedComponent, importedComponentCopy, map);
 
         StringStringMap unitNamesToReplace;
         for (const auto &units : uniqueRequiredUnits) {
@@ -950,6 +954,8 @@ void flattenComponentImports(const ComponentEntityPtr &parent, ComponentPtr &com
 
 ModelPtr Importer::flattenModel(const ModelPtr &model)
 {
+    ProfilerScope profilerScope(pFunc()->mProfiler, Profiler::Phase::FLATTEN_MODEL);
+
     pFunc()->removeAllIssues();
     ModelPtr flatModel;
     if (model == nullptr) {
@@ -16,6 +16,8 @@ limitations under the License.
 
 #include "internaltypes.h"
 
+#include <iterator>
+
 #include "commonutils.h"
 #include "libcellml/importsource.h"
 
@@ -59,4 +61,68 @@ void HistoryEpoch::setDestinationModel(const ImportedEntityConstPtr &importedEnt
     }
 }
 
+void NameIndex::add(NamedEntity *entity, const std::string &name)
+{
+    mEntities.emplace(name, entity);
+    ++mRevision;
+}
+
+void NameIndex::remove(NamedEntity *entity, const std::string &name)
+{
+    auto range = mEntities.equal_range(name);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == entity) {
+            mEntities.erase(it);
+            ++mRevision;
+            return;
+        }
+    }
+}
+
+void NameIndex::rename(NamedEntity *entity, const std::string &oldName, const std::string &newName)
+{
+    size_t occurrences = 0;
+    auto range = mEntities.equal_range(oldName);
+    for (auto it = range.first; it != range.second;) {
+        if (it->second == entity) {
+            it = mEntities.erase(it);
+            ++occurrences;
+        } else {
+            ++it;
+        }
+    }
+    for (size_t i = 0; i < occurrences; ++i) {
+        mEntities.emplace(newName, entity);
+    }
+    if (occurrences != 0) {
+        ++mRevision;
+    }
+}
+
+void NameIndex::clear()
+{
+    mEntities.clear();
+    ++mRevision;
+}
+
+size_t NameIndex::count(const std::string &name) const
+{
+    return mEntities.count(name);
+}
+
+NamedEntity *NameIndex::unique(const std::string &name) const
+{
+    auto range = mEntities.equal_range(name);
+    if ((range.first != range.second) && (std::next(range.first) == range.second)) {
+        return range.first->second;
+    }
+
+    return nullptr;
+}
+
+size_t NameIndex::revision() const
+{
+    return mRevision;
+}
+
 } // namespace libcellml
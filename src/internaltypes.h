@@ -17,8 +17,11 @@ limitations under the License.
 #pragma once
 
 #include <map>
+#include <memory>
 #include <set>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "libcellml/component.h"
@@ -32,7 +35,7 @@ const std::string ORIGIN_MODEL_REF = ":this:";
 using ComponentNameMap = std::map<std::string, ComponentPtr>; /**< Type definition for map of component name to component pointer. */
 
 using IndexStack = std::vector<size_t>; /**< Type definition for tracking indices. */
-using EquivalenceMap = std::map<IndexStack, std::vector<IndexStack>>; /**< Type definition for map of variable equivalences defined over model. */
+using VariableCloneMap = std::unordered_map<VariablePtr, VariablePtr>; /**< Type definition for map of original variable to cloned variable. */
 
 using NamePair = std::pair<std::string, std::string>; /**< Type definition for pair of names. */
 using NameList = std::vector<std::string>; /**< Type definition for list of names. */
@@ -51,16 +54,18 @@ using ComponentMap = std::vector<ComponentPair>; /**< Type definition for vector
 using ComponentMapIterator = ComponentMap::const_iterator; /**< Type definition of const iterator for vector of ComponentPair.*/
 
 using VariablePtrs = std::vector<VariablePtr>; /**< Type definition for list of variables. */
+using AnalyserEquationSet = std::unordered_set<AnalyserEquationPtr>; /**< Type definition for a set of analyser equations. */
 
 using IdMap = std::map<std::string, std::pair<int, std::vector<std::string>>>; /**< Type definition for map of IDs in Validator. **/
 using ImportLibrary = std::map<std::string, ModelPtr>; /** Type definition for library map of imported models. */
-using IdList = std::unordered_set<std::string>; /**< Type definition for list of identifiers. */
 
 using ResetOrderMap = std::map<VariablePtr, std::vector<int>>; /** Type definition for map of variable to reset order. **/
 
 using AnalyserEquationAstWeakPtr = std::weak_ptr<AnalyserEquationAst>; /**< Type definition for weak analyser equation AST pointer. */
 using AnalyserEquationWeakPtr = std::weak_ptr<AnalyserEquation>; /**< Type definition for weak analyser equation pointer. */
+using AnalyserModelWeakPtr = std::weak_ptr<AnalyserModel>; /**< Type definition for weak analyser model pointer. */
 using ComponentWeakPtr = std::weak_ptr<Component>; /**< Type definition for weak component pointer. */
+using EntityWeakPtr = std::weak_ptr<Entity>; /**< Type definition for weak entity pointer. */
 using ImportSourceWeakPtr = std::weak_ptr<ImportSource>; /**< Type definition for weak import source pointer. */
 using ModelWeakPtr = std::weak_ptr<Model>; /**< Type definition for weak model pointer. */
 using ResetWeakPtr = std::weak_ptr<Reset>; /**< Type definition for weak reset pointer. */
@@ -135,11 +140,221 @@ public:
     void setDestinationModel(const ImportedEntityConstPtr &importedEntity);
 };
 
+/**
+ * @brief Class for a list of identifiers from which unique identifiers can be made.
+ *
+ * New identifiers are made from a counter that only ever goes up, so that
+ * making an identifier doesn't test again the candidates that were rejected
+ * or used when making the previous ones.
+ */
+class IdList
+{
+public:
+    std::unordered_set<std::string> mIds; /**< The identifiers in the list. */
+    size_t mCounter = 0xb4da55; /**< The counter from which the next identifier is made. */
+};
+
+/**
+ * @brief Class for indexing the named children of an entity by name.
+ *
+ * This class is kept alongside the ordered list of children of an entity so
+ * that children can be looked up by name without scanning the list.  Children
+ * hold a weak reference to the index of their parent so that renaming a child
+ * keeps the index up to date.
+ */
+class NameIndex
+{
+public:
+    /**
+     * @brief Add the @p entity to the index under the given @p name.
+     *
+     * @param entity The entity to add.
+     * @param name The name of the @p entity.
+     */
+    void add(NamedEntity *entity, const std::string &name);
+
+    /**
+     * @brief Remove the @p entity from the index.
+     *
+     * Remove one occurrence of the @p entity indexed under the given @p name.
+     *
+     * @param entity The entity to remove.
+     * @param name The name the @p entity is indexed under.
+     */
+    void remove(NamedEntity *entity, const std::string &name);
+
+    /**
+     * @brief Re-index the @p entity from @p oldName to @p newName.
+     *
+     * Re-index every occurrence of the @p entity indexed under @p oldName.
+     * Nothing happens if the @p entity is not indexed under @p oldName.
+     *
+     * @param entity The entity that has been renamed.
+     * @param oldName The name the @p entity is indexed under.
+     * @param newName The new name of the @p entity.
+     */
+    void rename(NamedEntity *entity, const std::string &oldName, const std::string &newName);
+
+    /**
+     * @brief Remove all entities from the index.
+     */
+    void clear();
+
+    /**
+     * @brief Get the number of entities indexed under the given @p name.
+     *
+     * @param name The name to count.
+     *
+     * @return The number of entities indexed under @p name.
+     */
+    size_t count(const std::string &name) const;
+
+    /**
+     * @brief Get the entity indexed under the given @p name.
+     *
+     * Get the entity indexed under the given @p name, if there is exactly one
+     * such entity.
+     *
+     * @param name The name to look up.
+     *
+     * @return The entity if exactly one entity is indexed under @p name, @c nullptr otherwise.
+     */
+    NamedEntity *unique(const std::string &name) const;
+
+    /**
+     * @brief Get the revision of the index.
+     *
+     * Get the revision of the index, which changes whenever an entity is
+     * added to, removed from, or re-indexed in the index, i.e. whenever
+     * looking up a name may give a different result.
+     *
+     * @return The revision of the index.
+     */
+    size_t revision() const;
+
+private:
+    std::unordered_multimap<std::string, NamedEntity *> mEntities;
+    size_t mRevision = 0;
+};
+
+using NameIndexPtr = std::shared_ptr<NameIndex>; /**< Type definition for shared name index pointer. */
+using NameIndexWeakPtr = std::weak_ptr<NameIndex>; /**< Type definition for weak name index pointer. */
+
 using HistoryEpochPtr = std::shared_ptr<HistoryEpoch>; /**< Type definition for shared history epoch pointer. */
 using History = std::vector<HistoryEpochPtr>; /**< Type definition for history.*/
 
 using Strings = std::vector<std::string>; /**< Type definition for strings.*/
 
+/**
+ * @brief Class for holding a value that is shared between clones until written.
+ *
+ * Cloning a @c CopyOnWrite only copies a reference to the held value.  The
+ * value itself is only copied when it is written to through @ref write and
+ * it is still shared with another @c CopyOnWrite.  A value that is about to
+ * be replaced as a whole should rather be given through @ref assign or
+ * @ref reset, which never copy the held value.
+ *
+ * Whether the held value is shared is determined using its reference count,
+ * which is only reliable if a @c CopyOnWrite is not shared (see @ref share)
+ * while another thread writes to the @c CopyOnWrite it is shared with.  In
+ * other words, an entity must not be cloned while another thread modifies
+ * it, but an entity and its clones can otherwise be used, and modified, on
+ * different threads.
+ */
+template<typename T>
+class CopyOnWrite
+{
+public:
+    CopyOnWrite()
+        : mValue(std::make_shared<T>())
+    {
+    }
+
+    /**
+     * @brief Get read access to the held value.
+     *
+     * Get read access to the held value, without copying it.
+     *
+     * @return A const reference to the held value.
+     */
+    const T &read() const
+    {
+        return *mValue;
+    }
+
+    /**
+     * @brief Get write access to the held value.
+     *
+     * Get write access to the held value.  If the value is shared with
+     * another @c CopyOnWrite then it is copied first.
+     *
+     * @return A reference to the held value.
+     */
+    T &write()
+    {
+        if (mValue.use_count() > 1) {
+            mValue = std::make_shared<T>(*mValue);
+        }
+
+        return *mValue;
+    }
+
+    /**
+     * @brief Replace the held value.
+     *
+     * Replace the held value with @p value, without copying the held value
+     * first if it is shared with another @c CopyOnWrite.
+     *
+     * @param value The value to hold.
+     */
+    void assign(T value)
+    {
+        if (mValue.use_count() > 1) {
+            mValue = std::make_shared<T>(std::move(value));
+        } else {
+            *mValue = std::move(value);
+        }
+    }
+
+    /**
+     * @brief Reset the held value.
+     *
+     * Reset the held value to a default constructed value, without copying
+     * the held value first if it is shared with another @c CopyOnWrite.
+     */
+    void reset()
+    {
+        assign(T {});
+    }
+
+    /**
+     * @brief Share the value held by @p other.
+     *
+     * Release the currently held value and share the value held by @p other.
+     *
+     * @param other The @c CopyOnWrite to share the value of.
+     */
+    void share(const CopyOnWrite<T> &other)
+    {
+        mValue = other.mValue;
+    }
+
+    /**
+     * @brief Test if the held value is shared with @p other.
+     *
+     * @param other The @c CopyOnWrite to test against.
+     *
+     * @return @c true if the held value is shared with @p other, @c false otherwise.
+     */
+    bool isSharedWith(const CopyOnWrite<T> &other) const
+    {
+        return mValue == other.mValue;
+    }
+
+private:
+    std::shared_ptr<T> mValue;
+};
+
 enum class TestType
 {
     RESOLVED,
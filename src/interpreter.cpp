@@ -0,0 +1,1122 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifdef _WIN32
+#    define _USE_MATH_DEFINES
+#endif
+
+#include "libcellml/interpreter.h"
+
+#include <cmath>
+#include <limits>
+
+#include "libcellml/analyserequation.h"
+#include "libcellml/analyserequationast.h"
+#include "libcellml/analysermodel.h"
+#include "libcellml/analyservariable.h"
+#include "libcellml/component.h"
+#include "libcellml/units.h"
+#include "libcellml/variable.h"
+
+#include "commonutils.h"
+#include "interpreter_p.h"
+#include "utilities.h"
+
+namespace libcellml {
+
+static const double NOT_A_NUMBER = std::numeric_limits<double>::quiet_NaN();
+
+static const size_t NEWTON_MAXIMUM_NUMBER_OF_ITERATIONS = 100;
+static const double NEWTON_TOLERANCE = 1.0e-12;
+static const double NEWTON_MINIMUM_DAMPING_FACTOR = 1.0 / 1024.0;
+
+using OpCode = InterpreterInstruction::OpCode;
+
+static bool isNumber(const AnalyserEquationAstPtr &ast, double value)
+{
+    // Check whether the given AST is the given number, looking through
+    // qualifiers (i.e. the degree of a root and the base of a logarithm).
+
+    if ((ast->type() == AnalyserEquationAst::Type::DEGREE)
+        || (ast->type() == AnalyserEquationAst::Type::LOGBASE)) {
+        return isNumber(ast->leftChild(), value);
+    }
+
+    double astValue;
+
+    return (ast->type() == AnalyserEquationAst::Type::CN)
+           && convertToDouble(ast->value(), astValue)
+           && areEqual(astValue, value);
+}
+
+void Interpreter::InterpreterImpl::reset()
+{
+    mVoi = 0.0;
+
+    mStates.clear();
+    mRates.clear();
+    mVariables.clear();
+
+    mConstants.clear();
+    mRegisters.clear();
+    mFreeRegisters.clear();
+
+    mInitialiseVariablesProgram.clear();
+    mComputeComputedConstantsProgram.clear();
+    mComputeRatesProgram.clear();
+    mComputeVariablesProgram.clear();
+    mNlaSystems.clear();
+}
+
+double *Interpreter::InterpreterImpl::constant(double value)
+{
+    // Note: we use a deque so that the address of our existing constants
+    //       remains valid when adding a new one.
+
+    mConstants.push_back(value);
+
+    return &mConstants.back();
+}
+
+double *Interpreter::InterpreterImpl::allocateRegister()
+{
+    // Reuse a released register, if possible, so that we keep the number of
+    // registers (and therefore our memory footprint) to a minimum.
+
+    if (!mFreeRegisters.empty()) {
+        auto res = mFreeRegisters.back();
+
+        mFreeRegisters.pop_back();
+
+        return res;
+    }
+
+    mRegisters.push_back(0.0);
+
+    return &mRegisters.back();
+}
+
+void Interpreter::InterpreterImpl::releaseRegister(const Operand &operand)
+{
+    if (operand.mIsRegister) {
+        mFreeRegisters.push_back(operand.mValue);
+    }
+}
+
+double *Interpreter::InterpreterImpl::variableLocation(const VariablePtr &variable, bool state)
+{
+    // Return the location of the given variable, i.e. the variable of
+    // integration, a state (or its rate, if state is false) or a variable.
+
+    auto analyserVariable = mModel->analyserVariable(variable);
+
+    switch (analyserVariable->type()) {
+    case AnalyserVariable::Type::VARIABLE_OF_INTEGRATION:
+        return &mVoi;
+    case AnalyserVariable::Type::STATE:
+        return state ?
+                   &mStates[analyserVariable->index()] :
+                   &mRates[analyserVariable->index()];
+    default:
+        return &mVariables[analyserVariable->index()];
+    }
+}
+
+double *Interpreter::InterpreterImpl::initialValueLocation(const VariablePtr &variable)
+{
+    // The initial value of a variable is either a number or a reference to a
+    // constant variable.
+
+    if (isCellMLReal(variable->initialValue())) {
+        double value;
+
+        convertToDouble(variable->initialValue(), value);
+
+        return constant(value);
+    }
+
+    return variableLocation(owningComponent(variable)->variable(variable->initialValue()));
+}
+
+Interpreter::InterpreterImpl::Operand Interpreter::InterpreterImpl::compileOperation(OpCode opCode,
+                                                                                     const AnalyserEquationAstPtr &leftAst,
+                                                                                     const AnalyserEquationAstPtr &rightAst,
+                                                                                     double *result,
+                                                                                     InterpreterProgram &program)
+{
+    // Compile the operand(s) of the operation, which can then release their
+    // register since the operation only reads them before writing its result.
+
+    auto left = compile(leftAst, nullptr, program);
+    auto right = (rightAst != nullptr) ?
+                     compile(rightAst, nullptr, program) :
+                     Operand {nullptr, false};
+
+    releaseRegister(right);
+    releaseRegister(left);
+
+    Operand res = (result != nullptr) ?
+                      Operand {result, false} :
+                      Operand {allocateRegister(), true};
+
+    program.push_back({opCode, res.mValue, left.mValue, right.mValue});
+
+    return res;
+}
+
+Interpreter::InterpreterImpl::Operand Interpreter::InterpreterImpl::compilePiecewise(const AnalyserEquationAstPtr &ast,
+                                                                                     double *result,
+                                                                                     InterpreterProgram &program)
+{
+    // Compile a piecewise statement as a sequence of conditional jumps over
+    // the value of its pieces, each of which then jumps to the end of the
+    // piecewise statement. If there is no otherwise, the result is NaN.
+
+    Operand res = (result != nullptr) ?
+                      Operand {result, false} :
+                      Operand {allocateRegister(), true};
+    std::vector<size_t> endJumps;
+    auto hasOtherwise = false;
+    auto node = ast;
+
+    while (node != nullptr) {
+        AnalyserEquationAstPtr piece;
+
+        if (node->type() == AnalyserEquationAst::Type::PIECEWISE) {
+            piece = node->leftChild();
+            node = node->rightChild();
+        } else {
+            piece = node;
+            node = nullptr;
+        }
+
+        if (piece->type() == AnalyserEquationAst::Type::OTHERWISE) {
+            compile(piece->leftChild(), res.mValue, program);
+
+            hasOtherwise = true;
+        } else {
+            auto condition = compile(piece->rightChild(), nullptr, program);
+            auto conditionJump = program.size();
+
+            program.push_back({OpCode::JUMP_IF_FALSE, nullptr, condition.mValue, nullptr});
+
+            releaseRegister(condition);
+
+            compile(piece->leftChild(), res.mValue, program);
+
+            endJumps.push_back(program.size());
+
+            program.push_back({OpCode::JUMP, nullptr, nullptr, nullptr});
+
+            program[conditionJump].mIndex = program.size();
+        }
+    }
+
+    if (!hasOtherwise) {
+        program.push_back({OpCode::COPY, res.mValue, constant(NOT_A_NUMBER), nullptr});
+    }
+
+    for (auto endJump : endJumps) {
+        program[endJump].mIndex = program.size();
+    }
+
+    return res;
+}
+
+Interpreter::InterpreterImpl::Operand Interpreter::InterpreterImpl::compile(const AnalyserEquationAstPtr &ast,
+                                                                            double *result,
+                                                                            InterpreterProgram &program)
+{
+    // Compile the given AST so that its value ends up in result or, if result
+    // is null, in whatever location is the most suitable (i.e. the location of
+    // a variable or a constant, or a register if some computation is needed).
+
+    double *leaf = nullptr;
+
+    switch (ast->type()) {
+    case AnalyserEquationAst::Type::EQ:
+        return compileOperation(OpCode::EQ, ast->leftChild(), ast->rightChild(), result, program);
+    case AnalyserEquationAst::Type::NEQ:
+        return compileOperation(OpCode::NEQ, ast->leftChild(), ast->rightChild(), result, program);
+    case AnalyserEquationAst::Type::LT:
+        return compileOperation(OpCode::LT, ast->leftChild(), ast->rightChild(), result, program);
+    case AnalyserEquationAst::Type::LEQ:
+        return compileOperation(OpCode::LEQ, ast->leftChild(), ast->rightChild(), result, program);
+    case AnalyserEquationAst::Type::GT:
+        return compileOperation(OpCode::GT, ast->leftChild(), ast->rightChild(), result, program);
+    case AnalyserEquationAst::Type::GEQ:
+        return compileOperation(OpCode::GEQ, ast->leftChild(), ast->rightChild(), result, program);
+    case AnalyserEquationAst::Type::AND:
+        return compileOperation(OpCode::AND, ast->leftChild(), ast->rightChild(), result, program);
+    case AnalyserEquationAst::Type::OR:
+        return compileOperation(OpCode::OR, ast->leftChild(), ast->rightChild(), result, program);
+    case AnalyserEquationAst::Type::XOR:
+        return compileOperation(OpCode::XOR, ast->leftChild(), ast->rightChild(), result, program);
+    case AnalyserEquationAst::Type::NOT:
+        return compileOperation(OpCode::NOT, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::PLUS:
+        if (ast->rightChild() != nullptr) {
+            return compileOperation(OpCode::PLUS, ast->leftChild(), ast->rightChild(), result, program);
+        }
+
+        return compile(ast->leftChild(), result, program);
+    case AnalyserEquationAst::Type::MINUS:
+        if (ast->rightChild() != nullptr) {
+            return compileOperation(OpCode::MINUS, ast->leftChild(), ast->rightChild(), result, program);
+        }
+
+        return compileOperation(OpCode::NEGATE, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::TIMES:
+        return compileOperation(OpCode::TIMES, ast->leftChild(), ast->rightChild(), result, program);
+    case AnalyserEquationAst::Type::DIVIDE:
+        return compileOperation(OpCode::DIVIDE, ast->leftChild(), ast->rightChild(), result, program);
+    case AnalyserEquationAst::Type::POWER:
+        if (isNumber(ast->rightChild(), 0.5)) {
+            return compileOperation(OpCode::SQUARE_ROOT, ast->leftChild(), nullptr, result, program);
+        }
+
+        if (isNumber(ast->rightChild(), 2.0)) {
+            return compileOperation(OpCode::SQUARE, ast->leftChild(), nullptr, result, program);
+        }
+
+        return compileOperation(OpCode::POWER, ast->leftChild(), ast->rightChild(), result, program);
+    case AnalyserEquationAst::Type::ROOT:
+        if (ast->rightChild() == nullptr) {
+            return compileOperation(OpCode::SQUARE_ROOT, ast->leftChild(), nullptr, result, program);
+        }
+
+        if (isNumber(ast->leftChild(), 2.0)) {
+            return compileOperation(OpCode::SQUARE_ROOT, ast->rightChild(), nullptr, result, program);
+        }
+
+        return compileOperation(OpCode::ROOT, ast->rightChild(), ast->leftChild(), result, program);
+    case AnalyserEquationAst::Type::ABS:
+        return compileOperation(OpCode::ABS, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::EXP:
+        return compileOperation(OpCode::EXP, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::LN:
+        return compileOperation(OpCode::LN, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::LOG:
+        if (ast->rightChild() == nullptr) {
+            return compileOperation(OpCode::LOG, ast->leftChild(), nullptr, result, program);
+        }
+
+        if (isNumber(ast->leftChild(), 10.0)) {
+            return compileOperation(OpCode::LOG, ast->rightChild(), nullptr, result, program);
+        }
+
+        return compileOperation(OpCode::LOG_BASE, ast->rightChild(), ast->leftChild(), result, program);
+    case AnalyserEquationAst::Type::CEILING:
+        return compileOperation(OpCode::CEILING, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::FLOOR:
+        return compileOperation(OpCode::FLOOR, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::MIN:
+        return compileOperation(OpCode::MIN, ast->leftChild(), ast->rightChild(), result, program);
+    case AnalyserEquationAst::Type::MAX:
+        return compileOperation(OpCode::MAX, ast->leftChild(), ast->rightChild(), result, program);
+    case AnalyserEquationAst::Type::REM:
+        return compileOperation(OpCode::REM, ast->leftChild(), ast->rightChild(), result, program);
+    case AnalyserEquationAst::Type::DIFF:
+        return compile(ast->rightChild(), result, program);
+    case AnalyserEquationAst::Type::SIN:
+        return compileOperation(OpCode::SIN, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::COS:
+        return compileOperation(OpCode::COS, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::TAN:
+        return compileOperation(OpCode::TAN, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::SEC:
+        return compileOperation(OpCode::SEC, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::CSC:
+        return compileOperation(OpCode::CSC, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::COT:
+        return compileOperation(OpCode::COT, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::SINH:
+        return compileOperation(OpCode::SINH, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::COSH:
+        return compileOperation(OpCode::COSH, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::TANH:
+        return compileOperation(OpCode::TANH, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::SECH:
+        return compileOperation(OpCode::SECH, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::CSCH:
+        return compileOperation(OpCode::CSCH, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::COTH:
+        return compileOperation(OpCode::COTH, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::ASIN:
+        return compileOperation(OpCode::ASIN, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::ACOS:
+        return compileOperation(OpCode::ACOS, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::ATAN:
+        return compileOperation(OpCode::ATAN, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::ASEC:
+        return compileOperation(OpCode::ASEC, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::ACSC:
+        return compileOperation(OpCode::ACSC, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::ACOT:
+        return compileOperation(OpCode::ACOT, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::ASINH:
+        return compileOperation(OpCode::ASINH, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::ACOSH:
+        return compileOperation(OpCode::ACOSH, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::ATANH:
+        return compileOperation(OpCode::ATANH, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::ASECH:
+        return compileOperation(OpCode::ASECH, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::ACSCH:
+        return compileOperation(OpCode::ACSCH, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::ACOTH:
+        return compileOperation(OpCode::ACOTH, ast->leftChild(), nullptr, result, program);
+    case AnalyserEquationAst::Type::PIECEWISE:
+    case AnalyserEquationAst::Type::PIECE:
+    case AnalyserEquationAst::Type::OTHERWISE:
+        return compilePiecewise(ast, result, program);
+    case AnalyserEquationAst::Type::CI:
+        leaf = variableLocation(ast->variable(), ast->parent()->type() != AnalyserEquationAst::Type::DIFF);
+
+        break;
+    case AnalyserEquationAst::Type::CN: {
+        double value;
+
+        convertToDouble(ast->value(), value);
+
+        leaf = constant(value);
+    } break;
+    case AnalyserEquationAst::Type::DEGREE:
+    case AnalyserEquationAst::Type::LOGBASE:
+    case AnalyserEquationAst::Type::BVAR:
+        return compile(ast->leftChild(), result, program);
+    case AnalyserEquationAst::Type::TRUE:
+        leaf = constant(1.0);
+
+        break;
+    case AnalyserEquationAst::Type::FALSE:
+        leaf = constant(0.0);
+
+        break;
+    case AnalyserEquationAst::Type::E:
+        leaf = constant(M_E);
+
+        break;
+    case AnalyserEquationAst::Type::PI:
+        leaf = constant(M_PI);
+
+        break;
+    case AnalyserEquationAst::Type::INF:
+        leaf = constant(std::numeric_limits<double>::infinity());
+
+        break;
+    default: // AnalyserEquationAst::Type::NAN.
+        leaf = constant(NOT_A_NUMBER);
+
+        break;
+    }
+
+    // We are dealing with a leaf, so there is nothing to compute unless its
+    // value is expected in a specific location.
+
+    if (result == nullptr) {
+        return {leaf, false};
+    }
+
+    program.push_back({OpCode::COPY, result, leaf, nullptr});
+
+    return {result, false};
+}
+
+void Interpreter::InterpreterImpl::compileInitialisation(const AnalyserVariablePtr &variable,
+                                                         InterpreterProgram &program)
+{
+    auto initialisingVariable = variable->initialisingVariable();
+    auto scalingFactor = Units::scalingFactor(initialisingVariable->units(), variable->variable()->units());
+    auto location = variableLocation(variable->variable());
+    auto initialValue = initialValueLocation(initialisingVariable);
+
+    if (areNearlyEqual(scalingFactor, 1.0)) {
+        program.push_back({OpCode::COPY, location, initialValue, nullptr});
+    } else {
+        program.push_back({OpCode::TIMES, location, constant(1.0 / scalingFactor), initialValue});
+    }
+}
+
+void Interpreter::InterpreterImpl::compileNlaSystem(const AnalyserEquationPtr &equation)
+{
+    // Compile the program that computes the residuals of the NLA system to
+    // which the given equation belongs, unless it has already been compiled.
+    // Note: the residuals must be allocated before compiling the program since
+    //       it directly refers to them.
+
+    if (mNlaSystems.count(equation->nlaSystemIndex()) != 0) {
+        return;
+    }
+
+    auto &nlaSystem = mNlaSystems[equation->nlaSystemIndex()];
+    auto unknownCount = equation->variableCount();
+    auto residualCount = 1 + equation->nlaSiblingCount();
+
+    for (const auto &variable : equation->variables()) {
+        nlaSystem.mUnknowns.push_back(variableLocation(variable->variable(), false));
+    }
+
+    nlaSystem.mResiduals.resize(residualCount);
+    nlaSystem.mInitialUnknowns.resize(unknownCount);
+    nlaSystem.mInitialResiduals.resize(residualCount);
+    nlaSystem.mJacobian.resize(residualCount * unknownCount);
+    nlaSystem.mStep.resize(unknownCount);
+
+    compile(equation->ast(), &nlaSystem.mResiduals[0], nlaSystem.mProgram);
+
+    for (size_t i = 0; i < equation->nlaSiblingCount(); ++i) {
+        compile(equation->nlaSibling(i)->ast(), &nlaSystem.mResiduals[i + 1], nlaSystem.mProgram);
+    }
+}
+
+void Interpreter::InterpreterImpl::compileEquation(const AnalyserEquationPtr &equation,
+                                                   InterpreterProgram &program)
+{
+    // Compile the equation, based on its type. The value of an external
+    // variable is set by the user, so there is nothing to compile for it.
+
+    switch (equation->type()) {
+    case AnalyserEquation::Type::EXTERNAL:
+        break;
+    case AnalyserEquation::Type::NLA:
+        compileNlaSystem(equation);
+
+        program.push_back({OpCode::NLA_SOLVE, nullptr, nullptr, nullptr, equation->nlaSystemIndex()});
+
+        break;
+    default: {
+        auto ast = equation->ast();
+
+        compile(ast->rightChild(), compile(ast->leftChild(), nullptr, program).mValue, program);
+    } break;
+    }
+}
+
+void Interpreter::InterpreterImpl::compileEquations(const std::vector<AnalyserEquationPtr> &equations,
+                                                    InterpreterProgram &program)
+{
+    // Compile the given equations, which are scheduled the same way as for
+    // the generator (see scheduleEquation()), so that we compute things in
+    // the same order as generated code.
+
+    for (const auto &equation : equations) {
+        compileEquation(equation, program);
+    }
+}
+
+void Interpreter::InterpreterImpl::compileInitialiseVariablesProgram(AnalyserEquationSet &remainingEquations)
+{
+    // Initialise our constants and our algebraic variables that have an
+    // initial value. Also use an initial guess of zero for computed constants
+    // and algebraic variables computed using an NLA system.
+
+    for (const auto &variable : mModel->variables()) {
+        switch (variable->type()) {
+        case AnalyserVariable::Type::CONSTANT:
+            compileInitialisation(variable, mInitialiseVariablesProgram);
+
+            break;
+        case AnalyserVariable::Type::COMPUTED_CONSTANT:
+        case AnalyserVariable::Type::ALGEBRAIC:
+            if (variable->initialisingVariable() != nullptr) {
+                compileInitialisation(variable, mInitialiseVariablesProgram);
+            } else if (variable->equation(0)->type() == AnalyserEquation::Type::NLA) {
+                mInitialiseVariablesProgram.push_back({OpCode::COPY, variableLocation(variable->variable(), false), constant(0.0), nullptr});
+            }
+
+            break;
+        default: // Other types we don't care about.
+            break;
+        }
+    }
+
+    // Initialise our true constants.
+
+    compileEquations(equationsToInitialiseVariables(mModel, remainingEquations), mInitialiseVariablesProgram);
+
+    // Initialise our states.
+
+    for (const auto &state : mModel->states()) {
+        compileInitialisation(state, mInitialiseVariablesProgram);
+    }
+
+    // Use an initial guess of zero for rates computed using an NLA system.
+
+    for (const auto &state : mModel->states()) {
+        if (state->equation(0)->type() == AnalyserEquation::Type::NLA) {
+            mInitialiseVariablesProgram.push_back({OpCode::COPY, variableLocation(state->variable(), false), constant(0.0), nullptr});
+        }
+    }
+}
+
+void Interpreter::InterpreterImpl::compileComputeComputedConstantsProgram(AnalyserEquationSet &remainingEquations)
+{
+    compileEquations(equationsToComputeComputedConstants(mModel, remainingEquations), mComputeComputedConstantsProgram);
+}
+
+void Interpreter::InterpreterImpl::compileComputeRatesProgram(AnalyserEquationSet &remainingEquations)
+{
+    compileEquations(equationsToComputeRates(mModel, remainingEquations), mComputeRatesProgram);
+}
+
+void Interpreter::InterpreterImpl::compileComputeVariablesProgram(AnalyserEquationSet &remainingEquations)
+{
+    compileEquations(equationsToComputeVariables(mModel, remainingEquations), mComputeVariablesProgram);
+}
+
+void Interpreter::InterpreterImpl::execute(const InterpreterProgram &program)
+{
+    const auto *instructions = program.data();
+    auto instructionCount = program.size();
+    size_t i = 0;
+
+    while (i < instructionCount) {
+        const auto &instruction = instructions[i++];
+        auto *result = instruction.mResult;
+        const auto *left = instruction.mLeft;
+        const auto *right = instruction.mRight;
+
+        switch (instruction.mOpCode) {
+        case OpCode::COPY:
+            *result = *left;
+
+            break;
+        case OpCode::EQ:
+            *result = (*left == *right) ? 1.0 : 0.0;
+
+            break;
+        case OpCode::NEQ:
+            *result = (*left != *right) ? 1.0 : 0.0;
+
+            break;
+        case OpCode::LT:
+            *result = (*left < *right) ? 1.0 : 0.0;
+
+            break;
+        case OpCode::LEQ:
+            *result = (*left <= *right) ? 1.0 : 0.0;
+
+            break;
+        case OpCode::GT:
+            *result = (*left > *right) ? 1.0 : 0.0;
+
+            break;
+        case OpCode::GEQ:
+            *result = (*left >= *right) ? 1.0 : 0.0;
+
+            break;
+        case OpCode::AND:
+            *result = ((*left != 0.0) && (*right != 0.0)) ? 1.0 : 0.0;
+
+            break;
+        case OpCode::OR:
+            *result = ((*left != 0.0) || (*right != 0.0)) ? 1.0 : 0.0;
+
+            break;
+        case OpCode::XOR:
+            *result = ((*left != 0.0) != (*right != 0.0)) ? 1.0 : 0.0;
+
+            break;
+        case OpCode::NOT:
+            *result = (*left == 0.0) ? 1.0 : 0.0;
+
+            break;
+        case OpCode::PLUS:
+            *result = *left + *right;
+
+            break;
+        case OpCode::MINUS:
+            *result = *left - *right;
+
+            break;
+        case OpCode::NEGATE:
+            *result = -*left;
+
+            break;
+        case OpCode::TIMES:
+            *result = *left * *right;
+
+            break;
+        case OpCode::DIVIDE:
+            *result = *left / *right;
+
+            break;
+        case OpCode::POWER:
+            *result = std::pow(*left, *right);
+
+            break;
+        case OpCode::SQUARE:
+            *result = *left * *left;
+
+            break;
+        case OpCode::SQUARE_ROOT:
+            *result = std::sqrt(*left);
+
+            break;
+        case OpCode::ROOT:
+            *result = std::pow(*left, 1.0 / *right);
+
+            break;
+        case OpCode::ABS:
+            *result = std::fabs(*left);
+
+            break;
+        case OpCode::EXP:
+            *result = std::exp(*left);
+
+            break;
+        case OpCode::LN:
+            *result = std::log(*left);
+
+            break;
+        case OpCode::LOG:
+            *result = std::log10(*left);
+
+            break;
+        case OpCode::LOG_BASE:
+            *result = std::log(*left) / std::log(*right);
+
+            break;
+        case OpCode::CEILING:
+            *result = std::ceil(*left);
+
+            break;
+        case OpCode::FLOOR:
+            *result = std::floor(*left);
+
+            break;
+        case OpCode::MIN:
+            *result = std::fmin(*left, *right);
+
+            break;
+        case OpCode::MAX:
+            *result = std::fmax(*left, *right);
+
+            break;
+        case OpCode::REM:
+            *result = std::fmod(*left, *right);
+
+            break;
+        case OpCode::SIN:
+            *result = std::sin(*left);
+
+            break;
+        case OpCode::COS:
+            *result = std::cos(*left);
+
+            break;
+        case OpCode::TAN:
+            *result = std::tan(*left);
+
+            break;
+        case OpCode::SEC:
+            *result = 1.0 / std::cos(*left);
+
+            break;
+        case OpCode::CSC:
+            *result = 1.0 / std::sin(*left);
+
+            break;
+        case OpCode::COT:
+            *result = 1.0 / std::tan(*left);
+
+            break;
+        case OpCode::SINH:
+            *result = std::sinh(*left);
+
+            break;
+        case OpCode::COSH:
+            *result = std::cosh(*left);
+
+            break;
+        case OpCode::TANH:
+            *result = std::tanh(*left);
+
+            break;
+        case OpCode::SECH:
+            *result = 1.0 / std::cosh(*left);
+
+            break;
+        case OpCode::CSCH:
+            *result = 1.0 / std::sinh(*left);
+
+            break;
+        case OpCode::COTH:
+            *result = 1.0 / std::tanh(*left);
+
+            break;
+        case OpCode::ASIN:
+            *result = std::asin(*left);
+
+            break;
+        case OpCode::ACOS:
+            *result = std::acos(*left);
+
+            break;
+        case OpCode::ATAN:
+            *result = std::atan(*left);
+
+            break;
+        case OpCode::ASEC:
+            *result = std::acos(1.0 / *left);
+
+            break;
+        case OpCode::ACSC:
+            *result = std::asin(1.0 / *left);
+
+            break;
+        case OpCode::ACOT:
+            *result = std::atan(1.0 / *left);
+
+            break;
+        case OpCode::ASINH:
+            *result = std::asinh(*left);
+
+            break;
+        case OpCode::ACOSH:
+            *result = std::acosh(*left);
+
+            break;
+        case OpCode::ATANH:
+            *result = std::atanh(*left);
+
+            break;
+        case OpCode::ASECH:
+            *result = std::acosh(1.0 / *left);
+
+            break;
+        case OpCode::ACSCH:
+            *result = std::asinh(1.0 / *left);
+
+            break;
+        case OpCode::ACOTH:
+            *result = std::atanh(1.0 / *left);
+
+            break;
+        case OpCode::JUMP:
+            i = instruction.mIndex;
+
+            break;
+        case OpCode::JUMP_IF_FALSE:
+            if (*left == 0.0) {
+                i = instruction.mIndex;
+            }
+
+            break;
+        case OpCode::NLA_SOLVE:
+            solveNlaSystem(mNlaSystems.find(instruction.mIndex)->second);
+
+            break;
+        }
+    }
+}
+
+static double maximumNorm(const std::vector<double> &values)
+{
+    double res = 0.0;
+
+    for (auto value : values) {
+        res = std::fmax(res, std::fabs(value));
+    }
+
+    return res;
+}
+
+static bool solveLinearSystem(std::vector<double> &matrix, std::vector<double> &vector)
+{
+    // Solve the given (row-major) linear system in place using Gaussian
+    // elimination with partial pivoting. The solution ends up in vector.
+
+    auto size = vector.size();
+
+    for (size_t k = 0; k < size; ++k) {
+        auto pivot = k;
+
+        for (size_t i = k + 1; i < size; ++i) {
+            if (std::fabs(matrix[i * size + k]) > std::fabs(matrix[pivot * size + k])) {
+                pivot = i;
+            }
+        }
+
+        if ((matrix[pivot * size + k] == 0.0) || std::isnan(matrix[pivot * size + k])) {
+            return false;
+        }
+
+        if (pivot != k) {
+            for (size_t j = k; j < size; ++j) {
+                std::swap(matrix[k * size + j], matrix[pivot * size + j]);
+            }
+
+            std::swap(vector[k], vector[pivot]);
+        }
+
+        for (size_t i = k + 1; i < size; ++i) {
+            auto factor = matrix[i * size + k] / matrix[k * size + k];
+
+            for (size_t j = k + 1; j < size; ++j) {
+                matrix[i * size + j] -= factor * matrix[k * size + j];
+            }
+
+            vector[i] -= factor * vector[k];
+        }
+    }
+
+    for (size_t k = size; k-- > 0;) {
+        for (size_t j = k + 1; j < size; ++j) {
+            vector[k] -= matrix[k * size + j] * vector[j];
+        }
+
+        vector[k] /= matrix[k * size + k];
+    }
+
+    return true;
+}
+
+void Interpreter::InterpreterImpl::solveNlaSystem(NlaSystem &nlaSystem)
+{
+    // Solve the NLA system using a damped Newton method, with a Jacobian
+    // approximated using forward finite differences. The current value of the
+    // unknowns is used as an initial guess.
+    // Note: the analyser guarantees that an NLA system has as many equations
+    //       as unknowns.
+
+    static const double SQRT_EPSILON = std::sqrt(std::numeric_limits<double>::epsilon());
+
+    auto &unknowns = nlaSystem.mUnknowns;
+    auto &residuals = nlaSystem.mResiduals;
+    auto &initialUnknowns = nlaSystem.mInitialUnknowns;
+    auto &initialResiduals = nlaSystem.mInitialResiduals;
+    auto &jacobian = nlaSystem.mJacobian;
+    auto &step = nlaSystem.mStep;
+    auto size = unknowns.size();
+
+    execute(nlaSystem.mProgram);
+
+    auto residualsNorm = maximumNorm(residuals);
+
+    for (size_t iteration = 0;
+         (iteration < NEWTON_MAXIMUM_NUMBER_OF_ITERATIONS) && (residualsNorm != 0.0);
+         ++iteration) {
+        // Approximate the Jacobian.
+
+        initialResiduals = residuals;
+
+        for (size_t j = 0; j < size; ++j) {
+            initialUnknowns[j] = *unknowns[j];
+
+            auto h = SQRT_EPSILON * std::fmax(std::fabs(initialUnknowns[j]), 1.0);
+
+            *unknowns[j] = initialUnknowns[j] + h;
+
+            execute(nlaSystem.mProgram);
+
+            for (size_t i = 0; i < size; ++i) {
+                jacobian[i * size + j] = (residuals[i] - initialResiduals[i]) / h;
+            }
+
+            *unknowns[j] = initialUnknowns[j];
+        }
+
+        // Compute the Newton step.
+
+        for (size_t i = 0; i < size; ++i) {
+            step[i] = -initialResiduals[i];
+        }
+
+        if (!solveLinearSystem(jacobian, step)) {
+            residuals = initialResiduals;
+
+            break;
+        }
+
+        // Take the Newton step, halving it for as long as it doesn't reduce
+        // the residuals (but only up to a point).
+
+        auto dampingFactor = 1.0;
+
+        for (;;) {
+            for (size_t j = 0; j < size; ++j) {
+                *unknowns[j] = initialUnknowns[j] + dampingFactor * step[j];
+            }
+
+            execute(nlaSystem.mProgram);
+
+            auto newResidualsNorm = maximumNorm(residuals);
+
+            if ((newResidualsNorm < residualsNorm)
+                || (dampingFactor <= NEWTON_MINIMUM_DAMPING_FACTOR)) {
+                residualsNorm = newResidualsNorm;
+
+                break;
+            }
+
+            dampingFactor *= 0.5;
+        }
+
+        // Check whether the step was small enough for us to have converged.
+
+        auto converged = true;
+
+        for (size_t j = 0; j < size; ++j) {
+            if (std::fabs(dampingFactor * step[j]) > NEWTON_TOLERANCE * std::fmax(std::fabs(*unknowns[j]), 1.0)) {
+                converged = false;
+
+                break;
+            }
+        }
+
+        if (converged) {
+            break;
+        }
+    }
+}
+
+Interpreter::Interpreter()
+    : mPimpl(new InterpreterImpl())
+{
+}
+
+Interpreter::~Interpreter()
+{
+    delete mPimpl;
+}
+
+InterpreterPtr Interpreter::create() noexcept
+{
+    return std::shared_ptr<Interpreter> {new Interpreter {}};
+}
+
+AnalyserModelPtr Interpreter::model()
+{
+    return mPimpl->mModel;
+}
+
+void Interpreter::setModel(const AnalyserModelPtr &model)
+{
+    mPimpl->mModel = model;
+
+    mPimpl->reset();
+
+    if ((model == nullptr) || !model->isValid()) {
+        return;
+    }
+
+    // Allocate our arrays before compiling anything since our bytecode refers
+    // directly to them.
+
+    mPimpl->mStates.assign(model->stateCount(), NOT_A_NUMBER);
+    mPimpl->mRates.assign(model->stateCount(), NOT_A_NUMBER);
+    mPimpl->mVariables.assign(model->variableCount(), NOT_A_NUMBER);
+
+    // Compile our different programs, keeping track of the equations that
+    // have been compiled so far, in the same way as the generator does.
+
+    const auto &equations = model->equations();
+    AnalyserEquationSet remainingEquations {std::begin(equations), std::end(equations)};
+
+    mPimpl->compileInitialiseVariablesProgram(remainingEquations);
+    mPimpl->compileComputeComputedConstantsProgram(remainingEquations);
+    mPimpl->compileComputeRatesProgram(remainingEquations);
+    mPimpl->compileComputeVariablesProgram(remainingEquations);
+}
+
+double Interpreter::voi() const
+{
+    return mPimpl->mVoi;
+}
+
+std::vector<double> Interpreter::states() const
+{
+    return mPimpl->mStates;
+}
+
+double Interpreter::state(size_t index) const
+{
+    if (index < mPimpl->mStates.size()) {
+        return mPimpl->mStates[index];
+    }
+
+    return NOT_A_NUMBER;
+}
+
+void Interpreter::setState(size_t index, double value)
+{
+    if (index < mPimpl->mStates.size()) {
+        mPimpl->mStates[index] = value;
+    }
+}
+
+std::vector<double> Interpreter::rates() const
+{
+    return mPimpl->mRates;
+}
+
+double Interpreter::rate(size_t index) const
+{
+    if (index < mPimpl->mRates.size()) {
+        return mPimpl->mRates[index];
+    }
+
+    return NOT_A_NUMBER;
+}
+
+std::vector<double> Interpreter::variables() const
+{
+    return mPimpl->mVariables;
+}
+
+double Interpreter::variable(size_t index) const
+{
+    if (index < mPimpl->mVariables.size()) {
+        return mPimpl->mVariables[index];
+    }
+
+    return NOT_A_NUMBER;
+}
+
+void Interpreter::setVariable(size_t index, double value)
+{
+    if (index < mPimpl->mVariables.size()) {
+        mPimpl->mVariables[index] = value;
+    }
+}
+
+void Interpreter::initialiseVariables()
+{
+    mPimpl->execute(mPimpl->mInitialiseVariablesProgram);
+}
+
+void Interpreter::computeComputedConstants()
+{
+    mPimpl->execute(mPimpl->mComputeComputedConstantsProgram);
+}
+
+void Interpreter::computeRates(double voi)
+{
+    mPimpl->mVoi = voi;
+
+    mPimpl->execute(mPimpl->mComputeRatesProgram);
+}
+
+void Interpreter::computeVariables(double voi)
+{
+    mPimpl->mVoi = voi;
+
+    mPimpl->execute(mPimpl->mComputeVariablesProgram);
+}
+
+} // namespace libcellml
@@ -0,0 +1,210 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <deque>
+#include <map>
+
+#include "libcellml/interpreter.h"
+
+#include "internaltypes.h"
+
+namespace libcellml {
+
+/**
+ * @brief The InterpreterInstruction struct.
+ *
+ * An instruction of the bytecode executed by the @ref Interpreter.  Its
+ * operands are pointers to either an array of the interpreter, a constant or
+ * a register, so that no lookup is needed when executing it.
+ */
+struct InterpreterInstruction
+{
+    enum class OpCode
+    {
+        // Assignment.
+
+        COPY,
+
+        // Relational and logical operators.
+
+        EQ,
+        NEQ,
+        LT,
+        LEQ,
+        GT,
+        GEQ,
+        AND,
+        OR,
+        XOR,
+        NOT,
+
+        // Arithmetic operators.
+
+        PLUS,
+        MINUS,
+        NEGATE,
+        TIMES,
+        DIVIDE,
+        POWER,
+        SQUARE,
+        SQUARE_ROOT,
+        ROOT,
+        ABS,
+        EXP,
+        LN,
+        LOG,
+        LOG_BASE,
+        CEILING,
+        FLOOR,
+        MIN,
+        MAX,
+        REM,
+
+        // Trigonometric operators.
+
+        SIN,
+        COS,
+        TAN,
+        SEC,
+        CSC,
+        COT,
+        SINH,
+        COSH,
+        TANH,
+        SECH,
+        CSCH,
+        COTH,
+        ASIN,
+        ACOS,
+        ATAN,
+        ASEC,
+        ACSC,
+        ACOT,
+        ASINH,
+        ACOSH,
+        ATANH,
+        ASECH,
+        ACSCH,
+        ACOTH,
+
+        // Control flow.
+
+        JUMP,
+        JUMP_IF_FALSE,
+        NLA_SOLVE
+    };
+
+    OpCode mOpCode; /**< The operation to perform. */
+    double *mResult = nullptr; /**< Where to store the result of the operation. */
+    const double *mLeft = nullptr; /**< The first operand, if any. */
+    const double *mRight = nullptr; /**< The second operand, if any. */
+    size_t mIndex = 0; /**< The target of a jump or the index of an NLA system. */
+};
+
+using InterpreterProgram = std::vector<InterpreterInstruction>; /**< Type definition for a list of instructions. */
+
+/**
+ * @brief The Interpreter::InterpreterImpl struct.
+ *
+ * The private implementation for the Interpreter class.
+ */
+struct Interpreter::InterpreterImpl
+{
+    /**
+     * @brief An NLA system.
+     *
+     * The unknowns of an NLA system and the program that computes its
+     * residuals, i.e. the value of its equations written as lhs-rhs.
+     */
+    struct NlaSystem
+    {
+        std::vector<double *> mUnknowns; /**< The unknowns, in the states, rates and variables arrays. */
+        std::vector<double> mResiduals; /**< The residuals, as computed by mProgram. */
+        InterpreterProgram mProgram; /**< The program that computes the residuals. */
+
+        std::vector<double> mInitialUnknowns; /**< Work array for the value of the unknowns at the start of a Newton iteration. */
+        std::vector<double> mInitialResiduals; /**< Work array for the value of the residuals at the start of a Newton iteration. */
+        std::vector<double> mJacobian; /**< Work array for the (row-major) Jacobian of the residuals. */
+        std::vector<double> mStep; /**< Work array for the Newton step. */
+    };
+
+    /**
+     * @brief An operand.
+     *
+     * The location of a value and whether that location is a register that
+     * can be released once the value has been used.
+     */
+    struct Operand
+    {
+        double *mValue;
+        bool mIsRegister;
+    };
+
+    AnalyserModelPtr mModel;
+
+    double mVoi = 0.0;
+    std::vector<double> mStates;
+    std::vector<double> mRates;
+    std::vector<double> mVariables;
+
+    std::deque<double> mConstants;
+    std::deque<double> mRegisters;
+    std::vector<double *> mFreeRegisters;
+
+    InterpreterProgram mInitialiseVariablesProgram;
+    InterpreterProgram mComputeComputedConstantsProgram;
+    InterpreterProgram mComputeRatesProgram;
+    InterpreterProgram mComputeVariablesProgram;
+    std::map<size_t, NlaSystem> mNlaSystems;
+
+    void reset();
+
+    double *constant(double value);
+    double *allocateRegister();
+    void releaseRegister(const Operand &operand);
+
+    double *variableLocation(const VariablePtr &variable, bool state = true);
+    double *initialValueLocation(const VariablePtr &variable);
+
+    Operand compileOperation(InterpreterInstruction::OpCode opCode,
+                             const AnalyserEquationAstPtr &leftAst,
+                             const AnalyserEquationAstPtr &rightAst,
+                             double *result, InterpreterProgram &program);
+    Operand compilePiecewise(const AnalyserEquationAstPtr &ast,
+                             double *result, InterpreterProgram &program);
+    Operand compile(const AnalyserEquationAstPtr &ast, double *result,
+                    InterpreterProgram &program);
+
+    void compileInitialisation(const AnalyserVariablePtr &variable,
+                               InterpreterProgram &program);
+    void compileNlaSystem(const AnalyserEquationPtr &equation);
+    void compileEquation(const AnalyserEquationPtr &equation,
+                         InterpreterProgram &program);
+    void compileEquations(const std::vector<AnalyserEquationPtr> &equations,
+                          InterpreterProgram &program);
+
+    void compileInitialiseVariablesProgram(AnalyserEquationSet &remainingEquations);
+    void compileComputeComputedConstantsProgram(AnalyserEquationSet &remainingEquations);
+    void compileComputeRatesProgram(AnalyserEquationSet &remainingEquations);
+    void compileComputeVariablesProgram(AnalyserEquationSet &remainingEquations);
+
+    void execute(const InterpreterProgram &program);
+    void solveNlaSystem(NlaSystem &nlaSystem);
+};
+
+} // namespace libcellml
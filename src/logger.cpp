@@ -45,7 +45,7 @@ Logger::~Logger() = default;
 
 size_t Logger::errorCount() const
 {
-    return pFunc()->mErrors.size();
+    return pFunc()->mErrorCount;
 }
 
 IssuePtr Logger::error(size_t index) const
@@ -59,7 +59,7 @@ IssuePtr Logger::error(size_t index) const
 
 size_t Logger::warningCount() const
 {
-    return pFunc()->mWarnings.size();
+    return pFunc()->mWarningCount;
 }
 
 IssuePtr Logger::warning(size_t index) const
@@ -73,7 +73,7 @@ IssuePtr Logger::warning(size_t index) const
 
 size_t Logger::messageCount() const
 {
-    return pFunc()->mMessages.size();
+    return pFunc()->mMessageCount;
 }
 
 IssuePtr Logger::message(size_t index) const
@@ -91,37 +91,85 @@ void Logger::LoggerImpl::removeAllIssues()
     mErrors.clear();
     mWarnings.clear();
     mMessages.clear();
+    mErrorCount = 0;
+    mWarningCount = 0;
+    mMessageCount = 0;
 }
 
 void Logger::LoggerImpl::removeError(size_t index)
 {
-    mIssues.erase(mIssues.begin() + ptrdiff_t(mErrors.at(index)));
-    mErrors.erase(mErrors.begin() + ptrdiff_t(index));
+    // Errors that were only counted are not in our arrays.
+    if (index < mErrors.size()) {
+        mIssues.erase(mIssues.begin() + ptrdiff_t(mErrors.at(index)));
+        mErrors.erase(mErrors.begin() + ptrdiff_t(index));
+    }
+    --mErrorCount;
+}
+
+bool Logger::LoggerImpl::isStoringIssues() const
+{
+    // Stop storing issues as soon as one of them has been dropped, so that
+    // stored issues are always the first ones that were added.
+    return (mIssues.size() < mIssueStorageLimit)
+           && (mIssues.size() == mErrorCount + mWarningCount + mMessageCount);
 }
 
 void Logger::LoggerImpl::addIssue(const IssuePtr &issue)
 {
-    // When an issue is added, update the appropriate array based on its level.
+    // When an issue is added, count it and, if there is still room for it,
+    // update the appropriate array based on its level.
+    bool store = isStoringIssues();
     size_t index = mIssues.size();
-    mIssues.push_back(issue);
+    if (store) {
+        mIssues.push_back(issue);
+    }
     libcellml::Issue::Level level = issue->level();
     switch (level) {
     case libcellml::Issue::Level::ERROR:
-        mErrors.push_back(index);
+        ++mErrorCount;
+        if (store) {
+            mErrors.push_back(index);
+        }
         break;
     case libcellml::Issue::Level::WARNING:
-        mWarnings.push_back(index);
+        ++mWarningCount;
+        if (store) {
+            mWarnings.push_back(index);
+        }
         break;
     default:
         // Only remaining level is MESSAGE.
-        mMessages.push_back(index);
+        ++mMessageCount;
+        if (store) {
+            mMessages.push_back(index);
+        }
         break;
     }
 }
 
 size_t Logger::issueCount() const
 {
-    return pFunc()->mIssues.size();
+    return pFunc()->mErrorCount + pFunc()->mWarningCount + pFunc()->mMessageCount;
+}
+
+void Logger::setIssueStorageLimit(size_t limit)
+{
+    pFunc()->mIssueStorageLimit = limit;
+}
+
+size_t Logger::issueStorageLimit() const
+{
+    return pFunc()->mIssueStorageLimit;
+}
+
+void Logger::setProfiler(const ProfilerPtr &profiler)
+{
+    pFunc()->mProfiler = profiler;
+}
+
+ProfilerPtr Logger::profiler() const
+{
+    return pFunc()->mProfiler;
 }
 
 IssuePtr Logger::issue(size_t index) const
@@ -16,8 +16,13 @@ limitations under the License.
 
 #pragma once
 
+#include <limits>
+
 #include "libcellml/logger.h"
 
+#include "issue_p.h"
+#include "profiler_p.h"
+
 namespace libcellml {
 
 /**
@@ -35,6 +40,23 @@ public:
     std::vector<size_t> mMessages;
     std::vector<IssuePtr> mIssues;
 
+    size_t mIssueStorageLimit = std::numeric_limits<size_t>::max(); /**< The maximum number of issues kept by the logger. */
+    size_t mErrorCount = 0; /**< The number of errors logged, stored or not. */
+    size_t mWarningCount = 0; /**< The number of warnings logged, stored or not. */
+    size_t mMessageCount = 0; /**< The number of messages logged, stored or not. */
+
+    ProfilerPtr mProfiler; /**< The profiler, if any, used by the logger. */
+
+    /**
+     * @brief Test if the next issue will be stored.
+     *
+     * Test if the next issue added to this logger will be stored, or only
+     * counted because the issue storage limit has been reached.
+     *
+     * @return @c true if the next issue will be stored, @c false otherwise.
+     */
+    bool isStoringIssues() const;
+
     /**
      * @brief Add an issue to the logger.
      *
@@ -44,6 +66,27 @@ public:
      */
     void addIssue(const IssuePtr &issue);
 
+    /**
+     * @brief Add an issue to the logger, describing it on demand.
+     *
+     * Adds the argument @p issue to this logger.  The description of the
+     * issue is only formatted, using @p describe, if the issue is going to be
+     * stored.  Issues that are only counted never have their description
+     * built.
+     *
+     * @param issue The @c IssuePtr to add.
+     * @param describe A callable returning the description of @p issue.
+     */
+    template<typename Describe>
+    void addIssue(const IssuePtr &issue, Describe &&describe)
+    {
+        if (isStoringIssues()) {
+            issue->mPimpl->setDescription(describe());
+        }
+
+        addIssue(issue);
+    }
+
     /**
      * @brief Remove issue of level ERROR at the specified @p index.
      *
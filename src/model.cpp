@@ -42,6 +42,10 @@ namespace libcellml {
 
 std::vector<UnitsPtr>::const_iterator Model::ModelImpl::findUnits(const std::string &name) const
 {
+    if (mUnitsNames->count(name) == 0) {
+        return mUnits.end();
+    }
+
     return std::find_if(mUnits.begin(), mUnits.end(),
                         [=](const UnitsPtr &u) -> bool { return u->name() == name; });
 }
@@ -56,6 +60,49 @@ std::vector<UnitsPtr>::const_iterator Model::ModelImpl::findUnits(const UnitsPtr
                         [=](const UnitsPtr &u) -> bool { return u->equals(units); });
 }
 
+UnitsPtr Model::ModelImpl::lookupUnits(const std::string &name) const
+{
+    auto units = mUnitsNames->unique(name);
+    if (units != nullptr) {
+        return static_cast<Units *>(units)->shared_from_this();
+    }
+
+    auto result = findUnits(name);
+    if (result != mUnits.end()) {
+        return *result;
+    }
+
+    return nullptr;
+}
+
+void Model::ModelImpl::indexUnits(const UnitsPtr &units)
+{
+    mUnitsNames->add(units.get(), units->name());
+    units->pFunc()->mNameIndex = mUnitsNames;
+}
+
+void Model::ModelImpl::invalidateIds()
+{
+    ++mIdsRevision;
+    mIdChanges.clear();
+}
+
+void Model::ModelImpl::recordIdChange(IdChange idChange)
+{
+    // Keeping more changes would cost more memory than it would save time
+    // compared to rebuilding a list of identifiers.
+
+    static const size_t MAX_ID_CHANGES = 1024;
+
+    if (mIdChanges.size() == MAX_ID_CHANGES) {
+        mIdChanges.clear();
+    }
+
+    idChange.mRevision = ++mIdsRevision;
+
+    mIdChanges.push_back(std::move(idChange));
+}
+
 bool Model::ModelImpl::equalUnits(const ModelPtr &other) const
 {
     std::vector<EntityPtr> entities;
@@ -122,7 +169,9 @@ bool Model::addUnits(const UnitsPtr &units)
         otherParent->removeUnits(units);
     }
     pFunc()->mUnits.push_back(units);
+    pFunc()->indexUnits(units);
     units->pFunc()->setParent(thisModel);
+    units->pFunc()->invalidateResolvedUnits();
 
     return true;
 }
@@ -133,6 +182,8 @@ bool Model::removeUnits(size_t index)
     if (index < pFunc()->mUnits.size()) {
         auto result = pFunc()->mUnits.begin() + ptrdiff_t(index);
         (*result)->pFunc()->removeParent();
+        (*result)->pFunc()->invalidateResolvedUnits();
+        pFunc()->mUnitsNames->remove(result->get(), (*result)->name());
         pFunc()->mUnits.erase(result);
         status = true;
     }
@@ -146,6 +197,8 @@ bool Model::removeUnits(const std::string &name)
     auto result = pFunc()->findUnits(name);
     if (result != pFunc()->mUnits.end()) {
         (*result)->pFunc()->removeParent();
+        (*result)->pFunc()->invalidateResolvedUnits();
+        pFunc()->mUnitsNames->remove(result->get(), name);
         pFunc()->mUnits.erase(result);
         status = true;
     }
@@ -159,6 +212,8 @@ bool Model::removeUnits(const UnitsPtr &units)
     auto result = pFunc()->findUnits(units);
     if (result != pFunc()->mUnits.end()) {
         units->pFunc()->removeParent();
+        units->pFunc()->invalidateResolvedUnits();
+        pFunc()->mUnitsNames->remove(result->get(), (*result)->name());
         pFunc()->mUnits.erase(result);
         status = true;
     }
@@ -170,13 +225,15 @@ void Model::removeAllUnits()
 {
     for (const auto &u : pFunc()->mUnits) {
         u->pFunc()->removeParent();
+        u->pFunc()->invalidateResolvedUnits();
     }
     pFunc()->mUnits.clear();
+    pFunc()->mUnitsNames->clear();
 }
 
 bool Model::hasUnits(const std::string &name) const
 {
-    return pFunc()->findUnits(name) != pFunc()->mUnits.end();
+    return pFunc()->mUnitsNames->count(name) != 0;
 }
 
 bool Model::hasUnits(const UnitsPtr &units) const
@@ -196,13 +253,7 @@ UnitsPtr Model::units(size_t index) const
 
 UnitsPtr Model::units(const std::string &name) const
 {
-    UnitsPtr units = nullptr;
-    auto result = pFunc()->findUnits(name);
-    if (result != pFunc()->mUnits.end()) {
-        units = *result;
-    }
-
-    return units;
+    return pFunc()->lookupUnits(name);
 }
 
 UnitsPtr Model::takeUnits(size_t index)
@@ -227,7 +278,9 @@ bool Model::replaceUnits(size_t index, const UnitsPtr &units)
     bool status = false;
     if (removeUnits(index)) {
         pFunc()->mUnits.insert(pFunc()->mUnits.begin() + ptrdiff_t(index), units);
+        pFunc()->indexUnits(units);
         units->pFunc()->setParent(shared_from_this());
+        units->pFunc()->invalidateResolvedUnits();
         status = true;
     }
 
@@ -381,17 +434,14 @@ ModelPtr Model::clone() const
         fixComponentUnits(m, m->component(index));
     }
 
-    // Generate equivalence map starting from the models components.
-    EquivalenceMap map;
-    IndexStack indexStack;
+    // Map the original variables to their clones and transfer the equivalences across.
+    VariableCloneMap map;
     for (size_t index = 0; index < componentCount(); ++index) {
-        indexStack.push_back(index);
-        auto c = component(index);
-        recordVariableEquivalences(c, map, indexStack);
-        generateEquivalenceMap(c, map, indexStack);
-        indexStack.pop_back();
+        recordClonedVariables(component(index), m->component(index), map);
+    }
+    for (size_t index = 0; index < componentCount(); ++index) {
+        transferEquivalences(component(index), m->component(index), map);
     }
-    applyEquivalenceMapToModel(map, m);
 
     return m;
 }
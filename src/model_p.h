@@ -16,12 +16,32 @@ limitations under the License.
 
 #pragma once
 
+#include <string>
+#include <vector>
+
+#include "libcellml/enums.h"
 #include "libcellml/model.h"
 
 #include "componententity_p.h"
+#include "internaltypes.h"
 
 namespace libcellml {
 
+/**
+ * @brief The IdChange struct.
+ *
+ * An internal structure to capture a change of the identifier of an entity
+ * of a model, see invalidateId().
+ */
+struct IdChange
+{
+    size_t mRevision = 0; /**< Revision of the identifiers of the model following the change.*/
+    CellmlElementType mType = CellmlElementType::UNDEFINED; /**< Type of the entity.*/
+    EntityWeakPtr mEntity; /**< The entity.*/
+    std::string mOldId; /**< Previous identifier of the entity.*/
+    std::string mId; /**< New identifier of the entity.*/
+};
+
 /**
  * @brief The Model::ModelImpl class.
  *
@@ -33,10 +53,59 @@ class Model::ModelImpl: public ComponentEntityImpl
 {
 public:
     std::vector<UnitsPtr> mUnits;
+    NameIndexPtr mUnitsNames = std::make_shared<NameIndex>(); /**< Name index of the units in mUnits. */
+    size_t mIdsRevision = 1; /**< Revision of the identifiers of this model, changed whenever one of them changes. */
+    std::vector<IdChange> mIdChanges; /**< Changes of identifiers leading to the current revision, see recordIdChange(). */
 
     std::vector<UnitsPtr>::const_iterator findUnits(const std::string &name) const;
     std::vector<UnitsPtr>::const_iterator findUnits(const UnitsPtr &units) const;
 
+    /**
+     * @brief Look up the units with the given @p name.
+     *
+     * Look up the units with the given @p name using the name index.  If
+     * more than one units has the given @p name then the first one is
+     * returned.
+     *
+     * @param name The name of the units to look up.
+     *
+     * @return The units with the given @p name, @c nullptr if there is none.
+     */
+    UnitsPtr lookupUnits(const std::string &name) const;
+
+    /**
+     * @brief Add the @p units to the name index.
+     *
+     * Add the @p units to the name index and give it a reference to the
+     * name index so that it can be re-indexed when renamed.
+     *
+     * @param units The units to index.
+     */
+    void indexUnits(const UnitsPtr &units);
+
+    /**
+     * @brief Move to a new revision of the identifiers of this model.
+     *
+     * Move to a new revision of the identifiers of this model and forget
+     * about the changes of identifiers leading to it, i.e. a list of the
+     * identifiers of this model older than this revision needs rebuilding.
+     */
+    void invalidateIds();
+
+    /**
+     * @brief Move to a new revision of the identifiers of this model
+     * following the given @p idChange.
+     *
+     * Move to a new revision of the identifiers of this model and record the
+     * given @p idChange, so that a list of the identifiers of this model can be
+     * brought up to date by applying the changes recorded since its revision.
+     * Only a limited number of changes is kept, past which a list needs
+     * rebuilding.
+     *
+     * @param idChange The change of identifier.
+     */
+    void recordIdChange(IdChange idChange);
+
     /**
      * @brief Test to see if the units of this @ref Model are equal to the units of the @p other @ref Model.
      *
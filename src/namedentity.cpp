@@ -17,6 +17,7 @@ limitations under the License.
 #include "libcellml/namedentity.h"
 
 #include "namedentity_p.h"
+#include "units_p.h"
 
 namespace libcellml {
 
@@ -30,6 +31,22 @@ const NamedEntity::NamedEntityImpl *NamedEntity::pFunc() const
     return reinterpret_cast<NamedEntity::NamedEntityImpl const *>(Entity::pFunc());
 }
 
+void NamedEntity::NamedEntityImpl::setName(NamedEntity *entity, const std::string &name)
+{
+    auto nameIndex = mNameIndex.lock();
+    if (nameIndex != nullptr) {
+        nameIndex->rename(entity, mName, name);
+    }
+    mName = name;
+    // The name of some units may determine what they resolve to, e.g. if they
+    // are named after a base unit.  Units that refer to them by name get
+    // resolved again through the name index of their model.
+    auto units = dynamic_cast<Units *>(entity);
+    if (units != nullptr) {
+        units->pFunc()->invalidateResolvedUnits();
+    }
+}
+
 NamedEntity::NamedEntity(NamedEntity::NamedEntityImpl *pImpl)
     : ParentedEntity(pImpl)
 {
@@ -37,7 +54,7 @@ NamedEntity::NamedEntity(NamedEntity::NamedEntityImpl *pImpl)
 
 void NamedEntity::setName(const std::string &name)
 {
-    pFunc()->mName = name;
+    pFunc()->setName(this, name);
 }
 
 std::string NamedEntity::name() const
@@ -47,7 +64,7 @@ std::string NamedEntity::name() const
 
 void NamedEntity::removeName()
 {
-    pFunc()->mName = "";
+    pFunc()->setName(this, "");
 }
 
 bool NamedEntity::doEquals(const EntityPtr &other) const
@@ -18,6 +18,7 @@ limitations under the License.
 
 #include "libcellml/namedentity.h"
 
+#include "internaltypes.h"
 #include "parentedentity_p.h"
 
 namespace libcellml {
@@ -31,6 +32,18 @@ class NamedEntity::NamedEntityImpl: public ParentedEntityImpl
 {
 public:
     std::string mName; /**< Entity name represented as a std::string. */
+    NameIndexWeakPtr mNameIndex; /**< Name index of the parent entity, updated when this entity is renamed. */
+
+    /**
+     * @brief Set the name of this entity.
+     *
+     * Set the name of this entity, re-indexing it in the name index of its
+     * parent entity, if any.
+     *
+     * @param entity The entity this is the implementation of.
+     * @param name The new name.
+     */
+    void setName(NamedEntity *entity, const std::string &name);
 };
 
 } // namespace libcellml
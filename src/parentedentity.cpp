@@ -16,10 +16,17 @@ limitations under the License.
 
 #include "libcellml/entity.h"
 
+#include "libcellml/model.h"
+
 #include "parentedentity_p.h"
 
 namespace libcellml {
 
+ParentedEntity::ParentedEntityImpl *ParentedEntity::pFunc()
+{
+    return reinterpret_cast<ParentedEntity::ParentedEntityImpl *>(Entity::pFunc());
+}
+
 const ParentedEntity::ParentedEntityImpl *ParentedEntity::pFunc() const
 {
     return reinterpret_cast<ParentedEntity::ParentedEntityImpl const *>(Entity::pFunc());
@@ -37,7 +44,12 @@ ParentedEntityPtr ParentedEntity::parent() const
 
 void ParentedEntity::ParentedEntityImpl::removeParent()
 {
+    auto parent = mParent.lock();
+
     mParent = {};
+    if (mHasIds) {
+        invalidateIds(parent.get());
+    }
 }
 
 bool ParentedEntity::hasParent() const
@@ -67,6 +79,29 @@ bool ParentedEntity::hasAncestor(const ParentedEntityPtr &entity) const
 void ParentedEntity::ParentedEntityImpl::setParent(const ParentedEntityPtr &parent)
 {
     mParent = parent;
+    if (mHasIds) {
+        invalidateIds(parent.get());
+    }
+}
+
+Model *ParentedEntity::ParentedEntityImpl::flagIds(ParentedEntity *entity)
+{
+    ParentedEntityPtr parent;
+
+    while (entity != nullptr) {
+        entity->pFunc()->mHasIds = true;
+
+        auto model = dynamic_cast<Model *>(entity);
+
+        if (model != nullptr) {
+            return model;
+        }
+
+        parent = entity->parent();
+        entity = parent.get();
+    }
+
+    return nullptr;
 }
 
 } // namespace libcellml
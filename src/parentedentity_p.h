@@ -48,7 +48,22 @@ public:
      */
     void removeParent();
 
+    /**
+     * @brief Flag the given @p entity and its ancestors as having identifiers.
+     *
+     * Flag the given @p entity and its ancestors as having identifiers, so
+     * that the identifiers of a model only move to a new revision when an
+     * entity with identifiers, or with descendants with identifiers, is added
+     * to or removed from it.
+     *
+     * @param entity The entity to flag.
+     *
+     * @return The model owning the @p entity, if any, @c nullptr otherwise.
+     */
+    static Model *flagIds(ParentedEntity *entity);
+
     ParentedEntityWeakPtr mParent; /**< Pointer to parent. */
+    bool mHasIds = false; /**< Whether this entity, or one of its descendants, has ever had identifiers. */
 };
 
 } // namespace libcellml
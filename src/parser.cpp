@@ -276,6 +276,8 @@ ModelPtr Parser::parseModel(const std::string &input)
 
 ModelPtr Parser::ParserImpl::parseModel(const std::string &input)
 {
+    ProfilerScope profilerScope(mProfiler, Profiler::Phase::PARSE_MODEL);
+
     removeAllIssues();
     ModelPtr model = nullptr;
     if (input.empty()) {
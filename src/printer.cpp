@@ -284,9 +284,9 @@ std::string Printer::PrinterImpl::printComponent(const ComponentPtr &component,
                 repr += printReset(component->reset(i), idList, autoIds);
             }
             if (!component->math().empty()) {
-                size_t startIssueCount = mPrinter->issueCount();
+                size_t startIssueCount = mIssues.size();
                 repr += printMath(component->math());
-                size_t endIssueCount = mPrinter->issueCount();
+                size_t endIssueCount = mIssues.size();
                 for (size_t current = startIssueCount; current < endIssueCount; ++current) {
                     auto issue = mPrinter->issue(current);
                     issue->mPimpl->mItem->mPimpl->setComponent(component);
@@ -411,7 +411,7 @@ std::string Printer::PrinterImpl::printReset(const ResetPtr &reset, IdList &idLi
         repr += " id=\"" + makeUniqueId(idList) + "\"";
     }
 
-    size_t startIssueCount = mPrinter->issueCount();
+    size_t startIssueCount = mIssues.size();
     std::string testValue = printResetChild("test_value", reset->testValueId(), reset->testValue(), idList, autoIds);
     if (!testValue.empty()) {
         repr += ">" + testValue;
@@ -426,7 +426,7 @@ std::string Printer::PrinterImpl::printReset(const ResetPtr &reset, IdList &idLi
         hasChild = true;
     }
     if (hasChild) {
-        size_t endIssueCount = mPrinter->issueCount();
+        size_t endIssueCount = mIssues.size();
         for (size_t current = startIssueCount; current < endIssueCount; ++current) {
             auto issue = mPrinter->issue(current);
             issue->mPimpl->mItem->mPimpl->setReset(reset);
@@ -517,6 +517,8 @@ PrinterPtr Printer::create() noexcept
 
 std::string Printer::printModel(const ModelPtr &model, bool autoIds)
 {
+    ProfilerScope profilerScope(pFunc()->mProfiler, Profiler::Phase::PRINT_MODEL);
+
     if (model == nullptr) {
         return "";
     }
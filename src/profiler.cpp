@@ -0,0 +1,120 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "libcellml/profiler.h"
+
+#include <map>
+
+#include "profiler_p.h"
+
+namespace libcellml {
+
+void Profiler::ProfilerImpl::enter(Phase phase)
+{
+    // Only the outermost call of a phase is timed, so that recursive calls
+    // (e.g. when fetching nested imports) are not accounted for twice.
+
+    auto &data = mPhases[size_t(phase)];
+
+    ++data.mCallCount;
+
+    if (data.mDepth++ == 0) {
+        if (mAllocationCounter) {
+            data.mStartAllocationCount = mAllocationCounter();
+        }
+
+        data.mStartTime = std::chrono::steady_clock::now();
+    }
+}
+
+void Profiler::ProfilerImpl::leave(Phase phase)
+{
+    auto &data = mPhases[size_t(phase)];
+
+    if (--data.mDepth == 0) {
+        data.mElapsedTime += std::chrono::steady_clock::now() - data.mStartTime;
+
+        if (mAllocationCounter) {
+            data.mAllocationCount += mAllocationCounter() - data.mStartAllocationCount;
+        }
+    }
+}
+
+Profiler::Profiler()
+    : mPimpl(new ProfilerImpl())
+{
+}
+
+Profiler::~Profiler()
+{
+    delete mPimpl;
+}
+
+ProfilerPtr Profiler::create() noexcept
+{
+    return std::shared_ptr<Profiler> {new Profiler {}};
+}
+
+size_t Profiler::callCount(Phase phase) const
+{
+    return mPimpl->mPhases[size_t(phase)].mCallCount;
+}
+
+double Profiler::elapsedTime(Phase phase) const
+{
+    return std::chrono::duration<double>(mPimpl->mPhases[size_t(phase)].mElapsedTime).count();
+}
+
+size_t Profiler::allocationCount(Phase phase) const
+{
+    return mPimpl->mPhases[size_t(phase)].mAllocationCount;
+}
+
+void Profiler::setAllocationCounter(const AllocationCounter &counter)
+{
+    mPimpl->mAllocationCounter = counter;
+}
+
+void Profiler::reset()
+{
+    for (auto &data : mPimpl->mPhases) {
+        data.mCallCount = 0;
+        data.mElapsedTime = std::chrono::steady_clock::duration::zero();
+        data.mAllocationCount = 0;
+    }
+}
+
+static const std::map<Profiler::Phase, std::string> phaseToString = {
+    {Profiler::Phase::PARSE_MODEL, "parse_model"},
+    {Profiler::Phase::VALIDATE_MODEL, "validate_model"},
+    {Profiler::Phase::VALIDATE_MATH, "validate_math"},
+    {Profiler::Phase::ANALYSE_MODEL, "analyse_model"},
+    {Profiler::Phase::ANALYSE_EQUATION_UNITS, "analyse_equation_units"},
+    {Profiler::Phase::CHECK_EQUATIONS, "check_equations"},
+    {Profiler::Phase::RESOLVE_IMPORTS, "resolve_imports"},
+    {Profiler::Phase::FETCH_MODEL, "fetch_model"},
+    {Profiler::Phase::FLATTEN_MODEL, "flatten_model"},
+    {Profiler::Phase::PRINT_MODEL, "print_model"},
+    {Profiler::Phase::GENERATE_INTERFACE_CODE, "generate_interface_code"},
+    {Profiler::Phase::GENERATE_IMPLEMENTATION_CODE, "generate_implementation_code"},
+    {Profiler::Phase::ADD_NLA_SYSTEMS_CODE, "add_nla_systems_code"}};
+
+std::string Profiler::phaseAsString(Phase phase)
+{
+    return phaseToString.at(phase);
+}
+
+} // namespace libcellml
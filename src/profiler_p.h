@@ -0,0 +1,88 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <chrono>
+
+#include "libcellml/profiler.h"
+
+namespace libcellml {
+
+static const size_t PROFILER_PHASE_COUNT = size_t(Profiler::Phase::ADD_NLA_SYSTEMS_CODE) + 1;
+
+/**
+ * @brief The Profiler::ProfilerImpl struct.
+ *
+ * The private implementation for the Profiler class.
+ */
+struct Profiler::ProfilerImpl
+{
+    struct PhaseData
+    {
+        size_t mCallCount = 0; /**< The number of times the phase was entered. */
+        std::chrono::steady_clock::duration mElapsedTime = std::chrono::steady_clock::duration::zero(); /**< The time spent in the phase. */
+        size_t mAllocationCount = 0; /**< The number of allocations made in the phase. */
+        size_t mDepth = 0; /**< The number of active (i.e. nested) calls of the phase. */
+        std::chrono::steady_clock::time_point mStartTime; /**< The time at which the outermost call of the phase started. */
+        size_t mStartAllocationCount = 0; /**< The allocation count at which the outermost call of the phase started. */
+    };
+
+    std::array<PhaseData, PROFILER_PHASE_COUNT> mPhases;
+    AllocationCounter mAllocationCounter;
+
+    void enter(Phase phase);
+    void leave(Phase phase);
+};
+
+/**
+ * @brief The ProfilerScope class.
+ *
+ * Profile the enclosing scope as the given phase, if a profiler is set.  This
+ * class is meant to be instantiated on the stack at the start of a phase::
+ *
+ *   ProfilerScope scope(mProfiler, Profiler::Phase::VALIDATE_MATH);
+ */
+class ProfilerScope
+{
+public:
+    ProfilerScope(const ProfilerPtr &profiler, Profiler::Phase phase)
+        : mProfiler((profiler != nullptr) ? profiler->mPimpl : nullptr)
+        , mPhase(phase)
+    {
+        if (mProfiler != nullptr) {
+            mProfiler->enter(mPhase);
+        }
+    }
+
+    ~ProfilerScope()
+    {
+        if (mProfiler != nullptr) {
+            mProfiler->leave(mPhase);
+        }
+    }
+
+    ProfilerScope(const ProfilerScope &rhs) = delete;
+    ProfilerScope(ProfilerScope &&rhs) noexcept = delete;
+    ProfilerScope &operator=(ProfilerScope rhs) = delete;
+
+private:
+    Profiler::ProfilerImpl *mProfiler;
+    Profiler::Phase mPhase;
+};
+
+} // namespace libcellml
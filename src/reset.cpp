@@ -106,22 +106,25 @@ VariablePtr Reset::testVariable() const
 
 void Reset::appendTestValue(const std::string &math)
 {
-    pFunc()->mTestValue.append(math);
+    pFunc()->mTestValue.write().append(math);
 }
 
 std::string Reset::testValue() const
 {
-    return pFunc()->mTestValue;
+    return pFunc()->mTestValue.read();
 }
 
 void Reset::setTestValueId(const std::string &id)
 {
-    pFunc()->mTestValueId = id;
+    if (pFunc()->mTestValueId != id) {
+        pFunc()->mTestValueId = id;
+        invalidateIds(this);
+    }
 }
 
 void Reset::removeTestValueId()
 {
-    pFunc()->mTestValueId = "";
+    setTestValueId("");
 }
 
 std::string Reset::testValueId() const
@@ -131,42 +134,45 @@ std::string Reset::testValueId() const
 
 void Reset::setTestValue(const std::string &math)
 {
-    pFunc()->mTestValue = math;
+    pFunc()->mTestValue.assign(math);
 }
 
 void Reset::removeTestValue()
 {
-    pFunc()->mTestValue = "";
+    pFunc()->mTestValue.reset();
 }
 
 void Reset::appendResetValue(const std::string &math)
 {
-    pFunc()->mResetValue.append(math);
+    pFunc()->mResetValue.write().append(math);
 }
 
 std::string Reset::resetValue() const
 {
-    return pFunc()->mResetValue;
+    return pFunc()->mResetValue.read();
 }
 
 void Reset::setResetValue(const std::string &math)
 {
-    pFunc()->mResetValue = math;
+    pFunc()->mResetValue.assign(math);
 }
 
 void Reset::removeResetValue()
 {
-    pFunc()->mResetValue = "";
+    pFunc()->mResetValue.reset();
 }
 
 void Reset::setResetValueId(const std::string &id)
 {
-    pFunc()->mResetValueId = id;
+    if (pFunc()->mResetValueId != id) {
+        pFunc()->mResetValueId = id;
+        invalidateIds(this);
+    }
 }
 
 void Reset::removeResetValueId()
 {
-    pFunc()->mResetValueId = "";
+    setResetValueId("");
 }
 
 std::string Reset::resetValueId() const
@@ -180,9 +186,9 @@ ResetPtr Reset::clone() const
 
     r->setId(id());
     r->setOrder(order());
-    r->setResetValue(resetValue());
+    r->pFunc()->mResetValue.share(pFunc()->mResetValue);
     r->setResetValueId(resetValueId());
-    r->setTestValue(testValue());
+    r->pFunc()->mTestValue.share(pFunc()->mTestValue);
     r->setTestValueId(testValueId());
     if (pFunc()->mVariable != nullptr) {
         r->setVariable(pFunc()->mVariable->clone());
@@ -199,9 +205,9 @@ bool Reset::doEquals(const EntityPtr &other) const
     if (Entity::doEquals(other)) {
         auto reset = std::dynamic_pointer_cast<Reset>(other);
         if ((reset != nullptr) && pFunc()->mOrder == reset->order()
-            && areEqual(pFunc()->mResetValue, reset->resetValue())
+            && areEqual(pFunc()->mResetValue.read(), reset->resetValue())
             && pFunc()->mResetValueId == reset->resetValueId()
-            && areEqual(pFunc()->mTestValue, reset->testValue())
+            && areEqual(pFunc()->mTestValue.read(), reset->testValue())
             && pFunc()->mTestValueId == reset->testValueId()) {
             if (pFunc()->mTestVariable != nullptr
                 && !pFunc()->mTestVariable->equals(reset->testVariable())) {
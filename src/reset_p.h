@@ -18,6 +18,7 @@ limitations under the License.
 
 #include "libcellml/reset.h"
 
+#include "internaltypes.h"
 #include "parentedentity_p.h"
 
 namespace libcellml {
@@ -34,9 +35,9 @@ public:
     bool mOrderSet = false; /**< Whether the relative order of the reset has been set.*/
     VariablePtr mVariable; /**< The associated variable for the reset.*/
     VariablePtr mTestVariable; /**< The associated test_variable for the reset.*/
-    std::string mTestValue; /**< The MathML string for the test_value.*/
+    CopyOnWrite<std::string> mTestValue; /**< The MathML string for the test_value.*/
     std::string mTestValueId; /**< The identifier of the test_value block */
-    std::string mResetValue; /**< The MathML string for the reset_value.*/
+    CopyOnWrite<std::string> mResetValue; /**< The MathML string for the reset_value.*/
     std::string mResetValueId; /**< The identifier of the reset_value block */
 };
 
@@ -31,6 +31,7 @@ limitations under the License.
 #include <vector>
 
 #include "commonutils.h"
+#include "model_p.h"
 #include "units_p.h"
 #include "utilities.h"
 
@@ -93,7 +94,7 @@ static const std::map<Units::StandardUnit, const std::string> standardUnitToStri
 
 std::vector<UnitDefinition>::const_iterator Units::UnitsImpl::findUnit(const std::string &reference) const
 {
-    return std::find_if(mUnitDefinitions.begin(), mUnitDefinitions.end(),
+    return std::find_if(mUnitDefinitions.read().begin(), mUnitDefinitions.read().end(),
                         [=](const UnitDefinition &u) -> bool { return u.mReference == reference; });
 }
 
@@ -257,6 +258,9 @@ bool updateUnitMultiplier(const UnitsPtr &units, int direction, double &multipli
                 localMultiplier += mult + standardMult * exp + prefixMult;
             } else {
                 auto model = owningModel(units);
+                if (model == nullptr) {
+                    return false;
+                }
                 auto refUnits = model->units(ref);
                 if (refUnits == nullptr) {
                     return false;
@@ -301,7 +305,7 @@ bool Units::doEquals(const EntityPtr &other) const
     auto units = std::dynamic_pointer_cast<Units>(other);
 
     if ((units == nullptr)
-        || (pFunc()->mUnitDefinitions.size() != units->unitCount())
+        || (pFunc()->mUnitDefinitions.read().size() != units->unitCount())
         || !ImportedEntity::doEquals(units)) {
         return false;
     }
@@ -311,11 +315,11 @@ bool Units::doEquals(const EntityPtr &other) const
     double exponent;
     double multiplier;
     std::string id;
-    std::vector<size_t> unmatchedUnitIndex(pFunc()->mUnitDefinitions.size());
+    std::vector<size_t> unmatchedUnitIndex(pFunc()->mUnitDefinitions.read().size());
 
     std::iota(unmatchedUnitIndex.begin(), unmatchedUnitIndex.end(), 0);
 
-    for (const auto &unitDefinition : pFunc()->mUnitDefinitions) {
+    for (const auto &unitDefinition : pFunc()->mUnitDefinitions.read()) {
         bool unitFound = false;
         size_t index = 0;
 
@@ -367,7 +371,11 @@ void Units::addUnit(const std::string &reference, const std::string &prefix, dou
     ud.mMultiplier = multiplier;
     ud.mId = id;
 
-    pFunc()->mUnitDefinitions.push_back(ud);
+    pFunc()->mUnitDefinitions.write().push_back(ud);
+    pFunc()->invalidateResolvedUnits();
+    if (!id.empty()) {
+        invalidateIds(this);
+    }
 }
 
 void Units::addUnit(const std::string &reference, Prefix prefix, double exponent,
@@ -423,20 +431,20 @@ void Units::addUnit(StandardUnit standardUnit)
 void Units::unitAttributes(StandardUnit standardUnit, std::string &prefix, double &exponent, double &multiplier, std::string &id) const
 {
     std::string dummyReference;
-    unitAttributes(static_cast<size_t>(pFunc()->findUnit(standardUnitToString.at(standardUnit)) - pFunc()->mUnitDefinitions.begin()), dummyReference, prefix, exponent, multiplier, id);
+    unitAttributes(static_cast<size_t>(pFunc()->findUnit(standardUnitToString.at(standardUnit)) - pFunc()->mUnitDefinitions.read().begin()), dummyReference, prefix, exponent, multiplier, id);
 }
 
 void Units::unitAttributes(const std::string &reference, std::string &prefix, double &exponent, double &multiplier, std::string &id) const
 {
     std::string dummyReference;
-    unitAttributes(static_cast<size_t>(pFunc()->findUnit(reference) - pFunc()->mUnitDefinitions.begin()), dummyReference, prefix, exponent, multiplier, id);
+    unitAttributes(static_cast<size_t>(pFunc()->findUnit(reference) - pFunc()->mUnitDefinitions.read().begin()), dummyReference, prefix, exponent, multiplier, id);
 }
 
 void Units::unitAttributes(size_t index, std::string &reference, std::string &prefix, double &exponent, double &multiplier, std::string &id) const
 {
     UnitDefinition ud;
-    if (index < pFunc()->mUnitDefinitions.size()) {
-        ud = pFunc()->mUnitDefinitions.at(index);
+    if (index < pFunc()->mUnitDefinitions.read().size()) {
+        ud = pFunc()->mUnitDefinitions.read().at(index);
     }
     reference = ud.mReference;
     prefix = ud.mPrefix;
@@ -458,10 +466,9 @@ std::string Units::unitAttributeReference(size_t index) const
 
 void Units::setUnitAttributeReference(size_t index, const std::string &reference)
 {
-    if (index < pFunc()->mUnitDefinitions.size()) {
-        UnitDefinition unitDefinition = pFunc()->mUnitDefinitions.at(index);
-        unitDefinition.mReference = reference;
-        pFunc()->mUnitDefinitions[index] = unitDefinition;
+    if (index < pFunc()->mUnitDefinitions.read().size()) {
+        pFunc()->mUnitDefinitions.write()[index].mReference = reference;
+        pFunc()->invalidateResolvedUnits();
     }
 }
 
@@ -500,8 +507,11 @@ double Units::unitAttributeMultiplier(size_t index) const
 
 bool Units::setUnitId(size_t index, const std::string &id)
 {
-    if (index < pFunc()->mUnitDefinitions.size()) {
-        pFunc()->mUnitDefinitions[index].mId = id;
+    if (index < pFunc()->mUnitDefinitions.read().size()) {
+        if (pFunc()->mUnitDefinitions.read()[index].mId != id) {
+            pFunc()->mUnitDefinitions.write()[index].mId = id;
+            invalidateIds(this);
+        }
         return true;
     }
     return false;
@@ -509,8 +519,8 @@ bool Units::setUnitId(size_t index, const std::string &id)
 
 std::string Units::unitId(size_t index) const
 {
-    if (index < pFunc()->mUnitDefinitions.size()) {
-        return pFunc()->mUnitDefinitions.at(index).mId;
+    if (index < pFunc()->mUnitDefinitions.read().size()) {
+        return pFunc()->mUnitDefinitions.read().at(index).mId;
     }
     return "";
 }
@@ -519,8 +529,12 @@ bool Units::removeUnit(const std::string &reference)
 {
     bool status = false;
     auto result = pFunc()->findUnit(reference);
-    if (result != pFunc()->mUnitDefinitions.end()) {
-        pFunc()->mUnitDefinitions.erase(result);
+    if (result != pFunc()->mUnitDefinitions.read().end()) {
+        auto index = result - pFunc()->mUnitDefinitions.read().begin();
+        auto &unitDefinitions = pFunc()->mUnitDefinitions.write();
+        unitDefinitions.erase(unitDefinitions.begin() + index);
+        pFunc()->invalidateResolvedUnits();
+        invalidateIds(this);
         status = true;
     }
 
@@ -530,8 +544,11 @@ bool Units::removeUnit(const std::string &reference)
 bool Units::removeUnit(size_t index)
 {
     bool status = false;
-    if (index < pFunc()->mUnitDefinitions.size()) {
-        pFunc()->mUnitDefinitions.erase(pFunc()->mUnitDefinitions.begin() + ptrdiff_t(index));
+    if (index < pFunc()->mUnitDefinitions.read().size()) {
+        auto &unitDefinitions = pFunc()->mUnitDefinitions.write();
+        unitDefinitions.erase(unitDefinitions.begin() + ptrdiff_t(index));
+        pFunc()->invalidateResolvedUnits();
+        invalidateIds(this);
         status = true;
     }
 
@@ -546,7 +563,9 @@ bool Units::removeUnit(StandardUnit standardUnit)
 
 void Units::removeAllUnits()
 {
-    pFunc()->mUnitDefinitions.clear();
+    pFunc()->mUnitDefinitions.reset();
+    pFunc()->invalidateResolvedUnits();
+    invalidateIds(this);
 }
 
 void Units::setSourceUnits(ImportSourcePtr &importSource, const std::string &name)
@@ -557,7 +576,7 @@ void Units::setSourceUnits(ImportSourcePtr &importSource, const std::string &nam
 
 size_t Units::unitCount() const
 {
-    return pFunc()->mUnitDefinitions.size();
+    return pFunc()->mUnitDefinitions.read().size();
 }
 
 double Units::scalingFactor(const UnitsPtr &units1, const UnitsPtr &units2, bool checkCompatibility)
@@ -566,24 +585,18 @@ double Units::scalingFactor(const UnitsPtr &units1, const UnitsPtr &units2, bool
         return 0.0;
     }
 
-    bool updateUnits1 = false;
-    bool updateUnits2 = false;
-
     if ((units1 != nullptr) && (units2 != nullptr)) {
-        double multiplier = 0.0;
-        updateUnits1 = updateUnitMultiplier(units1, -1, multiplier);
-        updateUnits2 = updateUnitMultiplier(units2, 1, multiplier);
+        auto resolvedUnits1 = units1->pFunc()->resolvedUnits();
+        auto resolvedUnits2 = units2->pFunc()->resolvedUnits();
 
-        if (updateUnits1 && updateUnits2) {
-            return std::pow(10, multiplier);
+        if (resolvedUnits1->mValidMultiplier && resolvedUnits2->mValidMultiplier) {
+            return std::pow(10, resolvedUnits2->mMultiplier - resolvedUnits1->mMultiplier);
         }
     }
 
     return 0.0;
 }
 
-using UnitsMap = std::map<std::string, double>;
-
 void updateUnitsMapWithStandardUnit(const std::string &name, UnitsMap &unitsMap, double exp)
 {
     for (const auto &baseUnitsComponent : standardUnitsList.at(name)) {
@@ -650,6 +663,122 @@ UnitsMap defineUnitsMap(const UnitsPtr &units)
     return unitsMap;
 }
 
+void Units::UnitsImpl::recordRevisions(ResolvedUnits &resolvedUnits, std::set<const Units *> &visitedUnits) const
+{
+    if (!visitedUnits.insert(mUnits).second) {
+        return;
+    }
+
+    resolvedUnits.mUnitsRevisions.emplace_back(mUnits->shared_from_this(), mRevision);
+
+    // Our units resolve through the units of our imported model or, if we are
+    // not imported, through the units of our owning model.
+
+    ModelPtr model;
+    std::vector<std::string> references;
+
+    if (mUnits->isImport()) {
+        auto importSource = mUnits->importSource();
+
+        model = importSource->model();
+
+        resolvedUnits.mImportSourceModels.emplace_back(importSource, model.get());
+        references.push_back(mUnits->importReference());
+    } else {
+        model = owningModel(mUnits->shared_from_this());
+
+        for (const auto &unitDefinition : mUnitDefinitions.read()) {
+            if (!isStandardUnitName(unitDefinition.mReference)) {
+                references.push_back(unitDefinition.mReference);
+            }
+        }
+    }
+
+    if (model == nullptr) {
+        return;
+    }
+
+    const auto &unitsNames = model->pFunc()->mUnitsNames;
+
+    resolvedUnits.mUnitsNamesRevisions.emplace_back(unitsNames, unitsNames->revision());
+
+    for (const auto &reference : references) {
+        auto units = model->units(reference);
+
+        if (units != nullptr) {
+            units->pFunc()->recordRevisions(resolvedUnits, visitedUnits);
+        }
+    }
+}
+
+bool Units::UnitsImpl::isUpToDate(const ResolvedUnits &resolvedUnits)
+{
+    for (const auto &unitsRevision : resolvedUnits.mUnitsRevisions) {
+        auto units = unitsRevision.first.lock();
+
+        if ((units == nullptr) || (units->pFunc()->mRevision != unitsRevision.second)) {
+            return false;
+        }
+    }
+
+    for (const auto &unitsNamesRevision : resolvedUnits.mUnitsNamesRevisions) {
+        auto unitsNames = unitsNamesRevision.first.lock();
+
+        if ((unitsNames == nullptr) || (unitsNames->revision() != unitsNamesRevision.second)) {
+            return false;
+        }
+    }
+
+    for (const auto &importSourceModel : resolvedUnits.mImportSourceModels) {
+        auto importSource = importSourceModel.first.lock();
+
+        if ((importSource == nullptr) || (importSource->model().get() != importSourceModel.second)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void Units::UnitsImpl::invalidateResolvedUnits()
+{
+    ++mRevision;
+}
+
+std::shared_ptr<const ResolvedUnits> Units::UnitsImpl::resolvedUnits() const
+{
+    std::shared_ptr<const ResolvedUnits> res;
+
+    {
+        std::lock_guard<std::mutex> lock(mResolvedUnitsMutex);
+
+        res = mResolvedUnits;
+    }
+
+    if ((res != nullptr) && isUpToDate(*res)) {
+        return res;
+    }
+
+    // Resolve our units without holding our mutex, so that concurrent calls
+    // are not serialised, and only then cache the result.
+
+    auto units = mUnits->shared_from_this();
+    auto resolvedUnits = std::make_shared<ResolvedUnits>();
+    std::set<const Units *> visitedUnits;
+
+    recordRevisions(*resolvedUnits, visitedUnits);
+
+    resolvedUnits->mDefined = units->isDefined();
+    resolvedUnits->mUnitsMap = resolvedUnits->mDefined ? defineUnitsMap(units) : UnitsMap();
+    resolvedUnits->mValidMultiplier = updateUnitMultiplier(units, 1, resolvedUnits->mMultiplier);
+
+    std::lock_guard<std::mutex> lock(mResolvedUnitsMutex);
+
+    mResolvedUnits = resolvedUnits;
+
+    return resolvedUnits;
+}
+
 bool Units::requiresImports() const
 {
     // Function to check child unit dependencies for imports.
@@ -679,12 +808,16 @@ bool Units::compatible(const UnitsPtr &units1, const UnitsPtr &units2)
     if ((units1 == nullptr) || (units2 == nullptr)) {
         return false;
     }
-    if ((!units1->isDefined()) || (!units2->isDefined())) {
+
+    auto resolvedUnits1 = units1->pFunc()->resolvedUnits();
+    auto resolvedUnits2 = units2->pFunc()->resolvedUnits();
+
+    if ((!resolvedUnits1->mDefined) || (!resolvedUnits2->mDefined)) {
         return false;
     }
 
-    UnitsMap units1Map = defineUnitsMap(units1);
-    UnitsMap units2Map = defineUnitsMap(units2);
+    const UnitsMap &units1Map = resolvedUnits1->mUnitsMap;
+    const UnitsMap &units2Map = resolvedUnits2->mUnitsMap;
 
     if (units1Map.size() == units2Map.size()) {
         for (const auto &units : units1Map) {
@@ -694,7 +827,7 @@ bool Units::compatible(const UnitsPtr &units1, const UnitsPtr &units2)
             if (found == units2Map.end()) {
                 return false;
             }
-            if (!areEqual(found->second, units.second)) {
+            if ((found->second != units.second) && !areEqual(found->second, units.second)) {
                 return false;
             }
         }
@@ -724,15 +857,7 @@ UnitsPtr Units::clone() const
 
     units->setImportReference(importReference());
 
-    std::string reference;
-    std::string prefix;
-    std::string id;
-    double exponent;
-    double multiplier;
-    for (size_t index = 0; index < pFunc()->mUnitDefinitions.size(); ++index) {
-        unitAttributes(index, reference, prefix, exponent, multiplier, id);
-        units->addUnit(reference, prefix, exponent, multiplier, id);
-    }
+    units->pFunc()->mUnitDefinitions.share(pFunc()->mUnitDefinitions);
 
     return units;
 }
@@ -16,6 +16,14 @@ limitations under the License.
 
 #pragma once
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "libcellml/units.h"
 
 #include "internaltypes.h"
@@ -39,6 +47,29 @@ struct UnitDefinition
     std::string mId; /**< Identifier for the unit.*/
 };
 
+using UnitsMap = std::map<std::string, double>; /**< Type definition for a map of base units to their exponent. */
+
+/**
+ * @brief The ResolvedUnits struct.
+ *
+ * An internal structure to capture what a units resolves to in terms of
+ * base units.  It is computed when first needed and kept for as long as
+ * nothing it was resolved through changes, i.e. the units it was resolved
+ * through, the units of the models in which those units were looked up, and
+ * the model of the import sources it was resolved through.  Once computed, it
+ * is never modified, so that it can be shared between threads.
+ */
+struct ResolvedUnits
+{
+    std::vector<std::pair<UnitsWeakPtr, size_t>> mUnitsRevisions; /**< Revision of each units this was resolved through, starting with the units itself.*/
+    std::vector<std::pair<NameIndexWeakPtr, size_t>> mUnitsNamesRevisions; /**< Revision of the units name index of each model in which a units was looked up.*/
+    std::vector<std::pair<ImportSourceWeakPtr, const Model *>> mImportSourceModels; /**< Model of each import source this was resolved through.*/
+    bool mDefined = false; /**< Whether the units is defined.*/
+    UnitsMap mUnitsMap; /**< Exponent of each base unit, only set if the units is defined.*/
+    bool mValidMultiplier = false; /**< Whether the multiplier of the units could be determined.*/
+    double mMultiplier = 0.0; /**< Log10 of the multiplier of the units with respect to its base units.*/
+};
+
 /**
  * @brief The Units::UnitsImpl class.
  *
@@ -47,7 +78,7 @@ struct UnitDefinition
 class Units::UnitsImpl: public NamedEntityImpl
 {
 public:
-    std::vector<UnitDefinition> mUnitDefinitions; /**< A vector of unit defined for this Units.*/
+    CopyOnWrite<std::vector<UnitDefinition>> mUnitDefinitions; /**< A vector of unit defined for this Units, shared with clones until written.*/
 
     std::vector<UnitDefinition>::const_iterator findUnit(const std::string &reference) const;
 
@@ -69,7 +100,53 @@ public:
 
     bool performTestWithHistory(History &history, const UnitsConstPtr &units, TestType type) const;
 
+    /**
+     * @brief Get what this units resolves to.
+     *
+     * Get what this units resolves to in terms of base units, resolving it
+     * only if a units definition has changed since it was last resolved.
+     * This is safe to call concurrently on the same units, as is the case
+     * when a model is used read-only by several threads.
+     *
+     * @return The resolved units.
+     */
+    std::shared_ptr<const ResolvedUnits> resolvedUnits() const;
+
+    /**
+     * @brief Record what this units resolves through.
+     *
+     * Record, in @p resolvedUnits, the current revision of this units and of
+     * everything it resolves through, following the same units references
+     * and imports as the resolution itself.
+     *
+     * @param resolvedUnits The resolved units to record the revisions in.
+     * @param visitedUnits The units already recorded, to stop on cycles.
+     */
+    void recordRevisions(ResolvedUnits &resolvedUnits, std::set<const Units *> &visitedUnits) const;
+
+    /**
+     * @brief Test if the @p resolvedUnits are up to date.
+     *
+     * @param resolvedUnits The resolved units to test.
+     *
+     * @return @c true if nothing the @p resolvedUnits were resolved through
+     * has changed since, @c false otherwise.
+     */
+    static bool isUpToDate(const ResolvedUnits &resolvedUnits);
+
+    /**
+     * @brief Invalidate what this units resolves to.
+     *
+     * To be called whenever the unit definitions, name, import or owning
+     * model of this units change, so that this units and any units resolving
+     * through it get resolved again.
+     */
+    void invalidateResolvedUnits();
+
     Units *mUnits = nullptr;
+    size_t mRevision = 0; /**< Revision of this units, see invalidateResolvedUnits().*/
+    mutable std::mutex mResolvedUnitsMutex; /**< Mutex guarding mResolvedUnits.*/
+    mutable std::shared_ptr<const ResolvedUnits> mResolvedUnits; /**< What this units resolves to, see resolvedUnits().*/
 };
 
 } // namespace libcellml
@@ -20,12 +20,16 @@ limitations under the License.
 #include <cmath>
 #include <cstring>
 #include <iomanip>
+#include <iterator>
 #include <limits>
 #include <numeric>
 #include <set>
 #include <sstream>
 #include <vector>
 
+#include "libcellml/analyserequation.h"
+#include "libcellml/analysermodel.h"
+#include "libcellml/analyservariable.h"
 #include "libcellml/component.h"
 #include "libcellml/importsource.h"
 #include "libcellml/model.h"
@@ -169,6 +173,22 @@ std::string convertToString(size_t value)
     return strs.str();
 }
 
+std::string convertToHexString(size_t value)
+{
+    static const char digits[] = "0123456789abcdef";
+
+    std::string res;
+
+    do {
+        res.push_back(digits[value & 0xf]);
+        value >>= 4;
+    } while (value != 0);
+
+    std::reverse(res.begin(), res.end());
+
+    return res;
+}
+
 std::string convertToString(int value)
 {
     std::ostringstream strs;
@@ -522,12 +542,7 @@ NameList findComponentCnUnitsNames(const ComponentConstPtr &component);
 
 void findAndReplaceCnUnitsNames(const XmlNodePtr &node, const std::string &oldName, const std::string &newName);
 void findAndReplaceComponentCnUnitsNames(const ComponentPtr &component, const std::string &oldName, const std::string &newName);
-size_t getComponentIndexInComponentEntity(const ComponentEntityPtr &componentParent, const ComponentEntityPtr &component);
-IndexStack indexStackOf(const VariablePtr &variable);
-VariablePtr getVariableLocatedAt(const IndexStack &stack, const ModelPtr &model);
-void makeEquivalence(const IndexStack &stack1, const IndexStack &stack2, const ModelPtr &model);
-IndexStack rebaseIndexStack(const IndexStack &stack, const IndexStack &originStack, const IndexStack &destinationStack);
-void componentNames(const ComponentPtr &component, NameList &names);
+void componentNames(const ComponentPtr &component, UniqueNames &names);
 
 UniqueNames findCnUnitsNames(const XmlNodePtr &node)
 {
@@ -619,90 +634,21 @@ void findAndReplaceComponentsCnUnitsNames(const ComponentPtr &component, const s
     }
 }
 
-size_t getComponentIndexInComponentEntity(const ComponentEntityPtr &componentParent, const ComponentEntityPtr &component)
-{
-    size_t index = 0;
-    bool found = false;
-    while (!found) {
-        if (componentParent->component(index) == component) {
-            found = true;
-        } else {
-            ++index;
-        }
-    }
-
-    return index;
-}
-
-IndexStack indexStackOf(const ComponentPtr &component)
-{
-    auto dummyVariable = Variable::create();
-    component->addVariable(dummyVariable);
-    IndexStack indexStack = indexStackOf(dummyVariable);
-    indexStack.pop_back();
-    component->removeVariable(dummyVariable);
-
-    return indexStack;
-}
-
-IndexStack rebaseIndexStack(const IndexStack &stack, const IndexStack &originStack, const IndexStack &destinationStack)
-{
-    auto rebasedStack = stack;
-
-    rebasedStack.resize(originStack.size(), SIZE_MAX);
-    if (rebasedStack == originStack) {
-        rebasedStack = destinationStack;
-        auto offsetIt = stack.begin() + ptrdiff_t(originStack.size());
-        rebasedStack.insert(rebasedStack.end(), offsetIt, stack.end());
-    } else {
-        rebasedStack.clear();
-    }
-
-    return rebasedStack;
-}
-
-EquivalenceMap rebaseEquivalenceMap(const EquivalenceMap &map, const IndexStack &originStack, const IndexStack &destinationStack)
-{
-    EquivalenceMap rebasedMap;
-    for (const auto &entry : map) {
-        auto key = entry.first;
-        auto rebasedKey = rebaseIndexStack(key, originStack, destinationStack);
-        auto vector = entry.second;
-        std::vector<IndexStack> rebasedVector;
-        for (auto stack : vector) {
-            // Temporarily remove the variable index whilst we rebase the component part of the stack.
-            size_t variableIndex = stack.back();
-            stack.pop_back();
-            auto rebasedTarget = rebaseIndexStack(stack, originStack, destinationStack);
-            if (!rebasedTarget.empty()) {
-                rebasedTarget.push_back(variableIndex);
-                rebasedVector.push_back(rebasedTarget);
-            }
-        }
-
-        if (!rebasedVector.empty()) {
-            rebasedMap.emplace(rebasedKey, rebasedVector);
-        }
-    }
-
-    return rebasedMap;
-}
-
-void componentNames(const ComponentPtr &component, NameList &names)
+void componentNames(const ComponentPtr &component, UniqueNames &names)
 {
     for (size_t index = 0; index < component->componentCount(); ++index) {
         auto c = component->component(index);
-        names.push_back(c->name());
+        names.insert(c->name());
         componentNames(c, names);
     }
 }
 
-NameList componentNames(const ModelPtr &model)
+UniqueNames componentNames(const ModelPtr &model)
 {
-    NameList names;
+    UniqueNames names;
     for (size_t index = 0; index < model->componentCount(); ++index) {
         auto component = model->component(index);
-        names.push_back(component->name());
+        names.insert(component->name());
         componentNames(component, names);
     }
     return names;
@@ -796,86 +742,30 @@ NameList unitsNamesUsed(const ComponentPtr &component)
     return unitNames;
 }
 
-IndexStack indexStackOf(const VariablePtr &variable)
+void recordClonedVariables(const ComponentPtr &original, const ComponentPtr &clone, VariableCloneMap &map)
 {
-    IndexStack indexStack;
-    ComponentPtr component = std::dynamic_pointer_cast<Component>(variable->parent());
-    indexStack.push_back(indexOf(variable, component));
-
-    ComponentEntityPtr parent = component;
-    ComponentEntityPtr grandParent = std::dynamic_pointer_cast<ComponentEntity>(parent->parent());
-    while (grandParent != nullptr) {
-        indexStack.push_back(getComponentIndexInComponentEntity(grandParent, parent));
-        parent = grandParent;
-        grandParent = std::dynamic_pointer_cast<ComponentEntity>(parent->parent());
+    for (size_t index = 0; index < original->variableCount(); ++index) {
+        map.emplace(original->variable(index), clone->variable(index));
+    }
+    for (size_t index = 0; index < original->componentCount(); ++index) {
+        recordClonedVariables(original->component(index), clone->component(index), map);
     }
-
-    std::reverse(std::begin(indexStack), std::end(indexStack));
-
-    return indexStack;
 }
 
-void recordVariableEquivalences(const ComponentPtr &component, EquivalenceMap &equivalenceMap, IndexStack &indexStack)
+void transferEquivalences(const ComponentPtr &original, const ComponentPtr &clone, const VariableCloneMap &map)
 {
-    for (size_t index = 0; index < component->variableCount(); ++index) {
-        auto variable = component->variable(index);
+    for (size_t index = 0; index < original->variableCount(); ++index) {
+        auto variable = original->variable(index);
+        auto clonedVariable = clone->variable(index);
         for (size_t j = 0; j < variable->equivalentVariableCount(); ++j) {
-            if (j == 0) {
-                indexStack.push_back(index);
-            }
-            auto equivalentVariable = variable->equivalentVariable(j);
-            auto equivalentVariableIndexStack = indexStackOf(equivalentVariable);
-            if (equivalenceMap.count(indexStack) == 0) {
-                equivalenceMap.emplace(indexStack, std::vector<IndexStack>());
+            auto found = map.find(variable->equivalentVariable(j));
+            if (found != map.end()) {
+                Variable::addEquivalence(clonedVariable, found->second);
             }
-            equivalenceMap[indexStack].push_back(equivalentVariableIndexStack);
-        }
-        if (variable->equivalentVariableCount() > 0) {
-            indexStack.pop_back();
         }
     }
-}
-
-void generateEquivalenceMap(const ComponentPtr &component, EquivalenceMap &map, IndexStack &indexStack)
-{
-    for (size_t index = 0; index < component->componentCount(); ++index) {
-        indexStack.push_back(index);
-        auto c = component->component(index);
-        recordVariableEquivalences(c, map, indexStack);
-        generateEquivalenceMap(c, map, indexStack);
-        indexStack.pop_back();
-    }
-}
-
-VariablePtr getVariableLocatedAt(const IndexStack &stack, const ModelPtr &model)
-{
-    ComponentPtr component;
-    for (size_t index = 0; index < stack.size() - 1; ++index) {
-        if (index == 0) {
-            component = model->component(stack.at(index));
-        } else {
-            component = component->component(stack.at(index));
-        }
-    }
-
-    return component->variable(stack.back());
-}
-
-void makeEquivalence(const IndexStack &stack1, const IndexStack &stack2, const ModelPtr &model)
-{
-    auto v1 = getVariableLocatedAt(stack1, model);
-    auto v2 = getVariableLocatedAt(stack2, model);
-    Variable::addEquivalence(v1, v2);
-}
-
-void applyEquivalenceMapToModel(const EquivalenceMap &map, const ModelPtr &model)
-{
-    for (const auto &iter : map) {
-        auto key = iter.first;
-        auto vector = iter.second;
-        for (auto vectorIter = vector.begin(); vectorIter < vector.end(); ++vectorIter) {
-            makeEquivalence(key, *vectorIter, model);
-        }
+    for (size_t index = 0; index < original->componentCount(); ++index) {
+        transferEquivalences(original->component(index), clone->component(index), map);
     }
 }
 
@@ -883,39 +773,39 @@ void listComponentIds(const ComponentPtr &component, IdList &idList)
 {
     std::string id = component->id();
     if (!id.empty()) {
-        idList.insert(id);
+        idList.mIds.insert(id);
     }
     // Imports.
     auto importSource = component->importSource();
     if (importSource != nullptr) {
         id = importSource->id();
         if (!id.empty()) {
-            idList.insert(id);
+            idList.mIds.insert(id);
         }
     }
     // Component reference in encapsulation structure.
     id = component->encapsulationId();
     if (!id.empty()) {
-        idList.insert(id);
+        idList.mIds.insert(id);
     }
     // Variables.
     for (size_t v = 0; v < component->variableCount(); ++v) {
         auto variable = component->variable(v);
         id = variable->id();
         if (!id.empty()) {
-            idList.insert(id);
+            idList.mIds.insert(id);
         }
 
         for (size_t e = 0; e < variable->equivalentVariableCount(); ++e) {
             // Equivalent variable mappings.
             id = Variable::equivalenceMappingId(variable, variable->equivalentVariable(e));
             if (!id.empty()) {
-                idList.insert(id);
+                idList.mIds.insert(id);
             }
             // Connections.
             id = Variable::equivalenceConnectionId(variable, variable->equivalentVariable(e));
             if (!id.empty()) {
-                idList.insert(id);
+                idList.mIds.insert(id);
             }
         }
     }
@@ -924,15 +814,15 @@ void listComponentIds(const ComponentPtr &component, IdList &idList)
         auto reset = component->reset(r);
         id = reset->id();
         if (!id.empty()) {
-            idList.insert(id);
+            idList.mIds.insert(id);
         }
         id = reset->testValueId();
         if (!id.empty()) {
-            idList.insert(id);
+            idList.mIds.insert(id);
         }
         id = reset->resetValueId();
         if (!id.empty()) {
-            idList.insert(id);
+            idList.mIds.insert(id);
         }
     }
 
@@ -948,25 +838,25 @@ IdList listIds(const ModelPtr &model)
     // Collect all existing identifiers in a list and return. NB can't use a map or a set as we need to be able to print
     // invalid models (with duplicated identifiers) too.
 
-    std::unordered_set<std::string> idList;
+    IdList idList;
     // Model.
     std::string id = model->id();
     if (!id.empty()) {
-        idList.insert(id);
+        idList.mIds.insert(id);
     }
     // Units.
     for (size_t u = 0; u < model->unitsCount(); ++u) {
         auto units = model->units(u);
         id = units->id();
         if (!id.empty()) {
-            idList.insert(id);
+            idList.mIds.insert(id);
         }
         // Imports.
         auto importSource = units->importSource();
         if (importSource != nullptr) {
             id = importSource->id();
             if (!id.empty()) {
-                idList.insert(id);
+                idList.mIds.insert(id);
             }
         }
         for (size_t i = 0; i < units->unitCount(); ++i) {
@@ -976,7 +866,7 @@ IdList listIds(const ModelPtr &model)
             double multiplier;
             units->unitAttributes(i, reference, prefix, exponent, multiplier, id);
             if (!id.empty()) {
-                idList.insert(id);
+                idList.mIds.insert(id);
             }
         }
     }
@@ -987,7 +877,7 @@ IdList listIds(const ModelPtr &model)
     // Encapsulation.
     id = model->encapsulationId();
     if (!id.empty()) {
-        idList.insert(id);
+        idList.mIds.insert(id);
     }
 
     return idList;
@@ -996,20 +886,15 @@ IdList listIds(const ModelPtr &model)
 std::string makeUniqueId(IdList &idList)
 {
     // Because the hexadecimal counter starts high enough that it will always have a letter as the first character,
-    // we don't need to prefix it with any other string to be valid.
-    int counter = 0xb4da55;
-    std::stringstream stream;
-    stream << std::hex << counter;
-    std::string id = stream.str();
-    stream.str(std::string());
-
-    while (idList.count(id) != 0) {
-        ++counter;
-        stream << std::hex << counter;
-        id = stream.str();
-        stream.str(std::string());
-    }
-    idList.insert(id);
+    // we don't need to prefix it with any other string to be valid.  The counter is kept in the list so that we
+    // carry on from where we left off the next time.
+    std::string id = convertToHexString(idList.mCounter);
+
+    while (idList.mIds.count(id) != 0) {
+        id = convertToHexString(++idList.mCounter);
+    }
+    ++idList.mCounter;
+    idList.mIds.insert(id);
     return id;
 }
 
@@ -1127,6 +1012,15 @@ std::string replace(std::string string, const std::string &from, const std::stri
                string.replace(index, from.length(), to);
 }
 
+std::string replaceAll(std::string string, const std::string &from, const std::string &to)
+{
+    for (auto index = string.find(from); index != std::string::npos; index = string.find(from, index + to.length())) {
+        string.replace(index, from.length(), to);
+    }
+
+    return string;
+}
+
 bool equalEntities(const EntityPtr &owner, const std::vector<EntityPtr> &entities)
 {
     std::vector<size_t> unmatchedIndex(entities.size());
@@ -1315,4 +1209,166 @@ XmlNodePtr mathmlChildNode(const XmlNodePtr &node, size_t index)
     return res;
 }
 
+static bool isToBeComputedAgain(const AnalyserEquationPtr &equation)
+{
+    // NLA and algebraic equations that are state/rate-based and external
+    // equations are to be computed again (in the computeVariables() method).
+
+    switch (equation->type()) {
+    case AnalyserEquation::Type::NLA:
+    case AnalyserEquation::Type::ALGEBRAIC:
+        return equation->isStateRateBased();
+    case AnalyserEquation::Type::EXTERNAL:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool isSomeConstant(const AnalyserEquationPtr &equation,
+                           bool includeComputedConstants)
+{
+    auto type = equation->type();
+
+    return (type == AnalyserEquation::Type::TRUE_CONSTANT)
+           || (!includeComputedConstants && (type == AnalyserEquation::Type::VARIABLE_BASED_CONSTANT));
+}
+
+void scheduleEquation(const AnalyserEquationPtr &equation,
+                      AnalyserEquationSet &remainingEquations,
+                      const AnalyserEquationSet &equationsForDependencies,
+                      bool includeComputedConstants,
+                      std::vector<AnalyserEquationPtr> &equations)
+{
+    if (remainingEquations.erase(equation) != 0) {
+        // Stop tracking the NLA siblings of the equation, if any.
+        // Note: we need to do this (and to stop tracking the equation itself)
+        //       as soon as possible to avoid recursive calls, something that
+        //       would happen if we were to do this at the end of this if
+        //       statement.
+
+        for (size_t i = 0; i < equation->nlaSiblingCount(); ++i) {
+            remainingEquations.erase(equation->nlaSibling(i));
+        }
+
+        // Schedule any dependency that this equation may have.
+
+        if (!isSomeConstant(equation, includeComputedConstants)) {
+            for (size_t i = 0; i < equation->dependencyCount(); ++i) {
+                auto dependency = equation->dependency(i);
+
+                if ((dependency->type() != AnalyserEquation::Type::ODE)
+                    && !isSomeConstant(dependency, includeComputedConstants)
+                    && (equationsForDependencies.empty()
+                        || isToBeComputedAgain(dependency)
+                        || (equationsForDependencies.count(dependency) != 0))) {
+                    scheduleEquation(dependency, remainingEquations, equationsForDependencies, includeComputedConstants, equations);
+                }
+            }
+        }
+
+        // Schedule the equation itself.
+
+        equations.push_back(equation);
+    }
+}
+
+std::vector<AnalyserEquationPtr> equationsToInitialiseVariables(const AnalyserModelPtr &model,
+                                                                AnalyserEquationSet &remainingEquations)
+{
+    std::vector<AnalyserEquationPtr> res;
+    AnalyserEquationSet dummyEquationsForDependencies;
+
+    for (const auto &equation : model->equations()) {
+        if (equation->type() == AnalyserEquation::Type::TRUE_CONSTANT) {
+            scheduleEquation(equation, remainingEquations, dummyEquationsForDependencies, true, res);
+        }
+    }
+
+    return res;
+}
+
+std::vector<AnalyserEquationPtr> equationsToInitialiseExternalVariables(const AnalyserModelPtr &model)
+{
+    std::vector<AnalyserEquationPtr> res;
+
+    if (model->hasExternalVariables()) {
+        const auto &equations = model->equations();
+        AnalyserEquationSet remainingExternalEquations;
+        AnalyserEquationSet dummyEquationsForDependencies;
+
+        std::copy_if(equations.begin(), equations.end(),
+                     std::inserter(remainingExternalEquations, remainingExternalEquations.end()),
+                     [](const AnalyserEquationPtr &equation) { return equation->type() == AnalyserEquation::Type::EXTERNAL; });
+
+        for (const auto &equation : equations) {
+            if (equation->type() == AnalyserEquation::Type::EXTERNAL) {
+                scheduleEquation(equation, remainingExternalEquations, dummyEquationsForDependencies, true, res);
+            }
+        }
+    }
+
+    return res;
+}
+
+std::vector<AnalyserEquationPtr> equationsToComputeComputedConstants(const AnalyserModelPtr &model,
+                                                                     AnalyserEquationSet &remainingEquations)
+{
+    std::vector<AnalyserEquationPtr> res;
+    AnalyserEquationSet dummyEquationsForDependencies;
+
+    for (const auto &equation : model->equations()) {
+        if (equation->type() == AnalyserEquation::Type::VARIABLE_BASED_CONSTANT) {
+            scheduleEquation(equation, remainingEquations, dummyEquationsForDependencies, true, res);
+        }
+    }
+
+    return res;
+}
+
+std::vector<AnalyserEquationPtr> equationsToComputeRates(const AnalyserModelPtr &model,
+                                                         AnalyserEquationSet &remainingEquations)
+{
+    std::vector<AnalyserEquationPtr> res;
+
+    if ((model->type() != AnalyserModel::Type::ODE)
+        && (model->type() != AnalyserModel::Type::DAE)) {
+        return res;
+    }
+
+    AnalyserEquationSet dummyEquationsForDependencies;
+
+    for (const auto &equation : model->equations()) {
+        // A rate is computed either through an ODE equation or through an NLA
+        // equation in case the rate is not on its own on either the LHS or RHS
+        // of the equation.
+
+        if ((equation->type() == AnalyserEquation::Type::ODE)
+            || ((equation->type() == AnalyserEquation::Type::NLA)
+                && (equation->variableCount() == 1)
+                && (equation->variable(0)->type() == AnalyserVariable::Type::STATE))) {
+            scheduleEquation(equation, remainingEquations, dummyEquationsForDependencies, true, res);
+        }
+    }
+
+    return res;
+}
+
+std::vector<AnalyserEquationPtr> equationsToComputeVariables(const AnalyserModelPtr &model,
+                                                             const AnalyserEquationSet &remainingEquations)
+{
+    std::vector<AnalyserEquationPtr> res;
+    const auto &equations = model->equations();
+    AnalyserEquationSet newRemainingEquations {std::begin(equations), std::end(equations)};
+
+    for (const auto &equation : equations) {
+        if ((remainingEquations.count(equation) != 0)
+            || isToBeComputedAgain(equation)) {
+            scheduleEquation(equation, newRemainingEquations, remainingEquations, false, res);
+        }
+    }
+
+    return res;
+}
+
 } // namespace libcellml
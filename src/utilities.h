@@ -241,6 +241,18 @@ std::string convertToString(int value);
  */
 std::string convertToString(size_t value);
 
+/**
+ * @brief Convert a @c size_t to a hexadecimal @c std::string format.
+ *
+ * Convert the @p value to a lowercase hexadecimal @c std::string
+ * representation, without any prefix.
+ *
+ * @param value The @c size_t value of the integer to convert.
+ *
+ * @return Hexadecimal @c std::string representation of the @p value.
+ */
+std::string convertToHexString(size_t value);
+
 /**
  * @brief Convert a @c double to @c std::string format.
  *
@@ -607,6 +619,20 @@ static inline std::string trimCopy(std::string s)
  */
 std::string replace(std::string string, const std::string &from, const std::string &to);
 
+/**
+ * @brief Replace all the occurrences of some text in string.
+ *
+ * Replace all the occurrences of the @c std::string @p from in @p string with
+ * @c std::string @p to.  Occurrences of @p from in @p to are not replaced.
+ *
+ * @param string The string to make the substitutions in.
+ * @param from The string to replace.
+ * @param to The replacement string.
+ *
+ * @return The modified string.
+ */
+std::string replaceAll(std::string string, const std::string &from, const std::string &to);
+
 /**
  * @brief Collect all existing identifier attributes within the given model.
  *
@@ -619,7 +645,10 @@ IdList listIds(const ModelPtr &model);
 /**
  * @brief Creates an identifier string for a "type" object, unique in the context of @p idList.
  *
- * The identifier format is a 6-digit hexadecimal string.
+ * The identifier format is a 6-digit hexadecimal string.  The new identifier
+ * is added to @p idList and its counter is moved past it.
+ *
+ * @param idList The @c IdList to make the identifier unique in.
  *
  * @return A string representing a unique identifier.
  */
@@ -726,17 +755,6 @@ bool equalEntities(const EntityPtr &owner, const std::vector<EntityPtr> &entitie
  */
 std::vector<ImportSourcePtr> getAllImportSources(const ModelConstPtr &model);
 
-/**
- * @brief Return the @ref IndexStack for the given @p component.
- *
- * Return the @ref IndexStack for the given @p component.
- *
- * @param component The component to find the index stack for.
- *
- * @return An @ref IndexStack.
- */
-IndexStack indexStackOf(const ComponentPtr &component);
-
 /**
  * @brief Create a history epoch for a @ref Units with optional destination URL.
  *
@@ -800,12 +818,36 @@ bool checkForImportCycles(const History &history, const HistoryEpochPtr &h);
  */
 std::string formDescriptionOfCyclicDependency(const History &history, const std::string &action);
 
-void recordVariableEquivalences(const ComponentPtr &component, EquivalenceMap &equivalenceMap, IndexStack &indexStack);
-void generateEquivalenceMap(const ComponentPtr &component, EquivalenceMap &map, IndexStack &indexStack);
-void applyEquivalenceMapToModel(const EquivalenceMap &map, const ModelPtr &model);
-NameList componentNames(const ModelPtr &model);
+/**
+ * @brief Record the mapping from the variables of @p original to the variables of @p clone.
+ *
+ * Walk the component trees of @p original and @p clone in parallel, recording
+ * which variable in @p clone was cloned from which variable in @p original.
+ * The @p clone is expected to have been created by cloning @p original, any
+ * components appended to @p clone afterwards are ignored.
+ *
+ * @param original The component that was cloned.
+ * @param clone The clone of @p original.
+ * @param map The @ref VariableCloneMap to record the mapping in.
+ */
+void recordClonedVariables(const ComponentPtr &original, const ComponentPtr &clone, VariableCloneMap &map);
+
+/**
+ * @brief Transfer the equivalences of @p original onto @p clone.
+ *
+ * Walk the component trees of @p original and @p clone in parallel, adding to
+ * each cloned variable the equivalences of its original variable.  Only
+ * equivalences to variables found in @p map are transferred, i.e. equivalences
+ * that lead out of the cloned component trees are dropped.
+ *
+ * @param original The component that was cloned.
+ * @param clone The clone of @p original.
+ * @param map The @ref VariableCloneMap from original variables to cloned variables.
+ */
+void transferEquivalences(const ComponentPtr &original, const ComponentPtr &clone, const VariableCloneMap &map);
+
+UniqueNames componentNames(const ModelPtr &model);
 NameList unitsNamesUsed(const ComponentPtr &component);
-EquivalenceMap rebaseEquivalenceMap(const EquivalenceMap &map, const IndexStack &originStack, const IndexStack &destinationStack);
 std::vector<UnitsPtr> unitsUsed(const ModelPtr &model, const ComponentConstPtr &component);
 ComponentNameMap createComponentNamesMap(const ComponentPtr &component);
 
@@ -870,4 +912,111 @@ size_t mathmlChildCount(const XmlNodePtr &node);
  */
 XmlNodePtr mathmlChildNode(const XmlNodePtr &node, size_t index);
 
+/**
+ * @brief Schedule the computation of an equation.
+ *
+ * Append to @p equations the equations that need to be computed, in the order
+ * in which they need to be computed, so that @p equation can be computed, i.e.
+ * its dependencies followed by @p equation itself.  Only the equations in
+ * @p remainingEquations get scheduled and they get removed from it, along with
+ * their NLA siblings, which are computed with them.  The dependencies of
+ * @p equation that are ODEs or constants (including computed constants unless
+ * @p includeComputedConstants is @c true) don't get scheduled.  Neither do
+ * those that are not in @p equationsForDependencies, if it is not empty,
+ * unless they are to be computed again (i.e. state/rate-based algebraic and
+ * NLA equations, and external equations).
+ *
+ * @param equation The equation to schedule.
+ * @param remainingEquations The equations that remain to be scheduled.
+ * @param equationsForDependencies The equations that may be scheduled as a
+ * dependency, or all of them if empty.
+ * @param includeComputedConstants Whether computed constants may be scheduled
+ * as a dependency.
+ * @param equations The scheduled equations.
+ */
+void scheduleEquation(const AnalyserEquationPtr &equation,
+                      AnalyserEquationSet &remainingEquations,
+                      const AnalyserEquationSet &equationsForDependencies,
+                      bool includeComputedConstants,
+                      std::vector<AnalyserEquationPtr> &equations);
+
+/**
+ * @brief Return the equations to compute when initialising the variables.
+ *
+ * Return the equations, in the order in which they need to be computed, to
+ * compute when initialising the variables of @p model, i.e. its true
+ * constants.  The scheduled equations get removed from @p remainingEquations.
+ *
+ * @param model The analyser model for which we want the equations.
+ * @param remainingEquations The equations that remain to be scheduled.
+ *
+ * @return The equations to compute when initialising the variables.
+ */
+std::vector<AnalyserEquationPtr> equationsToInitialiseVariables(const AnalyserModelPtr &model,
+                                                                AnalyserEquationSet &remainingEquations);
+
+/**
+ * @brief Return the equations to compute when initialising the external
+ * variables.
+ *
+ * Return the external equations of @p model, in the order in which they need
+ * to be computed when initialising its variables, i.e. after its true
+ * constants and states.  The dependencies of an external equation don't get
+ * scheduled, unless they are themselves external equations.
+ *
+ * @param model The analyser model for which we want the equations.
+ *
+ * @return The equations to compute when initialising the external variables.
+ */
+std::vector<AnalyserEquationPtr> equationsToInitialiseExternalVariables(const AnalyserModelPtr &model);
+
+/**
+ * @brief Return the equations to compute when computing the computed constants.
+ *
+ * Return the equations, in the order in which they need to be computed, to
+ * compute when computing the computed constants of @p model.  The scheduled
+ * equations get removed from @p remainingEquations.
+ *
+ * @param model The analyser model for which we want the equations.
+ * @param remainingEquations The equations that remain to be scheduled.
+ *
+ * @return The equations to compute when computing the computed constants.
+ */
+std::vector<AnalyserEquationPtr> equationsToComputeComputedConstants(const AnalyserModelPtr &model,
+                                                                     AnalyserEquationSet &remainingEquations);
+
+/**
+ * @brief Return the equations to compute when computing the rates.
+ *
+ * Return the equations, in the order in which they need to be computed, to
+ * compute when computing the rates of @p model, i.e. its ODEs, its NLA
+ * systems that compute a rate, and their dependencies.  The scheduled
+ * equations get removed from @p remainingEquations.  There are no such
+ * equations if @p model has no ODEs.
+ *
+ * @param model The analyser model for which we want the equations.
+ * @param remainingEquations The equations that remain to be scheduled.
+ *
+ * @return The equations to compute when computing the rates.
+ */
+std::vector<AnalyserEquationPtr> equationsToComputeRates(const AnalyserModelPtr &model,
+                                                         AnalyserEquationSet &remainingEquations);
+
+/**
+ * @brief Return the equations to compute when computing the variables.
+ *
+ * Return the equations, in the order in which they need to be computed, to
+ * compute when computing the variables of @p model, i.e. the equations that
+ * have not been scheduled by any of the other methods (see
+ * @p remainingEquations) and those that are to be computed again.
+ *
+ * @param model The analyser model for which we want the equations.
+ * @param remainingEquations The equations that have not been scheduled by any
+ * of the other methods.
+ *
+ * @return The equations to compute when computing the variables.
+ */
+std::vector<AnalyserEquationPtr> equationsToComputeVariables(const AnalyserModelPtr &model,
+                                                             const AnalyserEquationSet &remainingEquations);
+
 } // namespace libcellml
@@ -286,6 +286,29 @@ class Validator::ValidatorImpl: public LoggerImpl
 {
 public:
     Validator *mValidator = nullptr;
+    size_t mErrorLimit = 0; /**< The number of errors after which validation stops. */
+    std::vector<ComponentPtr> mDeferredMathComponents; /**< Components of the validated model whose math is validated last. */
+    std::set<std::set<std::string>> mReportedCycles; /**< Names in the cyclic units reported so far, stored or not. */
+    std::set<std::string> mReportedDescriptions; /**< Descriptions of the duplicate units reported so far, stored or not. */
+
+    /**
+     * @brief Test if the error limit has been reached.
+     *
+     * Test if at least as many errors as the error limit have been found.
+     *
+     * @return @c true if the error limit has been reached, @c false otherwise.
+     */
+    bool isErrorLimitReached() const;
+
+    /**
+     * @brief Test if validation should fail fast.
+     *
+     * Test if an error limit has been set, in which case the checks are run
+     * cheapest first and validation stops as soon as the limit is reached.
+     *
+     * @return @c true if validation should fail fast, @c false otherwise.
+     */
+    bool isFailingFast() const;
 
     /**
      * @brief Utility function to construct an @c Issue if required for a given CellML identifier string.
@@ -338,6 +361,28 @@ public:
      */
     void validateComponentTree(const ModelPtr &model, const ComponentPtr &component, NameList &componentNames, History &history, std::vector<ModelPtr> &modelsVisited);
 
+    /**
+     * @brief Validate all the component trees of the given @p model.
+     *
+     * Validate all the component trees of the given @p model, stopping early
+     * if the error limit is reached.
+     *
+     * @param model The model to validate the components of.
+     * @param modelsVisited The list of visited models.
+     */
+    void validateAllComponents(const ModelPtr &model, std::vector<ModelPtr> &modelsVisited);
+
+    /**
+     * @brief Validate all the units of the given @p model.
+     *
+     * Validate all the units of the given @p model, stopping early if the
+     * error limit is reached.
+     *
+     * @param model The model to validate the units of.
+     * @param modelsVisited The list of visited models.
+     */
+    void validateAllUnits(const ModelPtr &model, std::vector<ModelPtr> &modelsVisited);
+
     /**
      * @brief Validate the @p units using the CellML 2.0 Specification.
      *
@@ -688,7 +733,8 @@ public:
     /**
      * @brief Check if the @p names are already part of a cyclic issues.
      *
-     * Check to see if the @p names have already been reported in a cyclic issue.
+     * Check to see if the @p names have already been reported in a cyclic
+     * issue, whether that issue was stored or not.
      *
      * @param names The names that make up the cycle.
      *
@@ -699,8 +745,8 @@ public:
     /**
      * @brief Check to see if the @p description is already present in the issues.
      *
-     * Check to see if the @p description has already been reported in
-     * existing issues.
+     * Check to see if the @p description has already been reported, whether
+     * the corresponding issue was stored or not.
      *
      * @param description The description to check for prior existence.
      *
@@ -739,6 +785,21 @@ Validator::ValidatorImpl *Validator::pFunc()
     return reinterpret_cast<Validator::ValidatorImpl *>(Logger::pFunc());
 }
 
+const Validator::ValidatorImpl *Validator::pFunc() const
+{
+    return reinterpret_cast<Validator::ValidatorImpl const *>(Logger::pFunc());
+}
+
+bool Validator::ValidatorImpl::isErrorLimitReached() const
+{
+    return isFailingFast() && (mErrorCount >= mErrorLimit);
+}
+
+bool Validator::ValidatorImpl::isFailingFast() const
+{
+    return mErrorLimit != 0;
+}
+
 Validator::Validator()
     : Logger(new ValidatorImpl())
 {
@@ -755,10 +816,25 @@ ValidatorPtr Validator::create() noexcept
     return std::shared_ptr<Validator> {new Validator {}};
 }
 
+void Validator::setErrorLimit(size_t limit)
+{
+    pFunc()->mErrorLimit = limit;
+}
+
+size_t Validator::errorLimit() const
+{
+    return pFunc()->mErrorLimit;
+}
+
 void Validator::validateModel(const ModelPtr &model)
 {
+    ProfilerScope profilerScope(pFunc()->mProfiler, Profiler::Phase::VALIDATE_MODEL);
+
     // Clear any pre-existing issues in this validator instance.
     pFunc()->removeAllIssues();
+    pFunc()->mDeferredMathComponents.clear();
+    pFunc()->mReportedCycles.clear();
+    pFunc()->mReportedDescriptions.clear();
 
     if (model == nullptr) {
         auto issue = Issue::IssueImpl::create();
@@ -771,45 +847,73 @@ void Validator::validateModel(const ModelPtr &model)
             auto issue = pFunc()->makeIssueIllegalIdentifier(model->name());
             issue->mPimpl->mItem->mPimpl->setModel(model);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MODEL_NAME_VALUE);
-            issue->mPimpl->setDescription("Model '" + model->name() + "' does not have a valid name attribute. " + issue->description());
-            pFunc()->addIssue(issue);
+            pFunc()->addIssue(issue, [&] {
+                return "Model '" + model->name() + "' does not have a valid name attribute. " + issue->description();
+            });
         }
         // Check for a valid identifier.
         if (!isValidXmlName(model->id())) {
             auto issue = Issue::IssueImpl::create();
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
             issue->mPimpl->mItem->mPimpl->setModel(model);
-            issue->mPimpl->setDescription("Model '" + model->name() + "' does not have a valid 'id' attribute, '" + model->id() + "'.");
-            pFunc()->addIssue(issue);
+            pFunc()->addIssue(issue, [&] {
+                return "Model '" + model->name() + "' does not have a valid 'id' attribute, '" + model->id() + "'.";
+            });
         }
         std::vector<ModelPtr> modelsVisited = {model};
-        // Check for components in this model.
-        if (model->componentCount() > 0) {
-            NameList componentNames;
-            History history;
-            for (size_t i = 0; i < model->componentCount(); ++i) {
-                history.clear();
-                ComponentPtr component = model->component(i);
-                pFunc()->validateComponentTree(model, component, componentNames, history, modelsVisited);
-            }
-        }
-        // Check for units in this model.
-        if (model->unitsCount() > 0) {
-            History history;
-            for (size_t i = 0; i < model->unitsCount(); ++i) {
-                history.clear();
-                UnitsPtr units = model->units(i);
-                pFunc()->validateUnits(units, history, modelsVisited);
-            }
+        // When failing fast, units are checked before components since they
+        // are cheaper to check, and the validation of math (incl. its DTD
+        // pass) is deferred until all the other checks have been done.
+        if (pFunc()->isFailingFast()) {
+            pFunc()->validateAllUnits(model, modelsVisited);
+            pFunc()->validateAllComponents(model, modelsVisited);
+        } else {
+            pFunc()->validateAllComponents(model, modelsVisited);
+            pFunc()->validateAllUnits(model, modelsVisited);
         }
 
         // Validate any connections / variable equivalence networks in the model.
-        pFunc()->validateConnections(model);
+        if (!pFunc()->isErrorLimitReached()) {
+            pFunc()->validateConnections(model);
+        }
 
         // Check identifiers across the model are unique.
-        pFunc()->checkUniqueIds(model);
+        if (!pFunc()->isErrorLimitReached()) {
+            pFunc()->checkUniqueIds(model);
+        }
+
+        if (!pFunc()->isErrorLimitReached()) {
+            pFunc()->checkUniqueResetOrders(model);
+        }
 
-        pFunc()->checkUniqueResetOrders(model);
+        for (const auto &component : pFunc()->mDeferredMathComponents) {
+            if (pFunc()->isErrorLimitReached()) {
+                break;
+            }
+            pFunc()->validateMath(component->math(), component);
+        }
+        pFunc()->mDeferredMathComponents.clear();
+    }
+}
+
+void Validator::ValidatorImpl::validateAllComponents(const ModelPtr &model, std::vector<ModelPtr> &modelsVisited)
+{
+    NameList componentNames;
+    History history;
+    for (size_t i = 0; (i < model->componentCount()) && !isErrorLimitReached(); ++i) {
+        history.clear();
+        ComponentPtr component = model->component(i);
+        validateComponentTree(model, component, componentNames, history, modelsVisited);
+    }
+}
+
+void Validator::ValidatorImpl::validateAllUnits(const ModelPtr &model, std::vector<ModelPtr> &modelsVisited)
+{
+    History history;
+    for (size_t i = 0; (i < model->unitsCount()) && !isErrorLimitReached(); ++i) {
+        history.clear();
+        UnitsPtr units = model->units(i);
+        validateUnits(units, history, modelsVisited);
     }
 }
 
@@ -819,14 +923,15 @@ void Validator::ValidatorImpl::validateUniqueName(const ModelPtr &model, const C
     if (!name.empty()) {
         if (std::find(names.begin(), names.end(), name) != names.end()) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Model '" + model->name() + "' contains multiple components with the name '" + name + "'. Valid component names must be unique to their model.");
             issue->mPimpl->mItem->mPimpl->setModel(model);
             if (component->isImport()) {
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_COMPONENT_NAME_UNIQUE);
             } else {
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::COMPONENT_NAME_UNIQUE);
             }
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return "Model '" + model->name() + "' contains multiple components with the name '" + name + "'. Valid component names must be unique to their model.";
+            });
         } else {
             names.push_back(name);
         }
@@ -836,11 +941,13 @@ void Validator::ValidatorImpl::validateUniqueName(const ModelPtr &model, const C
 void Validator::ValidatorImpl::validateComponentTree(const ModelPtr &model, const ComponentPtr &component, NameList &componentNames, History &history, std::vector<ModelPtr> &modelsVisited)
 {
     validateUniqueName(model, component, componentNames);
-    for (size_t i = 0; i < component->componentCount(); ++i) {
+    for (size_t i = 0; (i < component->componentCount()) && !isErrorLimitReached(); ++i) {
         auto childComponent = component->component(i);
         validateComponentTree(model, childComponent, componentNames, history, modelsVisited);
     }
-    validateComponent(component, history, modelsVisited);
+    if (!isErrorLimitReached()) {
+        validateComponent(component, history, modelsVisited);
+    }
 }
 
 void Validator::ValidatorImpl::validateImportSource(const ImportSourcePtr &importSource, const std::string &importName, const std::string &importType)
@@ -852,24 +959,27 @@ void Validator::ValidatorImpl::validateImportSource(const ImportSourcePtr &impor
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
         issue->mPimpl->mItem->mPimpl->setImportSource(importSource);
-        issue->mPimpl->setDescription("Import of " + importType + " '" + importName + "' does not have a valid 'id' attribute, '" + importSource->id() + "'.");
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return "Import of " + importType + " '" + importName + "' does not have a valid 'id' attribute, '" + importSource->id() + "'.";
+        });
     }
 
     if (url.empty()) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Import of " + importType + " '" + importName + "' does not have a valid locator xlink:href attribute.");
         issue->mPimpl->mItem->mPimpl->setImportSource(importSource);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_HREF_LOCATOR);
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return "Import of " + importType + " '" + importName + "' does not have a valid locator xlink:href attribute.";
+        });
     } else {
         xmlURIPtr uri = xmlParseURI(url.c_str());
         if (uri == nullptr) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Import of " + importType + " '" + importName + "' has an invalid URI in the xlink:href attribute.");
             issue->mPimpl->mItem->mPimpl->setImportSource(importSource);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_HREF_LOCATOR);
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return "Import of " + importType + " '" + importName + "' has an invalid URI in the xlink:href attribute.";
+            });
 
         } else {
             xmlFreeURI(uri);
@@ -884,7 +994,7 @@ void Validator::ValidatorImpl::handleErrorsFromImports(size_t initialErrorCount,
     static const std::string dataBoundaryMarker = "&";
     static const std::string dataSeparator = ";";
 
-    for (size_t i = initialErrorCount; i < mValidator->issueCount(); ++i) {
+    for (size_t i = initialErrorCount; i < mIssues.size(); ++i) {
         auto issue = mValidator->issue(i);
         auto description = issue->description();
         if (description.substr(0, skipThis.length()) != skipThis) {
@@ -945,7 +1055,7 @@ void Validator::ValidatorImpl::handleErrorsFromImports(size_t initialErrorCount,
 
 void Validator::ValidatorImpl::validateComponent(const ComponentPtr &component, History &history, std::vector<ModelPtr> &modelsVisited)
 {
-    size_t initialIssueCount = mValidator->issueCount();
+    size_t initialIssueCount = mIssues.size();
     bool isOriginatingModel = modelsVisited.size() == 1;
 
     std::string componentName = component->name();
@@ -959,21 +1069,23 @@ void Validator::ValidatorImpl::validateComponent(const ComponentPtr &component,
     if (!isCellmlIdentifier(componentName)) {
         auto issue = makeIssueIllegalIdentifier(componentName);
         issue->mPimpl->mItem->mPimpl->setComponent(component);
-        issue->mPimpl->setDescription(descriptionPrefix + "'" + componentName + "' does not have a valid name attribute. " + issue->description());
         if (isImported) {
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_COMPONENT_NAME_VALUE);
         } else {
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::COMPONENT_NAME_VALUE);
         }
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return descriptionPrefix + "'" + componentName + "' does not have a valid name attribute. " + issue->description();
+        });
     }
     // Check for a valid identifier.
     if (!isValidXmlName(component->id())) {
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
         issue->mPimpl->mItem->mPimpl->setComponent(component);
-        issue->mPimpl->setDescription(descriptionPrefix + "'" + componentName + "' does not have a valid 'id' attribute, '" + component->id() + "'.");
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return descriptionPrefix + "'" + componentName + "' does not have a valid 'id' attribute, '" + component->id() + "'.";
+        });
     }
 
     if (isImported) {
@@ -982,10 +1094,11 @@ void Validator::ValidatorImpl::validateComponent(const ComponentPtr &component,
 
         if (!isCellmlIdentifier(componentRef)) {
             auto issue = makeIssueIllegalIdentifier(componentRef);
-            issue->mPimpl->setDescription(descriptionPrefix + "'" + componentName + "' does not have a valid component_ref attribute. " + issue->description());
             issue->mPimpl->mItem->mPimpl->setComponent(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_COMPONENT_COMPONENT_REFERENCE_VALUE);
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return descriptionPrefix + "'" + componentName + "' does not have a valid component_ref attribute. " + issue->description();
+            });
         }
 
         validateImportSource(component->importSource(), componentName, "component");
@@ -1012,30 +1125,35 @@ void Validator::ValidatorImpl::validateComponent(const ComponentPtr &component,
                 history.pop_back();
             } else {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription(descriptionPrefix + "'" + componentName + "' refers to component '" + componentRef + "' which does not appear in '" + component->importSource()->url() + "'.");
                 issue->mPimpl->mItem->mPimpl->setComponent(component);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_COMPONENT_COMPONENT_REFERENCE_TARGET);
-                addIssue(issue);
+                addIssue(issue, [&] {
+                    return descriptionPrefix + "'" + componentName + "' refers to component '" + componentRef + "' which does not appear in '" + component->importSource()->url() + "'.";
+                });
             }
         }
     } else {
         // Check for variables in this component.
         NameList variableNames;
         // Validate variable(s).
-        for (size_t i = 0; i < component->variableCount(); ++i) {
+        for (size_t i = 0; (i < component->variableCount()) && !isErrorLimitReached(); ++i) {
             VariablePtr variable = component->variable(i);
             validateVariable(variable, variableNames);
             variableNames.push_back(variable->name());
         }
         // Check for resets in this component.
-        for (size_t i = 0; i < component->resetCount(); ++i) {
+        for (size_t i = 0; (i < component->resetCount()) && !isErrorLimitReached(); ++i) {
             ResetPtr reset = component->reset(i);
             validateReset(reset, component);
         }
 
         // Validate math through the private implementation (for XML handling).
-        if (!component->math().empty()) {
-            validateMath(component->math(), component);
+        if (!component->math().empty() && !isErrorLimitReached()) {
+            if (isFailingFast() && isOriginatingModel) {
+                mDeferredMathComponents.push_back(component);
+            } else {
+                validateMath(component->math(), component);
+            }
         }
     }
 
@@ -1060,33 +1178,16 @@ std::set<std::string> namesInCycle(NameList allNames)
 
 bool Validator::ValidatorImpl::hasCycleAlreadyBeenReported(NameList names) const
 {
-    std::set<std::string> testNamesInCycle = namesInCycle(std::move(names));
-    bool found = false;
-    for (size_t i = 0; !found && (i < mValidator->issueCount()); ++i) {
-        auto issue = mValidator->issue(i);
-        if (issue->description().substr(0, 20) == "Cyclic units exist: ") {
-            // Remove prefix to loop information.
-            auto loop = issue->description().substr(20);
-            // Remove suffix to loop information.
-            loop.pop_back();
-            auto parts = split(loop, " -> ");
-            auto existingNamesInCycle = namesInCycle(parts);
-            found = testNamesInCycle == existingNamesInCycle;
-        }
-    }
+    // Note: we keep track of the reported cycles ourselves rather than look
+    //       for them in our issues since some issues may not be stored (see
+    //       Logger::setIssueStorageLimit()).
 
-    return found;
+    return mReportedCycles.count(namesInCycle(std::move(names))) != 0;
 }
 
 bool Validator::ValidatorImpl::checkIssuesForDuplications(const std::string &description) const
 {
-    size_t count = mValidator->issueCount();
-    for (size_t i = 0; i < count; ++i) {
-        if (mValidator->issue(count - 1 - i)->description() == description) {
-            return true;
-        }
-    }
-    return false;
+    return mReportedDescriptions.count(description) != 0;
 }
 
 void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &history, std::vector<ModelPtr> &modelsVisited, const std::string &sourceUrl)
@@ -1105,18 +1206,21 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
             des += tmp;
         }
         if (!hasCycleAlreadyBeenReported(names)) {
+            mReportedCycles.insert(namesInCycle(names));
+
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Cyclic units exist: " + des + ".");
             issue->mPimpl->mItem->mPimpl->setUnits(units);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNIT_UNITS_CIRCULAR_REFERENCE);
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return "Cyclic units exist: " + des + ".";
+            });
         }
         history.pop_back();
         return;
     }
 
     std::string unitsName = units->name();
-    size_t initialIssueCount = mValidator->issueCount();
+    size_t initialIssueCount = mIssues.size();
     bool isOriginatingModel = modelsVisited.size() == 1;
 
     std::string unitsRef;
@@ -1149,10 +1253,11 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
         size_t currentIssueCount = mValidator->issueCount();
         if (!isCellmlIdentifier(unitsRef)) {
             auto issue = makeIssueIllegalIdentifier(unitsRef);
-            issue->mPimpl->setDescription("Imported units '" + unitsName + "' does not have a valid units_ref attribute. " + issue->description());
             issue->mPimpl->mItem->mPimpl->setUnits(units);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_UNITS_UNITS_REFERENCE_VALUE);
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return "Imported units '" + unitsName + "' does not have a valid units_ref attribute. " + issue->description();
+            });
         }
 
         auto importSource = units->importSource();
@@ -1165,6 +1270,8 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
         if (!foundImportIssue && (unitsWithImportSource > 1)) {
             auto description = "Model '" + model->name() + "' contains multiple imported units from '" + unitsImportUrl + "' with the same units_ref attribute '" + unitsRef + "'.";
             if (!checkIssuesForDuplications(description)) {
+                mReportedDescriptions.insert(description);
+
                 auto issue = Issue::IssueImpl::create();
                 issue->mPimpl->setDescription(description);
                 issue->mPimpl->mItem->mPimpl->setModel(model);
@@ -1198,10 +1305,11 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
                 }
             } else {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Imported units '" + units->name() + "' refers to units '" + unitsRef + "' which does not appear in '" + importSource->url() + "'.");
                 issue->mPimpl->mItem->mPimpl->setUnits(units);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_UNITS_UNITS_REFERENCE_VALUE_TARGET);
-                addIssue(issue);
+                addIssue(issue, [&] {
+                    return "Imported units '" + units->name() + "' refers to units '" + unitsRef + "' which does not appear in '" + importSource->url() + "'.";
+                });
             }
         }
     }
@@ -1209,6 +1317,8 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
     if (unitsWithNameCount > 1) {
         std::string description = "Model '" + model->name() + "' contains multiple units with the name '" + unitsName + "'. Valid units names must be unique to their model.";
         if (!checkIssuesForDuplications(description)) {
+            mReportedDescriptions.insert(description);
+
             auto issue = Issue::IssueImpl::create();
             issue->mPimpl->setDescription(description);
             issue->mPimpl->mItem->mPimpl->setModel(model);
@@ -1237,10 +1347,11 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
         // Check for a matching standard units.
         if (isStandardUnitName(unitsName)) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Units is named '" + unitsName + "' which is a protected standard unit name.");
             issue->mPimpl->mItem->mPimpl->setUnits(units);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNITS_STANDARD);
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return "Units is named '" + unitsName + "' which is a protected standard unit name.";
+            });
         }
     }
     // Check for a valid identifier.
@@ -1252,8 +1363,9 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
         if (units->isImport()) {
             descriptionStart = "Imported units";
         }
-        issue->mPimpl->setDescription(descriptionStart + " '" + unitsName + "' does not have a valid 'id' attribute, '" + units->id() + "'.");
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return descriptionStart + " '" + unitsName + "' does not have a valid 'id' attribute, '" + units->id() + "'.";
+        });
     }
 
     if (units->unitCount() > 0) {
@@ -1283,44 +1395,49 @@ void Validator::ValidatorImpl::validateUnitsUnitsItem(size_t index, const UnitsP
             validateUnits(model->units(reference), history, modelsVisited);
         } else if (!model->hasUnits(reference) && !isStandardUnitName(reference)) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Units reference '" + reference + "' in units '" + units->name() + "' is not a valid reference to a local units or a standard unit type.");
             issue->mPimpl->mItem->mPimpl->setUnitsItem(UnitsItem::create(units, index));
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNIT_UNITS_REFERENCE);
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return "Units reference '" + reference + "' in units '" + units->name() + "' is not a valid reference to a local units or a standard unit type.";
+            });
         }
     } else {
         auto issue = makeIssueIllegalIdentifier(reference);
-        issue->mPimpl->setDescription("Unit in units '" + units->name() + "' does not have a valid units reference. The reference given is '" + reference + "'. " + issue->description());
         issue->mPimpl->mItem->mPimpl->setUnitsItem(UnitsItem::create(units, index));
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNIT_UNITS_REFERENCE);
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return "Unit in units '" + units->name() + "' does not have a valid units reference. The reference given is '" + reference + "'. " + issue->description();
+        });
     }
     // Check for a valid identifier.
     if (!isValidXmlName(id)) {
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
         issue->mPimpl->mItem->mPimpl->setUnitsItem(UnitsItem::create(units, index));
-        issue->mPimpl->setDescription("Unit in units '" + units->name() + "' does not have a valid 'id' attribute, '" + units->id() + "'.");
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return "Unit in units '" + units->name() + "' does not have a valid 'id' attribute, '" + units->id() + "'.";
+        });
     }
     if (!prefix.empty()) {
         if (!isStandardPrefixName(prefix)) {
             if (!isCellMLInteger(prefix)) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Prefix '" + prefix + "' of a unit referencing '" + reference + "' in units '" + units->name() + "' is not a valid integer or an SI prefix.");
                 issue->mPimpl->mItem->mPimpl->setUnitsItem(UnitsItem::create(units, index));
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNIT_ATTRIBUTE_PREFIX_VALUE);
-                addIssue(issue);
+                addIssue(issue, [&] {
+                    return "Prefix '" + prefix + "' of a unit referencing '" + reference + "' in units '" + units->name() + "' is not a valid integer or an SI prefix.";
+                });
             } else {
                 try {
                     int test = std::stoi(prefix);
                     (void)test;
                 } catch (std::out_of_range &) {
                     auto issue = Issue::IssueImpl::create();
-                    issue->mPimpl->setDescription("Prefix '" + prefix + "' of a unit referencing '" + reference + "' in units '" + units->name() + "' is out of the integer range.");
                     issue->mPimpl->mItem->mPimpl->setUnitsItem(UnitsItem::create(units, index));
                     issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNIT_ATTRIBUTE_PREFIX_VALUE);
-                    addIssue(issue);
+                    addIssue(issue, [&] {
+                        return "Prefix '" + prefix + "' of a unit referencing '" + reference + "' in units '" + units->name() + "' is out of the integer range.";
+                    });
                 }
             }
         }
@@ -1334,52 +1451,58 @@ void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, con
     if (!variableName.empty()) {
         if (std::find(variableNames.begin(), variableNames.end(), variableName) != variableNames.end()) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Component '" + component->name() + "' contains multiple variables with the name '" + variableName + "'. Valid variable names must be unique to their component.");
             issue->mPimpl->mItem->mPimpl->setComponent(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_NAME_UNIQUE);
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return "Component '" + component->name() + "' contains multiple variables with the name '" + variableName + "'. Valid variable names must be unique to their component.";
+            });
         }
     }
 
     // Check for a valid name attribute.
     if (!isCellmlIdentifier(variableName)) {
         auto issue = makeIssueIllegalIdentifier(variableName);
-        issue->mPimpl->setDescription("Variable '" + variableName + "' in component '" + component->name() + "' does not have a valid name attribute. " + issue->description());
         issue->mPimpl->mItem->mPimpl->setVariable(variable);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_NAME_VALUE);
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return "Variable '" + variableName + "' in component '" + component->name() + "' does not have a valid name attribute. " + issue->description();
+        });
     }
     // Check for a valid identifier.
     if (!isValidXmlName(variable->id())) {
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
         issue->mPimpl->mItem->mPimpl->setVariable(variable);
-        issue->mPimpl->setDescription("Variable '" + variableName + "' does not have a valid 'id' attribute, '" + variable->id() + "'.");
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return "Variable '" + variableName + "' does not have a valid 'id' attribute, '" + variable->id() + "'.";
+        });
     }
     // Check for a valid units attribute.
     if (variable->units() == nullptr) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Variable '" + variableName + "' in component '" + component->name() + "' does not have any units specified.");
         issue->mPimpl->mItem->mPimpl->setVariable(variable);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_UNITS_VALUE);
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return "Variable '" + variableName + "' in component '" + component->name() + "' does not have any units specified.";
+        });
     } else {
         std::string unitsName = variable->units()->name();
         if (!isCellmlIdentifier(unitsName)) {
             auto issue = makeIssueIllegalIdentifier(unitsName);
-            issue->mPimpl->setDescription("Variable '" + variableName + "' in component '" + component->name() + "' does not have a valid units attribute. The attribute given is '" + unitsName + "'. " + issue->description());
             issue->mPimpl->mItem->mPimpl->setVariable(variable);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_UNITS_VALUE);
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return "Variable '" + variableName + "' in component '" + component->name() + "' does not have a valid units attribute. The attribute given is '" + unitsName + "'. " + issue->description();
+            });
         } else if (!isStandardUnitName(unitsName)) {
             ModelPtr model = owningModel(component);
             if (!model->hasUnits(unitsName)) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Variable '" + variableName + "' in component '" + component->name() + "' has a units reference '" + unitsName + "' which is neither standard nor defined in the parent model.");
                 issue->mPimpl->mItem->mPimpl->setVariable(variable);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_UNITS_VALUE);
-                addIssue(issue);
+                addIssue(issue, [&] {
+                    return "Variable '" + variableName + "' in component '" + component->name() + "' has a units reference '" + unitsName + "' which is neither standard nor defined in the parent model.";
+                });
             }
         }
     }
@@ -1388,10 +1511,11 @@ void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, con
         std::string interfaceType = variable->interfaceType();
         if ((interfaceType != "public") && (interfaceType != "private") && (interfaceType != "none") && (interfaceType != "public_and_private")) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Variable '" + variableName + "' in component '" + component->name() + "' has an invalid interface attribute value '" + interfaceType + "'.");
             issue->mPimpl->mItem->mPimpl->setVariable(variable);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_INTERFACE_VALUE);
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return "Variable '" + variableName + "' in component '" + component->name() + "' has an invalid interface attribute value '" + interfaceType + "'.";
+            });
         }
     }
     // Check for a valid initial value attribute.
@@ -1402,10 +1526,11 @@ void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, con
             // Otherwise, check that the initial value can be converted to a double
             if (!isCellMLReal(initialValue)) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Variable '" + variableName + "' in component '" + component->name() + "' has an invalid initial value '" + initialValue + "'. Initial values must be a real number string or a variable reference.");
                 issue->mPimpl->mItem->mPimpl->setVariable(variable);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_INITIAL_VALUE_VALUE);
-                addIssue(issue);
+                addIssue(issue, [&] {
+                    return "Variable '" + variableName + "' in component '" + component->name() + "' has an invalid initial value '" + initialValue + "'. Initial values must be a real number string or a variable reference.";
+                });
             }
         }
     }
@@ -1436,8 +1561,9 @@ void Validator::ValidatorImpl::validateReset(const ResetPtr &reset, const Compon
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
         issue->mPimpl->mItem->mPimpl->setReset(reset);
-        issue->mPimpl->setDescription(description + "' does not have a valid 'id' attribute, '" + reset->id() + "'.");
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return description + "' does not have a valid 'id' attribute, '" + reset->id() + "'.";
+        });
     }
 
     if (reset->variable() == nullptr) {
@@ -1485,71 +1611,82 @@ void Validator::ValidatorImpl::validateReset(const ResetPtr &reset, const Compon
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
         issue->mPimpl->mItem->mPimpl->setReset(reset);
-        issue->mPimpl->setDescription(description + "' does not have a valid test_value 'id' attribute, '" + reset->testValueId() + "'.");
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return description + "' does not have a valid test_value 'id' attribute, '" + reset->testValueId() + "'.";
+        });
     }
     // Check for a valid identifier.
     if (!isValidXmlName(reset->resetValueId())) {
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
         issue->mPimpl->mItem->mPimpl->setReset(reset);
-        issue->mPimpl->setDescription(description + "' does not have a valid reset_value 'id' attribute, '" + reset->resetValueId() + "'.");
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return description + "' does not have a valid reset_value 'id' attribute, '" + reset->resetValueId() + "'.";
+        });
     }
 
     if (noOrder) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription(description + "does not have an order set.");
         issue->mPimpl->mItem->mPimpl->setComponent(component);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::RESET_ORDER_VALUE);
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return description + "does not have an order set.";
+        });
     }
     if (noVariable) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription(description + "does not reference a variable.");
         issue->mPimpl->mItem->mPimpl->setReset(reset);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::RESET_VARIABLE_REFERENCE);
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return description + "does not reference a variable.";
+        });
     }
     if (noTestVariable) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription(description + "does not reference a test_variable.");
         issue->mPimpl->mItem->mPimpl->setReset(reset);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::RESET_TEST_VARIABLE_REFERENCE);
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return description + "does not reference a test_variable.";
+        });
     }
     if (noTestValue) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription(description + "does not have a test_value specified.");
         issue->mPimpl->mItem->mPimpl->setReset(reset);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::TEST_VALUE_ELEMENT);
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return description + "does not have a test_value specified.";
+        });
     }
     if (noResetValue) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription(description + "does not have a reset_value specified.");
         issue->mPimpl->mItem->mPimpl->setReset(reset);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::RESET_VALUE_ELEMENT);
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return description + "does not have a reset_value specified.";
+        });
     }
     if (varOutsideComponent) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription(description + "refers to a variable '" + reset->variable()->name() + "' in a different component '" + varParentName + "'.");
         issue->mPimpl->mItem->mPimpl->setReset(reset);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::RESET_VARIABLE_REFERENCE);
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return description + "refers to a variable '" + reset->variable()->name() + "' in a different component '" + varParentName + "'.";
+        });
     }
     if (testVarOutsideComponent) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription(description + "refers to a test_variable '" + reset->testVariable()->name() + "' in a different component '" + testVarParentName + "'.");
         issue->mPimpl->mItem->mPimpl->setReset(reset);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::RESET_TEST_VARIABLE_REFERENCE);
-        addIssue(issue);
+        addIssue(issue, [&] {
+            return description + "refers to a test_variable '" + reset->testVariable()->name() + "' in a different component '" + testVarParentName + "'.";
+        });
     }
 }
 
 void Validator::ValidatorImpl::validateMath(const std::string &input, const ComponentPtr &component)
 {
+    ProfilerScope profilerScope(mProfiler, Profiler::Phase::VALIDATE_MATH);
+
     // Parse as XML first.
     std::vector<XmlDocPtr> docs = multiRootXml(input);
     for (const auto &doc : docs) {
@@ -1557,26 +1694,29 @@ void Validator::ValidatorImpl::validateMath(const std::string &input, const Comp
         if (doc->xmlErrorCount() > 0) {
             for (size_t i = 0; i < doc->xmlErrorCount(); ++i) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("LibXml2 error: " + doc->xmlError(i));
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML);
-                addIssue(issue);
+                addIssue(issue, [&] {
+                    return "LibXml2 error: " + doc->xmlError(i);
+                });
             }
         }
         XmlNodePtr node = doc->rootNode();
         if (node == nullptr) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Could not get a valid XML root node from the math on component '" + component->name() + "'.");
             issue->mPimpl->mItem->mPimpl->setComponent(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML);
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return "Could not get a valid XML root node from the math on component '" + component->name() + "'.";
+            });
             return;
         }
         if (!node->isMathmlElement("math")) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Math root node is of invalid type '" + node->name() + "' on component '" + component->name() + "'. A valid math root node should be of type 'math'.");
             issue->mPimpl->mItem->mPimpl->setComponent(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_ELEMENT);
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return "Math root node is of invalid type '" + node->name() + "' on component '" + component->name() + "'. A valid math root node should be of type 'math'.";
+            });
             return;
         }
 
@@ -1595,6 +1735,11 @@ void Validator::ValidatorImpl::validateMath(const std::string &input, const Comp
         XmlNodePtr mathNode = node;
         validateAndCleanMathCiCnNodes(node, component, variableNames);
 
+        // Don't go through the DTD pass if we have already found enough errors.
+        if (isErrorLimitReached()) {
+            return;
+        }
+
         // Remove the cellml namespace definition.
         if (mathNode->hasNamespaceDefinition(CELLML_2_0_NS)) {
             mathNode->removeNamespaceDefinition(CELLML_2_0_NS);
@@ -1610,10 +1755,11 @@ void Validator::ValidatorImpl::validateMath(const std::string &input, const Comp
         if (mathmlDoc->xmlErrorCount() > 0) {
             for (size_t i = 0; i < mathmlDoc->xmlErrorCount(); ++i) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("W3C MathML DTD error: " + mathmlDoc->xmlError(i));
                 issue->mPimpl->mItem->mPimpl->setMath(component);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_MATHML);
-                addIssue(issue);
+                addIssue(issue, [&] {
+                    return "W3C MathML DTD error: " + mathmlDoc->xmlError(i);
+                });
             }
         }
 
@@ -1624,7 +1770,7 @@ void Validator::ValidatorImpl::validateMath(const std::string &input, const Comp
 
         auto childCount = mathmlChildCount(mathNode);
 
-        for (size_t i = 0; i < childCount; ++i) {
+        for (size_t i = 0; (i < childCount) && !isErrorLimitReached(); ++i) {
             validateMathMLElementsChildrenAndSiblings(mathmlChildNode(mathNode, i), component);
         }
     }
@@ -1637,10 +1783,11 @@ bool Validator::ValidatorImpl::validateCnUnits(const ComponentPtr &component, co
     }
 
     IssuePtr issue = makeIssueIllegalIdentifier(unitsName);
-    issue->mPimpl->setDescription("Math cn element with the value '" + textNode + "' does not have a valid cellml:units attribute. " + issue->description());
     issue->mPimpl->mItem->mPimpl->setMath(component);
     issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_CN_UNITS_ATTRIBUTE);
-    addIssue(issue);
+    addIssue(issue, [&] {
+        return "Math cn element with the value '" + textNode + "' does not have a valid cellml:units attribute. " + issue->description();
+    });
 
     return false;
 }
@@ -1671,10 +1818,11 @@ void Validator::ValidatorImpl::validateAndCleanCnNode(const XmlNodePtr &node, co
             } else if (attribute->inNamespaceUri(CELLML_2_0_NS)) {
                 cellmlAttributesToRemove.push_back(attribute);
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Math " + node->name() + " element has an invalid attribute type '" + attribute->name() + "' in the cellml namespace. Attribute 'units' is the only CellML namespace attribute allowed.");
                 issue->mPimpl->mItem->mPimpl->setMath(component);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_MATHML);
-                addIssue(issue);
+                addIssue(issue, [&] {
+                    return "Math " + node->name() + " element has an invalid attribute type '" + attribute->name() + "' in the cellml namespace. Attribute 'units' is the only CellML namespace attribute allowed.";
+                });
             }
         }
         attribute = attribute->next();
@@ -1693,10 +1841,11 @@ void Validator::ValidatorImpl::validateAndCleanCnNode(const XmlNodePtr &node, co
             // Check for a matching standard units.
             if (!isStandardUnitName(unitsName)) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Math has a " + node->name() + " element with a cellml:units attribute '" + unitsName + "' that is not a valid reference to units in the model '" + model->name() + "' or a standard unit.");
                 issue->mPimpl->mItem->mPimpl->setMath(component);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_CN_UNITS_ATTRIBUTE_REFERENCE);
-                addIssue(issue);
+                addIssue(issue, [&] {
+                    return "Math has a " + node->name() + " element with a cellml:units attribute '" + unitsName + "' that is not a valid reference to units in the model '" + model->name() + "' or a standard unit.";
+                });
             }
         }
     }
@@ -1719,10 +1868,11 @@ void Validator::ValidatorImpl::validateAndCleanCiNode(const XmlNodePtr &node, co
         // Check whether we can find this text as a variable name in this component.
         if (std::find(variableNames.begin(), variableNames.end(), textInNode) == variableNames.end()) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("MathML ci element has the child text '" + textInNode + "' which does not correspond with any variable names present in component '" + component->name() + "'.");
             issue->mPimpl->mItem->mPimpl->setMath(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_CI_VARIABLE_REFERENCE);
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return "MathML ci element has the child text '" + textInNode + "' which does not correspond with any variable names present in component '" + component->name() + "'.";
+            });
         }
     }
 }
@@ -1751,10 +1901,11 @@ void Validator::ValidatorImpl::validateMathMLElement(const XmlNodePtr &node, con
     if (node != nullptr) {
         if (!node->isComment() && !node->isText() && !isSupportedMathMLElement(node)) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Math has a '" + node->name() + "' element that is not a supported MathML element.");
             issue->mPimpl->mItem->mPimpl->setMath(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_CHILD);
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return "Math has a '" + node->name() + "' element that is not a supported MathML element.";
+            });
         }
         validateMathMLElements(node, component);
     }
@@ -2600,9 +2751,10 @@ void Validator::ValidatorImpl::checkUniqueResetOrders(const ModelPtr &model)
         if (ordersSet.size() < orders.size()) {
             auto issue = Issue::IssueImpl::create();
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::RESET_ORDER_UNIQUE);
-            issue->mPimpl->setDescription("Variable '" + variable->name() + "' used in resets does not have unique order values across the equivalent variable set.");
             issue->mPimpl->mItem->mPimpl->setModel(model);
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return "Variable '" + variable->name() + "' used in resets does not have unique order values across the equivalent variable set.";
+            });
         }
     }
 }
@@ -2740,8 +2892,9 @@ IdMap Validator::ValidatorImpl::buildModelIdMap(const ModelPtr &model)
             auto issue = Issue::IssueImpl::create();
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
             issue->mPimpl->mItem->mPimpl->setModel(model);
-            issue->mPimpl->setDescription("Model '" + model->name() + "' does not have a valid encapsulation 'id' attribute, '" + model->encapsulationId() + "'.");
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return "Model '" + model->name() + "' does not have a valid encapsulation 'id' attribute, '" + model->encapsulationId() + "'.";
+            });
         }
 
         info = " - encapsulation in model '" + model->name() + "'";
@@ -2801,8 +2954,9 @@ void Validator::ValidatorImpl::buildComponentIdMap(const ComponentPtr &component
                         auto issue = Issue::IssueImpl::create();
                         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
                         issue->mPimpl->mItem->mPimpl->setMapVariables(item, equiv);
-                        issue->mPimpl->setDescription("Variable equivalence " + mappingDescription + ", does not have a valid map_variables 'id' attribute, '" + mappingId + "'.");
-                        addIssue(issue);
+                        addIssue(issue, [&] {
+                            return "Variable equivalence " + mappingDescription + ", does not have a valid map_variables 'id' attribute, '" + mappingId + "'.";
+                        });
                     }
 
                     info = " - variable equivalence " + mappingDescription;
@@ -2821,8 +2975,9 @@ void Validator::ValidatorImpl::buildComponentIdMap(const ComponentPtr &component
                         auto issue = Issue::IssueImpl::create();
                         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
                         issue->mPimpl->mItem->mPimpl->setConnection(item, equiv);
-                        issue->mPimpl->setDescription("Connection " + connectionDescription + ", does not have a valid connection 'id' attribute, '" + connectionId + "'.");
-                        addIssue(issue);
+                        addIssue(issue, [&] {
+                            return "Connection " + connectionDescription + ", does not have a valid connection 'id' attribute, '" + connectionId + "'.";
+                        });
                     }
 
                     reportedConnections.insert(connection);
@@ -2871,8 +3026,9 @@ void Validator::ValidatorImpl::buildComponentIdMap(const ComponentPtr &component
             auto issue = Issue::IssueImpl::create();
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
             issue->mPimpl->mItem->mPimpl->setComponent(component);
-            issue->mPimpl->setDescription("Component '" + component->name() + "' does not have a valid encapsulation 'id' attribute, '" + component->encapsulationId() + "'.");
-            addIssue(issue);
+            addIssue(issue, [&] {
+                return "Component '" + component->name() + "' does not have a valid encapsulation 'id' attribute, '" + component->encapsulationId() + "'.";
+            });
         }
 
         info = " - encapsulation component_ref to component '" + component->name() + "'";
@@ -142,6 +142,9 @@ void Variable::removeAllEquivalences()
         }
     }
     pFunc()->mEquivalentVariables.clear();
+    if (!pFunc()->mMappingIdMap.empty() || !pFunc()->mConnectionIdMap.empty()) {
+        invalidateIds(this);
+    }
 }
 
 VariablePtr Variable::equivalentVariable(size_t index) const
@@ -266,14 +269,20 @@ bool Variable::VariableImpl::unsetEquivalentTo(const VariablePtr &equivalentVari
     auto result = findEquivalentVariable(equivalentVariable);
     if (result != mEquivalentVariables.end()) {
         mEquivalentVariables.erase(result);
+        bool hadIds = false;
         auto mappingIdResult = mMappingIdMap.find(equivalentVariable);
         if (mappingIdResult != mMappingIdMap.end()) {
+            hadIds = !mappingIdResult->second.empty();
             mMappingIdMap.erase(mappingIdResult);
         }
         auto connectionIdResult = mConnectionIdMap.find(equivalentVariable);
         if (connectionIdResult != mConnectionIdMap.end()) {
+            hadIds = hadIds || !connectionIdResult->second.empty();
             mConnectionIdMap.erase(connectionIdResult);
         }
+        if (hadIds) {
+            invalidateIds(mVariable);
+        }
         status = true;
     }
 
@@ -283,7 +292,11 @@ bool Variable::VariableImpl::unsetEquivalentTo(const VariablePtr &equivalentVari
 void Variable::VariableImpl::setEquivalentMappingId(const VariablePtr &equivalentVariable, const std::string &id)
 {
     VariableWeakPtr weakEquivalentVariable = equivalentVariable;
-    mMappingIdMap[weakEquivalentVariable] = id;
+    auto &mappingId = mMappingIdMap[weakEquivalentVariable];
+    if (mappingId != id) {
+        mappingId = id;
+        invalidateIds(mVariable);
+    }
 }
 
 std::string Variable::VariableImpl::equivalentMappingId(const VariablePtr &equivalentVariable) const
@@ -297,7 +310,11 @@ std::string Variable::VariableImpl::equivalentMappingId(const VariablePtr &equiv
 void Variable::VariableImpl::setEquivalentConnectionId(const VariablePtr &equivalentVariable, const std::string &id)
 {
     VariableWeakPtr weakEquivalentVariable = equivalentVariable;
-    mConnectionIdMap[weakEquivalentVariable] = id;
+    auto &connectionId = mConnectionIdMap[weakEquivalentVariable];
+    if (connectionId != id) {
+        connectionId = id;
+        invalidateIds(mVariable);
+    }
 }
 
 std::string Variable::VariableImpl::equivalentConnectionId(const VariablePtr &equivalentVariable) const
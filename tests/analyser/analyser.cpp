@@ -314,6 +314,35 @@ TEST(Analyser, nonInitialisedState)
     EXPECT_EQ(libcellml::AnalyserModel::Type::UNDERCONSTRAINED, analyser->model()->type());
 }
 
+TEST(Analyser, resetOfNonStateVariable)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("analyser/reset_of_non_state_variable.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    const std::vector<std::string> expectedIssues = {
+        "Variable 'k' in component 'my_component' is reset, but it is not a state variable.",
+    };
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ_ISSUES_CELLMLELEMENTTYPES_LEVELS_REFERENCERULES_URLS(expectedIssues,
+                                                                   expectedCellmlElementTypes(expectedIssues.size(), libcellml::CellmlElementType::RESET),
+                                                                   expectedLevels(expectedIssues.size(), libcellml::Issue::Level::ERROR),
+                                                                   expectedReferenceRules(expectedIssues.size(), libcellml::Issue::ReferenceRule::ANALYSER_RESET_VARIABLE_NOT_STATE),
+                                                                   expectedUrls(expectedIssues.size(), "https://libcellml.org/documentation/guides/latest/runtime_codes/index?issue=ANALYSER_RESET_VARIABLE_NOT_STATE"),
+                                                                   analyser);
+    EXPECT_EQ(model->component("my_component")->reset(0), analyser->issue(0)->item()->reset());
+
+    EXPECT_EQ(libcellml::AnalyserModel::Type::INVALID, analyser->model()->type());
+    EXPECT_EQ(size_t(0), analyser->model()->resetCount());
+    EXPECT_EQ(size_t(0), analyser->model()->resets().size());
+    EXPECT_EQ(nullptr, analyser->model()->reset(0));
+}
+
 TEST(Analyser, underconstrained)
 {
     auto parser = libcellml::Parser::create();
@@ -971,3 +1000,201 @@ TEST(Analyser, overconstrainedNlaSystem)
 
     EXPECT_EQ(libcellml::AnalyserModel::Type::OVERCONSTRAINED, analyser->model()->type());
 }
+
+TEST(Analyser, analyserVariableOfEquivalentVariables)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    auto analyserModel = analyser->model();
+    auto voi = analyserModel->voi();
+
+    EXPECT_EQ(voi, analyserModel->analyserVariable(model->component("environment")->variable("time")));
+    EXPECT_EQ(voi, analyserModel->analyserVariable(model->component("membrane")->variable("time")));
+    EXPECT_EQ(voi, analyserModel->analyserVariable(model->component("sodium_channel_m_gate")->variable("time")));
+
+    auto v = analyserModel->analyserVariable(model->component("membrane")->variable("V"));
+
+    EXPECT_EQ(libcellml::AnalyserVariable::Type::STATE, v->type());
+    EXPECT_EQ(v, analyserModel->analyserVariable(model->component("sodium_channel")->variable("V")));
+    EXPECT_EQ(v, analyserModel->analyserVariable(model->component("leakage_current")->variable("V")));
+
+    for (const auto &variable : analyserModel->variables()) {
+        EXPECT_EQ(variable, analyserModel->analyserVariable(variable->variable()));
+    }
+
+    EXPECT_EQ(nullptr, analyserModel->analyserVariable(libcellml::Variable::create("V")));
+    EXPECT_EQ(nullptr, analyserModel->analyserVariable(nullptr));
+}
+
+TEST(Analyser, odesLinearInTheirState)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    auto analyserModel = analyser->model();
+
+    // All the ODEs of the HH52 model are linear in their state, i.e. the gating
+    // equations, but also the membrane equation, since each current is linear
+    // in the membrane potential.
+
+    for (const auto &equation : analyserModel->equations()) {
+        EXPECT_EQ(equation->type() == libcellml::AnalyserEquation::Type::ODE, equation->isLinearInState());
+    }
+
+    // The rate of y1 in the Robertson model is linear in y1, while the rate of
+    // y2 is not linear in y2 and the rate of y3 doesn't depend on y3.
+
+    model = parser->parseModel(fileContents("generator/robertson_model_1966/model.ode.cellml"));
+
+    analyser->analyseModel(model);
+
+    analyserModel = analyser->model();
+
+    EXPECT_FALSE(analyserModel->state(0)->equation(0)->isLinearInState());
+    EXPECT_FALSE(analyserModel->state(1)->equation(0)->isLinearInState());
+    EXPECT_TRUE(analyserModel->state(2)->equation(0)->isLinearInState());
+
+    // The rates of the DAE version of the HH52 model are computed using NLA
+    // systems, so none of them is considered to be linear in its state.
+
+    model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.cellml"));
+
+    analyser->analyseModel(model);
+
+    analyserModel = analyser->model();
+
+    for (const auto &equation : analyserModel->equations()) {
+        EXPECT_FALSE(equation->isLinearInState());
+    }
+
+    // Whether an ODE is linear in its state can only be determined while its
+    // analyser model is around.
+
+    model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    analyser->analyseModel(model);
+
+    analyserModel = analyser->model();
+
+    auto testedEquation = analyserModel->state(0)->equation(0);
+    auto untestedEquation = analyserModel->state(1)->equation(0);
+
+    EXPECT_TRUE(testedEquation->isLinearInState());
+
+    analyser = nullptr;
+    analyserModel = nullptr;
+
+    EXPECT_TRUE(testedEquation->isLinearInState());
+    EXPECT_FALSE(untestedEquation->isLinearInState());
+}
+
+TEST(Analyser, resets)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/bouncing_ball/model.cellml"));
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    // The resets are listed in the order in which they are defined in the
+    // model, i.e. not by order.
+
+    auto analyserModel = analyser->model();
+    auto component = model->component("ball");
+
+    EXPECT_EQ(size_t(3), analyserModel->resetCount());
+    EXPECT_EQ(size_t(3), analyserModel->resets().size());
+    EXPECT_EQ(nullptr, analyserModel->reset(3));
+
+    auto reset = analyserModel->reset(0);
+
+    EXPECT_EQ(component->reset(0), reset->reset());
+    EXPECT_EQ(2, reset->order());
+    EXPECT_EQ(analyserModel->analyserVariable(component->variable("v")), reset->variable());
+    EXPECT_EQ(analyserModel->voi(), reset->testVariable());
+    EXPECT_EQ("t-t_kick", libcellml::Generator::equationCode(reset->conditionAst()));
+    EXPECT_EQ("v+v_kick", libcellml::Generator::equationCode(reset->resetValueAst()));
+
+    reset = analyserModel->reset(1);
+
+    EXPECT_EQ(1, reset->order());
+    EXPECT_EQ(libcellml::AnalyserVariable::Type::STATE, reset->variable()->type());
+    EXPECT_EQ(analyserModel->analyserVariable(component->variable("h")), reset->testVariable());
+    EXPECT_EQ("h-0.0", libcellml::Generator::equationCode(reset->conditionAst()));
+    EXPECT_EQ("-e*v", libcellml::Generator::equationCode(reset->resetValueAst()));
+
+    reset = analyserModel->reset(2);
+
+    EXPECT_EQ(analyserModel->analyserVariable(component->variable("x")), reset->variable());
+    EXPECT_EQ("r", libcellml::Generator::equationCode(reset->resetValueAst()));
+}
+
+TEST(Analyser, odesWithStepFunctionsOfTheirState)
+{
+    auto model = libcellml::Model::create("step_functions");
+    auto component = libcellml::Component::create("main");
+
+    model->addComponent(component);
+
+    for (const auto &name : {"t", "y1", "y2", "y3", "y4"}) {
+        auto variable = libcellml::Variable::create(name);
+
+        variable->setUnits("dimensionless");
+
+        if (std::string(name) != "t") {
+            variable->setInitialValue(0.5);
+        }
+
+        component->addVariable(variable);
+    }
+
+    component->setMath(
+        "<math xmlns=\"http://www.w3.org/1998/Math/MathML\" xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\">"
+        "  <apply>"
+        "    <eq/>"
+        "    <apply><diff/><bvar><ci>t</ci></bvar><ci>y1</ci></apply>"
+        "    <apply><plus/><ci>y1</ci><apply><floor/><ci>y1</ci></apply></apply>"
+        "  </apply>"
+        "  <apply>"
+        "    <eq/>"
+        "    <apply><diff/><bvar><ci>t</ci></bvar><ci>y2</ci></apply>"
+        "    <apply><minus/><apply><ceiling/><ci>y2</ci></apply><ci>y2</ci></apply>"
+        "  </apply>"
+        "  <apply>"
+        "    <eq/>"
+        "    <apply><diff/><bvar><ci>t</ci></bvar><ci>y3</ci></apply>"
+        "    <apply><rem/><ci>y3</ci><cn cellml:units=\"dimensionless\">2</cn></apply>"
+        "  </apply>"
+        "  <apply>"
+        "    <eq/>"
+        "    <apply><diff/><bvar><ci>t</ci></bvar><ci>y4</ci></apply>"
+        "    <apply><minus/><apply><floor/><ci>t</ci></apply><ci>y4</ci></apply>"
+        "  </apply>"
+        "</math>");
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+
+    // The derivative of a step function of a state is only zero almost
+    // everywhere, so an ODE that relies on one is not linear in its state, but
+    // a step function of the variable of integration is fine.
+
+    EXPECT_FALSE(analyserModel->state(0)->equation(0)->isLinearInState());
+    EXPECT_FALSE(analyserModel->state(1)->equation(0)->isLinearInState());
+    EXPECT_FALSE(analyserModel->state(2)->equation(0)->isLinearInState());
+    EXPECT_TRUE(analyserModel->state(3)->equation(0)->isLinearInState());
+}
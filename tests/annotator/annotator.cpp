@@ -2240,3 +2240,163 @@ TEST(Annotator, assignIdByAnyCellmlElement)
     EXPECT_EQ("b4da55", annotator->assignId(item));
     EXPECT_EQ(size_t(6), annotator->itemCount("duplicateId4"));
 }
+
+TEST(Annotator, changeIdsAfterAssigningIds)
+{
+    auto annotator = libcellml::Annotator::create();
+    auto model = libcellml::Model::create("model");
+    auto component1 = libcellml::Component::create("component1");
+    auto component2 = libcellml::Component::create("component2");
+    auto variable = libcellml::Variable::create("variable");
+
+    model->addComponent(component1);
+    model->addComponent(component2);
+    component1->addVariable(variable);
+
+    annotator->setModel(model);
+
+    EXPECT_EQ("b4da55", annotator->assignId(component1));
+    EXPECT_EQ(component1, annotator->component("b4da55"));
+
+    // Identifiers changed directly on the model must be picked up.
+
+    component1->setId("component1_id");
+
+    EXPECT_EQ(size_t(0), annotator->itemCount("b4da55"));
+    EXPECT_EQ(component1, annotator->component("component1_id"));
+
+    auto id = annotator->assignId(variable);
+
+    EXPECT_EQ(variable, annotator->variable(id));
+
+    variable->removeId();
+
+    EXPECT_EQ(nullptr, annotator->variable(id));
+
+    // So must items with an identifier being added to or removed from the
+    // model.
+
+    component2->setId("component2_id");
+
+    EXPECT_EQ(component2, annotator->component("component2_id"));
+
+    model->removeComponent(component2);
+
+    EXPECT_EQ(nullptr, annotator->component("component2_id"));
+    EXPECT_EQ(std::vector<std::string>({"component1_id"}), annotator->ids());
+}
+
+TEST(Annotator, changeIdsOfDescendantsAndImportSources)
+{
+    auto annotator = libcellml::Annotator::create();
+    auto model = libcellml::Model::create("model");
+    auto otherModel = libcellml::Model::create("other_model");
+    auto parent = libcellml::Component::create("parent");
+    auto child = libcellml::Component::create("child");
+    auto importedComponent = libcellml::Component::create("imported_component");
+    auto importSource = libcellml::ImportSource::create();
+    auto otherComponent = libcellml::Component::create("other_component");
+
+    importSource->setUrl("some-other-model.xml");
+    importedComponent->setImportSource(importSource);
+    importedComponent->setImportReference("some_component");
+
+    parent->addComponent(child);
+    model->addComponent(parent);
+    model->addComponent(importedComponent);
+    otherModel->addComponent(otherComponent);
+
+    annotator->setModel(model);
+
+    EXPECT_EQ(size_t(0), annotator->ids().size());
+
+    // Identifiers changed in another model must not get in the way.
+
+    otherComponent->setId("other_component_id");
+
+    EXPECT_EQ(size_t(0), annotator->ids().size());
+
+    // Identifiers changed deep in the model must be picked up.
+
+    child->setId("child_id");
+
+    EXPECT_EQ(child, annotator->component("child_id"));
+
+    // So must identifiers changed on an import source, which is not owned by
+    // any model.
+
+    importSource->setId("import_source_id");
+
+    EXPECT_EQ(importSource, annotator->importSource("import_source_id"));
+
+    // So must items with an identifier being added to the model as part of a
+    // component.
+
+    auto variable = libcellml::Variable::create("variable");
+    auto detachedComponent = libcellml::Component::create("detached_component");
+
+    variable->setId("variable_id");
+    detachedComponent->addVariable(variable);
+    child->addComponent(detachedComponent);
+
+    EXPECT_EQ(variable, annotator->variable("variable_id"));
+
+    child->removeComponent(detachedComponent);
+
+    EXPECT_EQ(nullptr, annotator->variable("variable_id"));
+}
+
+TEST(Annotator, changeIdsOfEntitiesMovedBetweenModels)
+{
+    auto annotator = libcellml::Annotator::create();
+    auto model = libcellml::Model::create("model");
+    auto otherModel = libcellml::Model::create("other_model");
+    auto component = libcellml::Component::create("component");
+    auto reset = libcellml::Reset::create();
+    auto variable = libcellml::Variable::create("variable");
+
+    component->addReset(reset);
+    component->addVariable(variable);
+    otherModel->addComponent(component);
+
+    annotator->setModel(model);
+
+    EXPECT_EQ(size_t(0), annotator->ids().size());
+
+    // Identifiers changed on the entities of another model must not show up,
+    // but they must once those entities are moved to our model.
+
+    reset->setId("reset_id");
+    variable->setId("variable_id");
+
+    EXPECT_EQ(size_t(0), annotator->ids().size());
+
+    model->addComponent(component);
+
+    EXPECT_EQ(reset, annotator->reset("reset_id"));
+    EXPECT_EQ(variable, annotator->variable("variable_id"));
+
+    // Identifiers changed directly on the model, however many, must be
+    // picked up, including duplicate ones.
+
+    for (size_t i = 0; i < 2000; ++i) {
+        variable->setId("variable_id_" + std::to_string(i));
+        reset->setId("variable_id_" + std::to_string(i));
+
+        EXPECT_EQ(size_t(2), annotator->itemCount("variable_id_" + std::to_string(i)));
+    }
+
+    component->setId("variable_id_1999");
+
+    EXPECT_EQ(size_t(3), annotator->itemCount("variable_id_1999"));
+
+    reset->removeId();
+    variable->removeId();
+
+    EXPECT_EQ(component, annotator->component("variable_id_1999"));
+    EXPECT_EQ(std::vector<std::string>({"variable_id_1999"}), annotator->ids());
+
+    otherModel->addComponent(component);
+
+    EXPECT_EQ(size_t(0), annotator->ids().size());
+}
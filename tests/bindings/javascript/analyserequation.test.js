@@ -49,6 +49,9 @@ describe("Analyser Equation tests", () => {
     test('Checking Analyser Equation isStateRateBased.', () => {
         expect(eqn.isStateRateBased()).toBe(false)
     });
+    test('Checking Analyser Equation isLinearInState.', () => {
+        expect(eqn.isLinearInState()).toBe(false)
+    });
     test('Checking Analyser Equation dependencyCount.', () => {
         expect(eqn.dependencyCount()).toBe(0)
     });
@@ -56,6 +56,11 @@ describe("Analyser Model tests", () => {
         expect(am.equations().get(1).type().value).toBe(libcellml.AnalyserEquation.Type.ODE.value)
         expect(am.equation(1).type().value).toBe(libcellml.AnalyserEquation.Type.ODE.value)
     });
+    test('Checking Analyser Model resets related API.', () => {
+        expect(am.resetCount()).toBe(0)
+        expect(am.resets().size()).toBe(0)
+        expect(am.reset(0)).toBe(null)
+    });
     test('Checking Analyser Model states related API.', () => {
         expect(am.stateCount()).toBe(4)
         expect(am.states().size()).toBe(4)
@@ -65,6 +70,7 @@ describe("Analyser Model tests", () => {
         expect(am.variableCount()).toBe(18)
         expect(am.variables().size()).toBe(18)
         expect(am.variable(2).variable().name()).toBe("i_L")
+        expect(am.analyserVariable(am.variable(2).variable()).variable().name()).toBe("i_L")
     });
     test('Checking Analyser Model need* API.', () => {
         expect(am.needEqFunction()).toBe(false)
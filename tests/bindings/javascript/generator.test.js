@@ -74,4 +74,113 @@ describe("Generator tests", () => {
         const equation_line_2 = libcellml.Generator.equationCodeByProfile(a.model().equation(0).ast(), gp)
         expect(equation_line_2.length).toBe(14)
     })
+    test('Checking Generator Jacobian generation.', () => {
+        const g = new libcellml.Generator()
+        const p = new libcellml.Parser(true)
+
+        m = p.parseModel(basicModel)
+        a = new libcellml.Analyser()
+
+        a.analyseModel(m)
+
+        g.setModel(a.model())
+
+        expect(g.isJacobianGenerated()).toBe(false)
+        expect(g.implementationCode()).not.toContain("computeJacobian")
+
+        g.setJacobianGenerated(true)
+
+        expect(g.isJacobianGenerated()).toBe(true)
+        expect(g.interfaceCode()).toContain("computeJacobian")
+        expect(g.implementationCode()).toContain("computeJacobian")
+    })
+    test('Checking Generator Jacobian sparsity pattern generation.', () => {
+        const g = new libcellml.Generator()
+        const p = new libcellml.Parser(true)
+
+        m = p.parseModel(basicModel)
+        a = new libcellml.Analyser()
+
+        a.analyseModel(m)
+
+        g.setModel(a.model())
+
+        expect(g.isJacobianSparsityPatternGenerated()).toBe(false)
+
+        g.setJacobianSparsityPatternGenerated(true)
+
+        expect(g.isJacobianSparsityPatternGenerated()).toBe(true)
+    })
+    test('Checking Generator variables array split.', () => {
+        const g = new libcellml.Generator()
+        const p = new libcellml.Parser(true)
+
+        m = p.parseModel(basicModel)
+        a = new libcellml.Analyser()
+
+        a.analyseModel(m)
+
+        g.setModel(a.model())
+
+        expect(g.isVariablesArraySplit()).toBe(false)
+
+        g.setVariablesArraySplit(true)
+
+        expect(g.isVariablesArraySplit()).toBe(true)
+        expect(g.interfaceCode()).toContain("createConstantsArray")
+        expect(g.implementationCode()).toContain("createAlgebraicArray")
+    })
+    test('Checking Generator gating coefficients generation.', () => {
+        const g = new libcellml.Generator()
+        const p = new libcellml.Parser(true)
+
+        m = p.parseModel(basicModel)
+        a = new libcellml.Analyser()
+
+        a.analyseModel(m)
+
+        g.setModel(a.model())
+
+        expect(g.isGatingCoefficientsGenerated()).toBe(false)
+
+        g.setGatingCoefficientsGenerated(true)
+
+        expect(g.isGatingCoefficientsGenerated()).toBe(true)
+        expect(g.implementationCode()).not.toContain("computeGatingCoefficients")
+    })
+    test('Checking Generator root functions generation.', () => {
+        const g = new libcellml.Generator()
+        const p = new libcellml.Parser(true)
+
+        m = p.parseModel(basicModel)
+        a = new libcellml.Analyser()
+
+        a.analyseModel(m)
+
+        g.setModel(a.model())
+
+        expect(g.isRootFunctionsGenerated()).toBe(false)
+
+        g.setRootFunctionsGenerated(true)
+
+        expect(g.isRootFunctionsGenerated()).toBe(true)
+        expect(g.implementationCode()).not.toContain("computeRootFunctions")
+    })
+    test('Checking Generator Newton solvers generation.', () => {
+        const g = new libcellml.Generator()
+        const p = new libcellml.Parser(true)
+
+        m = p.parseModel(basicModel)
+        a = new libcellml.Analyser()
+
+        a.analyseModel(m)
+
+        g.setModel(a.model())
+
+        expect(g.isNewtonSolversGenerated()).toBe(false)
+
+        g.setNewtonSolversGenerated(true)
+
+        expect(g.isNewtonSolversGenerated()).toBe(true)
+    })
 })
@@ -29,6 +29,10 @@ describe("GeneratorProfile tests", () => {
     x.setProfile(libcellml.GeneratorProfile.Profile.PYTHON)
     expect(x.profile()).toBe(libcellml.GeneratorProfile.Profile.PYTHON)
     expect(libcellml.GeneratorProfile.profileAsString(x.profile())).toBe("python")
+
+    x.setProfile(libcellml.GeneratorProfile.Profile.NUMPY)
+    expect(x.profile()).toBe(libcellml.GeneratorProfile.Profile.NUMPY)
+    expect(libcellml.GeneratorProfile.profileAsString(x.profile())).toBe("numpy")
   });
   test("Checking GeneratorProfile.hasInterface.", () => {
     const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
@@ -696,6 +700,42 @@ describe("GeneratorProfile tests", () => {
     x.setImplementationVariableCountString("something")
     expect(x.implementationVariableCountString()).toBe("something")
   });
+  test("Checking GeneratorProfile.interfaceConstantCountString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceConstantCountString("something")
+    expect(x.interfaceConstantCountString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationConstantCountString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationConstantCountString("something")
+    expect(x.implementationConstantCountString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceComputedConstantCountString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceComputedConstantCountString("something")
+    expect(x.interfaceComputedConstantCountString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationComputedConstantCountString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationComputedConstantCountString("something")
+    expect(x.implementationComputedConstantCountString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceAlgebraicCountString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceAlgebraicCountString("something")
+    expect(x.interfaceAlgebraicCountString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationAlgebraicCountString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationAlgebraicCountString("something")
+    expect(x.implementationAlgebraicCountString()).toBe("something")
+  });
   test("Checking GeneratorProfile.variableTypeObjectString.", () => {
     const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
 
@@ -786,6 +826,42 @@ describe("GeneratorProfile tests", () => {
     x.setImplementationVariableInfoString("something")
     expect(x.implementationVariableInfoString()).toBe("something")
   });
+  test("Checking GeneratorProfile.interfaceConstantInfoString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceConstantInfoString("something")
+    expect(x.interfaceConstantInfoString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationConstantInfoString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationConstantInfoString("something")
+    expect(x.implementationConstantInfoString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceComputedConstantInfoString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceComputedConstantInfoString("something")
+    expect(x.interfaceComputedConstantInfoString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationComputedConstantInfoString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationComputedConstantInfoString("something")
+    expect(x.implementationComputedConstantInfoString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceAlgebraicInfoString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceAlgebraicInfoString("something")
+    expect(x.interfaceAlgebraicInfoString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationAlgebraicInfoString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationAlgebraicInfoString("something")
+    expect(x.implementationAlgebraicInfoString()).toBe("something")
+  });
   test("Checking GeneratorProfile.variableInfoEntryString.", () => {
     const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
 
@@ -843,6 +919,30 @@ describe("GeneratorProfile tests", () => {
     x.setObjectiveFunctionMethodString(true, "something")
     expect(x.objectiveFunctionMethodString(true)).toBe("something")
   });
+  test("Checking GeneratorProfile.objectiveJacobianMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setObjectiveJacobianMethodString(false, "something")
+    expect(x.objectiveJacobianMethodString(false)).toBe("something")
+
+    x.setObjectiveJacobianMethodString(true, "something")
+    expect(x.objectiveJacobianMethodString(true)).toBe("something")
+  });
+  test("Checking GeneratorProfile.finiteDifferenceObjectiveJacobianMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setFiniteDifferenceObjectiveJacobianMethodString("something")
+    expect(x.finiteDifferenceObjectiveJacobianMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.newtonSolveCallString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setNewtonSolveCallString(false, "something")
+    expect(x.newtonSolveCallString(false)).toBe("something")
+
+    x.setNewtonSolveCallString(true, "something")
+    expect(x.newtonSolveCallString(true)).toBe("something")
+  });
   test("Checking GeneratorProfile.uArrayString.", () => {
     const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
 
@@ -855,6 +955,102 @@ describe("GeneratorProfile tests", () => {
     x.setFArrayString("something")
     expect(x.fArrayString()).toBe("something")
   });
+  test("Checking GeneratorProfile.jacobianArrayString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setJacobianArrayString("something")
+    expect(x.jacobianArrayString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.steadyStatesArrayString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setSteadyStatesArrayString("something")
+    expect(x.steadyStatesArrayString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.timeConstantsArrayString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setTimeConstantsArrayString("something")
+    expect(x.timeConstantsArrayString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.conditionsArrayString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setConditionsArrayString("something")
+    expect(x.conditionsArrayString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.eventsArrayString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setEventsArrayString("something")
+    expect(x.eventsArrayString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.resetValuesArrayString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setResetValuesArrayString("something")
+    expect(x.resetValuesArrayString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.rootFunctionsArrayString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setRootFunctionsArrayString("something")
+    expect(x.rootFunctionsArrayString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceJacobianSparsityPatternString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceJacobianSparsityPatternString("something")
+    expect(x.interfaceJacobianSparsityPatternString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationJacobianSparsityPatternString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationJacobianSparsityPatternString("something")
+    expect(x.implementationJacobianSparsityPatternString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.objectiveJacobianSparsityPatternString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setObjectiveJacobianSparsityPatternString("something")
+    expect(x.objectiveJacobianSparsityPatternString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceGatingStateIndicesString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceGatingStateIndicesString("something")
+    expect(x.interfaceGatingStateIndicesString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationGatingStateIndicesString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationGatingStateIndicesString("something")
+    expect(x.implementationGatingStateIndicesString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceEventCountString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceEventCountString("something")
+    expect(x.interfaceEventCountString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationEventCountString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationEventCountString("something")
+    expect(x.implementationEventCountString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceRootFunctionCountString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceRootFunctionCountString("something")
+    expect(x.interfaceRootFunctionCountString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationRootFunctionCountString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationRootFunctionCountString("something")
+    expect(x.implementationRootFunctionCountString()).toBe("something")
+  });
   test("Checking GeneratorProfile.voiString.", () => {
     const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
 
@@ -879,6 +1075,42 @@ describe("GeneratorProfile tests", () => {
     x.setVariablesArrayString("something")
     expect(x.variablesArrayString()).toBe("something")
   });
+  test("Checking GeneratorProfile.constantsArrayString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setConstantsArrayString("something")
+    expect(x.constantsArrayString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.computedConstantsArrayString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setComputedConstantsArrayString("something")
+    expect(x.computedConstantsArrayString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.algebraicArrayString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setAlgebraicArrayString("something")
+    expect(x.algebraicArrayString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.variablesParameterString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setVariablesParameterString("something")
+    expect(x.variablesParameterString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.variablesMemberString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setVariablesMemberString("something")
+    expect(x.variablesMemberString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.variablesDataString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setVariablesDataString("something")
+    expect(x.variablesDataString()).toBe("something")
+  });
   test("Checking GeneratorProfile.externalVariableMethodTypeDefinitionString.", () => {
     const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
 
@@ -921,6 +1153,42 @@ describe("GeneratorProfile tests", () => {
     x.setImplementationCreateVariablesArrayMethodString("something")
     expect(x.implementationCreateVariablesArrayMethodString()).toBe("something")
   });
+  test("Checking GeneratorProfile.interfaceCreateConstantsArrayMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceCreateConstantsArrayMethodString("something")
+    expect(x.interfaceCreateConstantsArrayMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationCreateConstantsArrayMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationCreateConstantsArrayMethodString("something")
+    expect(x.implementationCreateConstantsArrayMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceCreateComputedConstantsArrayMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceCreateComputedConstantsArrayMethodString("something")
+    expect(x.interfaceCreateComputedConstantsArrayMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationCreateComputedConstantsArrayMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationCreateComputedConstantsArrayMethodString("something")
+    expect(x.implementationCreateComputedConstantsArrayMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceCreateAlgebraicArrayMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceCreateAlgebraicArrayMethodString("something")
+    expect(x.interfaceCreateAlgebraicArrayMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationCreateAlgebraicArrayMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationCreateAlgebraicArrayMethodString("something")
+    expect(x.implementationCreateAlgebraicArrayMethodString()).toBe("something")
+  });
   test("Checking GeneratorProfile.interfaceDeleteArrayMethodString.", () => {
     const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
 
@@ -1023,6 +1291,66 @@ describe("GeneratorProfile tests", () => {
     x.setImplementationComputeVariablesMethodString(true, true, "something")
     expect(x.implementationComputeVariablesMethodString(true, true)).toBe("something")
   });
+  test("Checking GeneratorProfile.interfaceComputeJacobianMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceComputeJacobianMethodString("something")
+    expect(x.interfaceComputeJacobianMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationComputeJacobianMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationComputeJacobianMethodString("something")
+    expect(x.implementationComputeJacobianMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceComputeGatingCoefficientsMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceComputeGatingCoefficientsMethodString("something")
+    expect(x.interfaceComputeGatingCoefficientsMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationComputeGatingCoefficientsMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationComputeGatingCoefficientsMethodString("something")
+    expect(x.implementationComputeGatingCoefficientsMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceComputeEventConditionsMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceComputeEventConditionsMethodString("something")
+    expect(x.interfaceComputeEventConditionsMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationComputeEventConditionsMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationComputeEventConditionsMethodString("something")
+    expect(x.implementationComputeEventConditionsMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceApplyResetsMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceApplyResetsMethodString("something")
+    expect(x.interfaceApplyResetsMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationApplyResetsMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationApplyResetsMethodString("something")
+    expect(x.implementationApplyResetsMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceComputeRootFunctionsMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceComputeRootFunctionsMethodString("something")
+    expect(x.interfaceComputeRootFunctionsMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationComputeRootFunctionsMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationComputeRootFunctionsMethodString("something")
+    expect(x.implementationComputeRootFunctionsMethodString()).toBe("something")
+  });
   test("Checking GeneratorProfile.emptyMethodString.", () => {
     const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
 
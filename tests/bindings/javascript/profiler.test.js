@@ -0,0 +1,61 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+const loadLibCellML = require('libcellml.js/libcellml.common')
+const { basicModel } = require('./resources')
+
+let libcellml = null
+
+describe("Profiler tests", () => {
+    beforeAll(async () => {
+        libcellml = await loadLibCellML()
+    })
+    test('Checking Profiler phase as string.', () => {
+        expect(libcellml.Profiler.phaseAsString(libcellml.Profiler.Phase.VALIDATE_MATH)).toBe("validate_math")
+        expect(libcellml.Profiler.phaseAsString(libcellml.Profiler.Phase.ADD_NLA_SYSTEMS_CODE)).toBe("add_nla_systems_code")
+    })
+    test('Checking Profiler collection.', () => {
+        const profiler = new libcellml.Profiler()
+        const p = new libcellml.Parser(true)
+
+        expect(p.profiler()).toBe(null)
+
+        p.setProfiler(profiler)
+
+        const m = p.parseModel(basicModel)
+        const a = new libcellml.Analyser()
+
+        a.setProfiler(profiler)
+        a.analyseModel(m)
+
+        const g = new libcellml.Generator()
+
+        g.setProfiler(profiler)
+        g.setModel(a.model())
+        g.implementationCode()
+
+        expect(profiler.callCount(libcellml.Profiler.Phase.PARSE_MODEL)).toBe(1)
+        expect(profiler.callCount(libcellml.Profiler.Phase.VALIDATE_MODEL)).toBe(1)
+        expect(profiler.callCount(libcellml.Profiler.Phase.ANALYSE_MODEL)).toBe(1)
+        expect(profiler.callCount(libcellml.Profiler.Phase.GENERATE_IMPLEMENTATION_CODE)).toBe(1)
+        expect(profiler.elapsedTime(libcellml.Profiler.Phase.ANALYSE_MODEL)).toBeGreaterThan(0)
+        expect(profiler.allocationCount(libcellml.Profiler.Phase.ANALYSE_MODEL)).toBe(0)
+
+        profiler.reset()
+
+        expect(profiler.callCount(libcellml.Profiler.Phase.PARSE_MODEL)).toBe(0)
+    })
+})
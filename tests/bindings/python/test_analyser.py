@@ -118,6 +118,7 @@ class AnalyserTestCase(unittest.TestCase):
         self.assertEqual(17, am.variableCount())
         self.assertIsNotNone(am.variables())
         self.assertIsNotNone(am.variable(3))
+        self.assertEqual(am.variable(3).variable().name(), am.analyserVariable(am.variable(3).variable()).variable().name())
 
         self.assertEqual(16, am.equationCount())
         self.assertIsNotNone(am.equations())
@@ -180,6 +181,7 @@ class AnalyserTestCase(unittest.TestCase):
         self.assertIsNotNone(ae.nlaSiblings())
         self.assertIsNone(ae.nlaSibling(0))
         self.assertTrue(ae.isStateRateBased())
+        self.assertFalse(ae.isLinearInState())
         self.assertEqual(1, ae.variableCount())
         self.assertIsNotNone(ae.variables())
         self.assertIsNotNone(ae.variable(0))
@@ -221,6 +223,39 @@ class AnalyserTestCase(unittest.TestCase):
         self.assertIsNone(aea.leftChild())
         self.assertIsNone(aea.rightChild())
 
+    def test_resets(self):
+        from libcellml import Analyser
+        from libcellml import AnalyserReset
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        # Try to create an analyser reset, something that is not allowed.
+
+        self.assertRaises(AttributeError, AnalyserReset)
+
+        # Analyse a model with some resets.
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/bouncing_ball/model.cellml'))
+
+        a = Analyser()
+        a.analyseModel(m)
+
+        am = a.model()
+
+        self.assertEqual(3, am.resetCount())
+        self.assertIsNotNone(am.resets())
+        self.assertIsNone(am.reset(3))
+
+        ar = am.reset(1)
+
+        self.assertIsNotNone(ar.reset())
+        self.assertEqual(1, ar.order())
+        self.assertEqual("v", ar.variable().variable().name())
+        self.assertEqual("h", ar.testVariable().variable().name())
+        self.assertIsNotNone(ar.conditionAst())
+        self.assertIsNotNone(ar.resetValueAst())
+
 
 if __name__ == '__main__':
     unittest.main()
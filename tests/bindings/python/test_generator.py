@@ -55,6 +55,168 @@ class GeneratorTestCase(unittest.TestCase):
         self.assertEqual("x = a", Generator.equationCode(am.equation(0).ast()))
         self.assertEqual("x = a", Generator_equationCode(am.equation(0).ast()))
 
+    def test_jacobian(self):
+        from libcellml import Analyser
+        from libcellml import Generator
+        from libcellml import GeneratorProfile
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+
+        a = Analyser()
+        a.analyseModel(m)
+
+        g = Generator()
+
+        self.assertFalse(g.isJacobianGenerated())
+
+        g.setModel(a.model())
+        g.setJacobianGenerated(True)
+
+        self.assertTrue(g.isJacobianGenerated())
+
+        profile = GeneratorProfile(GeneratorProfile.Profile.PYTHON)
+        g.setProfile(profile)
+
+        self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.jacobian.py"), g.implementationCode())
+
+    def test_jacobian_sparsity_pattern(self):
+        from libcellml import Analyser
+        from libcellml import Generator
+        from libcellml import GeneratorProfile
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+
+        a = Analyser()
+        a.analyseModel(m)
+
+        g = Generator()
+
+        self.assertFalse(g.isJacobianSparsityPatternGenerated())
+
+        g.setModel(a.model())
+        g.setJacobianSparsityPatternGenerated(True)
+
+        self.assertTrue(g.isJacobianSparsityPatternGenerated())
+
+        profile = GeneratorProfile(GeneratorProfile.Profile.PYTHON)
+        g.setProfile(profile)
+
+        self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.sparsity.py"), g.implementationCode())
+
+
+    def test_variables_array_split(self):
+        from libcellml import Analyser
+        from libcellml import Generator
+        from libcellml import GeneratorProfile
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+
+        a = Analyser()
+        a.analyseModel(m)
+
+        g = Generator()
+
+        self.assertFalse(g.isVariablesArraySplit())
+
+        g.setModel(a.model())
+        g.setVariablesArraySplit(True)
+
+        self.assertTrue(g.isVariablesArraySplit())
+
+        profile = GeneratorProfile(GeneratorProfile.Profile.PYTHON)
+        g.setProfile(profile)
+
+        self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.split.py"), g.implementationCode())
+
+    def test_gating_coefficients(self):
+        from libcellml import Analyser
+        from libcellml import Generator
+        from libcellml import GeneratorProfile
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+
+        a = Analyser()
+        a.analyseModel(m)
+
+        g = Generator()
+
+        self.assertFalse(g.isGatingCoefficientsGenerated())
+
+        g.setModel(a.model())
+        g.setGatingCoefficientsGenerated(True)
+
+        self.assertTrue(g.isGatingCoefficientsGenerated())
+
+        profile = GeneratorProfile(GeneratorProfile.Profile.PYTHON)
+        g.setProfile(profile)
+
+        self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.gating.py"), g.implementationCode())
+
+    def test_root_functions(self):
+        from libcellml import Analyser
+        from libcellml import Generator
+        from libcellml import GeneratorProfile
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+
+        a = Analyser()
+        a.analyseModel(m)
+
+        g = Generator()
+
+        self.assertFalse(g.isRootFunctionsGenerated())
+
+        g.setModel(a.model())
+        g.setRootFunctionsGenerated(True)
+
+        self.assertTrue(g.isRootFunctionsGenerated())
+
+        profile = GeneratorProfile(GeneratorProfile.Profile.PYTHON)
+        g.setProfile(profile)
+
+        self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.root_functions.py"), g.implementationCode())
+
+    def test_newton_solvers(self):
+        from libcellml import Analyser
+        from libcellml import Generator
+        from libcellml import GeneratorProfile
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.dae.cellml'))
+
+        a = Analyser()
+        a.analyseModel(m)
+
+        g = Generator()
+
+        self.assertFalse(g.isNewtonSolversGenerated())
+
+        g.setModel(a.model())
+        g.setNewtonSolversGenerated(True)
+
+        self.assertTrue(g.isNewtonSolversGenerated())
+
+        profile = GeneratorProfile(GeneratorProfile.Profile.PYTHON)
+        g.setProfile(profile)
+
+        self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.newton.py"), g.implementationCode())
 
 if __name__ == '__main__':
     unittest.main()
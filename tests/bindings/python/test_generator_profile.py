@@ -33,6 +33,12 @@ class GeneratorProfileTestCase(unittest.TestCase):
         pp = GeneratorProfile(GeneratorProfile.Profile.PYTHON)
         self.assertEqual(GeneratorProfile.Profile.PYTHON, pp.profile())
 
+        # Make the profile a NumPy profile.
+        p.setProfile(GeneratorProfile.Profile.NUMPY)
+        self.assertEqual(GeneratorProfile.Profile.NUMPY, p.profile())
+        self.assertEqual("numpy", GeneratorProfile.profileAsString(p.profile()))
+        self.assertEqual("numpy", GeneratorProfile_profileAsString(p.profile()))
+
     @unittest.skip('Create tests script')
     def test_create_tests(self):
         import re
@@ -812,6 +818,89 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setImplementationComputeVariablesMethodString(True, True, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputeVariablesMethodString(True, True))
 
+    def test_implementation_compute_jacobian_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual(
+            'void computeJacobian(double voi, double *states, double *rates, double *variables, double *jacobian)\n{\n[CODE]}\n',
+            g.implementationComputeJacobianMethodString())
+        g.setImplementationComputeJacobianMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputeJacobianMethodString())
+
+    def test_interface_compute_gating_coefficients_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void computeGatingCoefficients(double voi, double *states, double *rates, double *variables, double *steadyStates, double *timeConstants);\n', g.interfaceComputeGatingCoefficientsMethodString())
+        g.setInterfaceComputeGatingCoefficientsMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputeGatingCoefficientsMethodString())
+
+    def test_implementation_compute_gating_coefficients_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void computeGatingCoefficients(double voi, double *states, double *rates, double *variables, double *steadyStates, double *timeConstants)\n{\n[CODE]}\n', g.implementationComputeGatingCoefficientsMethodString())
+        g.setImplementationComputeGatingCoefficientsMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputeGatingCoefficientsMethodString())
+
+    def test_interface_compute_event_conditions_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void computeEventConditions(double voi, double *states, double *rates, double *variables, double *conditions);\n', g.interfaceComputeEventConditionsMethodString())
+        g.setInterfaceComputeEventConditionsMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputeEventConditionsMethodString())
+
+    def test_implementation_compute_event_conditions_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void computeEventConditions(double voi, double *states, double *rates, double *variables, double *conditions)\n{\n[CODE]}\n', g.implementationComputeEventConditionsMethodString())
+        g.setImplementationComputeEventConditionsMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputeEventConditionsMethodString())
+
+    def test_interface_apply_resets_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void applyResets(double voi, double *states, double *rates, double *variables, int *events);\n', g.interfaceApplyResetsMethodString())
+        g.setInterfaceApplyResetsMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceApplyResetsMethodString())
+
+    def test_implementation_apply_resets_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void applyResets(double voi, double *states, double *rates, double *variables, int *events)\n{\n    double resetValues[[RESET_VARIABLE_COUNT]];\n\n[CODE]}\n', g.implementationApplyResetsMethodString())
+        g.setImplementationApplyResetsMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationApplyResetsMethodString())
+
+    def test_interface_compute_root_functions_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void computeRootFunctions(double voi, double *states, double *rates, double *variables, double *g);\n', g.interfaceComputeRootFunctionsMethodString())
+        g.setInterfaceComputeRootFunctionsMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputeRootFunctionsMethodString())
+
+    def test_implementation_compute_root_functions_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void computeRootFunctions(double voi, double *states, double *rates, double *variables, double *g)\n{\n[CODE]}\n', g.implementationComputeRootFunctionsMethodString())
+        g.setImplementationComputeRootFunctionsMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputeRootFunctionsMethodString())
+
     def test_implementation_create_states_array_method_string(self):
         from libcellml import GeneratorProfile
 
@@ -834,6 +923,60 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setImplementationCreateVariablesArrayMethodString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationCreateVariablesArrayMethodString())
 
+    def test_interface_create_constants_array_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('double * createConstantsArray();\n', g.interfaceCreateConstantsArrayMethodString())
+        g.setInterfaceCreateConstantsArrayMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceCreateConstantsArrayMethodString())
+
+    def test_implementation_create_constants_array_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('double * createConstantsArray()\n{\n    double *res = (double *) malloc(CONSTANT_COUNT*sizeof(double));\n\n    for (size_t i = 0; i < CONSTANT_COUNT; ++i) {\n        res[i] = NAN;\n    }\n\n    return res;\n}\n', g.implementationCreateConstantsArrayMethodString())
+        g.setImplementationCreateConstantsArrayMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationCreateConstantsArrayMethodString())
+
+    def test_interface_create_computed_constants_array_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('double * createComputedConstantsArray();\n', g.interfaceCreateComputedConstantsArrayMethodString())
+        g.setInterfaceCreateComputedConstantsArrayMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceCreateComputedConstantsArrayMethodString())
+
+    def test_implementation_create_computed_constants_array_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('double * createComputedConstantsArray()\n{\n    double *res = (double *) malloc(COMPUTED_CONSTANT_COUNT*sizeof(double));\n\n    for (size_t i = 0; i < COMPUTED_CONSTANT_COUNT; ++i) {\n        res[i] = NAN;\n    }\n\n    return res;\n}\n', g.implementationCreateComputedConstantsArrayMethodString())
+        g.setImplementationCreateComputedConstantsArrayMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationCreateComputedConstantsArrayMethodString())
+
+    def test_interface_create_algebraic_array_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('double * createAlgebraicArray();\n', g.interfaceCreateAlgebraicArrayMethodString())
+        g.setInterfaceCreateAlgebraicArrayMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceCreateAlgebraicArrayMethodString())
+
+    def test_implementation_create_algebraic_array_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('double * createAlgebraicArray()\n{\n    double *res = (double *) malloc(ALGEBRAIC_COUNT*sizeof(double));\n\n    for (size_t i = 0; i < ALGEBRAIC_COUNT; ++i) {\n        res[i] = NAN;\n    }\n\n    return res;\n}\n', g.implementationCreateAlgebraicArrayMethodString())
+        g.setImplementationCreateAlgebraicArrayMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationCreateAlgebraicArrayMethodString())
+
     def test_implementation_delete_array_method_string(self):
         from libcellml import GeneratorProfile
 
@@ -916,6 +1059,60 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setImplementationVariableCountString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationVariableCountString())
 
+    def test_interface_constant_count_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('extern const size_t CONSTANT_COUNT;\n', g.interfaceConstantCountString())
+        g.setInterfaceConstantCountString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceConstantCountString())
+
+    def test_implementation_constant_count_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('const size_t CONSTANT_COUNT = [CONSTANT_COUNT];\n', g.implementationConstantCountString())
+        g.setImplementationConstantCountString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationConstantCountString())
+
+    def test_interface_computed_constant_count_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('extern const size_t COMPUTED_CONSTANT_COUNT;\n', g.interfaceComputedConstantCountString())
+        g.setInterfaceComputedConstantCountString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputedConstantCountString())
+
+    def test_implementation_computed_constant_count_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('const size_t COMPUTED_CONSTANT_COUNT = [COMPUTED_CONSTANT_COUNT];\n', g.implementationComputedConstantCountString())
+        g.setImplementationComputedConstantCountString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputedConstantCountString())
+
+    def test_interface_algebraic_count_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('extern const size_t ALGEBRAIC_COUNT;\n', g.interfaceAlgebraicCountString())
+        g.setInterfaceAlgebraicCountString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceAlgebraicCountString())
+
+    def test_implementation_algebraic_count_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('const size_t ALGEBRAIC_COUNT = [ALGEBRAIC_COUNT];\n', g.implementationAlgebraicCountString())
+        g.setImplementationAlgebraicCountString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationAlgebraicCountString())
+
     def test_implementation_variable_info_string(self):
         from libcellml import GeneratorProfile
 
@@ -926,6 +1123,60 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setImplementationVariableInfoString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationVariableInfoString())
 
+    def test_interface_constant_info_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('extern const VariableInfo CONSTANT_INFO[];\n', g.interfaceConstantInfoString())
+        g.setInterfaceConstantInfoString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceConstantInfoString())
+
+    def test_implementation_constant_info_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('const VariableInfo CONSTANT_INFO[] = {\n[CODE]};\n', g.implementationConstantInfoString())
+        g.setImplementationConstantInfoString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationConstantInfoString())
+
+    def test_interface_computed_constant_info_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('extern const VariableInfo COMPUTED_CONSTANT_INFO[];\n', g.interfaceComputedConstantInfoString())
+        g.setInterfaceComputedConstantInfoString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputedConstantInfoString())
+
+    def test_implementation_computed_constant_info_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('const VariableInfo COMPUTED_CONSTANT_INFO[] = {\n[CODE]};\n', g.implementationComputedConstantInfoString())
+        g.setImplementationComputedConstantInfoString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputedConstantInfoString())
+
+    def test_interface_algebraic_info_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('extern const VariableInfo ALGEBRAIC_INFO[];\n', g.interfaceAlgebraicInfoString())
+        g.setInterfaceAlgebraicInfoString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceAlgebraicInfoString())
+
+    def test_implementation_algebraic_info_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('const VariableInfo ALGEBRAIC_INFO[] = {\n[CODE]};\n', g.implementationAlgebraicInfoString())
+        g.setImplementationAlgebraicInfoString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationAlgebraicInfoString())
+
     def test_implementation_version_string(self):
         from libcellml import GeneratorProfile
 
@@ -1018,6 +1269,17 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setInterfaceComputeVariablesMethodString(True, True, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputeVariablesMethodString(True, True))
 
+    def test_interface_compute_jacobian_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual(
+            'void computeJacobian(double voi, double *states, double *rates, double *variables, double *jacobian);\n',
+            g.interfaceComputeJacobianMethodString())
+        g.setInterfaceComputeJacobianMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputeJacobianMethodString())
+
     def test_interface_create_states_array_method_string(self):
         from libcellml import GeneratorProfile
 
@@ -1580,6 +1842,60 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setVariablesArrayString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.variablesArrayString())
 
+    def test_constants_array_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('constants', g.constantsArrayString())
+        g.setConstantsArrayString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.constantsArrayString())
+
+    def test_computed_constants_array_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('computedConstants', g.computedConstantsArrayString())
+        g.setComputedConstantsArrayString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.computedConstantsArrayString())
+
+    def test_algebraic_array_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('algebraic', g.algebraicArrayString())
+        g.setAlgebraicArrayString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.algebraicArrayString())
+
+    def test_variables_parameter_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('double *[ARRAY]', g.variablesParameterString())
+        g.setVariablesParameterString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.variablesParameterString())
+
+    def test_variables_member_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('    double *[ARRAY];\n', g.variablesMemberString())
+        g.setVariablesMemberString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.variablesMemberString())
+
+    def test_variables_data_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('    double *[ARRAY] = ((RootFindingInfo *) data)->[ARRAY];\n', g.variablesDataString())
+        g.setVariablesDataString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.variablesDataString())
+
     def test_external_variable_method_type_definition_string(self):
         from libcellml import GeneratorProfile
 
@@ -1686,6 +2002,41 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setObjectiveFunctionMethodString(True, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.objectiveFunctionMethodString(True))
 
+    def test_objective_jacobian_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void objectiveJacobian[INDEX](double *u, double *jacobian, void *data)\n{\n    double *variables = ((RootFindingInfo *) data)->variables;\n\n[CODE]}\n', g.objectiveJacobianMethodString(False))
+        g.setObjectiveJacobianMethodString(False, GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.objectiveJacobianMethodString(False))
+
+        self.assertEqual('void objectiveJacobian[INDEX](double *u, double *jacobian, void *data)\n{\n    double voi = ((RootFindingInfo *) data)->voi;\n    double *states = ((RootFindingInfo *) data)->states;\n    double *rates = ((RootFindingInfo *) data)->rates;\n    double *variables = ((RootFindingInfo *) data)->variables;\n\n[CODE]}\n', g.objectiveJacobianMethodString(True))
+        g.setObjectiveJacobianMethodString(True, GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.objectiveJacobianMethodString(True))
+
+    def test_finite_difference_objective_jacobian_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void objectiveJacobian[INDEX](double *u, double *f, double *jacobian, void *data)\n{\n    double fh[[SIZE]];\n\n    for (size_t j = 0; j < [SIZE]; ++j) {\n        double uj = u[j];\n        double h = 1.0e-8*fmax(1.0, fabs(uj));\n\n        u[j] = uj+h;\n\n        objectiveFunction[INDEX](u, fh, data);\n\n        u[j] = uj;\n\n        for (size_t i = 0; i < [SIZE]; ++i) {\n            jacobian[i*[SIZE]+j] = (fh[i]-f[i])/h;\n        }\n    }\n}\n', g.finiteDifferenceObjectiveJacobianMethodString())
+        g.setFiniteDifferenceObjectiveJacobianMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.finiteDifferenceObjectiveJacobianMethodString())
+
+    def test_newton_solve_call_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('for (int iteration = 0; iteration < 50; ++iteration) {\n        double f[[SIZE]];\n        double jacobian[[SIZE]*[SIZE]];\n        int converged = 1;\n\n        objectiveFunction[INDEX](u, f, &rfi);\n\n        for (size_t i = 0; i < [SIZE]; ++i) {\n            converged = converged && (fabs(f[i]) <= 1.0e-10);\n        }\n\n        if (converged) {\n            break;\n        }\n\n        objectiveJacobian[INDEX](u, [F_ARGUMENT]jacobian, &rfi);\n\n[CODE]    }\n', g.newtonSolveCallString(False))
+        g.setNewtonSolveCallString(False, GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.newtonSolveCallString(False))
+
+        self.assertEqual('for (int iteration = 0; iteration < 50; ++iteration) {\n        double f[[SIZE]];\n        double jacobian[[SIZE]*[SIZE]];\n        int converged = 1;\n\n        objectiveFunction[INDEX](u, f, &rfi);\n\n        for (size_t i = 0; i < [SIZE]; ++i) {\n            converged = converged && (fabs(f[i]) <= 1.0e-10);\n        }\n\n        if (converged) {\n            break;\n        }\n\n        objectiveJacobian[INDEX](u, [F_ARGUMENT]jacobian, &rfi);\n\n[CODE]    }\n', g.newtonSolveCallString(True))
+        g.setNewtonSolveCallString(True, GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.newtonSolveCallString(True))
+
     def test_u_array_string(self):
         from libcellml import GeneratorProfile
 
@@ -1704,6 +2055,140 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setFArrayString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.fArrayString())
 
+    def test_jacobian_array_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('jacobian', g.jacobianArrayString())
+        g.setJacobianArrayString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.jacobianArrayString())
+
+    def test_steady_states_array_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('steadyStates', g.steadyStatesArrayString())
+        g.setSteadyStatesArrayString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.steadyStatesArrayString())
+
+    def test_time_constants_array_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('timeConstants', g.timeConstantsArrayString())
+        g.setTimeConstantsArrayString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.timeConstantsArrayString())
+
+    def test_conditions_array_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('conditions', g.conditionsArrayString())
+        g.setConditionsArrayString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.conditionsArrayString())
+
+    def test_events_array_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('events', g.eventsArrayString())
+        g.setEventsArrayString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.eventsArrayString())
+
+    def test_reset_values_array_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('resetValues', g.resetValuesArrayString())
+        g.setResetValuesArrayString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.resetValuesArrayString())
+
+    def test_root_functions_array_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('g', g.rootFunctionsArrayString())
+        g.setRootFunctionsArrayString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.rootFunctionsArrayString())
+
+    def test_jacobian_sparsity_pattern_strings(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('extern const size_t JACOBIAN_NONZERO_COUNT;\nextern const size_t JACOBIAN_ROW_POINTERS[];\nextern const size_t JACOBIAN_COLUMN_INDICES[];\nextern const size_t JACOBIAN_COLUMN_POINTERS[];\nextern const size_t JACOBIAN_ROW_INDICES[];\n', g.interfaceJacobianSparsityPatternString())
+        g.setInterfaceJacobianSparsityPatternString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceJacobianSparsityPatternString())
+
+        self.assertEqual('const size_t JACOBIAN_NONZERO_COUNT = [NONZERO_COUNT];\nconst size_t JACOBIAN_ROW_POINTERS[] = {[ROW_POINTERS]};\nconst size_t JACOBIAN_COLUMN_INDICES[] = {[COLUMN_INDICES]};\nconst size_t JACOBIAN_COLUMN_POINTERS[] = {[COLUMN_POINTERS]};\nconst size_t JACOBIAN_ROW_INDICES[] = {[ROW_INDICES]};\n', g.implementationJacobianSparsityPatternString())
+        g.setImplementationJacobianSparsityPatternString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationJacobianSparsityPatternString())
+
+        self.assertEqual('static const size_t OBJECTIVE_JACOBIAN_[INDEX]_NONZERO_COUNT = [NONZERO_COUNT];\nstatic const size_t OBJECTIVE_JACOBIAN_[INDEX]_ROW_POINTERS[] = {[ROW_POINTERS]};\nstatic const size_t OBJECTIVE_JACOBIAN_[INDEX]_COLUMN_INDICES[] = {[COLUMN_INDICES]};\nstatic const size_t OBJECTIVE_JACOBIAN_[INDEX]_COLUMN_POINTERS[] = {[COLUMN_POINTERS]};\nstatic const size_t OBJECTIVE_JACOBIAN_[INDEX]_ROW_INDICES[] = {[ROW_INDICES]};\n', g.objectiveJacobianSparsityPatternString())
+        g.setObjectiveJacobianSparsityPatternString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.objectiveJacobianSparsityPatternString())
+
+    def test_interface_gating_state_indices_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('extern const size_t GATING_STATE_COUNT;\nextern const size_t GATING_STATE_INDICES[];\n', g.interfaceGatingStateIndicesString())
+        g.setInterfaceGatingStateIndicesString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceGatingStateIndicesString())
+
+    def test_implementation_gating_state_indices_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('const size_t GATING_STATE_COUNT = [GATING_STATE_COUNT];\nconst size_t GATING_STATE_INDICES[] = {[GATING_STATE_INDICES]};\n', g.implementationGatingStateIndicesString())
+        g.setImplementationGatingStateIndicesString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationGatingStateIndicesString())
+
+    def test_interface_event_count_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('extern const size_t EVENT_COUNT;\n', g.interfaceEventCountString())
+        g.setInterfaceEventCountString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceEventCountString())
+
+    def test_implementation_event_count_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('const size_t EVENT_COUNT = [EVENT_COUNT];\n', g.implementationEventCountString())
+        g.setImplementationEventCountString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationEventCountString())
+
+    def test_interface_root_function_count_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('extern const size_t ROOT_FUNCTION_COUNT;\n', g.interfaceRootFunctionCountString())
+        g.setInterfaceRootFunctionCountString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceRootFunctionCountString())
+
+    def test_implementation_root_function_count_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('const size_t ROOT_FUNCTION_COUNT = [ROOT_FUNCTION_COUNT];\n', g.implementationRootFunctionCountString())
+        g.setImplementationRootFunctionCountString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationRootFunctionCountString())
+
     def test_voi_string(self):
         from libcellml import GeneratorProfile
 
@@ -0,0 +1,58 @@
+#
+# Tests the Interpreter class bindings
+#
+import math
+import unittest
+
+
+class InterpreterTestCase(unittest.TestCase):
+
+    def test_create_destroy(self):
+        from libcellml import Interpreter
+
+        x = Interpreter()
+        del x
+
+    def test_interpret(self):
+        from libcellml import Analyser
+        from libcellml import Interpreter
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+
+        a = Analyser()
+        a.analyseModel(m)
+
+        i = Interpreter()
+
+        self.assertIsNone(i.model())
+
+        i.setModel(a.model())
+
+        self.assertIsNotNone(i.model())
+        self.assertEqual(4, len(i.states()))
+        self.assertEqual(4, len(i.rates()))
+        self.assertEqual(18, len(i.variables()))
+        self.assertTrue(math.isnan(i.state(0)))
+
+        i.initialiseVariables()
+        i.computeComputedConstants()
+        i.computeRates(10.2)
+        i.computeVariables(10.2)
+
+        self.assertEqual(10.2, i.voi())
+        self.assertEqual((0.0, 0.6, 0.05, 0.325), tuple(i.states()))
+        self.assertAlmostEqual(-19.39923125, i.rate(0))
+        self.assertEqual(-20.0, i.variable(0))
+
+        i.setState(0, -10.0)
+        i.setVariable(0, 0.0)
+
+        self.assertEqual(-10.0, i.state(0))
+        self.assertEqual(0.0, i.variable(0))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -30,6 +30,7 @@ class IssueTestCase(unittest.TestCase):
         self.assertIsInstance(Issue.ReferenceRule.ANALYSER_EXTERNAL_VARIABLE_USE_PRIMARY_VARIABLE, int)
         self.assertIsInstance(Issue.ReferenceRule.ANALYSER_EXTERNAL_VARIABLE_VOI, int)
         self.assertIsInstance(Issue.ReferenceRule.ANALYSER_ODE_NOT_FIRST_ORDER, int)
+        self.assertIsInstance(Issue.ReferenceRule.ANALYSER_RESET_VARIABLE_NOT_STATE, int)
         self.assertIsInstance(Issue.ReferenceRule.ANALYSER_STATE_NOT_INITIALISED, int)
         self.assertIsInstance(Issue.ReferenceRule.ANALYSER_STATE_RATE_AS_ALGEBRAIC, int)
         self.assertIsInstance(Issue.ReferenceRule.ANALYSER_UNITS, int)
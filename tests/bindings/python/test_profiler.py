@@ -0,0 +1,84 @@
+#
+# Tests the Profiler class bindings
+#
+import unittest
+
+
+class ProfilerTestCase(unittest.TestCase):
+
+    def test_create_destroy(self):
+        from libcellml import Profiler
+
+        x = Profiler()
+        del x
+
+    def test_phase_enum(self):
+        from libcellml import Profiler
+
+        self.assertIsInstance(Profiler.Phase.PARSE_MODEL, int)
+        self.assertIsInstance(Profiler.Phase.VALIDATE_MODEL, int)
+        self.assertIsInstance(Profiler.Phase.VALIDATE_MATH, int)
+        self.assertIsInstance(Profiler.Phase.ANALYSE_MODEL, int)
+        self.assertIsInstance(Profiler.Phase.ANALYSE_EQUATION_UNITS, int)
+        self.assertIsInstance(Profiler.Phase.CHECK_EQUATIONS, int)
+        self.assertIsInstance(Profiler.Phase.RESOLVE_IMPORTS, int)
+        self.assertIsInstance(Profiler.Phase.FETCH_MODEL, int)
+        self.assertIsInstance(Profiler.Phase.FLATTEN_MODEL, int)
+        self.assertIsInstance(Profiler.Phase.PRINT_MODEL, int)
+        self.assertIsInstance(Profiler.Phase.GENERATE_INTERFACE_CODE, int)
+        self.assertIsInstance(Profiler.Phase.GENERATE_IMPLEMENTATION_CODE, int)
+        self.assertIsInstance(Profiler.Phase.ADD_NLA_SYSTEMS_CODE, int)
+
+        # Test conversion to enum
+        e = Profiler.Phase.VALIDATE_MATH
+        self.assertEqual('validate_math', Profiler.phaseAsString(e))
+
+    def test_profile(self):
+        from libcellml import Analyser
+        from libcellml import Generator
+        from libcellml import Parser
+        from libcellml import Profiler
+        from libcellml import Validator
+        from test_resources import file_contents
+
+        profiler = Profiler()
+
+        p = Parser()
+        self.assertIsNone(p.profiler())
+        p.setProfiler(profiler)
+        self.assertIsNotNone(p.profiler())
+        m = p.parseModel(file_contents('generator/algebraic_eqn_computed_var_on_rhs/model.cellml'))
+
+        v = Validator()
+        v.setProfiler(profiler)
+        v.validateModel(m)
+
+        a = Analyser()
+        a.setProfiler(profiler)
+        a.analyseModel(m)
+
+        g = Generator()
+        self.assertIsNone(g.profiler())
+        g.setProfiler(profiler)
+        self.assertIsNotNone(g.profiler())
+        g.setModel(a.model())
+        g.implementationCode()
+
+        self.assertEqual(1, profiler.callCount(Profiler.Phase.PARSE_MODEL))
+        self.assertEqual(2, profiler.callCount(Profiler.Phase.VALIDATE_MODEL))
+        self.assertEqual(1, profiler.callCount(Profiler.Phase.ANALYSE_MODEL))
+        self.assertEqual(1, profiler.callCount(Profiler.Phase.GENERATE_IMPLEMENTATION_CODE))
+        self.assertGreater(profiler.elapsedTime(Profiler.Phase.ANALYSE_MODEL), 0.0)
+        self.assertEqual(0, profiler.allocationCount(Profiler.Phase.ANALYSE_MODEL))
+
+        profiler.reset()
+
+        self.assertEqual(0, profiler.callCount(Profiler.Phase.PARSE_MODEL))
+        self.assertEqual(0.0, profiler.elapsedTime(Profiler.Phase.ANALYSE_MODEL))
+
+        p.setProfiler(None)
+        self.assertIsNone(p.profiler())
+
+
+if __name__ == '__main__':
+    unittest.main()
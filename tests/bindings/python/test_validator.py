@@ -33,6 +33,33 @@ class ValidatorTestCase(unittest.TestCase):
         v = Validator()
         v.validateModel(libcellml.Model())
 
+    def test_issue_storage_limit(self):
+        import libcellml
+        from libcellml import Validator
+
+        v = Validator()
+        v.setIssueStorageLimit(0)
+        self.assertEqual(0, v.issueStorageLimit())
+
+        v.validateModel(libcellml.Model())
+        self.assertEqual(1, v.issueCount())
+        self.assertIsNone(v.issue(0))
+
+    def test_error_limit(self):
+        import libcellml
+        from libcellml import Validator
+
+        v = Validator()
+        self.assertEqual(0, v.errorLimit())
+
+        v.setErrorLimit(1)
+        self.assertEqual(1, v.errorLimit())
+
+        m = libcellml.Model()
+        m.addComponent(libcellml.Component())
+        v.validateModel(m)
+        self.assertEqual(1, v.errorCount())
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -484,6 +484,60 @@ TEST(Clone, modelWithVariableEquivalences)
     EXPECT_EQ(p->printModel(m), p->printModel(mClone));
 }
 
+TEST(Clone, modelWithDeepEncapsulationAndVariableEquivalences)
+{
+    const size_t depth = 20;
+    auto m = libcellml::Model::create("model");
+    auto parent = libcellml::Component::create("c0");
+    auto parentVariable = libcellml::Variable::create("x");
+
+    parentVariable->setUnits("dimensionless");
+    parentVariable->setInterfaceType("public_and_private");
+    parent->addVariable(parentVariable);
+    m->addComponent(parent);
+
+    for (size_t i = 1; i < depth; ++i) {
+        auto child = libcellml::Component::create("c" + std::to_string(i));
+        auto childVariable = libcellml::Variable::create("x");
+        auto otherVariable = libcellml::Variable::create("y");
+
+        childVariable->setUnits("dimensionless");
+        childVariable->setInterfaceType("public_and_private");
+        otherVariable->setUnits("dimensionless");
+        child->addVariable(otherVariable);
+        child->addVariable(childVariable);
+        parent->addComponent(child);
+
+        libcellml::Variable::addEquivalence(parentVariable, childVariable);
+
+        parent = child;
+        parentVariable = childVariable;
+    }
+
+    auto mClone = m->clone();
+
+    compareModel(m, mClone);
+
+    auto c = m->component(0);
+    auto cClone = mClone->component(0);
+
+    for (size_t i = 1; i < depth; ++i) {
+        auto v = c->variable("x");
+        auto vClone = cClone->variable("x");
+
+        c = c->component(0);
+        cClone = cClone->component(0);
+
+        EXPECT_EQ(v->equivalentVariableCount(), vClone->equivalentVariableCount());
+        EXPECT_TRUE(vClone->hasEquivalentVariable(cClone->variable("x")));
+        EXPECT_FALSE(vClone->hasEquivalentVariable(c->variable("x")));
+    }
+
+    auto printer = libcellml::Printer::create();
+
+    EXPECT_EQ(printer->printModel(m), printer->printModel(mClone));
+}
+
 TEST(Clone, generateFromClonedModel)
 {
     libcellml::ParserPtr parser = libcellml::Parser::create();
@@ -565,3 +619,83 @@ TEST(Clone, modelWithImportedItems)
     EXPECT_EQ(printer->printModel(model), printer->printModel(clonedModel));
     compareModel(model, clonedModel);
 }
+
+TEST(Clone, writeToClonedMathDoesNotAffectOriginal)
+{
+    const std::string math = "<math xmlns=\"http://www.w3.org/1998/Math/MathML\"/>";
+    const std::string otherMath = "<math xmlns=\"http://www.w3.org/1998/Math/MathML\"><apply/></math>";
+    auto c = libcellml::Component::create("component");
+    auto r = libcellml::Reset::create();
+
+    c->setMath(math);
+    r->setTestValue(math);
+    r->setResetValue(math);
+    c->addReset(r);
+
+    auto cClone = c->clone();
+    auto rClone = cClone->reset(0);
+
+    EXPECT_EQ(math, cClone->math());
+    EXPECT_EQ(math, rClone->testValue());
+    EXPECT_EQ(math, rClone->resetValue());
+
+    cClone->appendMath(math);
+    rClone->setTestValue(otherMath);
+    rClone->removeResetValue();
+
+    EXPECT_EQ(math, c->math());
+    EXPECT_EQ(math + math, cClone->math());
+    EXPECT_EQ(math, r->testValue());
+    EXPECT_EQ(otherMath, rClone->testValue());
+    EXPECT_EQ(math, r->resetValue());
+    EXPECT_EQ("", rClone->resetValue());
+
+    c->removeMath();
+
+    EXPECT_EQ("", c->math());
+    EXPECT_EQ(math + math, cClone->math());
+
+    auto otherClone = cClone->clone();
+
+    otherClone->setMath(otherMath);
+
+    EXPECT_EQ(math + math, cClone->math());
+    EXPECT_EQ(otherMath, otherClone->math());
+}
+
+TEST(Clone, writeToClonedUnitsDoesNotAffectOriginal)
+{
+    auto u = libcellml::Units::create("units");
+
+    u->addUnit("metre", "milli", -2.0);
+    u->addUnit("second");
+
+    auto uClone = u->clone();
+
+    uClone->setUnitAttributeReference(0, "ampere");
+    uClone->setUnitId(1, "unit_id");
+    uClone->addUnit("kelvin");
+
+    EXPECT_EQ(size_t(2), u->unitCount());
+    EXPECT_EQ("metre", u->unitAttributeReference(0));
+    EXPECT_EQ("", u->unitId(1));
+    EXPECT_EQ(size_t(3), uClone->unitCount());
+    EXPECT_EQ("ampere", uClone->unitAttributeReference(0));
+    EXPECT_EQ("unit_id", uClone->unitId(1));
+
+    auto uCloneClone = uClone->clone();
+
+    uClone->removeUnit("second");
+    uCloneClone->removeUnit(size_t(0));
+
+    EXPECT_EQ(size_t(2), uClone->unitCount());
+    EXPECT_EQ("kelvin", uClone->unitAttributeReference(1));
+    EXPECT_EQ(size_t(2), uCloneClone->unitCount());
+    EXPECT_EQ("second", uCloneClone->unitAttributeReference(0));
+
+    uCloneClone->removeAllUnits();
+
+    EXPECT_EQ(size_t(0), uCloneClone->unitCount());
+    EXPECT_EQ(size_t(2), uClone->unitCount());
+    EXPECT_EQ(size_t(2), u->unitCount());
+}
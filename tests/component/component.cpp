@@ -740,3 +740,50 @@ TEST(Component, definedComponentImport)
 
     EXPECT_FALSE(c->isDefined());
 }
+
+TEST(Component, lookUpRenamedVariablesAndComponents)
+{
+    auto c = libcellml::Component::create("component");
+    auto v1 = libcellml::Variable::create("v1");
+    auto v2 = libcellml::Variable::create("v2");
+    auto child = libcellml::Component::create("child");
+
+    c->addVariable(v1);
+    c->addVariable(v2);
+    c->addComponent(child);
+
+    v1->setName("renamed");
+    child->setName("renamed_child");
+
+    EXPECT_FALSE(c->hasVariable("v1"));
+    EXPECT_TRUE(c->hasVariable("renamed"));
+    EXPECT_EQ(v1, c->variable("renamed"));
+    EXPECT_EQ(nullptr, c->variable("v1"));
+    EXPECT_FALSE(c->containsComponent("child"));
+    EXPECT_EQ(child, c->component("renamed_child"));
+
+    v2->setName("renamed");
+
+    EXPECT_EQ(v1, c->variable("renamed"));
+
+    v1->removeName();
+
+    EXPECT_EQ(v2, c->variable("renamed"));
+    EXPECT_EQ(v1, c->variable(""));
+
+    EXPECT_TRUE(c->removeVariable("renamed"));
+    EXPECT_FALSE(c->hasVariable("renamed"));
+
+    auto other = libcellml::Component::create("other");
+    other->addVariable(v1);
+    v1->setName("moved");
+
+    EXPECT_FALSE(c->hasVariable("moved"));
+    EXPECT_FALSE(c->hasVariable(""));
+    EXPECT_EQ(v1, other->variable("moved"));
+
+    v2->setName("removed");
+
+    EXPECT_FALSE(c->hasVariable("removed"));
+    EXPECT_EQ(size_t(0), c->variableCount());
+}
@@ -455,6 +455,7 @@ TEST(Coverage, analyser)
     EXPECT_EQ(size_t(0), analyserModel->variableCount());
     EXPECT_EQ(size_t(0), analyserModel->variables().size());
     EXPECT_EQ(nullptr, analyserModel->variable(0));
+    EXPECT_EQ(nullptr, analyserModel->analyserVariable(nullptr));
 
     EXPECT_EQ(size_t(0), analyserModel->equationCount());
     EXPECT_EQ(size_t(0), analyserModel->equations().size());
@@ -795,6 +796,13 @@ TEST(Coverage, generator)
     EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
     EXPECT_EQ(fileContents("coverage/generator/model.py"), generator->implementationCode());
 
+    profile->setProfile(libcellml::GeneratorProfile::Profile::NUMPY);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("coverage/generator/model.numpy.py"), generator->implementationCode());
+
+    profile->setProfile(libcellml::GeneratorProfile::Profile::PYTHON);
+
     profile->setImplementationCreateStatesArrayMethodString("\n"
                                                             "def create_states_vector():\n"
                                                             "    return [nan]*STATE_COUNT\n");
@@ -907,6 +915,279 @@ TEST(Coverage, generator)
     libcellml::Generator::equationCode(analyser->model()->equation(0)->ast());
 }
 
+TEST(Coverage, generatorJacobian)
+{
+    // Ask for Jacobians that cannot be generated since the degree of a root
+    // or the base of a logarithm depends on the variable with respect to which
+    // we differentiate.
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("coverage/generator/jacobian.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyser->model());
+    generator->setJacobianGenerated(true);
+
+    EXPECT_EQ(std::string::npos, generator->interfaceCode().find("computeJacobian"));
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("Jacobian"));
+
+    // Generate Jacobians for our coverage model, but with a profile that
+    // doesn't support them.
+
+    model = parser->parseModel(fileContents("coverage/generator/model.cellml"));
+
+    analyser->analyseModel(model);
+
+    generator->setModel(analyser->model());
+
+    EXPECT_NE(std::string::npos, generator->interfaceCode().find("computeJacobian"));
+    EXPECT_NE(std::string::npos, generator->implementationCode().find("objectiveJacobian0"));
+
+    auto profile = generator->profile();
+
+    profile->setObjectiveJacobianMethodString(false, "");
+    profile->setObjectiveJacobianMethodString(true, "");
+    profile->setInterfaceComputeJacobianMethodString("");
+    profile->setImplementationComputeJacobianMethodString("");
+
+    EXPECT_EQ(std::string::npos, generator->interfaceCode().find("computeJacobian"));
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("Jacobian"));
+
+    // Generate the sparsity pattern of the Jacobians of our coverage model,
+    // which rates don't depend on any state, i.e. the sparsity pattern of the
+    // Jacobian of its rates is empty, unlike that of its NLA system.
+
+    generator->setJacobianSparsityPatternGenerated(true);
+
+    EXPECT_EQ(std::string::npos, generator->interfaceCode().find("JACOBIAN_NONZERO_COUNT"));
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("const size_t JACOBIAN_NONZERO_COUNT"));
+    EXPECT_NE(std::string::npos, generator->implementationCode().find("OBJECTIVE_JACOBIAN_0_NONZERO_COUNT"));
+
+    profile->setImplementationJacobianSparsityPatternString("");
+    profile->setObjectiveJacobianSparsityPatternString("");
+
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("NONZERO_COUNT"));
+}
+
+TEST(Coverage, generatorGatingCoefficients)
+{
+    // Ask for the gating coefficients of a model whose ODE is not linear in
+    // its state, and then of a model whose ODEs are linear in their state, but
+    // with a profile that doesn't support gating coefficients.
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("coverage/generator/model.cellml"));
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyser->model());
+    generator->setGatingCoefficientsGenerated(true);
+
+    EXPECT_EQ(std::string::npos, generator->interfaceCode().find("GATING_STATE"));
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("GATING_STATE"));
+
+    model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    analyser->analyseModel(model);
+
+    generator->setModel(analyser->model());
+
+    EXPECT_NE(std::string::npos, generator->interfaceCode().find("computeGatingCoefficients"));
+    EXPECT_NE(std::string::npos, generator->implementationCode().find("computeGatingCoefficients"));
+
+    auto profile = generator->profile();
+
+    profile->setInterfaceGatingStateIndicesString("");
+    profile->setImplementationGatingStateIndicesString("");
+    profile->setInterfaceComputeGatingCoefficientsMethodString("");
+    profile->setImplementationComputeGatingCoefficientsMethodString("");
+
+    EXPECT_EQ(std::string::npos, generator->interfaceCode().find("Gating"));
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("Gating"));
+}
+
+TEST(Coverage, generatorResets)
+{
+    // Generate the code for a model with some resets, but with a profile that
+    // doesn't support resets.
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/bouncing_ball/model.cellml"));
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyser->model());
+
+    EXPECT_NE(std::string::npos, generator->interfaceCode().find("applyResets"));
+    EXPECT_NE(std::string::npos, generator->implementationCode().find("applyResets"));
+
+    auto profile = generator->profile();
+
+    profile->setInterfaceEventCountString("");
+    profile->setImplementationEventCountString("");
+    profile->setInterfaceComputeEventConditionsMethodString("");
+    profile->setImplementationComputeEventConditionsMethodString("");
+    profile->setInterfaceApplyResetsMethodString("");
+    profile->setImplementationApplyResetsMethodString("");
+
+    EXPECT_EQ(std::string::npos, generator->interfaceCode().find("EVENT_COUNT"));
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("EVENT_COUNT"));
+    EXPECT_EQ(std::string::npos, generator->interfaceCode().find("Event"));
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("Event"));
+    EXPECT_EQ(std::string::npos, generator->interfaceCode().find("Resets"));
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("Resets"));
+}
+
+TEST(Coverage, generatorRootFunctions)
+{
+    // Generate the code for a model with some root functions, but with a
+    // profile that doesn't support root functions.
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/root_functions/model.cellml"));
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyser->model());
+    generator->setRootFunctionsGenerated(true);
+
+    auto profile = generator->profile();
+
+    profile->setInterfaceRootFunctionCountString("");
+    profile->setImplementationRootFunctionCountString("");
+    profile->setInterfaceComputeRootFunctionsMethodString("");
+    profile->setImplementationComputeRootFunctionsMethodString("");
+
+    EXPECT_EQ(std::string::npos, generator->interfaceCode().find("RootFunction"));
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("RootFunction"));
+    EXPECT_EQ(std::string::npos, generator->interfaceCode().find("ROOT_FUNCTION_COUNT"));
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("ROOT_FUNCTION_COUNT"));
+}
+
+TEST(Coverage, generatorNewtonSolvers)
+{
+    // Generate the code for a model with some small NLA systems, but with a
+    // profile that doesn't (fully) support Newton solvers, in which case we
+    // should fall back to the NLA solve method.
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/algebraic_system_with_three_linked_unknowns/model.cellml"));
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyser->model());
+    generator->setNewtonSolversGenerated(true);
+
+    auto profile = generator->profile();
+
+    profile->setFiniteDifferenceObjectiveJacobianMethodString("");
+
+    EXPECT_NE(std::string::npos, generator->implementationCode().find("nlaSolve(objectiveFunction0"));
+
+    generator->setJacobianGenerated(true);
+
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("nlaSolve(objectiveFunction0"));
+
+    profile->setObjectiveJacobianMethodString(false, "");
+
+    EXPECT_NE(std::string::npos, generator->implementationCode().find("nlaSolve(objectiveFunction0"));
+
+    profile->setNewtonSolveCallString(false, "");
+
+    EXPECT_NE(std::string::npos, generator->implementationCode().find("nlaSolve(objectiveFunction0"));
+}
+
+TEST(Coverage, interpreter)
+{
+    // Interpret a model that uses all the operators that we support, and then
+    // a model with NLA systems that have no solution, one of which has a
+    // singular Jacobian while the other requires the Newton step to be damped.
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("coverage/generator/model.cellml"));
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    auto interpreter = libcellml::Interpreter::create();
+
+    interpreter->setModel(analyser->model());
+
+    interpreter->initialiseVariables();
+    interpreter->computeComputedConstants();
+    interpreter->computeRates();
+    interpreter->computeVariables();
+
+    EXPECT_EQ(1.0, interpreter->rate(0));
+    EXPECT_NEAR(-2.0, interpreter->variable(205), 1.0e-12);
+    EXPECT_NEAR(2.0, interpreter->variable(206), 1.0e-12);
+    EXPECT_EQ(3.0, interpreter->variable(207));
+    EXPECT_EQ(1.0, interpreter->variable(208));
+
+    const std::string in =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\" name=\"nla_systems_without_solution\">\n"
+        "  <component name=\"main\">\n"
+        "    <variable name=\"x\" units=\"dimensionless\" initial_value=\"0\"/>\n"
+        "    <variable name=\"y\" units=\"dimensionless\" initial_value=\"0\"/>\n"
+        "    <math xmlns=\"http://www.w3.org/1998/Math/MathML\">\n"
+        "      <apply>\n"
+        "        <eq/>\n"
+        "        <apply>\n"
+        "          <floor/>\n"
+        "          <ci>x</ci>\n"
+        "        </apply>\n"
+        "        <cn cellml:units=\"dimensionless\">0.5</cn>\n"
+        "      </apply>\n"
+        "      <apply>\n"
+        "        <eq/>\n"
+        "        <apply>\n"
+        "          <abs/>\n"
+        "          <ci>y</ci>\n"
+        "        </apply>\n"
+        "        <cn cellml:units=\"dimensionless\">-1</cn>\n"
+        "      </apply>\n"
+        "    </math>\n"
+        "  </component>\n"
+        "</model>\n";
+
+    model = parser->parseModel(in);
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(libcellml::AnalyserModel::Type::NLA, analyser->model()->type());
+
+    interpreter->setModel(analyser->model());
+
+    interpreter->initialiseVariables();
+    interpreter->computeComputedConstants();
+    interpreter->computeVariables();
+
+    EXPECT_EQ(0.0, interpreter->variable(0));
+    EXPECT_NEAR(0.0, interpreter->variable(1), 0.01);
+}
+
 TEST(CoverageValidator, degreeElementWithOneSibling)
 {
     const std::string math =
@@ -388,6 +388,144 @@ TEST(Generator, algebraicSystemWithThreeLinkedUnknowns)
     EXPECT_EQ(fileContents("generator/algebraic_system_with_three_linked_unknowns/model.py"), generator->implementationCode());
 }
 
+TEST(Generator, algebraicSystemWithThreeLinkedUnknownsWithJacobian)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/algebraic_system_with_three_linked_unknowns/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+    generator->setJacobianGenerated(true);
+
+    auto profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.jacobian.h");
+
+    EXPECT_EQ(fileContents("generator/algebraic_system_with_three_linked_unknowns/model.jacobian.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/algebraic_system_with_three_linked_unknowns/model.jacobian.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/algebraic_system_with_three_linked_unknowns/model.jacobian.py"), generator->implementationCode());
+}
+
+TEST(Generator, algebraicSystemWithThreeLinkedUnknownsWithJacobianAndNewtonSolvers)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/algebraic_system_with_three_linked_unknowns/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+    generator->setJacobianGenerated(true);
+    generator->setNewtonSolversGenerated(true);
+
+    auto profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.jacobian.newton.h");
+
+    EXPECT_EQ(fileContents("generator/algebraic_system_with_three_linked_unknowns/model.jacobian.newton.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/algebraic_system_with_three_linked_unknowns/model.jacobian.newton.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/algebraic_system_with_three_linked_unknowns/model.jacobian.newton.py"), generator->implementationCode());
+}
+
+TEST(Generator, algebraicSystemsOfVariousSizes)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/algebraic_systems_of_various_sizes/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    EXPECT_EQ(fileContents("generator/algebraic_systems_of_various_sizes/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/algebraic_systems_of_various_sizes/model.c"), generator->implementationCode());
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/algebraic_systems_of_various_sizes/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, algebraicSystemsOfVariousSizesWithNewtonSolvers)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/algebraic_systems_of_various_sizes/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    EXPECT_FALSE(generator->isNewtonSolversGenerated());
+
+    generator->setModel(analyserModel);
+    generator->setNewtonSolversGenerated(true);
+
+    EXPECT_TRUE(generator->isNewtonSolversGenerated());
+
+    auto profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.newton.h");
+
+    EXPECT_EQ(fileContents("generator/algebraic_systems_of_various_sizes/model.newton.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/algebraic_systems_of_various_sizes/model.newton.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/algebraic_systems_of_various_sizes/model.newton.py"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::NUMPY);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/algebraic_systems_of_various_sizes/model.newton.numpy.py"), generator->implementationCode());
+}
+
 TEST(Generator, algebraicSystemWithThreeLinkedUnknownsWithThreeExternalVariables)
 {
     auto parser = libcellml::Parser::create();
@@ -1629,10 +1767,10 @@ TEST(Generator, hodgkinHuxleySquidAxonModel1952Nla)
     EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.py"), generator->implementationCode());
 }
 
-TEST(Generator, nobleModel1962)
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithJacobian)
 {
     auto parser = libcellml::Parser::create();
-    auto model = parser->parseModel(fileContents("generator/noble_model_1962/model.cellml"));
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
 
     EXPECT_EQ(size_t(0), parser->issueCount());
 
@@ -1645,27 +1783,42 @@ TEST(Generator, nobleModel1962)
     auto analyserModel = analyser->model();
     auto generator = libcellml::Generator::create();
 
+    EXPECT_FALSE(generator->isJacobianGenerated());
+
     generator->setModel(analyserModel);
+    generator->setJacobianGenerated(true);
 
-    EXPECT_EQ(fileContents("generator/noble_model_1962/model.h"), generator->interfaceCode());
-    EXPECT_EQ(fileContents("generator/noble_model_1962/model.c"), generator->implementationCode());
+    EXPECT_TRUE(generator->isJacobianGenerated());
 
-    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+    auto profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.jacobian.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.jacobian.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.jacobian.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
 
     generator->setProfile(profile);
 
-    EXPECT_EQ(fileContents("generator/noble_model_1962/model.py"), generator->implementationCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.jacobian.py"), generator->implementationCode());
 }
 
-TEST(Generator, robertsonOdeModel1966)
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithStateVariableAsExternalVariableAndJacobian)
 {
+    // Same as the hodgkinHuxleySquidAxonModel1952WithStateVariableAsExternalVariable
+    // test, except that we ask for a Jacobian, which cannot be generated since
+    // the model has an external variable.
+
     auto parser = libcellml::Parser::create();
-    auto model = parser->parseModel(fileContents("generator/robertson_model_1966/model.ode.cellml"));
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
 
     EXPECT_EQ(size_t(0), parser->issueCount());
 
     auto analyser = libcellml::Analyser::create();
 
+    analyser->addExternalVariable(libcellml::AnalyserExternalVariable::create(model->component("sodium_channel")->variable("m")));
+
     analyser->analyseModel(model);
 
     EXPECT_EQ(size_t(0), analyser->errorCount());
@@ -1674,25 +1827,31 @@ TEST(Generator, robertsonOdeModel1966)
     auto generator = libcellml::Generator::create();
 
     generator->setModel(analyserModel);
+    generator->setJacobianGenerated(true);
 
     auto profile = generator->profile();
 
-    profile->setInterfaceFileNameString("model.ode.h");
+    profile->setInterfaceFileNameString("model.state.h");
 
-    EXPECT_EQ(fileContents("generator/robertson_model_1966/model.ode.h"), generator->interfaceCode());
-    EXPECT_EQ(fileContents("generator/robertson_model_1966/model.ode.c"), generator->implementationCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.state.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.state.c"), generator->implementationCode());
 
     profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
 
     generator->setProfile(profile);
 
-    EXPECT_EQ(fileContents("generator/robertson_model_1966/model.ode.py"), generator->implementationCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.state.py"), generator->implementationCode());
 }
 
-TEST(Generator, robertsonDaeModel1966)
+TEST(Generator, hodgkinHuxleySquidAxonModel1952NlaWithJacobian)
 {
+    // Same as the hodgkinHuxleySquidAxonModel1952Nla test, except that we ask
+    // for a Jacobian.  No Jacobian can be generated for the ODEs since their
+    // rates depend on variables computed using NLA systems, but one is
+    // generated for each NLA system.
+
     auto parser = libcellml::Parser::create();
-    auto model = parser->parseModel(fileContents("generator/robertson_model_1966/model.dae.cellml"));
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.cellml"));
 
     EXPECT_EQ(size_t(0), parser->issueCount());
 
@@ -1706,35 +1865,28 @@ TEST(Generator, robertsonDaeModel1966)
     auto generator = libcellml::Generator::create();
 
     generator->setModel(analyserModel);
+    generator->setJacobianGenerated(true);
 
     auto profile = generator->profile();
 
-    profile->setInterfaceFileNameString("model.dae.h");
+    profile->setInterfaceFileNameString("model.dae.jacobian.h");
 
-    EXPECT_EQ(fileContents("generator/robertson_model_1966/model.dae.h"), generator->interfaceCode());
-    EXPECT_EQ(fileContents("generator/robertson_model_1966/model.dae.c"), generator->implementationCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.jacobian.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.jacobian.c"), generator->implementationCode());
 
     profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
 
     generator->setProfile(profile);
 
-    EXPECT_EQ(fileContents("generator/robertson_model_1966/model.dae.py"), generator->implementationCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.jacobian.py"), generator->implementationCode());
 }
 
-TEST(Generator, sineImports)
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithJacobianSparsityPattern)
 {
     auto parser = libcellml::Parser::create();
-    auto model = parser->parseModel(fileContents("sine_approximations_import.xml"));
-    auto importer = libcellml::Importer::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
 
     EXPECT_EQ(size_t(0), parser->issueCount());
-    EXPECT_TRUE(model->hasUnresolvedImports());
-
-    importer->resolveImports(model, resourcePath());
-
-    EXPECT_FALSE(model->hasUnresolvedImports());
-
-    model = importer->flattenModel(model);
 
     auto analyser = libcellml::Analyser::create();
 
@@ -1745,49 +1897,39 @@ TEST(Generator, sineImports)
     auto analyserModel = analyser->model();
     auto generator = libcellml::Generator::create();
 
-    generator->setModel(analyserModel);
-
-    EXPECT_EQ(fileContents("generator/sine_model_imports/model.h"), generator->interfaceCode());
-    EXPECT_EQ(fileContents("generator/sine_model_imports/model.c"), generator->implementationCode());
-
-    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
-
-    generator->setProfile(profile);
-
-    EXPECT_EQ(fileContents("generator/sine_model_imports/model.py"), generator->implementationCode());
-}
-
-TEST(Generator, analyserModelScopeTest)
-{
-    auto parser = libcellml::Parser::create();
-    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+    EXPECT_FALSE(generator->isJacobianSparsityPatternGenerated());
 
-    libcellml::AnalyserModelPtr analyserModel = nullptr;
+    generator->setModel(analyserModel);
+    generator->setJacobianSparsityPatternGenerated(true);
 
-    {
-        auto analyser = libcellml::Analyser::create();
+    EXPECT_TRUE(generator->isJacobianSparsityPatternGenerated());
 
-        analyser->analyseModel(model);
+    auto profile = generator->profile();
 
-        EXPECT_EQ(size_t(0), analyser->errorCount());
+    profile->setInterfaceFileNameString("model.sparsity.h");
 
-        analyserModel = analyser->model();
-    }
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.sparsity.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.sparsity.c"), generator->implementationCode());
 
-    auto generator = libcellml::Generator::create();
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
 
-    generator->setModel(analyserModel);
+    generator->setProfile(profile);
 
-    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.h"), generator->interfaceCode());
-    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.c"), generator->implementationCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.sparsity.py"), generator->implementationCode());
 }
 
-TEST(Generator, daeModel)
+TEST(Generator, hodgkinHuxleySquidAxonModel1952NlaWithJacobianSparsityPattern)
 {
-    auto parser = libcellml::Parser::create(false);
-    auto model = parser->parseModel(fileContents("generator/dae_cellml_1_1_model/model.cellml"));
+    // Same as the hodgkinHuxleySquidAxonModel1952Nla test, except that we ask
+    // for the sparsity pattern of the Jacobians. The sparsity pattern of the
+    // Jacobian of the rates is the same as for the ODE version of the model,
+    // since the states that a rate depends on are tracked through the NLA
+    // systems.
 
-    EXPECT_EQ(size_t(0), parser->errorCount());
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
 
     auto analyser = libcellml::Analyser::create();
 
@@ -1799,21 +1941,26 @@ TEST(Generator, daeModel)
     auto generator = libcellml::Generator::create();
 
     generator->setModel(analyserModel);
+    generator->setJacobianSparsityPatternGenerated(true);
 
-    EXPECT_EQ(fileContents("generator/dae_cellml_1_1_model/model.h"), generator->interfaceCode());
-    EXPECT_EQ(fileContents("generator/dae_cellml_1_1_model/model.c"), generator->implementationCode());
+    auto profile = generator->profile();
 
-    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+    profile->setInterfaceFileNameString("model.dae.sparsity.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.sparsity.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.sparsity.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
 
     generator->setProfile(profile);
 
-    EXPECT_EQ(fileContents("generator/dae_cellml_1_1_model/model.py"), generator->implementationCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.sparsity.py"), generator->implementationCode());
 }
 
-TEST(Generator, variableInitialisedUsingAConstant)
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithSplitVariablesArray)
 {
     auto parser = libcellml::Parser::create();
-    auto model = parser->parseModel(fileContents("generator/variable_initialised_using_a_constant/model.cellml"));
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
 
     EXPECT_EQ(size_t(0), parser->issueCount());
 
@@ -1826,58 +1973,78 @@ TEST(Generator, variableInitialisedUsingAConstant)
     auto analyserModel = analyser->model();
     auto generator = libcellml::Generator::create();
 
+    EXPECT_FALSE(generator->isVariablesArraySplit());
+
     generator->setModel(analyserModel);
+    generator->setVariablesArraySplit(true);
 
-    EXPECT_EQ(fileContents("generator/variable_initialised_using_a_constant/model.h"), generator->interfaceCode());
-    EXPECT_EQ(fileContents("generator/variable_initialised_using_a_constant/model.c"), generator->implementationCode());
+    EXPECT_TRUE(generator->isVariablesArraySplit());
 
-    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+    auto profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.split.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.split.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.split.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
 
     generator->setProfile(profile);
 
-    EXPECT_EQ(fileContents("generator/variable_initialised_using_a_constant/model.py"), generator->implementationCode());
-}
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.split.py"), generator->implementationCode());
 
-TEST(Generator, modelOutOfScope)
-{
-    libcellml::AnalyserModelPtr analyserModel;
+    // The default method strings refer to the variables array itself, but
+    // method strings may also use tags for the variables array(s).
 
-    {
-        auto analyser = libcellml::Analyser::create();
-        auto parser = libcellml::Parser::create();
-        auto model = parser->parseModel(fileContents("generator/ode_multiple_dependent_odes/model.cellml"));
+    EXPECT_EQ("\n"
+              "def compute_computed_constants(variables):\n"
+              "[CODE]",
+              profile->implementationComputeComputedConstantsMethodString());
 
-        EXPECT_EQ(size_t(0), parser->issueCount());
+    profile->setImplementationComputeComputedConstantsMethodString("\n"
+                                                                   "def compute_computed_constants([VARIABLES_PARAMETERS]):\n"
+                                                                   "[CODE]");
 
-        analyser->analyseModel(model);
+    EXPECT_NE(std::string::npos, generator->implementationCode().find("def compute_computed_constants(constants, computed_constants, algebraic):\n"));
 
-        EXPECT_EQ(size_t(0), analyser->errorCount());
+    generator->setVariablesArraySplit(false);
 
-        analyserModel = analyser->model();
-    }
+    EXPECT_NE(std::string::npos, generator->implementationCode().find("def compute_computed_constants(variables):\n"));
 
-    auto generator = libcellml::Generator::create();
+    // A method string that is not one of the default ones is used as is, even
+    // if it refers to the variables array itself.
 
-    generator->setModel(analyserModel);
+    profile->setImplementationComputeComputedConstantsMethodString("\n"
+                                                                   "def compute_computed_constants(variables, cell_count):\n"
+                                                                   "[CODE]");
 
-    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+    generator->setVariablesArraySplit(true);
 
-    generator->setProfile(profile);
+    EXPECT_NE(std::string::npos, generator->implementationCode().find("def compute_computed_constants(variables, cell_count):\n"));
 
-    EXPECT_EQ(fileContents("generator/ode_multiple_dependent_odes/model.py"), generator->implementationCode());
+    // Setting a method string back to its default value makes it work with a
+    // split variables array again.
+
+    profile->setImplementationComputeComputedConstantsMethodString("\n"
+                                                                   "def compute_computed_constants(variables):\n"
+                                                                   "[CODE]");
+
+    EXPECT_NE(std::string::npos, generator->implementationCode().find("def compute_computed_constants(constants, computed_constants, algebraic):\n"));
 }
 
-TEST(Generator, unknownVariableMarkedAsExternalVariable)
+TEST(Generator, hodgkinHuxleySquidAxonModel1952NlaWithSplitVariablesArray)
 {
+    // Same as the hodgkinHuxleySquidAxonModel1952Nla test, except that the
+    // constants, computed constants and algebraic variables are in their own
+    // array, which must therefore also be passed to the NLA solver.
+
     auto parser = libcellml::Parser::create();
-    auto model = parser->parseModel(fileContents("generator/unknown_variable_as_external_variable/model.cellml"));
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.cellml"));
 
     EXPECT_EQ(size_t(0), parser->issueCount());
 
     auto analyser = libcellml::Analyser::create();
 
-    analyser->addExternalVariable(libcellml::AnalyserExternalVariable::create(model->component("SLC_template3_ss")->variable("P_3")));
-
     analyser->analyseModel(model);
 
     EXPECT_EQ(size_t(0), analyser->errorCount());
@@ -1886,15 +2053,632 @@ TEST(Generator, unknownVariableMarkedAsExternalVariable)
     auto generator = libcellml::Generator::create();
 
     generator->setModel(analyserModel);
+    generator->setVariablesArraySplit(true);
 
-    EXPECT_EQ(fileContents("generator/unknown_variable_as_external_variable/model.h"), generator->interfaceCode());
-    EXPECT_EQ(fileContents("generator/unknown_variable_as_external_variable/model.c"), generator->implementationCode());
+    auto profile = generator->profile();
 
-    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+    profile->setInterfaceFileNameString("model.dae.split.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.split.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.split.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
 
     generator->setProfile(profile);
 
-    EXPECT_EQ(fileContents("generator/unknown_variable_as_external_variable/model.py"), generator->implementationCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.split.py"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithVariousExternalVariablesAndSplitVariablesArray)
+{
+    // Same as the hodgkinHuxleySquidAxonModel1952WithVariousExternalVariables
+    // test, except that the variables array is split. External variables,
+    // whether they would otherwise be constants, computed constants or
+    // algebraic variables, end up in the algebraic array.
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+    auto potassium_channel_n_gate_alpha_n = model->component("potassium_channel_n_gate")->variable("alpha_n");
+    auto external_sodium_channel_i_Na = libcellml::AnalyserExternalVariable::create(model->component("sodium_channel")->variable("i_Na"));
+
+    external_sodium_channel_i_Na->addDependency(potassium_channel_n_gate_alpha_n);
+    external_sodium_channel_i_Na->addDependency(model->component("sodium_channel_h_gate")->variable("h"));
+
+    analyser->addExternalVariable(libcellml::AnalyserExternalVariable::create(model->component("membrane")->variable("V")));
+    analyser->addExternalVariable(external_sodium_channel_i_Na);
+    analyser->addExternalVariable(libcellml::AnalyserExternalVariable::create(potassium_channel_n_gate_alpha_n));
+    analyser->addExternalVariable(libcellml::AnalyserExternalVariable::create(model->component("membrane")->variable("Cm")));
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+    generator->setVariablesArraySplit(true);
+
+    auto profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.external.split.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.external.split.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.external.split.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.external.split.py"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithGatingCoefficients)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    EXPECT_FALSE(generator->isGatingCoefficientsGenerated());
+
+    generator->setModel(analyserModel);
+    generator->setGatingCoefficientsGenerated(true);
+
+    EXPECT_TRUE(generator->isGatingCoefficientsGenerated());
+
+    auto profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.gating.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.gating.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.gating.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.gating.py"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithRootFunctions)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    EXPECT_FALSE(generator->isRootFunctionsGenerated());
+
+    generator->setModel(analyserModel);
+    generator->setRootFunctionsGenerated(true);
+
+    EXPECT_TRUE(generator->isRootFunctionsGenerated());
+
+    auto profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.root_functions.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.root_functions.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.root_functions.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.root_functions.py"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952DaeWithNewtonSolvers)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+    generator->setNewtonSolversGenerated(true);
+
+    auto profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.dae.newton.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.newton.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.newton.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.newton.py"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithNumpyProfile)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::NUMPY);
+
+    generator->setModel(analyserModel);
+    generator->setProfile(profile);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.numpy.py"), generator->implementationCode());
+}
+
+TEST(Generator, rootFunctions)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/root_functions/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+    generator->setRootFunctionsGenerated(true);
+
+    EXPECT_EQ(fileContents("generator/root_functions/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/root_functions/model.c"), generator->implementationCode());
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/root_functions/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952NlaWithGatingCoefficients)
+{
+    // Same as the hodgkinHuxleySquidAxonModel1952Nla test, except that we ask
+    // for the gating coefficients. None of the ODEs is linear in its state
+    // (since the rates are computed using NLA systems), so the generated code
+    // is the same as for the hodgkinHuxleySquidAxonModel1952Nla test.
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+    generator->setGatingCoefficientsGenerated(true);
+
+    auto profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.dae.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.py"), generator->implementationCode());
+}
+
+TEST(Generator, nobleModel1962)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/noble_model_1962/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    EXPECT_EQ(fileContents("generator/noble_model_1962/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/noble_model_1962/model.c"), generator->implementationCode());
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/noble_model_1962/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, robertsonOdeModel1966)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/robertson_model_1966/model.ode.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    auto profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.ode.h");
+
+    EXPECT_EQ(fileContents("generator/robertson_model_1966/model.ode.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/robertson_model_1966/model.ode.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/robertson_model_1966/model.ode.py"), generator->implementationCode());
+}
+
+TEST(Generator, robertsonDaeModel1966)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/robertson_model_1966/model.dae.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    auto profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.dae.h");
+
+    EXPECT_EQ(fileContents("generator/robertson_model_1966/model.dae.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/robertson_model_1966/model.dae.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/robertson_model_1966/model.dae.py"), generator->implementationCode());
+}
+
+TEST(Generator, sineImports)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("sine_approximations_import.xml"));
+    auto importer = libcellml::Importer::create();
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+    EXPECT_TRUE(model->hasUnresolvedImports());
+
+    importer->resolveImports(model, resourcePath());
+
+    EXPECT_FALSE(model->hasUnresolvedImports());
+
+    model = importer->flattenModel(model);
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    EXPECT_EQ(fileContents("generator/sine_model_imports/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/sine_model_imports/model.c"), generator->implementationCode());
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/sine_model_imports/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, analyserModelScopeTest)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    libcellml::AnalyserModelPtr analyserModel = nullptr;
+
+    {
+        auto analyser = libcellml::Analyser::create();
+
+        analyser->analyseModel(model);
+
+        EXPECT_EQ(size_t(0), analyser->errorCount());
+
+        analyserModel = analyser->model();
+    }
+
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.c"), generator->implementationCode());
+}
+
+TEST(Generator, daeModel)
+{
+    auto parser = libcellml::Parser::create(false);
+    auto model = parser->parseModel(fileContents("generator/dae_cellml_1_1_model/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->errorCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    EXPECT_EQ(fileContents("generator/dae_cellml_1_1_model/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/dae_cellml_1_1_model/model.c"), generator->implementationCode());
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/dae_cellml_1_1_model/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, variableInitialisedUsingAConstant)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/variable_initialised_using_a_constant/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    EXPECT_EQ(fileContents("generator/variable_initialised_using_a_constant/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/variable_initialised_using_a_constant/model.c"), generator->implementationCode());
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/variable_initialised_using_a_constant/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, jacobianModel)
+{
+    // Generate the Jacobian of a model that uses all the mathematical
+    // functions that can be differentiated, as well as algebraic variables
+    // that require the chain rule to be applied.
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/jacobian_model/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+    generator->setJacobianGenerated(true);
+
+    EXPECT_EQ(fileContents("generator/jacobian_model/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/jacobian_model/model.c"), generator->implementationCode());
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/jacobian_model/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, modelOutOfScope)
+{
+    libcellml::AnalyserModelPtr analyserModel;
+
+    {
+        auto analyser = libcellml::Analyser::create();
+        auto parser = libcellml::Parser::create();
+        auto model = parser->parseModel(fileContents("generator/ode_multiple_dependent_odes/model.cellml"));
+
+        EXPECT_EQ(size_t(0), parser->issueCount());
+
+        analyser->analyseModel(model);
+
+        EXPECT_EQ(size_t(0), analyser->errorCount());
+
+        analyserModel = analyser->model();
+    }
+
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/ode_multiple_dependent_odes/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, unknownVariableMarkedAsExternalVariable)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/unknown_variable_as_external_variable/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->addExternalVariable(libcellml::AnalyserExternalVariable::create(model->component("SLC_template3_ss")->variable("P_3")));
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    EXPECT_EQ(fileContents("generator/unknown_variable_as_external_variable/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/unknown_variable_as_external_variable/model.c"), generator->implementationCode());
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/unknown_variable_as_external_variable/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, bouncingBall)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/bouncing_ball/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    EXPECT_EQ(fileContents("generator/bouncing_ball/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/bouncing_ball/model.c"), generator->implementationCode());
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/bouncing_ball/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, bouncingBallWithExternalVariable)
+{
+    // The test variable of two of the resets is an external variable, so its
+    // value is not computed when computing the event conditions.
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/bouncing_ball/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->addExternalVariable(libcellml::AnalyserExternalVariable::create(model->component("ball")->variable("h")));
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    auto profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.external.h");
+
+    EXPECT_EQ(fileContents("generator/bouncing_ball/model.external.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/bouncing_ball/model.external.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/bouncing_ball/model.external.py"), generator->implementationCode());
 }
 
 TEST(Generator, modelWithComplexUnitsOutOfScope)
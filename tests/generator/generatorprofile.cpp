@@ -282,6 +282,15 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
     EXPECT_EQ("extern const size_t VARIABLE_COUNT;\n", generatorProfile->interfaceVariableCountString());
     EXPECT_EQ("const size_t VARIABLE_COUNT = [VARIABLE_COUNT];\n", generatorProfile->implementationVariableCountString());
 
+    EXPECT_EQ("extern const size_t CONSTANT_COUNT;\n", generatorProfile->interfaceConstantCountString());
+    EXPECT_EQ("const size_t CONSTANT_COUNT = [CONSTANT_COUNT];\n", generatorProfile->implementationConstantCountString());
+
+    EXPECT_EQ("extern const size_t COMPUTED_CONSTANT_COUNT;\n", generatorProfile->interfaceComputedConstantCountString());
+    EXPECT_EQ("const size_t COMPUTED_CONSTANT_COUNT = [COMPUTED_CONSTANT_COUNT];\n", generatorProfile->implementationComputedConstantCountString());
+
+    EXPECT_EQ("extern const size_t ALGEBRAIC_COUNT;\n", generatorProfile->interfaceAlgebraicCountString());
+    EXPECT_EQ("const size_t ALGEBRAIC_COUNT = [ALGEBRAIC_COUNT];\n", generatorProfile->implementationAlgebraicCountString());
+
     EXPECT_EQ("typedef enum {\n"
               "    CONSTANT,\n"
               "    COMPUTED_CONSTANT,\n"
@@ -343,6 +352,24 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
               "};\n",
               generatorProfile->implementationVariableInfoString());
 
+    EXPECT_EQ("extern const VariableInfo CONSTANT_INFO[];\n", generatorProfile->interfaceConstantInfoString());
+    EXPECT_EQ("const VariableInfo CONSTANT_INFO[] = {\n"
+              "[CODE]"
+              "};\n",
+              generatorProfile->implementationConstantInfoString());
+
+    EXPECT_EQ("extern const VariableInfo COMPUTED_CONSTANT_INFO[];\n", generatorProfile->interfaceComputedConstantInfoString());
+    EXPECT_EQ("const VariableInfo COMPUTED_CONSTANT_INFO[] = {\n"
+              "[CODE]"
+              "};\n",
+              generatorProfile->implementationComputedConstantInfoString());
+
+    EXPECT_EQ("extern const VariableInfo ALGEBRAIC_INFO[];\n", generatorProfile->interfaceAlgebraicInfoString());
+    EXPECT_EQ("const VariableInfo ALGEBRAIC_INFO[] = {\n"
+              "[CODE]"
+              "};\n",
+              generatorProfile->implementationAlgebraicInfoString());
+
     EXPECT_EQ("{\"[NAME]\", \"[UNITS]\", \"[COMPONENT]\", [TYPE]}", generatorProfile->variableInfoEntryString());
 
     EXPECT_EQ("voi", generatorProfile->voiString());
@@ -350,6 +377,13 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
     EXPECT_EQ("states", generatorProfile->statesArrayString());
     EXPECT_EQ("rates", generatorProfile->ratesArrayString());
     EXPECT_EQ("variables", generatorProfile->variablesArrayString());
+    EXPECT_EQ("constants", generatorProfile->constantsArrayString());
+    EXPECT_EQ("computedConstants", generatorProfile->computedConstantsArrayString());
+    EXPECT_EQ("algebraic", generatorProfile->algebraicArrayString());
+
+    EXPECT_EQ("double *[ARRAY]", generatorProfile->variablesParameterString());
+    EXPECT_EQ("    double *[ARRAY];\n", generatorProfile->variablesMemberString());
+    EXPECT_EQ("    double *[ARRAY] = ((RootFindingInfo *) data)->[ARRAY];\n", generatorProfile->variablesDataString());
 
     EXPECT_EQ("typedef double (* ExternalVariable)(double *variables, size_t index);\n", generatorProfile->externalVariableMethodTypeDefinitionString(false));
     EXPECT_EQ("typedef double (* ExternalVariable)(double voi, double *states, double *rates, double *variables, size_t index);\n", generatorProfile->externalVariableMethodTypeDefinitionString(true));
@@ -426,10 +460,137 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
               "[CODE]"
               "}\n",
               generatorProfile->objectiveFunctionMethodString(true));
+    EXPECT_EQ("void objectiveJacobian[INDEX](double *u, double *jacobian, void *data)\n"
+              "{\n"
+              "    double *variables = ((RootFindingInfo *) data)->variables;\n"
+              "\n"
+              "[CODE]"
+              "}\n",
+              generatorProfile->objectiveJacobianMethodString(false));
+    EXPECT_EQ("void objectiveJacobian[INDEX](double *u, double *jacobian, void *data)\n"
+              "{\n"
+              "    double voi = ((RootFindingInfo *) data)->voi;\n"
+              "    double *states = ((RootFindingInfo *) data)->states;\n"
+              "    double *rates = ((RootFindingInfo *) data)->rates;\n"
+              "    double *variables = ((RootFindingInfo *) data)->variables;\n"
+              "\n"
+              "[CODE]"
+              "}\n",
+              generatorProfile->objectiveJacobianMethodString(true));
+    EXPECT_EQ("void objectiveJacobian[INDEX](double *u, double *f, double *jacobian, void *data)\n"
+              "{\n"
+              "    double fh[[SIZE]];\n"
+              "\n"
+              "    for (size_t j = 0; j < [SIZE]; ++j) {\n"
+              "        double uj = u[j];\n"
+              "        double h = 1.0e-8*fmax(1.0, fabs(uj));\n"
+              "\n"
+              "        u[j] = uj+h;\n"
+              "\n"
+              "        objectiveFunction[INDEX](u, fh, data);\n"
+              "\n"
+              "        u[j] = uj;\n"
+              "\n"
+              "        for (size_t i = 0; i < [SIZE]; ++i) {\n"
+              "            jacobian[i*[SIZE]+j] = (fh[i]-f[i])/h;\n"
+              "        }\n"
+              "    }\n"
+              "}\n",
+              generatorProfile->finiteDifferenceObjectiveJacobianMethodString());
+    EXPECT_EQ("for (int iteration = 0; iteration < 50; ++iteration) {\n"
+              "        double f[[SIZE]];\n"
+              "        double jacobian[[SIZE]*[SIZE]];\n"
+              "        int converged = 1;\n"
+              "\n"
+              "        objectiveFunction[INDEX](u, f, &rfi);\n"
+              "\n"
+              "        for (size_t i = 0; i < [SIZE]; ++i) {\n"
+              "            converged = converged && (fabs(f[i]) <= 1.0e-10);\n"
+              "        }\n"
+              "\n"
+              "        if (converged) {\n"
+              "            break;\n"
+              "        }\n"
+              "\n"
+              "        objectiveJacobian[INDEX](u, [F_ARGUMENT]jacobian, &rfi);\n"
+              "\n"
+              "[CODE]"
+              "    }\n",
+              generatorProfile->newtonSolveCallString(false));
+    EXPECT_EQ("for (int iteration = 0; iteration < 50; ++iteration) {\n"
+              "        double f[[SIZE]];\n"
+              "        double jacobian[[SIZE]*[SIZE]];\n"
+              "        int converged = 1;\n"
+              "\n"
+              "        objectiveFunction[INDEX](u, f, &rfi);\n"
+              "\n"
+              "        for (size_t i = 0; i < [SIZE]; ++i) {\n"
+              "            converged = converged && (fabs(f[i]) <= 1.0e-10);\n"
+              "        }\n"
+              "\n"
+              "        if (converged) {\n"
+              "            break;\n"
+              "        }\n"
+              "\n"
+              "        objectiveJacobian[INDEX](u, [F_ARGUMENT]jacobian, &rfi);\n"
+              "\n"
+              "[CODE]"
+              "    }\n",
+              generatorProfile->newtonSolveCallString(true));
     EXPECT_EQ("u",
               generatorProfile->uArrayString());
     EXPECT_EQ("f",
               generatorProfile->fArrayString());
+    EXPECT_EQ("jacobian",
+              generatorProfile->jacobianArrayString());
+    EXPECT_EQ("steadyStates",
+              generatorProfile->steadyStatesArrayString());
+    EXPECT_EQ("timeConstants",
+              generatorProfile->timeConstantsArrayString());
+    EXPECT_EQ("conditions",
+              generatorProfile->conditionsArrayString());
+    EXPECT_EQ("events",
+              generatorProfile->eventsArrayString());
+    EXPECT_EQ("resetValues",
+              generatorProfile->resetValuesArrayString());
+    EXPECT_EQ("g",
+              generatorProfile->rootFunctionsArrayString());
+
+    EXPECT_EQ("extern const size_t JACOBIAN_NONZERO_COUNT;\n"
+              "extern const size_t JACOBIAN_ROW_POINTERS[];\n"
+              "extern const size_t JACOBIAN_COLUMN_INDICES[];\n"
+              "extern const size_t JACOBIAN_COLUMN_POINTERS[];\n"
+              "extern const size_t JACOBIAN_ROW_INDICES[];\n",
+              generatorProfile->interfaceJacobianSparsityPatternString());
+    EXPECT_EQ("const size_t JACOBIAN_NONZERO_COUNT = [NONZERO_COUNT];\n"
+              "const size_t JACOBIAN_ROW_POINTERS[] = {[ROW_POINTERS]};\n"
+              "const size_t JACOBIAN_COLUMN_INDICES[] = {[COLUMN_INDICES]};\n"
+              "const size_t JACOBIAN_COLUMN_POINTERS[] = {[COLUMN_POINTERS]};\n"
+              "const size_t JACOBIAN_ROW_INDICES[] = {[ROW_INDICES]};\n",
+              generatorProfile->implementationJacobianSparsityPatternString());
+    EXPECT_EQ("static const size_t OBJECTIVE_JACOBIAN_[INDEX]_NONZERO_COUNT = [NONZERO_COUNT];\n"
+              "static const size_t OBJECTIVE_JACOBIAN_[INDEX]_ROW_POINTERS[] = {[ROW_POINTERS]};\n"
+              "static const size_t OBJECTIVE_JACOBIAN_[INDEX]_COLUMN_INDICES[] = {[COLUMN_INDICES]};\n"
+              "static const size_t OBJECTIVE_JACOBIAN_[INDEX]_COLUMN_POINTERS[] = {[COLUMN_POINTERS]};\n"
+              "static const size_t OBJECTIVE_JACOBIAN_[INDEX]_ROW_INDICES[] = {[ROW_INDICES]};\n",
+              generatorProfile->objectiveJacobianSparsityPatternString());
+
+    EXPECT_EQ("extern const size_t GATING_STATE_COUNT;\n"
+              "extern const size_t GATING_STATE_INDICES[];\n",
+              generatorProfile->interfaceGatingStateIndicesString());
+    EXPECT_EQ("const size_t GATING_STATE_COUNT = [GATING_STATE_COUNT];\n"
+              "const size_t GATING_STATE_INDICES[] = {[GATING_STATE_INDICES]};\n",
+              generatorProfile->implementationGatingStateIndicesString());
+
+    EXPECT_EQ("extern const size_t EVENT_COUNT;\n",
+              generatorProfile->interfaceEventCountString());
+    EXPECT_EQ("const size_t EVENT_COUNT = [EVENT_COUNT];\n",
+              generatorProfile->implementationEventCountString());
+
+    EXPECT_EQ("extern const size_t ROOT_FUNCTION_COUNT;\n",
+              generatorProfile->interfaceRootFunctionCountString());
+    EXPECT_EQ("const size_t ROOT_FUNCTION_COUNT = [ROOT_FUNCTION_COUNT];\n",
+              generatorProfile->implementationRootFunctionCountString());
 
     EXPECT_EQ("double * createVariablesArray();\n",
               generatorProfile->interfaceCreateVariablesArrayMethodString());
@@ -445,6 +606,45 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
               "}\n",
               generatorProfile->implementationCreateVariablesArrayMethodString());
 
+    EXPECT_EQ("double * createConstantsArray();\n", generatorProfile->interfaceCreateConstantsArrayMethodString());
+    EXPECT_EQ("double * createConstantsArray()\n"
+              "{\n"
+              "    double *res = (double *) malloc(CONSTANT_COUNT*sizeof(double));\n"
+              "\n"
+              "    for (size_t i = 0; i < CONSTANT_COUNT; ++i) {\n"
+              "        res[i] = NAN;\n"
+              "    }\n"
+              "\n"
+              "    return res;\n"
+              "}\n",
+              generatorProfile->implementationCreateConstantsArrayMethodString());
+
+    EXPECT_EQ("double * createComputedConstantsArray();\n", generatorProfile->interfaceCreateComputedConstantsArrayMethodString());
+    EXPECT_EQ("double * createComputedConstantsArray()\n"
+              "{\n"
+              "    double *res = (double *) malloc(COMPUTED_CONSTANT_COUNT*sizeof(double));\n"
+              "\n"
+              "    for (size_t i = 0; i < COMPUTED_CONSTANT_COUNT; ++i) {\n"
+              "        res[i] = NAN;\n"
+              "    }\n"
+              "\n"
+              "    return res;\n"
+              "}\n",
+              generatorProfile->implementationCreateComputedConstantsArrayMethodString());
+
+    EXPECT_EQ("double * createAlgebraicArray();\n", generatorProfile->interfaceCreateAlgebraicArrayMethodString());
+    EXPECT_EQ("double * createAlgebraicArray()\n"
+              "{\n"
+              "    double *res = (double *) malloc(ALGEBRAIC_COUNT*sizeof(double));\n"
+              "\n"
+              "    for (size_t i = 0; i < ALGEBRAIC_COUNT; ++i) {\n"
+              "        res[i] = NAN;\n"
+              "    }\n"
+              "\n"
+              "    return res;\n"
+              "}\n",
+              generatorProfile->implementationCreateAlgebraicArrayMethodString());
+
     EXPECT_EQ("void deleteArray(double *array);\n",
               generatorProfile->interfaceDeleteArrayMethodString());
     EXPECT_EQ("void deleteArray(double *array)\n"
@@ -541,6 +741,48 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
               "}\n",
               generatorProfile->implementationComputeVariablesMethodString(true, true));
 
+    EXPECT_EQ("void computeJacobian(double voi, double *states, double *rates, double *variables, double *jacobian);\n",
+              generatorProfile->interfaceComputeJacobianMethodString());
+    EXPECT_EQ("void computeJacobian(double voi, double *states, double *rates, double *variables, double *jacobian)\n"
+              "{\n"
+              "[CODE]"
+              "}\n",
+              generatorProfile->implementationComputeJacobianMethodString());
+
+    EXPECT_EQ("void computeGatingCoefficients(double voi, double *states, double *rates, double *variables, double *steadyStates, double *timeConstants);\n",
+              generatorProfile->interfaceComputeGatingCoefficientsMethodString());
+    EXPECT_EQ("void computeGatingCoefficients(double voi, double *states, double *rates, double *variables, double *steadyStates, double *timeConstants)\n"
+              "{\n"
+              "[CODE]"
+              "}\n",
+              generatorProfile->implementationComputeGatingCoefficientsMethodString());
+
+    EXPECT_EQ("void computeEventConditions(double voi, double *states, double *rates, double *variables, double *conditions);\n",
+              generatorProfile->interfaceComputeEventConditionsMethodString());
+    EXPECT_EQ("void computeEventConditions(double voi, double *states, double *rates, double *variables, double *conditions)\n"
+              "{\n"
+              "[CODE]"
+              "}\n",
+              generatorProfile->implementationComputeEventConditionsMethodString());
+
+    EXPECT_EQ("void applyResets(double voi, double *states, double *rates, double *variables, int *events);\n",
+              generatorProfile->interfaceApplyResetsMethodString());
+    EXPECT_EQ("void applyResets(double voi, double *states, double *rates, double *variables, int *events)\n"
+              "{\n"
+              "    double resetValues[[RESET_VARIABLE_COUNT]];\n"
+              "\n"
+              "[CODE]"
+              "}\n",
+              generatorProfile->implementationApplyResetsMethodString());
+
+    EXPECT_EQ("void computeRootFunctions(double voi, double *states, double *rates, double *variables, double *g);\n",
+              generatorProfile->interfaceComputeRootFunctionsMethodString());
+    EXPECT_EQ("void computeRootFunctions(double voi, double *states, double *rates, double *variables, double *g)\n"
+              "{\n"
+              "[CODE]"
+              "}\n",
+              generatorProfile->implementationComputeRootFunctionsMethodString());
+
     EXPECT_EQ("", generatorProfile->emptyMethodString());
 
     EXPECT_EQ("    ", generatorProfile->indentString());
@@ -575,6 +817,65 @@ TEST(GeneratorProfile, generalSettings)
     EXPECT_EQ(falseValue, generatorProfile->hasInterface());
 }
 
+TEST(GeneratorProfile, numpyValues)
+{
+    // A NumPy profile is a Python profile that relies on NumPy's universal
+    // functions, so check some of the values that differ between the two.
+
+    libcellml::GeneratorProfilePtr generatorProfile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::NUMPY);
+
+    EXPECT_EQ(libcellml::GeneratorProfile::Profile::NUMPY, generatorProfile->profile());
+    EXPECT_EQ("numpy", libcellml::GeneratorProfile::profileAsString(generatorProfile->profile()));
+
+    EXPECT_EQ(false, generatorProfile->hasInterface());
+
+    EXPECT_EQ("np.greater_equal", generatorProfile->geqString());
+    EXPECT_EQ("np.logical_and", generatorProfile->andString());
+    EXPECT_EQ(false, generatorProfile->hasGeqOperator());
+    EXPECT_EQ(false, generatorProfile->hasAndOperator());
+
+    EXPECT_EQ("np.exp", generatorProfile->exponentialString());
+    EXPECT_EQ("np.minimum", generatorProfile->minString());
+    EXPECT_EQ("np.arcsin", generatorProfile->asinString());
+
+    EXPECT_EQ("np.where([CONDITION], [IF_STATEMENT]", generatorProfile->piecewiseIfString());
+    EXPECT_EQ(", [ELSE_STATEMENT])", generatorProfile->piecewiseElseString());
+    EXPECT_EQ(false, generatorProfile->hasConditionalOperator());
+
+    EXPECT_EQ("np.nan", generatorProfile->nanString());
+
+    EXPECT_EQ("", generatorProfile->geqFunctionString());
+    EXPECT_EQ("", generatorProfile->minFunctionString());
+    EXPECT_EQ("\n"
+              "def sec(x):\n"
+              "    return 1.0/np.cos(x)\n",
+              generatorProfile->secFunctionString());
+
+    EXPECT_EQ("from enum import Enum\n"
+              "\n"
+              "import numpy as np\n"
+              "\n",
+              generatorProfile->implementationHeaderString());
+    EXPECT_EQ("\n"
+              "def create_states_array(cell_count=1):\n"
+              "    return np.full((STATE_COUNT, cell_count), np.nan)\n",
+              generatorProfile->implementationCreateStatesArrayMethodString());
+
+    // The Newton solver works on copies of the unknowns, which are rows of our
+    // arrays.
+
+    EXPECT_EQ(size_t(0), generatorProfile->newtonSolveCallString(false).find("u = [ui.copy() for ui in u]\n"));
+    EXPECT_EQ(size_t(0), generatorProfile->newtonSolveCallString(true).find("u = [ui.copy() for ui in u]\n"));
+    EXPECT_NE(std::string::npos, generatorProfile->finiteDifferenceObjectiveJacobianMethodString().find("        uj = u[j].copy()\n"));
+
+    // Switching back to a Python profile restores the Python values.
+
+    generatorProfile->setProfile(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    EXPECT_EQ("geq_func", generatorProfile->geqString());
+    EXPECT_EQ(true, generatorProfile->hasConditionalOperator());
+}
+
 TEST(GeneratorProfile, relationalAndLogicalOperators)
 {
     libcellml::GeneratorProfilePtr generatorProfile = libcellml::GeneratorProfile::create();
@@ -868,6 +1169,15 @@ TEST(GeneratorProfile, miscellaneous)
     generatorProfile->setInterfaceVariableCountString(value);
     generatorProfile->setImplementationVariableCountString(value);
 
+    generatorProfile->setInterfaceConstantCountString(value);
+    generatorProfile->setImplementationConstantCountString(value);
+
+    generatorProfile->setInterfaceComputedConstantCountString(value);
+    generatorProfile->setImplementationComputedConstantCountString(value);
+
+    generatorProfile->setInterfaceAlgebraicCountString(value);
+    generatorProfile->setImplementationAlgebraicCountString(value);
+
     generatorProfile->setVariableTypeObjectString(false, false, value);
     generatorProfile->setVariableTypeObjectString(false, true, value);
     generatorProfile->setVariableTypeObjectString(true, false, value);
@@ -891,6 +1201,15 @@ TEST(GeneratorProfile, miscellaneous)
     generatorProfile->setInterfaceVariableInfoString(value);
     generatorProfile->setImplementationVariableInfoString(value);
 
+    generatorProfile->setInterfaceConstantInfoString(value);
+    generatorProfile->setImplementationConstantInfoString(value);
+
+    generatorProfile->setInterfaceComputedConstantInfoString(value);
+    generatorProfile->setImplementationComputedConstantInfoString(value);
+
+    generatorProfile->setInterfaceAlgebraicInfoString(value);
+    generatorProfile->setImplementationAlgebraicInfoString(value);
+
     generatorProfile->setVariableInfoEntryString(value);
 
     generatorProfile->setVoiString(value);
@@ -898,6 +1217,13 @@ TEST(GeneratorProfile, miscellaneous)
     generatorProfile->setStatesArrayString(value);
     generatorProfile->setRatesArrayString(value);
     generatorProfile->setVariablesArrayString(value);
+    generatorProfile->setConstantsArrayString(value);
+    generatorProfile->setComputedConstantsArrayString(value);
+    generatorProfile->setAlgebraicArrayString(value);
+
+    generatorProfile->setVariablesParameterString(value);
+    generatorProfile->setVariablesMemberString(value);
+    generatorProfile->setVariablesDataString(value);
 
     generatorProfile->setExternalVariableMethodTypeDefinitionString(false, value);
     generatorProfile->setExternalVariableMethodTypeDefinitionString(true, value);
@@ -919,12 +1245,46 @@ TEST(GeneratorProfile, miscellaneous)
     generatorProfile->setNlaSolveCallString(true, value);
     generatorProfile->setObjectiveFunctionMethodString(false, value);
     generatorProfile->setObjectiveFunctionMethodString(true, value);
+    generatorProfile->setObjectiveJacobianMethodString(false, value);
+    generatorProfile->setObjectiveJacobianMethodString(true, value);
+    generatorProfile->setFiniteDifferenceObjectiveJacobianMethodString(value);
+    generatorProfile->setNewtonSolveCallString(false, value);
+    generatorProfile->setNewtonSolveCallString(true, value);
     generatorProfile->setUArrayString(value);
     generatorProfile->setFArrayString(value);
+    generatorProfile->setJacobianArrayString(value);
+    generatorProfile->setSteadyStatesArrayString(value);
+    generatorProfile->setTimeConstantsArrayString(value);
+    generatorProfile->setConditionsArrayString(value);
+    generatorProfile->setEventsArrayString(value);
+    generatorProfile->setResetValuesArrayString(value);
+    generatorProfile->setRootFunctionsArrayString(value);
+
+    generatorProfile->setInterfaceJacobianSparsityPatternString(value);
+    generatorProfile->setImplementationJacobianSparsityPatternString(value);
+    generatorProfile->setObjectiveJacobianSparsityPatternString(value);
+
+    generatorProfile->setInterfaceGatingStateIndicesString(value);
+    generatorProfile->setImplementationGatingStateIndicesString(value);
+
+    generatorProfile->setInterfaceEventCountString(value);
+    generatorProfile->setImplementationEventCountString(value);
+
+    generatorProfile->setInterfaceRootFunctionCountString(value);
+    generatorProfile->setImplementationRootFunctionCountString(value);
 
     generatorProfile->setInterfaceCreateVariablesArrayMethodString(value);
     generatorProfile->setImplementationCreateVariablesArrayMethodString(value);
 
+    generatorProfile->setInterfaceCreateConstantsArrayMethodString(value);
+    generatorProfile->setImplementationCreateConstantsArrayMethodString(value);
+
+    generatorProfile->setInterfaceCreateComputedConstantsArrayMethodString(value);
+    generatorProfile->setImplementationCreateComputedConstantsArrayMethodString(value);
+
+    generatorProfile->setInterfaceCreateAlgebraicArrayMethodString(value);
+    generatorProfile->setImplementationCreateAlgebraicArrayMethodString(value);
+
     generatorProfile->setInterfaceDeleteArrayMethodString(value);
     generatorProfile->setImplementationDeleteArrayMethodString(value);
 
@@ -961,6 +1321,21 @@ TEST(GeneratorProfile, miscellaneous)
     generatorProfile->setInterfaceComputeVariablesMethodString(true, true, value);
     generatorProfile->setImplementationComputeVariablesMethodString(true, true, value);
 
+    generatorProfile->setInterfaceComputeJacobianMethodString(value);
+    generatorProfile->setImplementationComputeJacobianMethodString(value);
+
+    generatorProfile->setInterfaceComputeGatingCoefficientsMethodString(value);
+    generatorProfile->setImplementationComputeGatingCoefficientsMethodString(value);
+
+    generatorProfile->setInterfaceComputeEventConditionsMethodString(value);
+    generatorProfile->setImplementationComputeEventConditionsMethodString(value);
+
+    generatorProfile->setInterfaceApplyResetsMethodString(value);
+    generatorProfile->setImplementationApplyResetsMethodString(value);
+
+    generatorProfile->setInterfaceComputeRootFunctionsMethodString(value);
+    generatorProfile->setImplementationComputeRootFunctionsMethodString(value);
+
     generatorProfile->setEmptyMethodString(value);
 
     generatorProfile->setIndentString(value);
@@ -997,6 +1372,15 @@ TEST(GeneratorProfile, miscellaneous)
     EXPECT_EQ(value, generatorProfile->interfaceVariableCountString());
     EXPECT_EQ(value, generatorProfile->implementationVariableCountString());
 
+    EXPECT_EQ(value, generatorProfile->interfaceConstantCountString());
+    EXPECT_EQ(value, generatorProfile->implementationConstantCountString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceComputedConstantCountString());
+    EXPECT_EQ(value, generatorProfile->implementationComputedConstantCountString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceAlgebraicCountString());
+    EXPECT_EQ(value, generatorProfile->implementationAlgebraicCountString());
+
     EXPECT_EQ(value, generatorProfile->variableTypeObjectString(false, false));
     EXPECT_EQ(value, generatorProfile->variableTypeObjectString(false, true));
     EXPECT_EQ(value, generatorProfile->variableTypeObjectString(true, false));
@@ -1020,6 +1404,15 @@ TEST(GeneratorProfile, miscellaneous)
     EXPECT_EQ(value, generatorProfile->interfaceVariableInfoString());
     EXPECT_EQ(value, generatorProfile->implementationVariableInfoString());
 
+    EXPECT_EQ(value, generatorProfile->interfaceConstantInfoString());
+    EXPECT_EQ(value, generatorProfile->implementationConstantInfoString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceComputedConstantInfoString());
+    EXPECT_EQ(value, generatorProfile->implementationComputedConstantInfoString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceAlgebraicInfoString());
+    EXPECT_EQ(value, generatorProfile->implementationAlgebraicInfoString());
+
     EXPECT_EQ(value, generatorProfile->variableInfoEntryString());
 
     EXPECT_EQ(value, generatorProfile->voiString());
@@ -1027,6 +1420,13 @@ TEST(GeneratorProfile, miscellaneous)
     EXPECT_EQ(value, generatorProfile->statesArrayString());
     EXPECT_EQ(value, generatorProfile->ratesArrayString());
     EXPECT_EQ(value, generatorProfile->variablesArrayString());
+    EXPECT_EQ(value, generatorProfile->constantsArrayString());
+    EXPECT_EQ(value, generatorProfile->computedConstantsArrayString());
+    EXPECT_EQ(value, generatorProfile->algebraicArrayString());
+
+    EXPECT_EQ(value, generatorProfile->variablesParameterString());
+    EXPECT_EQ(value, generatorProfile->variablesMemberString());
+    EXPECT_EQ(value, generatorProfile->variablesDataString());
 
     EXPECT_EQ(value, generatorProfile->externalVariableMethodTypeDefinitionString(false));
     EXPECT_EQ(value, generatorProfile->externalVariableMethodTypeDefinitionString(true));
@@ -1048,12 +1448,46 @@ TEST(GeneratorProfile, miscellaneous)
     EXPECT_EQ(value, generatorProfile->nlaSolveCallString(true));
     EXPECT_EQ(value, generatorProfile->objectiveFunctionMethodString(false));
     EXPECT_EQ(value, generatorProfile->objectiveFunctionMethodString(true));
+    EXPECT_EQ(value, generatorProfile->objectiveJacobianMethodString(false));
+    EXPECT_EQ(value, generatorProfile->objectiveJacobianMethodString(true));
+    EXPECT_EQ(value, generatorProfile->finiteDifferenceObjectiveJacobianMethodString());
+    EXPECT_EQ(value, generatorProfile->newtonSolveCallString(false));
+    EXPECT_EQ(value, generatorProfile->newtonSolveCallString(true));
     EXPECT_EQ(value, generatorProfile->uArrayString());
     EXPECT_EQ(value, generatorProfile->fArrayString());
+    EXPECT_EQ(value, generatorProfile->jacobianArrayString());
+    EXPECT_EQ(value, generatorProfile->steadyStatesArrayString());
+    EXPECT_EQ(value, generatorProfile->timeConstantsArrayString());
+    EXPECT_EQ(value, generatorProfile->conditionsArrayString());
+    EXPECT_EQ(value, generatorProfile->eventsArrayString());
+    EXPECT_EQ(value, generatorProfile->resetValuesArrayString());
+    EXPECT_EQ(value, generatorProfile->rootFunctionsArrayString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceJacobianSparsityPatternString());
+    EXPECT_EQ(value, generatorProfile->implementationJacobianSparsityPatternString());
+    EXPECT_EQ(value, generatorProfile->objectiveJacobianSparsityPatternString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceGatingStateIndicesString());
+    EXPECT_EQ(value, generatorProfile->implementationGatingStateIndicesString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceEventCountString());
+    EXPECT_EQ(value, generatorProfile->implementationEventCountString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceRootFunctionCountString());
+    EXPECT_EQ(value, generatorProfile->implementationRootFunctionCountString());
 
     EXPECT_EQ(value, generatorProfile->interfaceCreateVariablesArrayMethodString());
     EXPECT_EQ(value, generatorProfile->implementationCreateVariablesArrayMethodString());
 
+    EXPECT_EQ(value, generatorProfile->interfaceCreateConstantsArrayMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationCreateConstantsArrayMethodString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceCreateComputedConstantsArrayMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationCreateComputedConstantsArrayMethodString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceCreateAlgebraicArrayMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationCreateAlgebraicArrayMethodString());
+
     EXPECT_EQ(value, generatorProfile->interfaceDeleteArrayMethodString());
     EXPECT_EQ(value, generatorProfile->implementationDeleteArrayMethodString());
 
@@ -1090,6 +1524,21 @@ TEST(GeneratorProfile, miscellaneous)
     EXPECT_EQ(value, generatorProfile->interfaceComputeVariablesMethodString(true, true));
     EXPECT_EQ(value, generatorProfile->implementationComputeVariablesMethodString(true, true));
 
+    EXPECT_EQ(value, generatorProfile->interfaceComputeJacobianMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeJacobianMethodString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceComputeGatingCoefficientsMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeGatingCoefficientsMethodString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceComputeEventConditionsMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeEventConditionsMethodString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceApplyResetsMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationApplyResetsMethodString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceComputeRootFunctionsMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeRootFunctionsMethodString());
+
     EXPECT_EQ(value, generatorProfile->emptyMethodString());
 
     EXPECT_EQ(value, generatorProfile->indentString());
@@ -0,0 +1,241 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+#include <libcellml>
+
+static libcellml::AnalyserModelPtr analyserModel(const std::string &fileName,
+                                                 const std::string &externalComponentName = "",
+                                                 const std::string &externalVariableName = "")
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents(fileName));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    if (!externalComponentName.empty()) {
+        analyser->addExternalVariable(libcellml::AnalyserExternalVariable::create(model->component(externalComponentName, true)->variable(externalVariableName)));
+    }
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    return analyser->model();
+}
+
+TEST(Interpreter, noModel)
+{
+    auto interpreter = libcellml::Interpreter::create();
+
+    EXPECT_EQ(nullptr, interpreter->model());
+
+    interpreter->initialiseVariables();
+    interpreter->computeComputedConstants();
+    interpreter->computeRates();
+    interpreter->computeVariables();
+
+    EXPECT_EQ(0.0, interpreter->voi());
+    EXPECT_EQ(size_t(0), interpreter->states().size());
+    EXPECT_EQ(size_t(0), interpreter->rates().size());
+    EXPECT_EQ(size_t(0), interpreter->variables().size());
+    EXPECT_TRUE(std::isnan(interpreter->state(0)));
+    EXPECT_TRUE(std::isnan(interpreter->rate(0)));
+    EXPECT_TRUE(std::isnan(interpreter->variable(0)));
+}
+
+TEST(Interpreter, invalidModel)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("analyser/initialised_variable_of_integration.cellml"));
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(libcellml::AnalyserModel::Type::INVALID, analyser->model()->type());
+
+    auto interpreter = libcellml::Interpreter::create();
+
+    interpreter->setModel(analyser->model());
+
+    EXPECT_EQ(analyser->model(), interpreter->model());
+    EXPECT_EQ(size_t(0), interpreter->states().size());
+    EXPECT_EQ(size_t(0), interpreter->rates().size());
+    EXPECT_EQ(size_t(0), interpreter->variables().size());
+}
+
+TEST(Interpreter, hodgkinHuxleySquidAxonModel1952)
+{
+    auto analyserModel = ::analyserModel("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml");
+    auto interpreter = libcellml::Interpreter::create();
+
+    interpreter->setModel(analyserModel);
+
+    EXPECT_EQ(analyserModel, interpreter->model());
+    EXPECT_EQ(size_t(4), interpreter->states().size());
+    EXPECT_EQ(size_t(4), interpreter->rates().size());
+    EXPECT_EQ(size_t(18), interpreter->variables().size());
+    EXPECT_TRUE(std::isnan(interpreter->state(0)));
+    EXPECT_TRUE(std::isnan(interpreter->rate(0)));
+    EXPECT_TRUE(std::isnan(interpreter->variable(0)));
+
+    interpreter->initialiseVariables();
+    interpreter->computeComputedConstants();
+    interpreter->computeRates();
+    interpreter->computeVariables();
+
+    EXPECT_EQ(std::vector<double>({0.0, 0.6, 0.05, 0.325}), interpreter->states());
+    EXPECT_NEAR(0.60076874999999963, interpreter->rate(0), 1.0e-15);
+    EXPECT_NEAR(-0.00045552390654006458, interpreter->rate(1), 1.0e-15);
+    EXPECT_NEAR(0.012385538355398518, interpreter->rate(2), 1.0e-15);
+    EXPECT_NEAR(-0.0013415722863204596, interpreter->rate(3), 1.0e-15);
+    EXPECT_EQ(0.0, interpreter->variable(0));
+    EXPECT_NEAR(3.1839, interpreter->variable(2), 1.0e-15);
+    EXPECT_NEAR(-4.8196687499999999, interpreter->variable(3), 1.0e-15);
+    EXPECT_NEAR(1.0350000000000004, interpreter->variable(4), 1.0e-15);
+    EXPECT_NEAR(-10.613, interpreter->variable(6), 1.0e-15);
+
+    // Apply the stimulus, which starts at t = 10 ms.
+
+    interpreter->computeRates(10.2);
+    interpreter->computeVariables(10.2);
+
+    EXPECT_EQ(10.2, interpreter->voi());
+    EXPECT_EQ(-20.0, interpreter->variable(0));
+    EXPECT_NEAR(-19.39923125, interpreter->rate(0), 1.0e-14);
+
+    // Update a state.
+
+    interpreter->setState(0, -10.0);
+    interpreter->setState(4, 123.0);
+
+    EXPECT_EQ(-10.0, interpreter->state(0));
+    EXPECT_TRUE(std::isnan(interpreter->state(4)));
+
+    interpreter->computeRates(0.0);
+
+    EXPECT_NE(0.60076874999999963, interpreter->rate(0));
+}
+
+TEST(Interpreter, hodgkinHuxleySquidAxonModel1952Dae)
+{
+    // The DAE version of the model has to solve several NLA systems, but it
+    // should give the same results as the ODE version.
+
+    auto odeInterpreter = libcellml::Interpreter::create();
+    auto daeInterpreter = libcellml::Interpreter::create();
+
+    odeInterpreter->setModel(analyserModel("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+    daeInterpreter->setModel(analyserModel("generator/hodgkin_huxley_squid_axon_model_1952/model.dae.cellml"));
+
+    EXPECT_EQ(libcellml::AnalyserModel::Type::DAE, daeInterpreter->model()->type());
+
+    for (const auto &interpreter : {odeInterpreter, daeInterpreter}) {
+        interpreter->initialiseVariables();
+        interpreter->computeComputedConstants();
+        interpreter->computeRates(10.2);
+        interpreter->computeVariables(10.2);
+    }
+
+    EXPECT_EQ(odeInterpreter->states(), daeInterpreter->states());
+
+    for (size_t i = 0; i < odeInterpreter->rates().size(); ++i) {
+        EXPECT_NEAR(odeInterpreter->rate(i), daeInterpreter->rate(i), 1.0e-12);
+    }
+
+    for (size_t i = 0; i < daeInterpreter->variables().size(); ++i) {
+        auto daeVariable = daeInterpreter->model()->variable(i)->variable();
+
+        for (size_t j = 0; j < odeInterpreter->variables().size(); ++j) {
+            auto odeVariable = odeInterpreter->model()->variable(j)->variable();
+
+            if ((daeVariable->name() == odeVariable->name())
+                && (std::dynamic_pointer_cast<libcellml::Component>(daeVariable->parent())->name() == std::dynamic_pointer_cast<libcellml::Component>(odeVariable->parent())->name())) {
+                EXPECT_NEAR(odeInterpreter->variable(j), daeInterpreter->variable(i), 1.0e-12);
+            }
+        }
+    }
+}
+
+TEST(Interpreter, algebraicSystemWithThreeLinkedUnknowns)
+{
+    auto interpreter = libcellml::Interpreter::create();
+
+    interpreter->setModel(analyserModel("generator/algebraic_system_with_three_linked_unknowns/model.cellml"));
+
+    EXPECT_EQ(libcellml::AnalyserModel::Type::NLA, interpreter->model()->type());
+
+    interpreter->initialiseVariables();
+    interpreter->computeComputedConstants();
+    interpreter->computeVariables();
+
+    EXPECT_NEAR(1.0, interpreter->variable(0), 1.0e-12);
+    EXPECT_NEAR(-1.0, interpreter->variable(1), 1.0e-12);
+    EXPECT_NEAR(1.0, interpreter->variable(2), 1.0e-12);
+}
+
+TEST(Interpreter, hodgkinHuxleySquidAxonModel1952WithExternalVariable)
+{
+    // An external variable is not computed by the interpreter, so its value
+    // must be set by the user.
+
+    auto interpreter = libcellml::Interpreter::create();
+
+    interpreter->setModel(analyserModel("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml", "membrane", "i_Stim"));
+
+    interpreter->initialiseVariables();
+    interpreter->computeComputedConstants();
+    interpreter->computeRates();
+
+    EXPECT_TRUE(std::isnan(interpreter->variable(0)));
+    EXPECT_TRUE(std::isnan(interpreter->rate(0)));
+
+    interpreter->setVariable(0, -20.0);
+    interpreter->setVariable(18, 123.0);
+
+    EXPECT_EQ(-20.0, interpreter->variable(0));
+    EXPECT_TRUE(std::isnan(interpreter->variable(18)));
+
+    interpreter->computeRates();
+
+    EXPECT_NEAR(-19.39923125, interpreter->rate(0), 1.0e-14);
+}
+
+TEST(Interpreter, unsetModel)
+{
+    auto interpreter = libcellml::Interpreter::create();
+
+    interpreter->setModel(analyserModel("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+    interpreter->initialiseVariables();
+    interpreter->computeRates(10.2);
+
+    EXPECT_EQ(size_t(4), interpreter->states().size());
+
+    interpreter->setModel(nullptr);
+
+    EXPECT_EQ(nullptr, interpreter->model());
+    EXPECT_EQ(0.0, interpreter->voi());
+    EXPECT_EQ(size_t(0), interpreter->states().size());
+    EXPECT_EQ(size_t(0), interpreter->rates().size());
+    EXPECT_EQ(size_t(0), interpreter->variables().size());
+}
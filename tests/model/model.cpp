@@ -1163,3 +1163,53 @@ TEST(Model, removeAllComponentsImportedChild)
     model->removeAllComponents();
     EXPECT_EQ(size_t(0), model->componentCount());
 }
+
+TEST(Model, lookUpRenamedUnitsAndComponents)
+{
+    auto m = libcellml::Model::create("model");
+    auto u1 = libcellml::Units::create("u1");
+    auto u2 = libcellml::Units::create("u2");
+    auto c1 = libcellml::Component::create("c1");
+    auto c2 = libcellml::Component::create("c2");
+
+    m->addUnits(u1);
+    m->addUnits(u2);
+    m->addComponent(c1);
+    m->addComponent(c2);
+
+    u1->setName("renamed_units");
+    c1->setName("renamed_component");
+
+    EXPECT_FALSE(m->hasUnits("u1"));
+    EXPECT_EQ(u1, m->units("renamed_units"));
+    EXPECT_FALSE(m->containsComponent("c1"));
+    EXPECT_EQ(c1, m->component("renamed_component"));
+
+    auto u3 = libcellml::Units::create("u3");
+    auto c3 = libcellml::Component::create("c3");
+
+    EXPECT_TRUE(m->replaceUnits("u2", u3));
+    EXPECT_TRUE(m->replaceComponent("c2", c3));
+
+    EXPECT_FALSE(m->hasUnits("u2"));
+    EXPECT_EQ(u3, m->units("u3"));
+    EXPECT_FALSE(m->containsComponent("c2"));
+    EXPECT_EQ(c3, m->component("c3"));
+
+    u2->setName("u3");
+    c2->setName("c3");
+
+    EXPECT_EQ(u3, m->units("u3"));
+    EXPECT_EQ(c3, m->component("c3"));
+
+    EXPECT_EQ(u1, m->takeUnits("renamed_units"));
+    EXPECT_EQ(c1, m->takeComponent("renamed_component"));
+    EXPECT_FALSE(m->hasUnits("renamed_units"));
+    EXPECT_FALSE(m->containsComponent("renamed_component"));
+
+    m->removeAllUnits();
+    m->removeAllComponents();
+
+    EXPECT_FALSE(m->hasUnits("u3"));
+    EXPECT_FALSE(m->containsComponent("c3"));
+}
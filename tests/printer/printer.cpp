@@ -1038,3 +1038,28 @@ TEST(Printer, printComponentWithMultipleFullyQualifiedMathDocuments)
     const std::string e = fileContents("printer/component_with_multiple_math.cellml");
     EXPECT_EQ(e, printer->printModel(model));
 }
+
+TEST(Printer, printModelWithAutoIdsSkippingExistingIds)
+{
+    const std::string e =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"model\" id=\"b4da56\">\n"
+        "  <component name=\"component1\" id=\"b4da55\"/>\n"
+        "  <component name=\"component2\" id=\"b4da58\"/>\n"
+        "  <component name=\"component3\" id=\"b4da57\"/>\n"
+        "  <component name=\"component4\" id=\"b4da59\"/>\n"
+        "</model>\n";
+
+    auto model = libcellml::Model::create("model");
+
+    for (size_t i = 1; i <= 4; ++i) {
+        model->addComponent(libcellml::Component::create("component" + std::to_string(i)));
+    }
+
+    model->component(0)->setId("b4da55");
+    model->component(2)->setId("b4da57");
+
+    auto printer = libcellml::Printer::create();
+
+    EXPECT_EQ(e, printer->printModel(model, true));
+}
@@ -0,0 +1,202 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <libcellml>
+
+TEST(Profiler, phaseAsString)
+{
+    EXPECT_EQ("parse_model", libcellml::Profiler::phaseAsString(libcellml::Profiler::Phase::PARSE_MODEL));
+    EXPECT_EQ("validate_model", libcellml::Profiler::phaseAsString(libcellml::Profiler::Phase::VALIDATE_MODEL));
+    EXPECT_EQ("validate_math", libcellml::Profiler::phaseAsString(libcellml::Profiler::Phase::VALIDATE_MATH));
+    EXPECT_EQ("analyse_model", libcellml::Profiler::phaseAsString(libcellml::Profiler::Phase::ANALYSE_MODEL));
+    EXPECT_EQ("analyse_equation_units", libcellml::Profiler::phaseAsString(libcellml::Profiler::Phase::ANALYSE_EQUATION_UNITS));
+    EXPECT_EQ("check_equations", libcellml::Profiler::phaseAsString(libcellml::Profiler::Phase::CHECK_EQUATIONS));
+    EXPECT_EQ("resolve_imports", libcellml::Profiler::phaseAsString(libcellml::Profiler::Phase::RESOLVE_IMPORTS));
+    EXPECT_EQ("fetch_model", libcellml::Profiler::phaseAsString(libcellml::Profiler::Phase::FETCH_MODEL));
+    EXPECT_EQ("flatten_model", libcellml::Profiler::phaseAsString(libcellml::Profiler::Phase::FLATTEN_MODEL));
+    EXPECT_EQ("print_model", libcellml::Profiler::phaseAsString(libcellml::Profiler::Phase::PRINT_MODEL));
+    EXPECT_EQ("generate_interface_code", libcellml::Profiler::phaseAsString(libcellml::Profiler::Phase::GENERATE_INTERFACE_CODE));
+    EXPECT_EQ("generate_implementation_code", libcellml::Profiler::phaseAsString(libcellml::Profiler::Phase::GENERATE_IMPLEMENTATION_CODE));
+    EXPECT_EQ("add_nla_systems_code", libcellml::Profiler::phaseAsString(libcellml::Profiler::Phase::ADD_NLA_SYSTEMS_CODE));
+}
+
+TEST(Profiler, noProfilerByDefault)
+{
+    EXPECT_EQ(nullptr, libcellml::Parser::create()->profiler());
+    EXPECT_EQ(nullptr, libcellml::Validator::create()->profiler());
+    EXPECT_EQ(nullptr, libcellml::Analyser::create()->profiler());
+    EXPECT_EQ(nullptr, libcellml::Importer::create()->profiler());
+    EXPECT_EQ(nullptr, libcellml::Printer::create()->profiler());
+    EXPECT_EQ(nullptr, libcellml::Generator::create()->profiler());
+}
+
+TEST(Profiler, setAndUnsetProfiler)
+{
+    auto profiler = libcellml::Profiler::create();
+    auto parser = libcellml::Parser::create();
+    auto generator = libcellml::Generator::create();
+
+    parser->setProfiler(profiler);
+    generator->setProfiler(profiler);
+
+    EXPECT_EQ(profiler, parser->profiler());
+    EXPECT_EQ(profiler, generator->profiler());
+
+    parser->setProfiler(nullptr);
+    generator->setProfiler(nullptr);
+
+    EXPECT_EQ(nullptr, parser->profiler());
+    EXPECT_EQ(nullptr, generator->profiler());
+}
+
+TEST(Profiler, parseValidatePrint)
+{
+    auto profiler = libcellml::Profiler::create();
+    auto parser = libcellml::Parser::create();
+    auto validator = libcellml::Validator::create();
+    auto printer = libcellml::Printer::create();
+
+    parser->setProfiler(profiler);
+    validator->setProfiler(profiler);
+    printer->setProfiler(profiler);
+
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    validator->validateModel(model);
+    printer->printModel(model);
+
+    EXPECT_EQ(size_t(0), validator->issueCount());
+
+    EXPECT_EQ(size_t(1), profiler->callCount(libcellml::Profiler::Phase::PARSE_MODEL));
+    EXPECT_EQ(size_t(1), profiler->callCount(libcellml::Profiler::Phase::VALIDATE_MODEL));
+    EXPECT_EQ(size_t(7), profiler->callCount(libcellml::Profiler::Phase::VALIDATE_MATH));
+    EXPECT_EQ(size_t(1), profiler->callCount(libcellml::Profiler::Phase::PRINT_MODEL));
+    EXPECT_EQ(size_t(0), profiler->callCount(libcellml::Profiler::Phase::ANALYSE_MODEL));
+
+    EXPECT_LT(0.0, profiler->elapsedTime(libcellml::Profiler::Phase::PARSE_MODEL));
+    EXPECT_LT(0.0, profiler->elapsedTime(libcellml::Profiler::Phase::VALIDATE_MATH));
+    EXPECT_LE(profiler->elapsedTime(libcellml::Profiler::Phase::VALIDATE_MATH),
+              profiler->elapsedTime(libcellml::Profiler::Phase::VALIDATE_MODEL));
+    EXPECT_EQ(0.0, profiler->elapsedTime(libcellml::Profiler::Phase::ANALYSE_MODEL));
+
+    EXPECT_EQ(size_t(0), profiler->allocationCount(libcellml::Profiler::Phase::PARSE_MODEL));
+}
+
+TEST(Profiler, analyseAndGenerate)
+{
+    auto profiler = libcellml::Profiler::create();
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/algebraic_system_with_three_linked_unknowns/model.cellml"));
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->setProfiler(profiler);
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto generator = libcellml::Generator::create();
+
+    generator->setProfiler(profiler);
+    generator->setModel(analyser->model());
+    generator->interfaceCode();
+    generator->implementationCode();
+
+    EXPECT_EQ(size_t(0), profiler->callCount(libcellml::Profiler::Phase::PARSE_MODEL));
+    EXPECT_EQ(size_t(1), profiler->callCount(libcellml::Profiler::Phase::ANALYSE_MODEL));
+    EXPECT_EQ(size_t(1), profiler->callCount(libcellml::Profiler::Phase::VALIDATE_MODEL));
+    EXPECT_EQ(size_t(3), profiler->callCount(libcellml::Profiler::Phase::ANALYSE_EQUATION_UNITS));
+    EXPECT_LT(size_t(0), profiler->callCount(libcellml::Profiler::Phase::CHECK_EQUATIONS));
+    EXPECT_EQ(size_t(1), profiler->callCount(libcellml::Profiler::Phase::GENERATE_INTERFACE_CODE));
+    EXPECT_EQ(size_t(1), profiler->callCount(libcellml::Profiler::Phase::GENERATE_IMPLEMENTATION_CODE));
+    EXPECT_EQ(size_t(1), profiler->callCount(libcellml::Profiler::Phase::ADD_NLA_SYSTEMS_CODE));
+
+    EXPECT_LE(profiler->elapsedTime(libcellml::Profiler::Phase::CHECK_EQUATIONS),
+              profiler->elapsedTime(libcellml::Profiler::Phase::ANALYSE_MODEL));
+    EXPECT_LE(profiler->elapsedTime(libcellml::Profiler::Phase::ADD_NLA_SYSTEMS_CODE),
+              profiler->elapsedTime(libcellml::Profiler::Phase::GENERATE_IMPLEMENTATION_CODE));
+}
+
+TEST(Profiler, resolveImportsAndFlatten)
+{
+    auto profiler = libcellml::Profiler::create();
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("importer/diamond.cellml"));
+    auto importer = libcellml::Importer::create();
+
+    importer->setProfiler(profiler);
+    importer->resolveImports(model, resourcePath("importer/"));
+
+    EXPECT_FALSE(model->hasUnresolvedImports());
+
+    importer->flattenModel(model);
+
+    EXPECT_EQ(size_t(1), profiler->callCount(libcellml::Profiler::Phase::RESOLVE_IMPORTS));
+    EXPECT_EQ(size_t(4), profiler->callCount(libcellml::Profiler::Phase::FETCH_MODEL));
+    EXPECT_EQ(size_t(3), profiler->callCount(libcellml::Profiler::Phase::PARSE_MODEL));
+    EXPECT_EQ(size_t(1), profiler->callCount(libcellml::Profiler::Phase::FLATTEN_MODEL));
+
+    EXPECT_LE(profiler->elapsedTime(libcellml::Profiler::Phase::FETCH_MODEL),
+              profiler->elapsedTime(libcellml::Profiler::Phase::RESOLVE_IMPORTS));
+}
+
+TEST(Profiler, allocationCounter)
+{
+    // Use a fake counter that "allocates" once each time it is queried, i.e.
+    // once when entering and once when leaving a phase.
+
+    size_t allocations = 0;
+    auto profiler = libcellml::Profiler::create();
+    auto parser = libcellml::Parser::create();
+
+    profiler->setAllocationCounter([&allocations]() {
+        return ++allocations;
+    });
+    parser->setProfiler(profiler);
+
+    parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+    parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(2), profiler->callCount(libcellml::Profiler::Phase::PARSE_MODEL));
+    EXPECT_EQ(size_t(2), profiler->allocationCount(libcellml::Profiler::Phase::PARSE_MODEL));
+
+    profiler->setAllocationCounter(nullptr);
+
+    parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(3), profiler->callCount(libcellml::Profiler::Phase::PARSE_MODEL));
+    EXPECT_EQ(size_t(2), profiler->allocationCount(libcellml::Profiler::Phase::PARSE_MODEL));
+}
+
+TEST(Profiler, reset)
+{
+    auto profiler = libcellml::Profiler::create();
+    auto parser = libcellml::Parser::create();
+
+    parser->setProfiler(profiler);
+    parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(1), profiler->callCount(libcellml::Profiler::Phase::PARSE_MODEL));
+    EXPECT_LT(0.0, profiler->elapsedTime(libcellml::Profiler::Phase::PARSE_MODEL));
+
+    profiler->reset();
+
+    EXPECT_EQ(size_t(0), profiler->callCount(libcellml::Profiler::Phase::PARSE_MODEL));
+    EXPECT_EQ(0.0, profiler->elapsedTime(libcellml::Profiler::Phase::PARSE_MODEL));
+}
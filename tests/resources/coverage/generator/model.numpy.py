@@ -0,0 +1,553 @@
+# The content of this file was generated using the NumPy profile of libCellML 0.6.3.
+
+from enum import Enum
+
+import numpy as np
+
+
+__version__ = "0.1.0"
+LIBCELLML_VERSION = "0.6.3"
+
+STATE_COUNT = 1
+VARIABLE_COUNT = 209
+
+
+class VariableType(Enum):
+    VARIABLE_OF_INTEGRATION = 0
+    STATE = 1
+    CONSTANT = 2
+    COMPUTED_CONSTANT = 3
+    ALGEBRAIC = 4
+
+
+VOI_INFO = {"name": "t", "units": "second", "component": "my_component", "type": VariableType.VARIABLE_OF_INTEGRATION}
+
+STATE_INFO = [
+    {"name": "x", "units": "dimensionless", "component": "my_component", "type": VariableType.STATE}
+]
+
+VARIABLE_INFO = [
+    {"name": "n", "units": "dimensionless", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "m", "units": "dimensionless", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "eqnEq", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnEqCoverageParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnNeq", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "o", "units": "dimensionless", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "eqnNeqCoverageParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnLt", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnLtCoverageParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnLeq", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnLeqCoverageParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnGt", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnGtCoverageParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnGeq", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnGeqCoverageParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnAnd", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnAndMultiple", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "p", "units": "dimensionless", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "eqnAndParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnAndParenthesesLeftPlusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnAndParenthesesLeftPlusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnAndParenthesesLeftMinusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnAndParenthesesLeftMinusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnAndParenthesesLeftPower", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnAndParenthesesLeftRoot", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnAndParenthesesRightPlusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnAndParenthesesRightPlusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnAndParenthesesRightMinusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnAndParenthesesRightMinusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnAndParenthesesRightPower", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnAndParenthesesRightRoot", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnAndCoverageParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnOr", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnOrMultiple", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnOrParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnOrParenthesesLeftPlusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnOrParenthesesLeftPlusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnOrParenthesesLeftMinusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnOrParenthesesLeftMinusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnOrParenthesesLeftPower", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnOrParenthesesLeftRoot", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnOrParenthesesRightPlusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnOrParenthesesRightPlusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnOrParenthesesRightMinusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnOrParenthesesRightMinusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnOrParenthesesRightPower", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnOrParenthesesRightRoot", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnOrCoverageParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnXor", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnXorMultiple", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnXorParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnXorParenthesesLeftPlusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnXorParenthesesLeftPlusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnXorParenthesesLeftMinusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnXorParenthesesLeftMinusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnXorParenthesesLeftPower", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnXorParenthesesLeftRoot", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnXorParenthesesRightPlusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnXorParenthesesRightPlusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnXorParenthesesRightMinusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnXorParenthesesRightMinusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnXorParenthesesRightPower", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnXorParenthesesRightRoot", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnXorCoverageParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnNot", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPlus", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPlusMultiple", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPlusParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPlusUnary", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnMinus", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnMinusParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnMinusParenthesesPlusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnMinusParenthesesPlusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnMinusParenthesesDirectUnaryMinus", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnMinusParenthesesIndirectUnaryMinus", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnMinusUnary", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnMinusUnaryParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnTimes", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnTimesMultiple", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnTimesParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnTimesParenthesesLeftPlusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnTimesParenthesesLeftPlusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnTimesParenthesesLeftMinusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnTimesParenthesesLeftMinusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnTimesParenthesesRightPlusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnTimesParenthesesRightPlusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnTimesParenthesesRightMinusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnTimesParenthesesRightMinusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnDivide", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnDivideParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnDivideParenthesesLeftPlusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnDivideParenthesesLeftPlusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnDivideParenthesesLeftMinusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnDivideParenthesesLeftMinusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnDivideParenthesesRightPlusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnDivideParenthesesRightPlusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnDivideParenthesesRightMinusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnDivideParenthesesRightMinusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnDivideParenthesesRightTimes", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnDivideParenthesesRightDivide", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerSqrt", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerSqr", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerCube", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerCi", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerParenthesesLeftPlusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerParenthesesLeftPlusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerParenthesesLeftMinusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerParenthesesLeftMinusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerParenthesesLeftTimes", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerParenthesesLeftDivide", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerParenthesesRightPlusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerParenthesesRightPlusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerParenthesesRightMinusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerParenthesesRightMinusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerParenthesesRightTimes", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerParenthesesRightDivide", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerParenthesesRightPower", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPowerParenthesesRightRoot", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootSqrt", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootSqrtOther", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootCube", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootCi", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootParentheses", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootParenthesesLeftPlusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootParenthesesLeftPlusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootParenthesesLeftMinusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootParenthesesLeftMinusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootParenthesesLeftTimes", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootParenthesesLeftDivide", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootParenthesesRightPlusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootParenthesesRightPlusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootParenthesesRightMinusWith", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootParenthesesRightMinusWithout", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootParenthesesRightTimes", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootParenthesesRightDivide", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootParenthesesRightPower", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRootParenthesesRightRoot", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnAbs", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnExp", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnLn", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnLog", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnLog2", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnLog10", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnLogCi", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCeiling", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnFloor", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnMin", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnMinMultiple", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnMax", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnMaxMultiple", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnRem", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnSin", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCos", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnTan", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnSec", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCsc", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCot", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnSinh", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCosh", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnTanh", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnSech", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCsch", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCoth", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnArcsin", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnArccos", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnArctan", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnArcsec", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnArccsc", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnArccot", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnArcsinh", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnArccosh", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnArctanh", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnArcsech", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnArccsch", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnArccoth", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPiecewisePiece", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPiecewisePieceOtherwise", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "q", "units": "dimensionless", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "r", "units": "dimensionless", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "eqnPiecewisePiecePiecePiece", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "s", "units": "dimensionless", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "eqnPiecewisePiecePiecePieceOtherwise", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnWithPiecewise", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCnInteger", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCnDouble", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCnIntegerWithExponent", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCnDoubleWithExponent", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCi", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnTrue", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnFalse", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnExponentiale", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnPi", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnInfinity", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnNotanumber", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCoverageForPlusOperator", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCoverageForMinusOperator", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCoverageForTimesOperator", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCoverageForDivideOperator", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCoverageForAndOperator", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCoverageForOrOperator", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCoverageForXorOperator", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCoverageForPowerOperator", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCoverageForRootOperator", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnCoverageForMinusUnary", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnNlaVariable2", "units": "dimensionless", "component": "my_component", "type": VariableType.ALGEBRAIC},
+    {"name": "eqnNlaVariable1", "units": "dimensionless", "component": "my_component", "type": VariableType.ALGEBRAIC},
+    {"name": "eqnComputedConstant2", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "eqnComputedConstant1", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT}
+]
+
+
+def sec(x):
+    return 1.0/np.cos(x)
+
+
+def csc(x):
+    return 1.0/np.sin(x)
+
+
+def cot(x):
+    return 1.0/np.tan(x)
+
+
+def sech(x):
+    return 1.0/np.cosh(x)
+
+
+def csch(x):
+    return 1.0/np.sinh(x)
+
+
+def coth(x):
+    return 1.0/np.tanh(x)
+
+
+def asec(x):
+    return np.arccos(1.0/x)
+
+
+def acsc(x):
+    return np.arcsin(1.0/x)
+
+
+def acot(x):
+    return np.arctan(1.0/x)
+
+
+def asech(x):
+    one_over_x = 1.0/x
+
+    return np.log(one_over_x+np.sqrt(one_over_x*one_over_x-1.0))
+
+
+def acsch(x):
+    one_over_x = 1.0/x
+
+    return np.log(one_over_x+np.sqrt(one_over_x*one_over_x+1.0))
+
+
+def acoth(x):
+    one_over_x = 1.0/x
+
+    return 0.5*np.log((1.0+one_over_x)/(1.0-one_over_x))
+
+
+def create_states_array(cell_count=1):
+    return np.full((STATE_COUNT, cell_count), np.nan)
+
+
+def create_variables_array(cell_count=1):
+    return np.full((VARIABLE_COUNT, cell_count), np.nan)
+
+
+from nlasolver import nla_solve
+
+
+def objective_function_0(u, f, data):
+    voi = data[0]
+    states = data[1]
+    rates = data[2]
+    variables = data[3]
+
+    variables[205] = u[0]
+    variables[206] = u[1]
+
+    f[0] = variables[206]+variables[205]+states[0]-0.0
+    f[1] = variables[206]-variables[205]-(variables[208]+variables[207])
+
+
+def find_root_0(voi, states, rates, variables):
+    u = [np.nan]*2
+
+    u[0] = variables[205]
+    u[1] = variables[206]
+
+    u = nla_solve(objective_function_0, u, 2, [voi, states, rates, variables])
+
+    variables[205] = u[0]
+    variables[206] = u[1]
+
+
+def initialise_variables(states, rates, variables):
+    variables[0] = 2.0
+    variables[1] = 1.0
+    variables[5] = 3.0
+    variables[17] = 4.0
+    variables[178] = 5.0
+    variables[179] = 6.0
+    variables[181] = 7.0
+    variables[205] = 2.0
+    variables[206] = 1.0
+    variables[184] = 123.0
+    variables[185] = 123.456789
+    variables[186] = 123.0e99
+    variables[187] = 123.456789e99
+    variables[189] = 1.0
+    variables[190] = 0.0
+    variables[191] = 2.71828182845905
+    variables[192] = 3.14159265358979
+    variables[193] = np.inf
+    variables[194] = np.nan
+    variables[208] = 1.0
+    variables[207] = 3.0
+    states[0] = 0.0
+
+
+def compute_computed_constants(variables):
+    variables[2] = np.equal(variables[1], variables[0])
+    variables[3] = variables[1]/np.equal(variables[0], variables[0])
+    variables[4] = np.not_equal(variables[1], variables[0])
+    variables[6] = variables[1]/np.not_equal(variables[0], variables[5])
+    variables[7] = np.less(variables[1], variables[0])
+    variables[8] = variables[1]/np.less(variables[0], variables[5])
+    variables[9] = np.less_equal(variables[1], variables[0])
+    variables[10] = variables[1]/np.less_equal(variables[0], variables[5])
+    variables[11] = np.greater(variables[1], variables[0])
+    variables[12] = variables[1]/np.greater(variables[0], variables[5])
+    variables[13] = np.greater_equal(variables[1], variables[0])
+    variables[14] = variables[1]/np.greater_equal(variables[0], variables[5])
+    variables[15] = np.logical_and(variables[1], variables[0])
+    variables[16] = np.logical_and(variables[1], np.logical_and(variables[0], variables[5]))
+    variables[18] = np.logical_and(np.less(variables[1], variables[0]), np.greater(variables[5], variables[17]))
+    variables[19] = np.logical_and(variables[1]+variables[0], np.greater(variables[5], variables[17]))
+    variables[20] = np.logical_and(variables[1], np.greater(variables[0], variables[5]))
+    variables[21] = np.logical_and(variables[1]-variables[0], np.greater(variables[5], variables[17]))
+    variables[22] = np.logical_and(-variables[1], np.greater(variables[0], variables[5]))
+    variables[23] = np.logical_and(np.power(variables[1], variables[0]), np.greater(variables[5], variables[17]))
+    variables[24] = np.logical_and(np.power(variables[1], 1.0/variables[0]), np.greater(variables[5], variables[17]))
+    variables[25] = np.logical_and(np.less(variables[1], variables[0]), variables[5]+variables[17])
+    variables[26] = np.logical_and(np.less(variables[1], variables[0]), variables[5])
+    variables[27] = np.logical_and(np.less(variables[1], variables[0]), variables[5]-variables[17])
+    variables[28] = np.logical_and(np.less(variables[1], variables[0]), -variables[5])
+    variables[29] = np.logical_and(np.less(variables[1], variables[0]), np.power(variables[5], variables[17]))
+    variables[30] = np.logical_and(np.less(variables[1], variables[0]), np.power(variables[5], 1.0/variables[17]))
+    variables[31] = variables[1]/np.logical_and(variables[0], variables[5])
+    variables[32] = np.logical_or(variables[1], variables[0])
+    variables[33] = np.logical_or(variables[1], np.logical_or(variables[0], variables[5]))
+    variables[34] = np.logical_or(np.less(variables[1], variables[0]), np.greater(variables[5], variables[17]))
+    variables[35] = np.logical_or(variables[1]+variables[0], np.greater(variables[5], variables[17]))
+    variables[36] = np.logical_or(variables[1], np.greater(variables[0], variables[5]))
+    variables[37] = np.logical_or(variables[1]-variables[0], np.greater(variables[5], variables[17]))
+    variables[38] = np.logical_or(-variables[1], np.greater(variables[0], variables[5]))
+    variables[39] = np.logical_or(np.power(variables[1], variables[0]), np.greater(variables[5], variables[17]))
+    variables[40] = np.logical_or(np.power(variables[1], 1.0/variables[0]), np.greater(variables[5], variables[17]))
+    variables[41] = np.logical_or(np.less(variables[1], variables[0]), variables[5]+variables[17])
+    variables[42] = np.logical_or(np.less(variables[1], variables[0]), variables[5])
+    variables[43] = np.logical_or(np.less(variables[1], variables[0]), variables[5]-variables[17])
+    variables[44] = np.logical_or(np.less(variables[1], variables[0]), -variables[5])
+    variables[45] = np.logical_or(np.less(variables[1], variables[0]), np.power(variables[5], variables[17]))
+    variables[46] = np.logical_or(np.less(variables[1], variables[0]), np.power(variables[5], 1.0/variables[17]))
+    variables[47] = variables[1]/np.logical_or(variables[0], variables[5])
+    variables[48] = np.logical_xor(variables[1], variables[0])
+    variables[49] = np.logical_xor(variables[1], np.logical_xor(variables[0], variables[5]))
+    variables[50] = np.logical_xor(np.less(variables[1], variables[0]), np.greater(variables[5], variables[17]))
+    variables[51] = np.logical_xor(variables[1]+variables[0], np.greater(variables[5], variables[17]))
+    variables[52] = np.logical_xor(variables[1], np.greater(variables[0], variables[5]))
+    variables[53] = np.logical_xor(variables[1]-variables[0], np.greater(variables[5], variables[17]))
+    variables[54] = np.logical_xor(-variables[1], np.greater(variables[0], variables[5]))
+    variables[55] = np.logical_xor(np.power(variables[1], variables[0]), np.greater(variables[5], variables[17]))
+    variables[56] = np.logical_xor(np.power(variables[1], 1.0/variables[0]), np.greater(variables[5], variables[17]))
+    variables[57] = np.logical_xor(np.less(variables[1], variables[0]), variables[5]+variables[17])
+    variables[58] = np.logical_xor(np.less(variables[1], variables[0]), variables[5])
+    variables[59] = np.logical_xor(np.less(variables[1], variables[0]), variables[5]-variables[17])
+    variables[60] = np.logical_xor(np.less(variables[1], variables[0]), -variables[5])
+    variables[61] = np.logical_xor(np.less(variables[1], variables[0]), np.power(variables[5], variables[17]))
+    variables[62] = np.logical_xor(np.less(variables[1], variables[0]), np.power(variables[5], 1.0/variables[17]))
+    variables[63] = variables[1]/np.logical_xor(variables[0], variables[5])
+    variables[64] = np.logical_not(variables[1])
+    variables[65] = variables[1]+variables[0]
+    variables[66] = variables[1]+variables[0]+variables[5]
+    variables[67] = np.less(variables[1], variables[0])+np.greater(variables[5], variables[17])
+    variables[68] = variables[1]
+    variables[69] = variables[1]-variables[0]
+    variables[70] = np.less(variables[1], variables[0])-np.greater(variables[5], variables[17])
+    variables[71] = np.less(variables[1], variables[0])-(variables[5]+variables[17])
+    variables[72] = np.less(variables[1], variables[0])-variables[5]
+    variables[73] = variables[1]-(-variables[0])
+    variables[74] = variables[1]-(-variables[0]*variables[5])
+    variables[75] = -variables[1]
+    variables[76] = -np.less(variables[1], variables[0])
+    variables[77] = variables[1]*variables[0]
+    variables[78] = variables[1]*variables[0]*variables[5]
+    variables[79] = np.less(variables[1], variables[0])*np.greater(variables[5], variables[17])
+    variables[80] = (variables[1]+variables[0])*np.greater(variables[5], variables[17])
+    variables[81] = variables[1]*np.greater(variables[0], variables[5])
+    variables[82] = (variables[1]-variables[0])*np.greater(variables[5], variables[17])
+    variables[83] = -variables[1]*np.greater(variables[0], variables[5])
+    variables[84] = np.less(variables[1], variables[0])*(variables[5]+variables[17])
+    variables[85] = np.less(variables[1], variables[0])*variables[5]
+    variables[86] = np.less(variables[1], variables[0])*(variables[5]-variables[17])
+    variables[87] = np.less(variables[1], variables[0])*-variables[5]
+    variables[88] = variables[1]/variables[0]
+    variables[89] = np.less(variables[1], variables[0])/np.greater(variables[17], variables[5])
+    variables[90] = (variables[1]+variables[0])/np.greater(variables[17], variables[5])
+    variables[91] = variables[1]/np.greater(variables[5], variables[0])
+    variables[92] = (variables[1]-variables[0])/np.greater(variables[17], variables[5])
+    variables[93] = -variables[1]/np.greater(variables[5], variables[0])
+    variables[94] = np.less(variables[1], variables[0])/(variables[5]+variables[17])
+    variables[95] = np.less(variables[1], variables[0])/variables[5]
+    variables[96] = np.less(variables[1], variables[0])/(variables[5]-variables[17])
+    variables[97] = np.less(variables[1], variables[0])/-variables[5]
+    variables[98] = np.less(variables[1], variables[0])/(variables[5]*variables[17])
+    variables[99] = np.less(variables[1], variables[0])/(variables[5]/variables[17])
+    variables[100] = np.sqrt(variables[1])
+    variables[101] = np.power(variables[1], 2.0)
+    variables[102] = np.power(variables[1], 3.0)
+    variables[103] = np.power(variables[1], variables[0])
+    variables[104] = np.power(np.less_equal(variables[1], variables[0]), np.greater_equal(variables[5], variables[17]))
+    variables[105] = np.power(variables[1]+variables[0], np.greater_equal(variables[5], variables[17]))
+    variables[106] = np.power(variables[1], np.greater_equal(variables[0], variables[5]))
+    variables[107] = np.power(variables[1]-variables[0], np.greater_equal(variables[5], variables[17]))
+    variables[108] = np.power(-variables[1], np.greater_equal(variables[0], variables[5]))
+    variables[109] = np.power(variables[1]*variables[0], np.greater_equal(variables[5], variables[17]))
+    variables[110] = np.power(variables[1]/variables[0], np.greater_equal(variables[5], variables[17]))
+    variables[111] = np.power(np.less_equal(variables[1], variables[0]), variables[5]+variables[17])
+    variables[112] = np.power(np.less_equal(variables[1], variables[0]), variables[5])
+    variables[113] = np.power(np.less_equal(variables[1], variables[0]), variables[5]-variables[17])
+    variables[114] = np.power(np.less_equal(variables[1], variables[0]), -variables[5])
+    variables[115] = np.power(np.less_equal(variables[1], variables[0]), variables[5]*variables[17])
+    variables[116] = np.power(np.less_equal(variables[1], variables[0]), variables[5]/variables[17])
+    variables[117] = np.power(np.less_equal(variables[1], variables[0]), np.power(variables[5], variables[17]))
+    variables[118] = np.power(np.less_equal(variables[1], variables[0]), np.power(variables[5], 1.0/variables[17]))
+    variables[119] = np.sqrt(variables[1])
+    variables[120] = np.sqrt(variables[1])
+    variables[121] = np.power(variables[1], 1.0/3.0)
+    variables[122] = np.power(variables[1], 1.0/variables[0])
+    variables[123] = np.power(np.less(variables[1], variables[0]), 1.0/np.greater(variables[17], variables[5]))
+    variables[124] = np.power(variables[1]+variables[0], 1.0/np.greater(variables[17], variables[5]))
+    variables[125] = np.power(variables[1], 1.0/np.greater(variables[5], variables[0]))
+    variables[126] = np.power(variables[1]-variables[0], 1.0/np.greater(variables[17], variables[5]))
+    variables[127] = np.power(-variables[1], 1.0/np.greater(variables[5], variables[0]))
+    variables[128] = np.power(variables[1]*variables[0], 1.0/np.greater(variables[17], variables[5]))
+    variables[129] = np.power(variables[1]/variables[0], 1.0/np.greater(variables[17], variables[5]))
+    variables[130] = np.power(np.less(variables[1], variables[0]), 1.0/(variables[5]+variables[17]))
+    variables[131] = np.power(np.less(variables[1], variables[0]), 1.0/variables[5])
+    variables[132] = np.power(np.less(variables[1], variables[0]), 1.0/(variables[5]-variables[17]))
+    variables[133] = np.power(np.less(variables[1], variables[0]), 1.0/-variables[5])
+    variables[134] = np.power(np.less(variables[1], variables[0]), 1.0/(variables[5]*variables[17]))
+    variables[135] = np.power(np.less(variables[1], variables[0]), 1.0/(variables[5]/variables[17]))
+    variables[136] = np.power(np.less(variables[1], variables[0]), 1.0/np.power(variables[5], variables[17]))
+    variables[137] = np.power(np.less(variables[1], variables[0]), 1.0/np.power(variables[5], 1.0/variables[17]))
+    variables[138] = np.fabs(variables[1])
+    variables[139] = np.exp(variables[1])
+    variables[140] = np.log(variables[1])
+    variables[141] = np.log10(variables[1])
+    variables[142] = np.log(variables[1])/np.log(2.0)
+    variables[143] = np.log10(variables[1])
+    variables[144] = np.log(variables[1])/np.log(variables[0])
+    variables[145] = np.ceil(variables[1])
+    variables[146] = np.floor(variables[1])
+    variables[147] = np.minimum(variables[1], variables[0])
+    variables[148] = np.minimum(variables[1], np.minimum(variables[0], variables[5]))
+    variables[149] = np.maximum(variables[1], variables[0])
+    variables[150] = np.maximum(variables[1], np.maximum(variables[0], variables[5]))
+    variables[151] = np.fmod(variables[1], variables[0])
+    variables[152] = np.sin(variables[1])
+    variables[153] = np.cos(variables[1])
+    variables[154] = np.tan(variables[1])
+    variables[155] = sec(variables[1])
+    variables[156] = csc(variables[1])
+    variables[157] = cot(variables[1])
+    variables[158] = np.sinh(variables[1])
+    variables[159] = np.cosh(variables[1])
+    variables[160] = np.tanh(variables[1])
+    variables[161] = sech(variables[1])
+    variables[162] = csch(variables[1])
+    variables[163] = coth(variables[1])
+    variables[164] = np.arcsin(variables[1])
+    variables[165] = np.arccos(variables[1])
+    variables[166] = np.arctan(variables[1])
+    variables[167] = asec(variables[1])
+    variables[168] = acsc(variables[1])
+    variables[169] = acot(variables[1])
+    variables[170] = np.arcsinh(variables[1])
+    variables[171] = np.arccosh(variables[1])
+    variables[172] = np.arctanh(variables[1]/2.0)
+    variables[173] = asech(variables[1])
+    variables[174] = acsch(variables[1])
+    variables[175] = acoth(2.0*variables[1])
+    variables[176] = np.where(np.greater(variables[1], variables[0]), variables[1], np.nan)
+    variables[177] = np.where(np.greater(variables[1], variables[0]), variables[1], variables[5])
+    variables[180] = np.where(np.greater(variables[1], variables[0]), variables[1], np.where(np.greater(variables[5], variables[17]), variables[5], np.where(np.greater(variables[178], variables[179]), variables[178], np.nan)))
+    variables[182] = np.where(np.greater(variables[1], variables[0]), variables[1], np.where(np.greater(variables[5], variables[17]), variables[5], np.where(np.greater(variables[178], variables[179]), variables[178], variables[181])))
+    variables[183] = 123.0+np.where(np.greater(variables[1], variables[0]), variables[1], np.nan)
+    variables[188] = variables[1]
+    variables[195] = np.logical_and(variables[1], variables[0])+np.where(np.greater(variables[5], variables[17]), variables[0], np.nan)+variables[178]+np.logical_and(variables[179], variables[181])
+    variables[196] = np.logical_and(variables[1], variables[0])-(np.where(np.greater(variables[5], variables[17]), variables[0], np.nan)-(variables[178]-np.where(np.greater(variables[5], variables[17]), variables[0], np.nan)))-np.logical_and(variables[179], variables[181])
+    variables[197] = np.logical_and(variables[1], variables[0])*np.where(np.greater(variables[5], variables[17]), variables[0], np.nan)*variables[178]*np.where(np.greater(variables[5], variables[17]), variables[0], np.nan)*np.logical_and(variables[179], variables[181])
+    variables[198] = np.logical_and(variables[1], variables[0])/(np.where(np.greater(variables[5], variables[17]), variables[0], np.nan)/(variables[178]/np.where(np.greater(variables[5], variables[17]), variables[0], np.nan)))
+    variables[199] = np.logical_and(np.logical_or(variables[1], variables[0]), np.logical_and(np.logical_xor(variables[1], variables[0]), np.logical_and(np.where(np.greater(variables[5], variables[17]), variables[0], np.nan), np.logical_and(np.logical_and(np.logical_and(variables[178], np.where(np.greater(variables[5], variables[17]), variables[0], np.nan)), np.logical_xor(variables[1], variables[0])), np.logical_or(variables[1], variables[0])))))
+    variables[200] = np.logical_or(np.logical_and(variables[1], variables[0]), np.logical_or(np.logical_xor(variables[1], variables[0]), np.logical_or(np.where(np.greater(variables[5], variables[17]), variables[0], np.nan), np.logical_or(np.logical_or(np.logical_or(variables[178], np.where(np.greater(variables[5], variables[17]), variables[0], np.nan)), np.logical_xor(variables[1], variables[0])), np.logical_and(variables[1], variables[0])))))
+    variables[201] = np.logical_xor(np.logical_and(variables[1], variables[0]), np.logical_xor(np.logical_or(variables[1], variables[0]), np.logical_xor(np.where(np.greater(variables[5], variables[17]), variables[0], np.nan), np.logical_xor(np.logical_xor(np.logical_xor(variables[178], np.where(np.greater(variables[5], variables[17]), variables[0], np.nan)), np.logical_or(variables[1], variables[0])), np.logical_and(variables[1], variables[0])))))
+    variables[202] = np.power(np.logical_and(variables[1], variables[0]), np.power(np.where(np.greater(variables[5], variables[17]), variables[0], np.nan), np.power(np.power(variables[178], np.where(np.greater(variables[5], variables[17]), variables[0], np.nan)), np.logical_and(variables[1], variables[0]))))
+    variables[203] = np.power(np.power(np.power(np.logical_and(variables[1], variables[0]), 1.0/np.power(np.where(np.greater(variables[5], variables[17]), variables[0], np.nan), 1.0/variables[178])), 1.0/np.where(np.greater(variables[5], variables[17]), variables[0], np.nan)), 1.0/np.logical_and(variables[1], variables[0]))
+    variables[204] = -np.logical_and(variables[1], variables[0])+-np.where(np.greater(variables[5], variables[17]), variables[0], np.nan)
+
+
+def compute_rates(voi, states, rates, variables):
+    rates[0] = 1.0
+
+
+def compute_variables(voi, states, rates, variables):
+    find_root_0(voi, states, rates, variables)
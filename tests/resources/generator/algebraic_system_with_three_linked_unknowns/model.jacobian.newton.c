@@ -0,0 +1,121 @@
+/* The content of this file was generated using the C profile of libCellML 0.6.3. */
+
+#include "model.jacobian.newton.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.5.0";
+const char LIBCELLML_VERSION[] = "0.6.3";
+
+const size_t VARIABLE_COUNT = 3;
+
+const VariableInfo VARIABLE_INFO[] = {
+    {"z", "dimensionless", "my_algebraic_system", ALGEBRAIC},
+    {"y", "dimensionless", "my_algebraic_system", ALGEBRAIC},
+    {"x", "dimensionless", "my_algebraic_system", ALGEBRAIC}
+};
+
+double * createVariablesArray()
+{
+    double *res = (double *) malloc(VARIABLE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+typedef struct {
+    double *variables;
+} RootFindingInfo;
+
+void objectiveFunction0(double *u, double *f, void *data)
+{
+    double *variables = ((RootFindingInfo *) data)->variables;
+
+    variables[0] = u[0];
+    variables[1] = u[1];
+    variables[2] = u[2];
+
+    f[0] = 2.0*variables[2]+variables[1]-2.0*variables[0]-(-1.0);
+    f[1] = 3.0*variables[2]-3.0*variables[1]-variables[0]-5.0;
+    f[2] = variables[2]-2.0*variables[1]+3.0*variables[0]-6.0;
+}
+
+void objectiveJacobian0(double *u, double *jacobian, void *data)
+{
+    double *variables = ((RootFindingInfo *) data)->variables;
+
+    variables[0] = u[0];
+    variables[1] = u[1];
+    variables[2] = u[2];
+
+    jacobian[0] = -2.0;
+    jacobian[1] = 1.0;
+    jacobian[2] = 2.0;
+    jacobian[3] = -1.0;
+    jacobian[4] = -3.0;
+    jacobian[5] = 3.0;
+    jacobian[6] = 3.0;
+    jacobian[7] = -2.0;
+    jacobian[8] = 1.0;
+}
+
+void findRoot0(double *variables)
+{
+    RootFindingInfo rfi = { variables };
+    double u[3];
+
+    u[0] = variables[0];
+    u[1] = variables[1];
+    u[2] = variables[2];
+
+    for (int iteration = 0; iteration < 50; ++iteration) {
+        double f[3];
+        double jacobian[3*3];
+        int converged = 1;
+
+        objectiveFunction0(u, f, &rfi);
+
+        for (size_t i = 0; i < 3; ++i) {
+            converged = converged && (fabs(f[i]) <= 1.0e-10);
+        }
+
+        if (converged) {
+            break;
+        }
+
+        objectiveJacobian0(u, jacobian, &rfi);
+
+        u[0] = u[0]-(f[0]*(jacobian[4]*jacobian[8]-jacobian[5]*jacobian[7])-jacobian[1]*(f[1]*jacobian[8]-jacobian[5]*f[2])+jacobian[2]*(f[1]*jacobian[7]-jacobian[4]*f[2]))/(jacobian[0]*(jacobian[4]*jacobian[8]-jacobian[5]*jacobian[7])-jacobian[1]*(jacobian[3]*jacobian[8]-jacobian[5]*jacobian[6])+jacobian[2]*(jacobian[3]*jacobian[7]-jacobian[4]*jacobian[6]));
+        u[1] = u[1]-(jacobian[0]*(f[1]*jacobian[8]-jacobian[5]*f[2])-f[0]*(jacobian[3]*jacobian[8]-jacobian[5]*jacobian[6])+jacobian[2]*(jacobian[3]*f[2]-f[1]*jacobian[6]))/(jacobian[0]*(jacobian[4]*jacobian[8]-jacobian[5]*jacobian[7])-jacobian[1]*(jacobian[3]*jacobian[8]-jacobian[5]*jacobian[6])+jacobian[2]*(jacobian[3]*jacobian[7]-jacobian[4]*jacobian[6]));
+        u[2] = u[2]-(jacobian[0]*(jacobian[4]*f[2]-f[1]*jacobian[7])-jacobian[1]*(jacobian[3]*f[2]-f[1]*jacobian[6])+f[0]*(jacobian[3]*jacobian[7]-jacobian[4]*jacobian[6]))/(jacobian[0]*(jacobian[4]*jacobian[8]-jacobian[5]*jacobian[7])-jacobian[1]*(jacobian[3]*jacobian[8]-jacobian[5]*jacobian[6])+jacobian[2]*(jacobian[3]*jacobian[7]-jacobian[4]*jacobian[6]));
+    }
+
+    variables[0] = u[0];
+    variables[1] = u[1];
+    variables[2] = u[2];
+}
+
+void initialiseVariables(double *variables)
+{
+    variables[0] = 1.0;
+    variables[1] = 1.0;
+    variables[2] = 1.0;
+}
+
+void computeComputedConstants(double *variables)
+{
+}
+
+void computeVariables(double *variables)
+{
+    findRoot0(variables);
+}
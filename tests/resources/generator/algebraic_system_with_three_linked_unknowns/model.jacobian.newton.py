@@ -0,0 +1,100 @@
+# The content of this file was generated using the Python profile of libCellML 0.6.3.
+
+from enum import Enum
+from math import *
+
+
+__version__ = "0.4.0"
+LIBCELLML_VERSION = "0.6.3"
+
+VARIABLE_COUNT = 3
+
+
+class VariableType(Enum):
+    CONSTANT = 0
+    COMPUTED_CONSTANT = 1
+    ALGEBRAIC = 2
+
+
+VARIABLE_INFO = [
+    {"name": "z", "units": "dimensionless", "component": "my_algebraic_system", "type": VariableType.ALGEBRAIC},
+    {"name": "y", "units": "dimensionless", "component": "my_algebraic_system", "type": VariableType.ALGEBRAIC},
+    {"name": "x", "units": "dimensionless", "component": "my_algebraic_system", "type": VariableType.ALGEBRAIC}
+]
+
+
+def create_variables_array():
+    return [nan]*VARIABLE_COUNT
+
+
+def objective_function_0(u, f, data):
+    variables = data[0]
+
+    variables[0] = u[0]
+    variables[1] = u[1]
+    variables[2] = u[2]
+
+    f[0] = 2.0*variables[2]+variables[1]-2.0*variables[0]-(-1.0)
+    f[1] = 3.0*variables[2]-3.0*variables[1]-variables[0]-5.0
+    f[2] = variables[2]-2.0*variables[1]+3.0*variables[0]-6.0
+
+
+def objective_jacobian_0(u, jacobian, data):
+    variables = data[0]
+
+    variables[0] = u[0]
+    variables[1] = u[1]
+    variables[2] = u[2]
+
+    jacobian[0] = -2.0
+    jacobian[1] = 1.0
+    jacobian[2] = 2.0
+    jacobian[3] = -1.0
+    jacobian[4] = -3.0
+    jacobian[5] = 3.0
+    jacobian[6] = 3.0
+    jacobian[7] = -2.0
+    jacobian[8] = 1.0
+
+
+def find_root_0(variables):
+    u = [nan]*3
+
+    u[0] = variables[0]
+    u[1] = variables[1]
+    u[2] = variables[2]
+
+    data = [variables]
+
+    for iteration in range(50):
+        f = [nan]*3
+        jacobian = [nan]*3*3
+
+        objective_function_0(u, f, data)
+
+        if all(fabs(f[i]) <= 1.0e-10 for i in range(3)):
+            break
+
+        objective_jacobian_0(u, jacobian, data)
+
+        u[0] = u[0]-(f[0]*(jacobian[4]*jacobian[8]-jacobian[5]*jacobian[7])-jacobian[1]*(f[1]*jacobian[8]-jacobian[5]*f[2])+jacobian[2]*(f[1]*jacobian[7]-jacobian[4]*f[2]))/(jacobian[0]*(jacobian[4]*jacobian[8]-jacobian[5]*jacobian[7])-jacobian[1]*(jacobian[3]*jacobian[8]-jacobian[5]*jacobian[6])+jacobian[2]*(jacobian[3]*jacobian[7]-jacobian[4]*jacobian[6]))
+        u[1] = u[1]-(jacobian[0]*(f[1]*jacobian[8]-jacobian[5]*f[2])-f[0]*(jacobian[3]*jacobian[8]-jacobian[5]*jacobian[6])+jacobian[2]*(jacobian[3]*f[2]-f[1]*jacobian[6]))/(jacobian[0]*(jacobian[4]*jacobian[8]-jacobian[5]*jacobian[7])-jacobian[1]*(jacobian[3]*jacobian[8]-jacobian[5]*jacobian[6])+jacobian[2]*(jacobian[3]*jacobian[7]-jacobian[4]*jacobian[6]))
+        u[2] = u[2]-(jacobian[0]*(jacobian[4]*f[2]-f[1]*jacobian[7])-jacobian[1]*(jacobian[3]*f[2]-f[1]*jacobian[6])+f[0]*(jacobian[3]*jacobian[7]-jacobian[4]*jacobian[6]))/(jacobian[0]*(jacobian[4]*jacobian[8]-jacobian[5]*jacobian[7])-jacobian[1]*(jacobian[3]*jacobian[8]-jacobian[5]*jacobian[6])+jacobian[2]*(jacobian[3]*jacobian[7]-jacobian[4]*jacobian[6]))
+
+    variables[0] = u[0]
+    variables[1] = u[1]
+    variables[2] = u[2]
+
+
+def initialise_variables(variables):
+    variables[0] = 1.0
+    variables[1] = 1.0
+    variables[2] = 1.0
+
+
+def compute_computed_constants(variables):
+    pass
+
+
+def compute_variables(variables):
+    find_root_0(variables)
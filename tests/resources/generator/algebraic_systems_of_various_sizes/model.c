@@ -0,0 +1,145 @@
+/* The content of this file was generated using the C profile of libCellML 0.6.3. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.5.0";
+const char LIBCELLML_VERSION[] = "0.6.3";
+
+const size_t VARIABLE_COUNT = 7;
+
+const VariableInfo VARIABLE_INFO[] = {
+    {"z", "dimensionless", "my_algebraic_systems", ALGEBRAIC},
+    {"y", "dimensionless", "my_algebraic_systems", ALGEBRAIC},
+    {"x", "dimensionless", "my_algebraic_systems", ALGEBRAIC},
+    {"w", "dimensionless", "my_algebraic_systems", ALGEBRAIC},
+    {"a", "dimensionless", "my_algebraic_systems", ALGEBRAIC},
+    {"c", "dimensionless", "my_algebraic_systems", ALGEBRAIC},
+    {"b", "dimensionless", "my_algebraic_systems", ALGEBRAIC}
+};
+
+double * createVariablesArray()
+{
+    double *res = (double *) malloc(VARIABLE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+typedef struct {
+    double *variables;
+} RootFindingInfo;
+
+extern void nlaSolve(void (*objectiveFunction)(double *, double *, void *),
+                     double *u, size_t n, void *data);
+
+void objectiveFunction0(double *u, double *f, void *data)
+{
+    double *variables = ((RootFindingInfo *) data)->variables;
+
+    variables[0] = u[0];
+    variables[1] = u[1];
+    variables[2] = u[2];
+    variables[3] = u[3];
+
+    f[0] = variables[3]+variables[2]+variables[1]+variables[0]-10.0;
+    f[1] = variables[3]-variables[2]+variables[1]-variables[0]-(-2.0);
+    f[2] = 2.0*variables[3]+variables[2]-variables[1]+variables[0]-5.0;
+    f[3] = variables[3]+2.0*variables[2]+3.0*variables[1]-variables[0]-10.0;
+}
+
+void findRoot0(double *variables)
+{
+    RootFindingInfo rfi = { variables };
+    double u[4];
+
+    u[0] = variables[0];
+    u[1] = variables[1];
+    u[2] = variables[2];
+    u[3] = variables[3];
+
+    nlaSolve(objectiveFunction0, u, 4, &rfi);
+
+    variables[0] = u[0];
+    variables[1] = u[1];
+    variables[2] = u[2];
+    variables[3] = u[3];
+}
+
+void objectiveFunction1(double *u, double *f, void *data)
+{
+    double *variables = ((RootFindingInfo *) data)->variables;
+
+    variables[4] = u[0];
+
+    f[0] = pow(variables[4], 3.0)+variables[4]-10.0;
+}
+
+void findRoot1(double *variables)
+{
+    RootFindingInfo rfi = { variables };
+    double u[1];
+
+    u[0] = variables[4];
+
+    nlaSolve(objectiveFunction1, u, 1, &rfi);
+
+    variables[4] = u[0];
+}
+
+void objectiveFunction2(double *u, double *f, void *data)
+{
+    double *variables = ((RootFindingInfo *) data)->variables;
+
+    variables[5] = u[0];
+    variables[6] = u[1];
+
+    f[0] = variables[6]*variables[5]-6.0;
+    f[1] = variables[6]+variables[5]-5.0;
+}
+
+void findRoot2(double *variables)
+{
+    RootFindingInfo rfi = { variables };
+    double u[2];
+
+    u[0] = variables[5];
+    u[1] = variables[6];
+
+    nlaSolve(objectiveFunction2, u, 2, &rfi);
+
+    variables[5] = u[0];
+    variables[6] = u[1];
+}
+
+void initialiseVariables(double *variables)
+{
+    variables[0] = 1.0;
+    variables[1] = 1.0;
+    variables[2] = 1.0;
+    variables[3] = 1.0;
+    variables[4] = 1.0;
+    variables[5] = 4.0;
+    variables[6] = 1.0;
+}
+
+void computeComputedConstants(double *variables)
+{
+}
+
+void computeVariables(double *variables)
+{
+    findRoot0(variables);
+    findRoot1(variables);
+    findRoot2(variables);
+}
@@ -0,0 +1,222 @@
+/* The content of this file was generated using the C profile of libCellML 0.6.3. */
+
+#include "model.newton.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.5.0";
+const char LIBCELLML_VERSION[] = "0.6.3";
+
+const size_t VARIABLE_COUNT = 7;
+
+const VariableInfo VARIABLE_INFO[] = {
+    {"z", "dimensionless", "my_algebraic_systems", ALGEBRAIC},
+    {"y", "dimensionless", "my_algebraic_systems", ALGEBRAIC},
+    {"x", "dimensionless", "my_algebraic_systems", ALGEBRAIC},
+    {"w", "dimensionless", "my_algebraic_systems", ALGEBRAIC},
+    {"a", "dimensionless", "my_algebraic_systems", ALGEBRAIC},
+    {"c", "dimensionless", "my_algebraic_systems", ALGEBRAIC},
+    {"b", "dimensionless", "my_algebraic_systems", ALGEBRAIC}
+};
+
+double * createVariablesArray()
+{
+    double *res = (double *) malloc(VARIABLE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+typedef struct {
+    double *variables;
+} RootFindingInfo;
+
+extern void nlaSolve(void (*objectiveFunction)(double *, double *, void *),
+                     double *u, size_t n, void *data);
+
+void objectiveFunction0(double *u, double *f, void *data)
+{
+    double *variables = ((RootFindingInfo *) data)->variables;
+
+    variables[0] = u[0];
+    variables[1] = u[1];
+    variables[2] = u[2];
+    variables[3] = u[3];
+
+    f[0] = variables[3]+variables[2]+variables[1]+variables[0]-10.0;
+    f[1] = variables[3]-variables[2]+variables[1]-variables[0]-(-2.0);
+    f[2] = 2.0*variables[3]+variables[2]-variables[1]+variables[0]-5.0;
+    f[3] = variables[3]+2.0*variables[2]+3.0*variables[1]-variables[0]-10.0;
+}
+
+void findRoot0(double *variables)
+{
+    RootFindingInfo rfi = { variables };
+    double u[4];
+
+    u[0] = variables[0];
+    u[1] = variables[1];
+    u[2] = variables[2];
+    u[3] = variables[3];
+
+    nlaSolve(objectiveFunction0, u, 4, &rfi);
+
+    variables[0] = u[0];
+    variables[1] = u[1];
+    variables[2] = u[2];
+    variables[3] = u[3];
+}
+
+void objectiveFunction1(double *u, double *f, void *data)
+{
+    double *variables = ((RootFindingInfo *) data)->variables;
+
+    variables[4] = u[0];
+
+    f[0] = pow(variables[4], 3.0)+variables[4]-10.0;
+}
+
+void objectiveJacobian1(double *u, double *f, double *jacobian, void *data)
+{
+    double fh[1];
+
+    for (size_t j = 0; j < 1; ++j) {
+        double uj = u[j];
+        double h = 1.0e-8*fmax(1.0, fabs(uj));
+
+        u[j] = uj+h;
+
+        objectiveFunction1(u, fh, data);
+
+        u[j] = uj;
+
+        for (size_t i = 0; i < 1; ++i) {
+            jacobian[i*1+j] = (fh[i]-f[i])/h;
+        }
+    }
+}
+
+void findRoot1(double *variables)
+{
+    RootFindingInfo rfi = { variables };
+    double u[1];
+
+    u[0] = variables[4];
+
+    for (int iteration = 0; iteration < 50; ++iteration) {
+        double f[1];
+        double jacobian[1*1];
+        int converged = 1;
+
+        objectiveFunction1(u, f, &rfi);
+
+        for (size_t i = 0; i < 1; ++i) {
+            converged = converged && (fabs(f[i]) <= 1.0e-10);
+        }
+
+        if (converged) {
+            break;
+        }
+
+        objectiveJacobian1(u, f, jacobian, &rfi);
+
+        u[0] = u[0]-f[0]/jacobian[0];
+    }
+
+    variables[4] = u[0];
+}
+
+void objectiveFunction2(double *u, double *f, void *data)
+{
+    double *variables = ((RootFindingInfo *) data)->variables;
+
+    variables[5] = u[0];
+    variables[6] = u[1];
+
+    f[0] = variables[6]*variables[5]-6.0;
+    f[1] = variables[6]+variables[5]-5.0;
+}
+
+void objectiveJacobian2(double *u, double *f, double *jacobian, void *data)
+{
+    double fh[2];
+
+    for (size_t j = 0; j < 2; ++j) {
+        double uj = u[j];
+        double h = 1.0e-8*fmax(1.0, fabs(uj));
+
+        u[j] = uj+h;
+
+        objectiveFunction2(u, fh, data);
+
+        u[j] = uj;
+
+        for (size_t i = 0; i < 2; ++i) {
+            jacobian[i*2+j] = (fh[i]-f[i])/h;
+        }
+    }
+}
+
+void findRoot2(double *variables)
+{
+    RootFindingInfo rfi = { variables };
+    double u[2];
+
+    u[0] = variables[5];
+    u[1] = variables[6];
+
+    for (int iteration = 0; iteration < 50; ++iteration) {
+        double f[2];
+        double jacobian[2*2];
+        int converged = 1;
+
+        objectiveFunction2(u, f, &rfi);
+
+        for (size_t i = 0; i < 2; ++i) {
+            converged = converged && (fabs(f[i]) <= 1.0e-10);
+        }
+
+        if (converged) {
+            break;
+        }
+
+        objectiveJacobian2(u, f, jacobian, &rfi);
+
+        u[0] = u[0]-(f[0]*jacobian[3]-jacobian[1]*f[1])/(jacobian[0]*jacobian[3]-jacobian[1]*jacobian[2]);
+        u[1] = u[1]-(jacobian[0]*f[1]-f[0]*jacobian[2])/(jacobian[0]*jacobian[3]-jacobian[1]*jacobian[2]);
+    }
+
+    variables[5] = u[0];
+    variables[6] = u[1];
+}
+
+void initialiseVariables(double *variables)
+{
+    variables[0] = 1.0;
+    variables[1] = 1.0;
+    variables[2] = 1.0;
+    variables[3] = 1.0;
+    variables[4] = 1.0;
+    variables[5] = 4.0;
+    variables[6] = 1.0;
+}
+
+void computeComputedConstants(double *variables)
+{
+}
+
+void computeVariables(double *variables)
+{
+    findRoot0(variables);
+    findRoot1(variables);
+    findRoot2(variables);
+}
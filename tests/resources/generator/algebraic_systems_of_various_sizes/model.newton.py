@@ -0,0 +1,185 @@
+# The content of this file was generated using the Python profile of libCellML 0.6.3.
+
+from enum import Enum
+from math import *
+
+
+__version__ = "0.4.0"
+LIBCELLML_VERSION = "0.6.3"
+
+VARIABLE_COUNT = 7
+
+
+class VariableType(Enum):
+    CONSTANT = 0
+    COMPUTED_CONSTANT = 1
+    ALGEBRAIC = 2
+
+
+VARIABLE_INFO = [
+    {"name": "z", "units": "dimensionless", "component": "my_algebraic_systems", "type": VariableType.ALGEBRAIC},
+    {"name": "y", "units": "dimensionless", "component": "my_algebraic_systems", "type": VariableType.ALGEBRAIC},
+    {"name": "x", "units": "dimensionless", "component": "my_algebraic_systems", "type": VariableType.ALGEBRAIC},
+    {"name": "w", "units": "dimensionless", "component": "my_algebraic_systems", "type": VariableType.ALGEBRAIC},
+    {"name": "a", "units": "dimensionless", "component": "my_algebraic_systems", "type": VariableType.ALGEBRAIC},
+    {"name": "c", "units": "dimensionless", "component": "my_algebraic_systems", "type": VariableType.ALGEBRAIC},
+    {"name": "b", "units": "dimensionless", "component": "my_algebraic_systems", "type": VariableType.ALGEBRAIC}
+]
+
+
+def create_variables_array():
+    return [nan]*VARIABLE_COUNT
+
+
+from nlasolver import nla_solve
+
+
+def objective_function_0(u, f, data):
+    variables = data[0]
+
+    variables[0] = u[0]
+    variables[1] = u[1]
+    variables[2] = u[2]
+    variables[3] = u[3]
+
+    f[0] = variables[3]+variables[2]+variables[1]+variables[0]-10.0
+    f[1] = variables[3]-variables[2]+variables[1]-variables[0]-(-2.0)
+    f[2] = 2.0*variables[3]+variables[2]-variables[1]+variables[0]-5.0
+    f[3] = variables[3]+2.0*variables[2]+3.0*variables[1]-variables[0]-10.0
+
+
+def find_root_0(variables):
+    u = [nan]*4
+
+    u[0] = variables[0]
+    u[1] = variables[1]
+    u[2] = variables[2]
+    u[3] = variables[3]
+
+    u = nla_solve(objective_function_0, u, 4, [variables])
+
+    variables[0] = u[0]
+    variables[1] = u[1]
+    variables[2] = u[2]
+    variables[3] = u[3]
+
+
+def objective_function_1(u, f, data):
+    variables = data[0]
+
+    variables[4] = u[0]
+
+    f[0] = pow(variables[4], 3.0)+variables[4]-10.0
+
+
+def objective_jacobian_1(u, f, jacobian, data):
+    fh = [nan]*1
+
+    for j in range(1):
+        uj = u[j]
+        h = 1.0e-8*max(1.0, fabs(uj))
+
+        u[j] = uj+h
+
+        objective_function_1(u, fh, data)
+
+        u[j] = uj
+
+        for i in range(1):
+            jacobian[i*1+j] = (fh[i]-f[i])/h
+
+
+def find_root_1(variables):
+    u = [nan]*1
+
+    u[0] = variables[4]
+
+    data = [variables]
+
+    for iteration in range(50):
+        f = [nan]*1
+        jacobian = [nan]*1*1
+
+        objective_function_1(u, f, data)
+
+        if all(fabs(f[i]) <= 1.0e-10 for i in range(1)):
+            break
+
+        objective_jacobian_1(u, f, jacobian, data)
+
+        u[0] = u[0]-f[0]/jacobian[0]
+
+    variables[4] = u[0]
+
+
+def objective_function_2(u, f, data):
+    variables = data[0]
+
+    variables[5] = u[0]
+    variables[6] = u[1]
+
+    f[0] = variables[6]*variables[5]-6.0
+    f[1] = variables[6]+variables[5]-5.0
+
+
+def objective_jacobian_2(u, f, jacobian, data):
+    fh = [nan]*2
+
+    for j in range(2):
+        uj = u[j]
+        h = 1.0e-8*max(1.0, fabs(uj))
+
+        u[j] = uj+h
+
+        objective_function_2(u, fh, data)
+
+        u[j] = uj
+
+        for i in range(2):
+            jacobian[i*2+j] = (fh[i]-f[i])/h
+
+
+def find_root_2(variables):
+    u = [nan]*2
+
+    u[0] = variables[5]
+    u[1] = variables[6]
+
+    data = [variables]
+
+    for iteration in range(50):
+        f = [nan]*2
+        jacobian = [nan]*2*2
+
+        objective_function_2(u, f, data)
+
+        if all(fabs(f[i]) <= 1.0e-10 for i in range(2)):
+            break
+
+        objective_jacobian_2(u, f, jacobian, data)
+
+        u[0] = u[0]-(f[0]*jacobian[3]-jacobian[1]*f[1])/(jacobian[0]*jacobian[3]-jacobian[1]*jacobian[2])
+        u[1] = u[1]-(jacobian[0]*f[1]-f[0]*jacobian[2])/(jacobian[0]*jacobian[3]-jacobian[1]*jacobian[2])
+
+    variables[5] = u[0]
+    variables[6] = u[1]
+
+
+def initialise_variables(variables):
+    variables[0] = 1.0
+    variables[1] = 1.0
+    variables[2] = 1.0
+    variables[3] = 1.0
+    variables[4] = 1.0
+    variables[5] = 4.0
+    variables[6] = 1.0
+
+
+def compute_computed_constants(variables):
+    pass
+
+
+def compute_variables(variables):
+    find_root_0(variables)
+    find_root_1(variables)
+    find_root_2(variables)
@@ -0,0 +1,103 @@
+/* The content of this file was generated using the C profile of libCellML 0.6.3. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.5.0";
+const char LIBCELLML_VERSION[] = "0.6.3";
+
+const size_t STATE_COUNT = 2;
+const size_t VARIABLE_COUNT = 6;
+
+const VariableInfo VOI_INFO = {"t", "second", "ball", VARIABLE_OF_INTEGRATION};
+
+const VariableInfo STATE_INFO[] = {
+    {"v", "metre_per_second", "ball", STATE},
+    {"x", "metre", "ball", STATE}
+};
+
+const VariableInfo VARIABLE_INFO[] = {
+    {"g", "metre_per_second2", "ball", CONSTANT},
+    {"r", "metre", "ball", CONSTANT},
+    {"h", "metre", "ball", ALGEBRAIC},
+    {"t_kick", "second", "ball", CONSTANT},
+    {"v_kick", "metre_per_second", "ball", CONSTANT},
+    {"e", "dimensionless", "ball", CONSTANT}
+};
+
+const size_t EVENT_COUNT = 3;
+
+double * createStatesArray()
+{
+    double *res = (double *) malloc(STATE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < STATE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+double * createVariablesArray()
+{
+    double *res = (double *) malloc(VARIABLE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initialiseVariables(double *states, double *rates, double *variables)
+{
+    variables[0] = 9.81;
+    variables[1] = 0.1;
+    variables[3] = 5.0;
+    variables[4] = 2.0;
+    variables[5] = 0.8;
+    states[0] = 0.0;
+    states[1] = 1.0;
+}
+
+void computeComputedConstants(double *variables)
+{
+}
+
+void computeRates(double voi, double *states, double *rates, double *variables)
+{
+    rates[1] = states[0];
+    rates[0] = -variables[0];
+}
+
+void computeVariables(double voi, double *states, double *rates, double *variables)
+{
+    variables[2] = states[1]-variables[1];
+}
+
+void computeEventConditions(double voi, double *states, double *rates, double *variables, double *conditions)
+{
+    variables[2] = states[1]-variables[1];
+
+    conditions[0] = voi-variables[3];
+    conditions[1] = variables[2]-0.0;
+    conditions[2] = variables[2]-0.0;
+}
+
+void applyResets(double voi, double *states, double *rates, double *variables, int *events)
+{
+    double resetValues[2];
+
+    resetValues[0] = (events[1])?-variables[5]*states[0]:(events[0])?states[0]+variables[4]:states[0];
+    resetValues[1] = (events[2])?variables[1]:states[1];
+
+    states[0] = resetValues[0];
+    states[1] = resetValues[1];
+}
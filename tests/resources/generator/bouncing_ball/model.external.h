@@ -0,0 +1,46 @@
+/* The content of this file was generated using the C profile of libCellML 0.6.3. */
+
+#pragma once
+
+#include <stddef.h>
+
+extern const char VERSION[];
+extern const char LIBCELLML_VERSION[];
+
+extern const size_t STATE_COUNT;
+extern const size_t VARIABLE_COUNT;
+
+typedef enum {
+    VARIABLE_OF_INTEGRATION,
+    STATE,
+    CONSTANT,
+    COMPUTED_CONSTANT,
+    ALGEBRAIC,
+    EXTERNAL
+} VariableType;
+
+typedef struct {
+    char name[7];
+    char units[18];
+    char component[5];
+    VariableType type;
+} VariableInfo;
+
+extern const VariableInfo VOI_INFO;
+extern const VariableInfo STATE_INFO[];
+extern const VariableInfo VARIABLE_INFO[];
+
+extern const size_t EVENT_COUNT;
+
+double * createStatesArray();
+double * createVariablesArray();
+void deleteArray(double *array);
+
+typedef double (* ExternalVariable)(double voi, double *states, double *rates, double *variables, size_t index);
+
+void initialiseVariables(double voi, double *states, double *rates, double *variables, ExternalVariable externalVariable);
+void computeComputedConstants(double *variables);
+void computeRates(double voi, double *states, double *rates, double *variables, ExternalVariable externalVariable);
+void computeVariables(double voi, double *states, double *rates, double *variables, ExternalVariable externalVariable);
+void computeEventConditions(double voi, double *states, double *rates, double *variables, double *conditions);
+void applyResets(double voi, double *states, double *rates, double *variables, int *events);
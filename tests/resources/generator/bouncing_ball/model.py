@@ -0,0 +1,87 @@
+# The content of this file was generated using the Python profile of libCellML 0.6.3.
+
+from enum import Enum
+from math import *
+
+
+__version__ = "0.4.0"
+LIBCELLML_VERSION = "0.6.3"
+
+STATE_COUNT = 2
+VARIABLE_COUNT = 6
+
+
+class VariableType(Enum):
+    VARIABLE_OF_INTEGRATION = 0
+    STATE = 1
+    CONSTANT = 2
+    COMPUTED_CONSTANT = 3
+    ALGEBRAIC = 4
+
+
+VOI_INFO = {"name": "t", "units": "second", "component": "ball", "type": VariableType.VARIABLE_OF_INTEGRATION}
+
+STATE_INFO = [
+    {"name": "v", "units": "metre_per_second", "component": "ball", "type": VariableType.STATE},
+    {"name": "x", "units": "metre", "component": "ball", "type": VariableType.STATE}
+]
+
+VARIABLE_INFO = [
+    {"name": "g", "units": "metre_per_second2", "component": "ball", "type": VariableType.CONSTANT},
+    {"name": "r", "units": "metre", "component": "ball", "type": VariableType.CONSTANT},
+    {"name": "h", "units": "metre", "component": "ball", "type": VariableType.ALGEBRAIC},
+    {"name": "t_kick", "units": "second", "component": "ball", "type": VariableType.CONSTANT},
+    {"name": "v_kick", "units": "metre_per_second", "component": "ball", "type": VariableType.CONSTANT},
+    {"name": "e", "units": "dimensionless", "component": "ball", "type": VariableType.CONSTANT}
+]
+
+EVENT_COUNT = 3
+
+
+def create_states_array():
+    return [nan]*STATE_COUNT
+
+
+def create_variables_array():
+    return [nan]*VARIABLE_COUNT
+
+
+def initialise_variables(states, rates, variables):
+    variables[0] = 9.81
+    variables[1] = 0.1
+    variables[3] = 5.0
+    variables[4] = 2.0
+    variables[5] = 0.8
+    states[0] = 0.0
+    states[1] = 1.0
+
+
+def compute_computed_constants(variables):
+    pass
+
+
+def compute_rates(voi, states, rates, variables):
+    rates[1] = states[0]
+    rates[0] = -variables[0]
+
+
+def compute_variables(voi, states, rates, variables):
+    variables[2] = states[1]-variables[1]
+
+
+def compute_event_conditions(voi, states, rates, variables, conditions):
+    variables[2] = states[1]-variables[1]
+
+    conditions[0] = voi-variables[3]
+    conditions[1] = variables[2]-0.0
+    conditions[2] = variables[2]-0.0
+
+
+def apply_resets(voi, states, rates, variables, events):
+    reset_values = [nan]*2
+
+    reset_values[0] = -variables[5]*states[0] if events[1] else states[0]+variables[4] if events[0] else states[0]
+    reset_values[1] = variables[1] if events[2] else states[1]
+
+    states[0] = reset_values[0]
+    states[1] = reset_values[1]
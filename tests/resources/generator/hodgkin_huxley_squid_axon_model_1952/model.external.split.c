@@ -0,0 +1,146 @@
+/* The content of this file was generated using the C profile of libCellML 0.6.3. */
+
+#include "model.external.split.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.5.0";
+const char LIBCELLML_VERSION[] = "0.6.3";
+
+const size_t STATE_COUNT = 3;
+const size_t CONSTANT_COUNT = 4;
+const size_t COMPUTED_CONSTANT_COUNT = 3;
+const size_t ALGEBRAIC_COUNT = 12;
+
+const VariableInfo VOI_INFO = {"time", "millisecond", "environment", VARIABLE_OF_INTEGRATION};
+
+const VariableInfo STATE_INFO[] = {
+    {"h", "dimensionless", "sodium_channel_h_gate", STATE},
+    {"m", "dimensionless", "sodium_channel_m_gate", STATE},
+    {"n", "dimensionless", "potassium_channel_n_gate", STATE}
+};
+
+const VariableInfo CONSTANT_INFO[] = {
+    {"E_R", "millivolt", "membrane", CONSTANT},
+    {"g_L", "milliS_per_cm2", "leakage_current", CONSTANT},
+    {"g_Na", "milliS_per_cm2", "sodium_channel", CONSTANT},
+    {"g_K", "milliS_per_cm2", "potassium_channel", CONSTANT}
+};
+
+const VariableInfo COMPUTED_CONSTANT_INFO[] = {
+    {"E_L", "millivolt", "leakage_current", COMPUTED_CONSTANT},
+    {"E_Na", "millivolt", "sodium_channel", COMPUTED_CONSTANT},
+    {"E_K", "millivolt", "potassium_channel", COMPUTED_CONSTANT}
+};
+
+const VariableInfo ALGEBRAIC_INFO[] = {
+    {"i_Stim", "microA_per_cm2", "membrane", ALGEBRAIC},
+    {"Cm", "microF_per_cm2", "membrane", EXTERNAL},
+    {"i_L", "microA_per_cm2", "leakage_current", ALGEBRAIC},
+    {"i_K", "microA_per_cm2", "potassium_channel", ALGEBRAIC},
+    {"i_Na", "microA_per_cm2", "sodium_channel", EXTERNAL},
+    {"V", "millivolt", "membrane", EXTERNAL},
+    {"alpha_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"beta_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"alpha_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"beta_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"alpha_n", "per_millisecond", "potassium_channel_n_gate", EXTERNAL},
+    {"beta_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC}
+};
+
+double * createStatesArray()
+{
+    double *res = (double *) malloc(STATE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < STATE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+double * createConstantsArray()
+{
+    double *res = (double *) malloc(CONSTANT_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < CONSTANT_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+double * createComputedConstantsArray()
+{
+    double *res = (double *) malloc(COMPUTED_CONSTANT_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < COMPUTED_CONSTANT_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+double * createAlgebraicArray()
+{
+    double *res = (double *) malloc(ALGEBRAIC_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < ALGEBRAIC_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initialiseVariables(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraic, ExternalVariable externalVariable)
+{
+    constants[0] = 0.0;
+    constants[1] = 0.3;
+    constants[2] = 120.0;
+    constants[3] = 36.0;
+    states[0] = 0.6;
+    states[1] = 0.05;
+    states[2] = 0.325;
+    algebraic[5] = externalVariable(voi, states, rates, constants, computedConstants, algebraic, 5);
+    algebraic[10] = externalVariable(voi, states, rates, constants, computedConstants, algebraic, 10);
+    algebraic[4] = externalVariable(voi, states, rates, constants, computedConstants, algebraic, 4);
+    algebraic[1] = externalVariable(voi, states, rates, constants, computedConstants, algebraic, 1);
+}
+
+void computeComputedConstants(double *constants, double *computedConstants, double *algebraic)
+{
+    computedConstants[0] = constants[0]-10.613;
+    computedConstants[1] = constants[0]-115.0;
+    computedConstants[2] = constants[0]+12.0;
+}
+
+void computeRates(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraic, ExternalVariable externalVariable)
+{
+    algebraic[5] = externalVariable(voi, states, rates, constants, computedConstants, algebraic, 5);
+    algebraic[7] = 4.0*exp(algebraic[5]/18.0);
+    algebraic[6] = 0.1*(algebraic[5]+25.0)/(exp((algebraic[5]+25.0)/10.0)-1.0);
+    rates[1] = algebraic[6]*(1.0-states[1])-algebraic[7]*states[1];
+    algebraic[9] = 1.0/(exp((algebraic[5]+30.0)/10.0)+1.0);
+    algebraic[8] = 0.07*exp(algebraic[5]/20.0);
+    rates[0] = algebraic[8]*(1.0-states[0])-algebraic[9]*states[0];
+    algebraic[11] = 0.125*exp(algebraic[5]/80.0);
+    algebraic[10] = externalVariable(voi, states, rates, constants, computedConstants, algebraic, 10);
+    rates[2] = algebraic[10]*(1.0-states[2])-algebraic[11]*states[2];
+}
+
+void computeVariables(double voi, double *states, double *rates, double *constants, double *computedConstants, double *algebraic, ExternalVariable externalVariable)
+{
+    algebraic[0] = ((voi >= 10.0) && (voi <= 10.5))?-20.0:0.0;
+    algebraic[5] = externalVariable(voi, states, rates, constants, computedConstants, algebraic, 5);
+    algebraic[2] = constants[1]*(algebraic[5]-computedConstants[0]);
+    algebraic[10] = externalVariable(voi, states, rates, constants, computedConstants, algebraic, 10);
+    algebraic[4] = externalVariable(voi, states, rates, constants, computedConstants, algebraic, 4);
+    algebraic[3] = constants[3]*pow(states[2], 4.0)*(algebraic[5]-computedConstants[2]);
+    algebraic[1] = externalVariable(voi, states, rates, constants, computedConstants, algebraic, 1);
+}
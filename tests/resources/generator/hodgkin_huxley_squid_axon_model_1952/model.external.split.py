@@ -0,0 +1,130 @@
+# The content of this file was generated using the Python profile of libCellML 0.6.3.
+
+from enum import Enum
+from math import *
+
+
+__version__ = "0.4.0"
+LIBCELLML_VERSION = "0.6.3"
+
+STATE_COUNT = 3
+CONSTANT_COUNT = 4
+COMPUTED_CONSTANT_COUNT = 3
+ALGEBRAIC_COUNT = 12
+
+
+class VariableType(Enum):
+    VARIABLE_OF_INTEGRATION = 0
+    STATE = 1
+    CONSTANT = 2
+    COMPUTED_CONSTANT = 3
+    ALGEBRAIC = 4
+    EXTERNAL = 5
+
+
+VOI_INFO = {"name": "time", "units": "millisecond", "component": "environment", "type": VariableType.VARIABLE_OF_INTEGRATION}
+
+STATE_INFO = [
+    {"name": "h", "units": "dimensionless", "component": "sodium_channel_h_gate", "type": VariableType.STATE},
+    {"name": "m", "units": "dimensionless", "component": "sodium_channel_m_gate", "type": VariableType.STATE},
+    {"name": "n", "units": "dimensionless", "component": "potassium_channel_n_gate", "type": VariableType.STATE}
+]
+
+CONSTANT_INFO = [
+    {"name": "E_R", "units": "millivolt", "component": "membrane", "type": VariableType.CONSTANT},
+    {"name": "g_L", "units": "milliS_per_cm2", "component": "leakage_current", "type": VariableType.CONSTANT},
+    {"name": "g_Na", "units": "milliS_per_cm2", "component": "sodium_channel", "type": VariableType.CONSTANT},
+    {"name": "g_K", "units": "milliS_per_cm2", "component": "potassium_channel", "type": VariableType.CONSTANT}
+]
+
+COMPUTED_CONSTANT_INFO = [
+    {"name": "E_L", "units": "millivolt", "component": "leakage_current", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "E_Na", "units": "millivolt", "component": "sodium_channel", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "E_K", "units": "millivolt", "component": "potassium_channel", "type": VariableType.COMPUTED_CONSTANT}
+]
+
+ALGEBRAIC_INFO = [
+    {"name": "i_Stim", "units": "microA_per_cm2", "component": "membrane", "type": VariableType.ALGEBRAIC},
+    {"name": "Cm", "units": "microF_per_cm2", "component": "membrane", "type": VariableType.EXTERNAL},
+    {"name": "i_L", "units": "microA_per_cm2", "component": "leakage_current", "type": VariableType.ALGEBRAIC},
+    {"name": "i_K", "units": "microA_per_cm2", "component": "potassium_channel", "type": VariableType.ALGEBRAIC},
+    {"name": "i_Na", "units": "microA_per_cm2", "component": "sodium_channel", "type": VariableType.EXTERNAL},
+    {"name": "V", "units": "millivolt", "component": "membrane", "type": VariableType.EXTERNAL},
+    {"name": "alpha_m", "units": "per_millisecond", "component": "sodium_channel_m_gate", "type": VariableType.ALGEBRAIC},
+    {"name": "beta_m", "units": "per_millisecond", "component": "sodium_channel_m_gate", "type": VariableType.ALGEBRAIC},
+    {"name": "alpha_h", "units": "per_millisecond", "component": "sodium_channel_h_gate", "type": VariableType.ALGEBRAIC},
+    {"name": "beta_h", "units": "per_millisecond", "component": "sodium_channel_h_gate", "type": VariableType.ALGEBRAIC},
+    {"name": "alpha_n", "units": "per_millisecond", "component": "potassium_channel_n_gate", "type": VariableType.EXTERNAL},
+    {"name": "beta_n", "units": "per_millisecond", "component": "potassium_channel_n_gate", "type": VariableType.ALGEBRAIC}
+]
+
+
+def leq_func(x, y):
+    return 1.0 if x <= y else 0.0
+
+
+def geq_func(x, y):
+    return 1.0 if x >= y else 0.0
+
+
+def and_func(x, y):
+    return 1.0 if bool(x) & bool(y) else 0.0
+
+
+def create_states_array():
+    return [nan]*STATE_COUNT
+
+
+def create_constants_array():
+    return [nan]*CONSTANT_COUNT
+
+
+def create_computed_constants_array():
+    return [nan]*COMPUTED_CONSTANT_COUNT
+
+
+def create_algebraic_array():
+    return [nan]*ALGEBRAIC_COUNT
+
+
+def initialise_variables(voi, states, rates, constants, computed_constants, algebraic, external_variable):
+    constants[0] = 0.0
+    constants[1] = 0.3
+    constants[2] = 120.0
+    constants[3] = 36.0
+    states[0] = 0.6
+    states[1] = 0.05
+    states[2] = 0.325
+    algebraic[5] = external_variable(voi, states, rates, constants, computed_constants, algebraic, 5)
+    algebraic[10] = external_variable(voi, states, rates, constants, computed_constants, algebraic, 10)
+    algebraic[4] = external_variable(voi, states, rates, constants, computed_constants, algebraic, 4)
+    algebraic[1] = external_variable(voi, states, rates, constants, computed_constants, algebraic, 1)
+
+
+def compute_computed_constants(constants, computed_constants, algebraic):
+    computed_constants[0] = constants[0]-10.613
+    computed_constants[1] = constants[0]-115.0
+    computed_constants[2] = constants[0]+12.0
+
+
+def compute_rates(voi, states, rates, constants, computed_constants, algebraic, external_variable):
+    algebraic[5] = external_variable(voi, states, rates, constants, computed_constants, algebraic, 5)
+    algebraic[7] = 4.0*exp(algebraic[5]/18.0)
+    algebraic[6] = 0.1*(algebraic[5]+25.0)/(exp((algebraic[5]+25.0)/10.0)-1.0)
+    rates[1] = algebraic[6]*(1.0-states[1])-algebraic[7]*states[1]
+    algebraic[9] = 1.0/(exp((algebraic[5]+30.0)/10.0)+1.0)
+    algebraic[8] = 0.07*exp(algebraic[5]/20.0)
+    rates[0] = algebraic[8]*(1.0-states[0])-algebraic[9]*states[0]
+    algebraic[11] = 0.125*exp(algebraic[5]/80.0)
+    algebraic[10] = external_variable(voi, states, rates, constants, computed_constants, algebraic, 10)
+    rates[2] = algebraic[10]*(1.0-states[2])-algebraic[11]*states[2]
+
+
+def compute_variables(voi, states, rates, constants, computed_constants, algebraic, external_variable):
+    algebraic[0] = -20.0 if and_func(geq_func(voi, 10.0), leq_func(voi, 10.5)) else 0.0
+    algebraic[5] = external_variable(voi, states, rates, constants, computed_constants, algebraic, 5)
+    algebraic[2] = constants[1]*(algebraic[5]-computed_constants[0])
+    algebraic[10] = external_variable(voi, states, rates, constants, computed_constants, algebraic, 10)
+    algebraic[4] = external_variable(voi, states, rates, constants, computed_constants, algebraic, 4)
+    algebraic[3] = constants[3]*pow(states[2], 4.0)*(algebraic[5]-computed_constants[2])
+    algebraic[1] = external_variable(voi, states, rates, constants, computed_constants, algebraic, 1)
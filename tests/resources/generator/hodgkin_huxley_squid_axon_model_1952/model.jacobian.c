@@ -0,0 +1,134 @@
+/* The content of this file was generated using the C profile of libCellML 0.6.3. */
+
+#include "model.jacobian.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.5.0";
+const char LIBCELLML_VERSION[] = "0.6.3";
+
+const size_t STATE_COUNT = 4;
+const size_t VARIABLE_COUNT = 18;
+
+const VariableInfo VOI_INFO = {"time", "millisecond", "environment", VARIABLE_OF_INTEGRATION};
+
+const VariableInfo STATE_INFO[] = {
+    {"V", "millivolt", "membrane", STATE},
+    {"h", "dimensionless", "sodium_channel_h_gate", STATE},
+    {"m", "dimensionless", "sodium_channel_m_gate", STATE},
+    {"n", "dimensionless", "potassium_channel_n_gate", STATE}
+};
+
+const VariableInfo VARIABLE_INFO[] = {
+    {"i_Stim", "microA_per_cm2", "membrane", ALGEBRAIC},
+    {"Cm", "microF_per_cm2", "membrane", CONSTANT},
+    {"i_L", "microA_per_cm2", "leakage_current", ALGEBRAIC},
+    {"i_K", "microA_per_cm2", "potassium_channel", ALGEBRAIC},
+    {"i_Na", "microA_per_cm2", "sodium_channel", ALGEBRAIC},
+    {"E_R", "millivolt", "membrane", CONSTANT},
+    {"E_L", "millivolt", "leakage_current", COMPUTED_CONSTANT},
+    {"g_L", "milliS_per_cm2", "leakage_current", CONSTANT},
+    {"E_Na", "millivolt", "sodium_channel", COMPUTED_CONSTANT},
+    {"g_Na", "milliS_per_cm2", "sodium_channel", CONSTANT},
+    {"alpha_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"beta_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"alpha_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"beta_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"E_K", "millivolt", "potassium_channel", COMPUTED_CONSTANT},
+    {"g_K", "milliS_per_cm2", "potassium_channel", CONSTANT},
+    {"alpha_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC},
+    {"beta_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC}
+};
+
+double * createStatesArray()
+{
+    double *res = (double *) malloc(STATE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < STATE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+double * createVariablesArray()
+{
+    double *res = (double *) malloc(VARIABLE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initialiseVariables(double *states, double *rates, double *variables)
+{
+    variables[1] = 1.0;
+    variables[5] = 0.0;
+    variables[7] = 0.3;
+    variables[9] = 120.0;
+    variables[15] = 36.0;
+    states[0] = 0.0;
+    states[1] = 0.6;
+    states[2] = 0.05;
+    states[3] = 0.325;
+}
+
+void computeComputedConstants(double *variables)
+{
+    variables[6] = variables[5]-10.613;
+    variables[8] = variables[5]-115.0;
+    variables[14] = variables[5]+12.0;
+}
+
+void computeRates(double voi, double *states, double *rates, double *variables)
+{
+    variables[0] = ((voi >= 10.0) && (voi <= 10.5))?-20.0:0.0;
+    variables[2] = variables[7]*(states[0]-variables[6]);
+    variables[3] = variables[15]*pow(states[3], 4.0)*(states[0]-variables[14]);
+    variables[4] = variables[9]*pow(states[2], 3.0)*states[1]*(states[0]-variables[8]);
+    rates[0] = -(-variables[0]+variables[4]+variables[3]+variables[2])/variables[1];
+    variables[11] = 4.0*exp(states[0]/18.0);
+    variables[10] = 0.1*(states[0]+25.0)/(exp((states[0]+25.0)/10.0)-1.0);
+    rates[2] = variables[10]*(1.0-states[2])-variables[11]*states[2];
+    variables[13] = 1.0/(exp((states[0]+30.0)/10.0)+1.0);
+    variables[12] = 0.07*exp(states[0]/20.0);
+    rates[1] = variables[12]*(1.0-states[1])-variables[13]*states[1];
+    variables[17] = 0.125*exp(states[0]/80.0);
+    variables[16] = 0.01*(states[0]+10.0)/(exp((states[0]+10.0)/10.0)-1.0);
+    rates[3] = variables[16]*(1.0-states[3])-variables[17]*states[3];
+}
+
+void computeVariables(double voi, double *states, double *rates, double *variables)
+{
+    variables[2] = variables[7]*(states[0]-variables[6]);
+    variables[4] = variables[9]*pow(states[2], 3.0)*states[1]*(states[0]-variables[8]);
+    variables[10] = 0.1*(states[0]+25.0)/(exp((states[0]+25.0)/10.0)-1.0);
+    variables[11] = 4.0*exp(states[0]/18.0);
+    variables[12] = 0.07*exp(states[0]/20.0);
+    variables[13] = 1.0/(exp((states[0]+30.0)/10.0)+1.0);
+    variables[3] = variables[15]*pow(states[3], 4.0)*(states[0]-variables[14]);
+    variables[16] = 0.01*(states[0]+10.0)/(exp((states[0]+10.0)/10.0)-1.0);
+    variables[17] = 0.125*exp(states[0]/80.0);
+}
+
+void computeJacobian(double voi, double *states, double *rates, double *variables, double *jacobian)
+{
+    jacobian[0] = -(variables[9]*pow(states[2], 3.0)*states[1]+variables[15]*pow(states[3], 4.0)+variables[7])/variables[1];
+    jacobian[1] = -variables[9]*pow(states[2], 3.0)*(states[0]-variables[8])/variables[1];
+    jacobian[2] = -3.0*variables[9]*pow(states[2], 2.0)*states[1]*(states[0]-variables[8])/variables[1];
+    jacobian[3] = -4.0*variables[15]*pow(states[3], 3.0)*(states[0]-variables[14])/variables[1];
+    jacobian[4] = 0.0035*exp(states[0]/20.0)*(1.0-states[1])+0.1*exp((states[0]+30.0)/10.0)/((exp((states[0]+30.0)/10.0)+1.0)*(exp((states[0]+30.0)/10.0)+1.0))*states[1];
+    jacobian[5] = -variables[12]-variables[13];
+    jacobian[8] = (0.1*(exp((states[0]+25.0)/10.0)-1.0)-0.01*(states[0]+25.0)*exp((states[0]+25.0)/10.0))/((exp((states[0]+25.0)/10.0)-1.0)*(exp((states[0]+25.0)/10.0)-1.0))*(1.0-states[2])-0.222222222222222*exp(states[0]/18.0)*states[2];
+    jacobian[10] = -variables[10]-variables[11];
+    jacobian[12] = (0.01*(exp((states[0]+10.0)/10.0)-1.0)-0.001*(states[0]+10.0)*exp((states[0]+10.0)/10.0))/((exp((states[0]+10.0)/10.0)-1.0)*(exp((states[0]+10.0)/10.0)-1.0))*(1.0-states[3])-0.0015625*exp(states[0]/80.0)*states[3];
+    jacobian[15] = -variables[16]-variables[17];
+}
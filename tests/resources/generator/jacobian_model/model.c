@@ -0,0 +1,194 @@
+/* The content of this file was generated using the C profile of libCellML 0.6.3. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.5.0";
+const char LIBCELLML_VERSION[] = "0.6.3";
+
+const size_t STATE_COUNT = 6;
+const size_t VARIABLE_COUNT = 3;
+
+const VariableInfo VOI_INFO = {"t", "dimensionless", "main", VARIABLE_OF_INTEGRATION};
+
+const VariableInfo STATE_INFO[] = {
+    {"x3", "dimensionless", "main", STATE},
+    {"x2", "dimensionless", "main", STATE},
+    {"x1", "dimensionless", "main", STATE},
+    {"x4", "dimensionless", "main", STATE},
+    {"x5", "dimensionless", "main", STATE},
+    {"x6", "dimensionless", "main", STATE}
+};
+
+const VariableInfo VARIABLE_INFO[] = {
+    {"a", "dimensionless", "main", ALGEBRAIC},
+    {"b", "dimensionless", "main", ALGEBRAIC},
+    {"n", "dimensionless", "main", CONSTANT}
+};
+
+double min(double x, double y)
+{
+    return (x < y)?x:y;
+}
+
+double max(double x, double y)
+{
+    return (x > y)?x:y;
+}
+
+double sec(double x)
+{
+    return 1.0/cos(x);
+}
+
+double csc(double x)
+{
+    return 1.0/sin(x);
+}
+
+double cot(double x)
+{
+    return 1.0/tan(x);
+}
+
+double sech(double x)
+{
+    return 1.0/cosh(x);
+}
+
+double csch(double x)
+{
+    return 1.0/sinh(x);
+}
+
+double coth(double x)
+{
+    return 1.0/tanh(x);
+}
+
+double asec(double x)
+{
+    return acos(1.0/x);
+}
+
+double acsc(double x)
+{
+    return asin(1.0/x);
+}
+
+double acot(double x)
+{
+    return atan(1.0/x);
+}
+
+double asech(double x)
+{
+    double oneOverX = 1.0/x;
+
+    return log(oneOverX+sqrt(oneOverX*oneOverX-1.0));
+}
+
+double acsch(double x)
+{
+    double oneOverX = 1.0/x;
+
+    return log(oneOverX+sqrt(oneOverX*oneOverX+1.0));
+}
+
+double acoth(double x)
+{
+    double oneOverX = 1.0/x;
+
+    return 0.5*log((1.0+oneOverX)/(1.0-oneOverX));
+}
+
+double * createStatesArray()
+{
+    double *res = (double *) malloc(STATE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < STATE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+double * createVariablesArray()
+{
+    double *res = (double *) malloc(VARIABLE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initialiseVariables(double *states, double *rates, double *variables)
+{
+    variables[2] = 3.0;
+    states[0] = 0.3;
+    states[1] = 0.2;
+    states[2] = 0.1;
+    states[3] = 0.4;
+    states[4] = 0.5;
+    states[5] = 0.6;
+}
+
+void computeComputedConstants(double *variables)
+{
+}
+
+void computeRates(double voi, double *states, double *rates, double *variables)
+{
+    variables[1] = exp(states[2])+log(states[1]+2.0)+log10(states[0]+2.0)+log(states[3]+2.0)/log(2.0);
+    variables[0] = sin(states[2])*cos(states[1])+tan(states[0]/10.0);
+    rates[2] = variables[0]-sec(states[2]/10.0)+csc(states[1]/10.0+1.0)+cot(states[0]/10.0+1.0)-variables[1]/10.0;
+    rates[1] = sinh(states[2])+cosh(states[1])+tanh(states[0])+sech(states[3])+csch(states[2]+1.0)+coth(states[1]+2.0);
+    rates[0] = asin(states[2])+acos(states[1])+atan(states[0])+asec(states[3]+2.0)+acsc(states[2]+2.0)+acot(states[1]);
+    rates[3] = asinh(states[2])+acosh(states[1]+2.0)+atanh(states[0])+asech(1.0/(states[3]+2.0))+acsch(states[2]+1.0)+acoth(states[1]+2.0);
+    rates[4] = fabs(states[2]-states[1])+pow(states[2]+2.0, states[1])+pow(states[0], variables[2])+sqrt(states[3]+2.0)+pow(states[4]+2.0, 1.0/variables[2])+min(states[2], states[1])+max(states[0], states[3]);
+    rates[5] = fmod(states[2]+5.0, states[1]+2.0)+((states[2] > states[1])?states[2]*states[1]:states[0]/states[5])+voi*states[5];
+}
+
+void computeVariables(double voi, double *states, double *rates, double *variables)
+{
+    variables[0] = sin(states[2])*cos(states[1])+tan(states[0]/10.0);
+    variables[1] = exp(states[2])+log(states[1]+2.0)+log10(states[0]+2.0)+log(states[3]+2.0)/log(2.0);
+}
+
+void computeJacobian(double voi, double *states, double *rates, double *variables, double *jacobian)
+{
+    jacobian[0] = 1.0/(1.0+states[0]*states[0]);
+    jacobian[1] = -1.0/sqrt(1.0-states[1]*states[1])-1.0/(1.0+states[1]*states[1]);
+    jacobian[2] = 1.0/sqrt(1.0-states[2]*states[2])-1.0/(fabs(states[2]+2.0)*sqrt((states[2]+2.0)*(states[2]+2.0)-1.0));
+    jacobian[3] = 1.0/(fabs(states[3]+2.0)*sqrt((states[3]+2.0)*(states[3]+2.0)-1.0));
+    jacobian[6] = 1.0-tanh(states[0])*tanh(states[0]);
+    jacobian[7] = sinh(states[1])+1.0-coth(states[1]+2.0)*coth(states[1]+2.0);
+    jacobian[8] = cosh(states[2])-csch(states[2]+1.0)/tanh(states[2]+1.0);
+    jacobian[9] = -sech(states[3])*tanh(states[3]);
+    jacobian[12] = 0.1/(cos(states[0]/10.0)*cos(states[0]/10.0))-0.1/(sin(states[0]/10.0+1.0)*sin(states[0]/10.0+1.0))-1.0/((states[0]+2.0)*log(10.0))/10.0;
+    jacobian[13] = -sin(states[2])*sin(states[1])-0.1*csc(states[1]/10.0+1.0)/tan(states[1]/10.0+1.0)-1.0/(states[1]+2.0)/10.0;
+    jacobian[14] = cos(states[2])*cos(states[1])-0.1*sec(states[2]/10.0)*tan(states[2]/10.0)-exp(states[2])/10.0;
+    jacobian[15] = -1.0/((states[3]+2.0)*log(2.0))/10.0;
+    jacobian[18] = 1.0/(1.0-states[0]*states[0]);
+    jacobian[19] = 1.0/sqrt((states[1]+2.0)*(states[1]+2.0)-1.0)+1.0/(1.0-(states[1]+2.0)*(states[1]+2.0));
+    jacobian[20] = 1.0/sqrt(states[2]*states[2]+1.0)-1.0/(fabs(states[2]+1.0)*sqrt(1.0+(states[2]+1.0)*(states[2]+1.0)));
+    jacobian[21] = 1.0/((states[3]+2.0)*(states[3]+2.0))/(1.0/(states[3]+2.0)*sqrt(1.0-1.0/(states[3]+2.0)*1.0/(states[3]+2.0)));
+    jacobian[24] = variables[2]*pow(states[0], variables[2]-1.0)+((states[3] < states[0])?1.0:0.0);
+    jacobian[25] = pow(states[2]+2.0, states[1])*log(states[2]+2.0)+((states[2] < states[1])?0.0:1.0)-((states[2]-states[1] < 0.0)?-1.0:1.0);
+    jacobian[26] = ((states[2]-states[1] < 0.0)?-1.0:1.0)+states[1]*pow(states[2]+2.0, states[1]-1.0)+((states[2] < states[1])?1.0:0.0);
+    jacobian[27] = 1.0/(2.0*sqrt(states[3]+2.0))+((states[3] < states[0])?0.0:1.0);
+    jacobian[28] = pow(states[4]+2.0, 1.0/variables[2])/(variables[2]*(states[4]+2.0));
+    jacobian[30] = (states[2] > states[1])?0.0:1.0/states[5];
+    jacobian[31] = ((states[2] > states[1])?states[2]:0.0)-(states[2]+5.0-fmod(states[2]+5.0, states[1]+2.0))/(states[1]+2.0);
+    jacobian[32] = 1.0+((states[2] > states[1])?states[1]:0.0);
+    jacobian[35] = ((states[2] > states[1])?0.0:-states[0]/(states[5]*states[5]))+voi;
+}
@@ -0,0 +1,173 @@
+# The content of this file was generated using the Python profile of libCellML 0.6.3.
+
+from enum import Enum
+from math import *
+
+
+__version__ = "0.4.0"
+LIBCELLML_VERSION = "0.6.3"
+
+STATE_COUNT = 6
+VARIABLE_COUNT = 3
+
+
+class VariableType(Enum):
+    VARIABLE_OF_INTEGRATION = 0
+    STATE = 1
+    CONSTANT = 2
+    COMPUTED_CONSTANT = 3
+    ALGEBRAIC = 4
+
+
+VOI_INFO = {"name": "t", "units": "dimensionless", "component": "main", "type": VariableType.VARIABLE_OF_INTEGRATION}
+
+STATE_INFO = [
+    {"name": "x3", "units": "dimensionless", "component": "main", "type": VariableType.STATE},
+    {"name": "x2", "units": "dimensionless", "component": "main", "type": VariableType.STATE},
+    {"name": "x1", "units": "dimensionless", "component": "main", "type": VariableType.STATE},
+    {"name": "x4", "units": "dimensionless", "component": "main", "type": VariableType.STATE},
+    {"name": "x5", "units": "dimensionless", "component": "main", "type": VariableType.STATE},
+    {"name": "x6", "units": "dimensionless", "component": "main", "type": VariableType.STATE}
+]
+
+VARIABLE_INFO = [
+    {"name": "a", "units": "dimensionless", "component": "main", "type": VariableType.ALGEBRAIC},
+    {"name": "b", "units": "dimensionless", "component": "main", "type": VariableType.ALGEBRAIC},
+    {"name": "n", "units": "dimensionless", "component": "main", "type": VariableType.CONSTANT}
+]
+
+
+def lt_func(x, y):
+    return 1.0 if x < y else 0.0
+
+
+def gt_func(x, y):
+    return 1.0 if x > y else 0.0
+
+
+def min(x, y):
+    return x if x < y else y
+
+
+def max(x, y):
+    return x if x > y else y
+
+
+def sec(x):
+    return 1.0/cos(x)
+
+
+def csc(x):
+    return 1.0/sin(x)
+
+
+def cot(x):
+    return 1.0/tan(x)
+
+
+def sech(x):
+    return 1.0/cosh(x)
+
+
+def csch(x):
+    return 1.0/sinh(x)
+
+
+def coth(x):
+    return 1.0/tanh(x)
+
+
+def asec(x):
+    return acos(1.0/x)
+
+
+def acsc(x):
+    return asin(1.0/x)
+
+
+def acot(x):
+    return atan(1.0/x)
+
+
+def asech(x):
+    one_over_x = 1.0/x
+
+    return log(one_over_x+sqrt(one_over_x*one_over_x-1.0))
+
+
+def acsch(x):
+    one_over_x = 1.0/x
+
+    return log(one_over_x+sqrt(one_over_x*one_over_x+1.0))
+
+
+def acoth(x):
+    one_over_x = 1.0/x
+
+    return 0.5*log((1.0+one_over_x)/(1.0-one_over_x))
+
+
+def create_states_array():
+    return [nan]*STATE_COUNT
+
+
+def create_variables_array():
+    return [nan]*VARIABLE_COUNT
+
+
+def initialise_variables(states, rates, variables):
+    variables[2] = 3.0
+    states[0] = 0.3
+    states[1] = 0.2
+    states[2] = 0.1
+    states[3] = 0.4
+    states[4] = 0.5
+    states[5] = 0.6
+
+
+def compute_computed_constants(variables):
+    pass
+
+
+def compute_rates(voi, states, rates, variables):
+    variables[1] = exp(states[2])+log(states[1]+2.0)+log10(states[0]+2.0)+log(states[3]+2.0)/log(2.0)
+    variables[0] = sin(states[2])*cos(states[1])+tan(states[0]/10.0)
+    rates[2] = variables[0]-sec(states[2]/10.0)+csc(states[1]/10.0+1.0)+cot(states[0]/10.0+1.0)-variables[1]/10.0
+    rates[1] = sinh(states[2])+cosh(states[1])+tanh(states[0])+sech(states[3])+csch(states[2]+1.0)+coth(states[1]+2.0)
+    rates[0] = asin(states[2])+acos(states[1])+atan(states[0])+asec(states[3]+2.0)+acsc(states[2]+2.0)+acot(states[1])
+    rates[3] = asinh(states[2])+acosh(states[1]+2.0)+atanh(states[0])+asech(1.0/(states[3]+2.0))+acsch(states[2]+1.0)+acoth(states[1]+2.0)
+    rates[4] = fabs(states[2]-states[1])+pow(states[2]+2.0, states[1])+pow(states[0], variables[2])+sqrt(states[3]+2.0)+pow(states[4]+2.0, 1.0/variables[2])+min(states[2], states[1])+max(states[0], states[3])
+    rates[5] = fmod(states[2]+5.0, states[1]+2.0)+(states[2]*states[1] if gt_func(states[2], states[1]) else states[0]/states[5])+voi*states[5]
+
+
+def compute_variables(voi, states, rates, variables):
+    variables[0] = sin(states[2])*cos(states[1])+tan(states[0]/10.0)
+    variables[1] = exp(states[2])+log(states[1]+2.0)+log10(states[0]+2.0)+log(states[3]+2.0)/log(2.0)
+
+
+def compute_jacobian(voi, states, rates, variables, jacobian):
+    jacobian[0] = 1.0/(1.0+states[0]*states[0])
+    jacobian[1] = -1.0/sqrt(1.0-states[1]*states[1])-1.0/(1.0+states[1]*states[1])
+    jacobian[2] = 1.0/sqrt(1.0-states[2]*states[2])-1.0/(fabs(states[2]+2.0)*sqrt((states[2]+2.0)*(states[2]+2.0)-1.0))
+    jacobian[3] = 1.0/(fabs(states[3]+2.0)*sqrt((states[3]+2.0)*(states[3]+2.0)-1.0))
+    jacobian[6] = 1.0-tanh(states[0])*tanh(states[0])
+    jacobian[7] = sinh(states[1])+1.0-coth(states[1]+2.0)*coth(states[1]+2.0)
+    jacobian[8] = cosh(states[2])-csch(states[2]+1.0)/tanh(states[2]+1.0)
+    jacobian[9] = -sech(states[3])*tanh(states[3])
+    jacobian[12] = 0.1/(cos(states[0]/10.0)*cos(states[0]/10.0))-0.1/(sin(states[0]/10.0+1.0)*sin(states[0]/10.0+1.0))-1.0/((states[0]+2.0)*log(10.0))/10.0
+    jacobian[13] = -sin(states[2])*sin(states[1])-0.1*csc(states[1]/10.0+1.0)/tan(states[1]/10.0+1.0)-1.0/(states[1]+2.0)/10.0
+    jacobian[14] = cos(states[2])*cos(states[1])-0.1*sec(states[2]/10.0)*tan(states[2]/10.0)-exp(states[2])/10.0
+    jacobian[15] = -1.0/((states[3]+2.0)*log(2.0))/10.0
+    jacobian[18] = 1.0/(1.0-states[0]*states[0])
+    jacobian[19] = 1.0/sqrt((states[1]+2.0)*(states[1]+2.0)-1.0)+1.0/(1.0-(states[1]+2.0)*(states[1]+2.0))
+    jacobian[20] = 1.0/sqrt(states[2]*states[2]+1.0)-1.0/(fabs(states[2]+1.0)*sqrt(1.0+(states[2]+1.0)*(states[2]+1.0)))
+    jacobian[21] = 1.0/((states[3]+2.0)*(states[3]+2.0))/(1.0/(states[3]+2.0)*sqrt(1.0-1.0/(states[3]+2.0)*1.0/(states[3]+2.0)))
+    jacobian[24] = variables[2]*pow(states[0], variables[2]-1.0)+(1.0 if lt_func(states[3], states[0]) else 0.0)
+    jacobian[25] = pow(states[2]+2.0, states[1])*log(states[2]+2.0)+(0.0 if lt_func(states[2], states[1]) else 1.0)-(-1.0 if lt_func(states[2]-states[1], 0.0) else 1.0)
+    jacobian[26] = (-1.0 if lt_func(states[2]-states[1], 0.0) else 1.0)+states[1]*pow(states[2]+2.0, states[1]-1.0)+(1.0 if lt_func(states[2], states[1]) else 0.0)
+    jacobian[27] = 1.0/(2.0*sqrt(states[3]+2.0))+(0.0 if lt_func(states[3], states[0]) else 1.0)
+    jacobian[28] = pow(states[4]+2.0, 1.0/variables[2])/(variables[2]*(states[4]+2.0))
+    jacobian[30] = 0.0 if gt_func(states[2], states[1]) else 1.0/states[5]
+    jacobian[31] = (states[2] if gt_func(states[2], states[1]) else 0.0)-(states[2]+5.0-fmod(states[2]+5.0, states[1]+2.0))/(states[1]+2.0)
+    jacobian[32] = 1.0+(states[1] if gt_func(states[2], states[1]) else 0.0)
+    jacobian[35] = (0.0 if gt_func(states[2], states[1]) else -states[0]/(states[5]*states[5]))+voi
@@ -0,0 +1,90 @@
+/* The content of this file was generated using the C profile of libCellML 0.6.3. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.5.0";
+const char LIBCELLML_VERSION[] = "0.6.3";
+
+const size_t STATE_COUNT = 1;
+const size_t VARIABLE_COUNT = 6;
+
+const VariableInfo VOI_INFO = {"t", "dimensionless", "main", VARIABLE_OF_INTEGRATION};
+
+const VariableInfo STATE_INFO[] = {
+    {"x", "dimensionless", "main", STATE}
+};
+
+const VariableInfo VARIABLE_INFO[] = {
+    {"y", "dimensionless", "main", ALGEBRAIC},
+    {"a", "dimensionless", "main", CONSTANT},
+    {"b", "dimensionless", "main", COMPUTED_CONSTANT},
+    {"flag", "dimensionless", "main", CONSTANT},
+    {"z", "dimensionless", "main", ALGEBRAIC},
+    {"w", "dimensionless", "main", ALGEBRAIC}
+};
+
+const size_t ROOT_FUNCTION_COUNT = 3;
+
+double * createStatesArray()
+{
+    double *res = (double *) malloc(STATE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < STATE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+double * createVariablesArray()
+{
+    double *res = (double *) malloc(VARIABLE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initialiseVariables(double *states, double *rates, double *variables)
+{
+    variables[1] = 2.0;
+    variables[3] = 1.0;
+    states[0] = 0.0;
+}
+
+void computeComputedConstants(double *variables)
+{
+    variables[2] = 2.0*variables[1];
+}
+
+void computeRates(double voi, double *states, double *rates, double *variables)
+{
+    variables[0] = states[0]+voi;
+    rates[0] = ((variables[0] >= variables[2]) && (variables[3] == 1.0))?-1.0:1.0;
+}
+
+void computeVariables(double voi, double *states, double *rates, double *variables)
+{
+    variables[0] = states[0]+voi;
+    variables[4] = (states[0] < variables[1])?1.0:(variables[0] >= variables[2])?2.0:0.0;
+    variables[5] = (voi != 0.5)?1.0:0.0;
+}
+
+void computeRootFunctions(double voi, double *states, double *rates, double *variables, double *g)
+{
+    variables[0] = states[0]+voi;
+
+    g[0] = variables[0]-variables[2];
+    g[1] = states[0]-variables[1];
+    g[2] = voi-0.5;
+}
@@ -0,0 +1,94 @@
+# The content of this file was generated using the Python profile of libCellML 0.6.3.
+
+from enum import Enum
+from math import *
+
+
+__version__ = "0.4.0"
+LIBCELLML_VERSION = "0.6.3"
+
+STATE_COUNT = 1
+VARIABLE_COUNT = 6
+
+
+class VariableType(Enum):
+    VARIABLE_OF_INTEGRATION = 0
+    STATE = 1
+    CONSTANT = 2
+    COMPUTED_CONSTANT = 3
+    ALGEBRAIC = 4
+
+
+VOI_INFO = {"name": "t", "units": "dimensionless", "component": "main", "type": VariableType.VARIABLE_OF_INTEGRATION}
+
+STATE_INFO = [
+    {"name": "x", "units": "dimensionless", "component": "main", "type": VariableType.STATE}
+]
+
+VARIABLE_INFO = [
+    {"name": "y", "units": "dimensionless", "component": "main", "type": VariableType.ALGEBRAIC},
+    {"name": "a", "units": "dimensionless", "component": "main", "type": VariableType.CONSTANT},
+    {"name": "b", "units": "dimensionless", "component": "main", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "flag", "units": "dimensionless", "component": "main", "type": VariableType.CONSTANT},
+    {"name": "z", "units": "dimensionless", "component": "main", "type": VariableType.ALGEBRAIC},
+    {"name": "w", "units": "dimensionless", "component": "main", "type": VariableType.ALGEBRAIC}
+]
+
+ROOT_FUNCTION_COUNT = 3
+
+
+def eq_func(x, y):
+    return 1.0 if x == y else 0.0
+
+
+def neq_func(x, y):
+    return 1.0 if x != y else 0.0
+
+
+def lt_func(x, y):
+    return 1.0 if x < y else 0.0
+
+
+def geq_func(x, y):
+    return 1.0 if x >= y else 0.0
+
+
+def and_func(x, y):
+    return 1.0 if bool(x) & bool(y) else 0.0
+
+
+def create_states_array():
+    return [nan]*STATE_COUNT
+
+
+def create_variables_array():
+    return [nan]*VARIABLE_COUNT
+
+
+def initialise_variables(states, rates, variables):
+    variables[1] = 2.0
+    variables[3] = 1.0
+    states[0] = 0.0
+
+
+def compute_computed_constants(variables):
+    variables[2] = 2.0*variables[1]
+
+
+def compute_rates(voi, states, rates, variables):
+    variables[0] = states[0]+voi
+    rates[0] = -1.0 if and_func(geq_func(variables[0], variables[2]), eq_func(variables[3], 1.0)) else 1.0
+
+
+def compute_variables(voi, states, rates, variables):
+    variables[0] = states[0]+voi
+    variables[4] = 1.0 if lt_func(states[0], variables[1]) else 2.0 if geq_func(variables[0], variables[2]) else 0.0
+    variables[5] = 1.0 if neq_func(voi, 0.5) else 0.0
+
+
+def compute_root_functions(voi, states, rates, variables, g):
+    variables[0] = states[0]+voi
+
+    g[0] = variables[0]-variables[2]
+    g[1] = states[0]-variables[1]
+    g[2] = voi-0.5
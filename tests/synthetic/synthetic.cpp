@@ -0,0 +1,169 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <libcellml>
+
+#include "../benchmarks/syntheticmodels.h"
+
+// The synthetic models are used to benchmark and stress test libCellML at
+// scale, so we check here that, at a small scale, they survive a round trip
+// through the Printer and Parser, and are valid and analysable.
+
+static libcellml::AnalyserModelPtr checkSyntheticModel(const libcellml::ModelPtr &model)
+{
+    auto validator = libcellml::Validator::create();
+
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(0), validator->issueCount());
+
+    auto printer = libcellml::Printer::create();
+    auto parser = libcellml::Parser::create();
+    auto parsedModel = parser->parseModel(printer->printModel(model));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    validator->validateModel(parsedModel);
+
+    EXPECT_EQ(size_t(0), validator->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->issueCount());
+
+    return analyser->model();
+}
+
+TEST(SyntheticModels, chain)
+{
+    auto model = synthetic::createChainModel(10);
+
+    EXPECT_EQ(size_t(10), model->componentCount());
+    EXPECT_EQ(size_t(1), model->component("link_9")->variable("x_previous")->equivalentVariableCount());
+
+    auto analyserModel = checkSyntheticModel(model);
+
+    EXPECT_EQ(libcellml::AnalyserModel::Type::ALGEBRAIC, analyserModel->type());
+    EXPECT_EQ(size_t(10), analyserModel->equationCount());
+}
+
+TEST(SyntheticModels, tree)
+{
+    auto model = synthetic::createTreeModel(2, 2);
+
+    EXPECT_EQ(size_t(1), model->componentCount());
+    EXPECT_EQ(size_t(2), model->component(0)->componentCount());
+    EXPECT_NE(nullptr, model->component("node_6", true));
+    EXPECT_EQ(nullptr, model->component("node_7", true));
+
+    auto analyserModel = checkSyntheticModel(model);
+
+    EXPECT_EQ(libcellml::AnalyserModel::Type::ALGEBRAIC, analyserModel->type());
+    EXPECT_EQ(size_t(7), analyserModel->equationCount());
+}
+
+TEST(SyntheticModels, deepEncapsulation)
+{
+    auto model = synthetic::createTreeModel(20, 1);
+    auto component = model->component(0);
+    size_t depth = 0;
+
+    while (component->componentCount() != 0) {
+        component = component->component(0);
+
+        ++depth;
+    }
+
+    EXPECT_EQ(size_t(20), depth);
+
+    auto analyserModel = checkSyntheticModel(model);
+
+    EXPECT_EQ(libcellml::AnalyserModel::Type::ALGEBRAIC, analyserModel->type());
+    EXPECT_EQ(size_t(21), analyserModel->equationCount());
+}
+
+TEST(SyntheticModels, cellArray)
+{
+    auto model = synthetic::createCellArrayModel(5, 3);
+
+    EXPECT_EQ(size_t(6), model->componentCount());
+    EXPECT_EQ(size_t(9), model->component("cell_0")->variableCount());
+    EXPECT_EQ(size_t(3), model->component("cell_0")->variable("V")->equivalentVariableCount());
+
+    auto analyserModel = checkSyntheticModel(model);
+
+    EXPECT_EQ(libcellml::AnalyserModel::Type::ODE, analyserModel->type());
+    EXPECT_EQ(size_t(10), analyserModel->stateCount());
+}
+
+TEST(SyntheticModels, cellArrayWithSingleCell)
+{
+    auto model = synthetic::createCellArrayModel(1, 4);
+
+    EXPECT_EQ(size_t(6), model->component("cell_0")->variableCount());
+
+    auto analyserModel = checkSyntheticModel(model);
+
+    EXPECT_EQ(libcellml::AnalyserModel::Type::ODE, analyserModel->type());
+    EXPECT_EQ(size_t(2), analyserModel->stateCount());
+}
+
+TEST(SyntheticModels, dae)
+{
+    auto model = synthetic::createDaeModel(3, 4);
+
+    EXPECT_EQ(size_t(4), model->componentCount());
+    EXPECT_EQ(size_t(7), model->component("block_0")->variableCount());
+
+    auto analyserModel = checkSyntheticModel(model);
+
+    EXPECT_EQ(libcellml::AnalyserModel::Type::DAE, analyserModel->type());
+    EXPECT_EQ(size_t(3), analyserModel->stateCount());
+}
+
+TEST(SyntheticModels, importFanOut)
+{
+    auto libraryModel = synthetic::createImportLibraryModel();
+    auto model = synthetic::createImportFanOutModel(libraryModel, 5);
+
+    EXPECT_EQ(size_t(6), model->componentCount());
+    EXPECT_TRUE(model->hasImports());
+    EXPECT_FALSE(model->hasUnresolvedImports());
+    EXPECT_EQ(model->component("instance_0")->importSource(), model->component("instance_4")->importSource());
+
+    auto validator = libcellml::Validator::create();
+
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(0), validator->issueCount());
+
+    auto importer = libcellml::Importer::create();
+    auto flatModel = importer->flattenModel(model);
+
+    EXPECT_EQ(size_t(0), importer->issueCount());
+    EXPECT_FALSE(flatModel->hasImports());
+
+    auto analyserModel = checkSyntheticModel(flatModel);
+
+    EXPECT_EQ(libcellml::AnalyserModel::Type::ODE, analyserModel->type());
+    EXPECT_EQ(size_t(5), analyserModel->stateCount());
+}
@@ -3436,3 +3436,108 @@ TEST(Units, definedUnitsImport)
 
     EXPECT_FALSE(u->isDefined());
 }
+
+TEST(Units, scalingFactorAfterUnitsChange)
+{
+    libcellml::ModelPtr model = libcellml::Model::create("model");
+    libcellml::UnitsPtr u1 = libcellml::Units::create("u1");
+    libcellml::UnitsPtr u2 = libcellml::Units::create("u2");
+    libcellml::UnitsPtr u3 = libcellml::Units::create("u3");
+
+    u1->addUnit("metre", "milli");
+    u2->addUnit("u3");
+    u3->addUnit("metre");
+
+    model->addUnits(u1);
+    model->addUnits(u2);
+    model->addUnits(u3);
+
+    EXPECT_TRUE(libcellml::Units::compatible(u1, u2));
+    EXPECT_EQ(1000.0, libcellml::Units::scalingFactor(u1, u2));
+
+    // Changing a units that another units is defined in terms of must be
+    // reflected in the result.
+
+    u3->removeUnit(0);
+    u3->addUnit("metre", "milli");
+
+    EXPECT_TRUE(libcellml::Units::equivalent(u1, u2));
+
+    u3->setUnitAttributeReference(0, "second");
+
+    EXPECT_FALSE(libcellml::Units::compatible(u1, u2));
+
+    // Replacing a units in the model must also be reflected in the result.
+
+    libcellml::UnitsPtr newU3 = libcellml::Units::create("u3");
+
+    newU3->addUnit("metre", "kilo");
+
+    model->replaceUnits(2, newU3);
+
+    EXPECT_TRUE(libcellml::Units::compatible(u1, u2));
+    EXPECT_EQ(1000000.0, libcellml::Units::scalingFactor(u1, u2));
+
+    // So must renaming a units.
+
+    newU3->setName("u4");
+
+    EXPECT_FALSE(libcellml::Units::compatible(u1, u2));
+}
+
+TEST(Units, scalingFactorAfterImportedUnitsChange)
+{
+    libcellml::ModelPtr model = libcellml::Model::create("model");
+    libcellml::ModelPtr importedModel = libcellml::Model::create("imported_model");
+    libcellml::ImportSourcePtr importSource = libcellml::ImportSource::create();
+    libcellml::UnitsPtr u1 = libcellml::Units::create("u1");
+    libcellml::UnitsPtr u2 = libcellml::Units::create("u2");
+    libcellml::UnitsPtr importedU2 = libcellml::Units::create("imported_u2");
+
+    u1->addUnit("metre", "milli");
+    u2->setImportSource(importSource);
+    u2->setImportReference("imported_u2");
+    importedU2->addUnit("metre");
+
+    model->addUnits(u1);
+    model->addUnits(u2);
+    importedModel->addUnits(importedU2);
+
+    EXPECT_FALSE(libcellml::Units::compatible(u1, u2));
+
+    // Resolving the import must be reflected in the result.
+
+    importSource->setModel(importedModel);
+
+    EXPECT_TRUE(libcellml::Units::compatible(u1, u2));
+    EXPECT_EQ(1000.0, libcellml::Units::scalingFactor(u1, u2));
+
+    // So must changing the imported units.
+
+    importedU2->removeUnit(0);
+    importedU2->addUnit("metre", "kilo");
+
+    EXPECT_EQ(1000000.0, libcellml::Units::scalingFactor(u1, u2));
+
+    // So must removing the imported units from, and adding it back to, the
+    // imported model.
+
+    importedModel->removeUnits(importedU2);
+
+    EXPECT_FALSE(libcellml::Units::compatible(u1, u2));
+
+    importedModel->addUnits(importedU2);
+
+    EXPECT_TRUE(libcellml::Units::compatible(u1, u2));
+
+    // So must the imported model going away, but not another model going
+    // away.
+
+    libcellml::Model::create("other_model")->addUnits(libcellml::Units::create("imported_u2"));
+
+    EXPECT_TRUE(libcellml::Units::compatible(u1, u2));
+
+    importedModel = nullptr;
+
+    EXPECT_FALSE(libcellml::Units::compatible(u1, u2));
+}
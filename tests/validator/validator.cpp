@@ -3962,3 +3962,148 @@ TEST(Validator, invalidMathMLElementsChildrenOrSiblings)
 
     EXPECT_EQ_ISSUES(expectedIssues, validator);
 }
+
+TEST(Validator, issueStorageLimit)
+{
+    auto model = libcellml::Model::create("model");
+    auto component = libcellml::Component::create("component");
+
+    model->addComponent(component);
+
+    for (size_t i = 0; i < 5; ++i) {
+        component->addVariable(libcellml::Variable::create("variable" + std::to_string(i)));
+    }
+
+    auto validator = libcellml::Validator::create();
+
+    EXPECT_EQ(std::numeric_limits<size_t>::max(), validator->issueStorageLimit());
+
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(5), validator->issueCount());
+    EXPECT_EQ(size_t(5), validator->errorCount());
+
+    validator->setIssueStorageLimit(2);
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(2), validator->issueStorageLimit());
+    EXPECT_EQ(size_t(5), validator->issueCount());
+    EXPECT_EQ(size_t(5), validator->errorCount());
+    EXPECT_EQ("Variable 'variable0' in component 'component' does not have any units specified.", validator->issue(0)->description());
+    EXPECT_EQ("Variable 'variable1' in component 'component' does not have any units specified.", validator->error(1)->description());
+    EXPECT_EQ(nullptr, validator->issue(2));
+    EXPECT_EQ(nullptr, validator->error(4));
+}
+
+TEST(Validator, countIssuesOnly)
+{
+    auto model = libcellml::Model::create("model");
+    auto component = libcellml::Component::create("component");
+
+    model->addComponent(component);
+    component->addVariable(libcellml::Variable::create("variable"));
+    component->addVariable(libcellml::Variable::create("variable"));
+
+    auto validator = libcellml::Validator::create();
+
+    validator->setIssueStorageLimit(0);
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(3), validator->issueCount());
+    EXPECT_EQ(size_t(3), validator->errorCount());
+    EXPECT_EQ(size_t(0), validator->warningCount());
+    EXPECT_EQ(size_t(0), validator->messageCount());
+    EXPECT_EQ(nullptr, validator->issue(0));
+    EXPECT_EQ(nullptr, validator->error(0));
+}
+
+TEST(Validator, issueStorageLimitDoesNotAffectErrorCount)
+{
+    // Duplicate and cyclic units are reported only once, whether the issues
+    // are stored or not.
+
+    auto model = libcellml::Model::create("model");
+
+    for (size_t i = 0; i < 3; ++i) {
+        model->addUnits(libcellml::Units::create("duplicated"));
+    }
+
+    auto grandfather = libcellml::Units::create("grandfather");
+    auto father = libcellml::Units::create("father");
+    auto child = libcellml::Units::create("child");
+
+    grandfather->addUnit("child");
+    father->addUnit("grandfather");
+    child->addUnit("father");
+
+    model->addUnits(grandfather);
+    model->addUnits(father);
+    model->addUnits(child);
+
+    auto validator = libcellml::Validator::create();
+
+    validator->validateModel(model);
+
+    auto errorCount = validator->errorCount();
+
+    EXPECT_EQ(size_t(2), errorCount);
+
+    validator->setIssueStorageLimit(0);
+    validator->validateModel(model);
+
+    EXPECT_EQ(errorCount, validator->errorCount());
+
+    validator->setIssueStorageLimit(1);
+    validator->validateModel(model);
+
+    EXPECT_EQ(errorCount, validator->errorCount());
+}
+
+TEST(Validator, errorLimit)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("invalidmathmlelementschildrenorsiblings.cellml"));
+    auto validator = libcellml::Validator::create();
+
+    model->setName("");
+
+    EXPECT_EQ(size_t(0), validator->errorLimit());
+
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(141), validator->errorCount());
+
+    validator->setErrorLimit(1);
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(1), validator->errorLimit());
+    EXPECT_EQ(size_t(1), validator->errorCount());
+    EXPECT_EQ("Model '' does not have a valid name attribute. CellML identifiers must contain one or more basic Latin alphabetic characters.", validator->error(0)->description());
+
+    validator->setErrorLimit(3);
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(3), validator->errorCount());
+
+    validator->setErrorLimit(0);
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(0), validator->errorLimit());
+    EXPECT_EQ(size_t(141), validator->errorCount());
+}
+
+TEST(Validator, errorLimitValidatesMathLast)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("invalidmathmlelementschildrenorsiblings.cellml"));
+    auto validator = libcellml::Validator::create();
+    auto component = model->component(0);
+
+    component->addVariable(libcellml::Variable::create("no_units"));
+
+    validator->setErrorLimit(1);
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(1), validator->errorCount());
+    EXPECT_EQ("Variable 'no_units' in component '" + component->name() + "' does not have any units specified.", validator->error(0)->description());
+}